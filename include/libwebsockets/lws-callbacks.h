@@ -548,12 +548,18 @@ enum lws_callback_reasons {
 	 * callback comes to protocols[0]. */
 
 	LWS_CALLBACK_WS_EXT_DEFAULTS				= 39,
-	/**< Gives client connections an opportunity to adjust negotiated
+	/**< Gives connections an opportunity to adjust negotiated
 	 * extension defaults.  `user` is the extension name that was
 	 * negotiated (eg, "permessage-deflate").  `in` points to a
 	 * buffer and `len` is the buffer size.  The user callback can
 	 * set the buffer to a string describing options the extension
-	 * should parse.  Or just ignore for defaults. */
+	 * should parse.  Or just ignore for defaults.
+	 *
+	 * On server connections, arg-less options in the string are also
+	 * added to the handshake response, eg, for permessage-deflate,
+	 * "server_no_context_takeover; client_no_context_takeover" makes
+	 * the connection use zlib streams from a shared pool only while
+	 * a message is in flight, instead of keeping its own. */
 
 
 	LWS_CALLBACK_FILTER_NETWORK_CONNECTION			= 17,
@@ -203,6 +203,12 @@ enum lws_context_options {
 	 * on the client using http when he meant https... it's not
 	 * recommended.
 	 */
+	LWS_SERVER_OPTION_EPOLL					= (1 << 30),
+	/**< (CTX) Use the native Linux epoll() event loop.  This is not a
+	 * foreign loop, you still call lws_service() as with the default
+	 * poll() loop, but the wait cost scales with the number of ready fds
+	 * rather than the number of connected fds.  Requires LWS_WITH_EPOLL.
+	 */
 
 	/****** add new things just above ---^ ******/
 };
@@ -633,6 +639,91 @@ struct lws_context_creation_info {
 	 * of \p ssl_ca_filepath or \p server_ssl_ca_mem should be non-NULL. */
 	unsigned int server_ssl_ca_mem_len;
 	/**< VHOST: length of \p server_ssl_ca_mem in memory */
+	const char *event_lib;
+	/**< CONTEXT: NULL to choose the event lib using the options flags as
+	 * usual, or the name of an event lib built into lws to use, eg,
+	 * "io_uring".  Creation fails if the name is not available.
+	 */
+	int listen_accept_own_pt;
+	/**< CONTEXT: On Linux with count_threads > 1, each service thread
+	 * gets its own SO_REUSEPORT listen socket for each vhost port, and
+	 * the kernel spreads incoming connections between them.  By default
+	 * an accepted connection is still bound to the service thread with the
+	 * fewest fds in use.  Nonzero keeps it on the thread that accepted it,
+	 * so each thread only inserts into its own fd table.  If that thread's
+	 * fd table is full, the connection goes to the idlest thread as usual.
+	 */
+	unsigned int h2_rx_window_budget;
+	/**< VHOST: h2 connections measure the bandwidth-delay product while
+	 * they receive DATA, and grow the windows they give the peer beyond
+	 * the initial window when that was holding the peer back.  Each byte
+	 * of growth may end up buffered, so this is the total growth all the
+	 * vhost's connections may have at one time.  0 = 64MiB default.
+	 */
+	int client_ssl_session_cache_max;
+	/**< VHOST: Client SSL context init: the vhost's client connections
+	 * keep the TLS sessions (or tickets) servers give them, and offer
+	 * them when they next connect to the same server name, address and
+	 * port, so the server can skip most of the handshake.  This is the
+	 * most sessions the vhost keeps, 0 = default 32, or -1 to keep none.
+	 * Not used with .provided_client_ssl_ctx, or with mbedtls.
+	 */
+	unsigned int client_ssl_session_timeout;
+	/**< VHOST: Client SSL context init: seconds a kept client TLS session
+	 * may be offered for, or less if the server gave it a shorter
+	 * lifetime.  0 = default 300s.
+	 */
+	int ssl_session_cache_size;
+	/**< VHOST: Server SSL context init: the most sessions the vhost's
+	 * SSL_CTX keeps for session ID resumption.  All the service threads
+	 * share it.  0 = OpenSSL default (20480), or -1 to keep none.
+	 */
+	unsigned int ssl_session_timeout;
+	/**< VHOST: Server SSL context init: seconds a session, or a session
+	 * ticket, the vhost issues may be resumed for.  0 = OpenSSL default.
+	 */
+	const char *ssl_ticket_key_filepath;
+	/**< VHOST: Server SSL context init: NULL for OpenSSL's default of a
+	 * random session ticket key per SSL_CTX, which changes when the
+	 * process restarts.  Or a file of one or more 80-byte ticket keys,
+	 * eg, from `openssl rand 80`, so tickets survive restarts and work
+	 * across processes given the same file.  Each key is a 16-byte name,
+	 * a 32-byte HMAC secret and a 32-byte AES key.  The first key issues
+	 * new tickets, and up to 3 more are still accepted, so to rotate,
+	 * put a new key in front of the current one.  Tickets made with an
+	 * older key are renewed.  Not used with mbedtls.
+	 *
+	 * Vhosts sharing a port by SNI each use their own file.  But OpenSSL
+	 * only asks the vhost that listens on the port about tickets, so if
+	 * any of them has a file, that vhost must have one too.
+	 */
+	unsigned int ssl_ticket_key_reload_secs;
+	/**< VHOST: Server SSL context init: how often the
+	 * .ssl_ticket_key_filepath file is read again, to pick up rotated
+	 * keys.  0 = default 60s.
+	 */
+	const char *async_dns_server;
+	/**< CONTEXT: only used with LWS_WITH_ASYNC_DNS: NULL to send client
+	 * connection DNS queries to the nameservers in /etc/resolv.conf, or
+	 * "ip" or "ip:port" (use "[ipv6]:port" for an ipv6 address with a
+	 * port) of the server to use instead, eg, "127.0.0.1:5353" for a
+	 * local test server.
+	 *
+	 * From resolv.conf, up to three nameservers are tried in turn on
+	 * retries, and the search or domain list is applied with options
+	 * ndots, as the libc resolver does.  Other options are ignored.  With
+	 * .async_dns_server set, resolv.conf isn't read at all and there is no
+	 * search list.  Each attempt is sent from a new random source port,
+	 * with random ids and 0x20 random case, and answers are cached for at
+	 * most an hour.  There's no fallback to TCP, a truncated answer is
+	 * used if it holds an address record, and otherwise fails.
+	 */
+	size_t ws_bcast_max_queued;
+	/**< VHOST: most bytes of lws_ws_broadcast() frames each protocol on
+	 * the vhost may have queued.  A broadcast that takes it over the
+	 * limit closes the connections that have yet to send the oldest
+	 * queued frame, until it's back under.  0 = 16MiB default.
+	 */
 
 
 	/* Add new things just above here ---^
@@ -980,7 +1071,11 @@ struct lws_http_mount {
 	 * as environment variables for the cgi process
 	 */
 	const struct lws_protocol_vhost_options *extra_mimetypes;
-	/**< optional linked-list of mimetype mappings */
+	/**< optional linked-list of mimetype mappings, from a file suffix
+	 * like ".zip" to the mimetype.  These are tried after the builtin
+	 * mimetypes.  An entry whose name starts with '*', eg, "*", matches
+	 * any file, but only if no suffix matched, wherever it is in the
+	 * list. */
 	const struct lws_protocol_vhost_options *interpret;
 	/**< optional linked-list of files to be interpreted */
 
@@ -142,6 +142,28 @@ lws_fts_fill(struct lws_fts *t, uint32_t file_index, const char *buf,
 LWS_VISIBLE LWS_EXTERN int
 lws_fts_serialize(struct lws_fts *t);
 
+/**
+ * lws_fts_merge() - Create a new index file combining existing index files
+ *
+ * \param fd: The fd opened for write, for the new index
+ * \param paths: Array of filepaths of the index files to combine
+ * \param count: The number of entries in paths
+ *
+ * Each struct lws_fts is independent, so a large corpus can be indexed
+ * quickly by splitting the input files between threads, each creating its own
+ * index file over its share with lws_fts_create() / lws_fts_fill() /
+ * lws_fts_serialize().  This then combines those into one index that can be
+ * searched with lws_fts_open() as usual.
+ *
+ * The input files are numbered in the new index in the order of paths, then
+ * in their order in each index.  The index files given in paths are not
+ * changed.
+ *
+ * Returns 0 for success.
+ */
+LWS_VISIBLE LWS_EXTERN int
+lws_fts_merge(int fd, const char * const *paths, int count);
+
 /*
  * index search functions
  */
@@ -153,6 +175,13 @@ lws_fts_serialize(struct lws_fts *t);
  *
  * Opening the index file returns an opaque struct lws_fts_file * that is
  * used to perform other operations on it, or NULL if it can't be opened.
+ *
+ * Where the platform has mmap(), the index is mapped shared until
+ * lws_fts_close().  So an open index must never be truncated or rewritten
+ * in place: a search touching a page past the new end gets SIGBUS.  Write
+ * the new index to a temporary file on the same filesystem and rename() it
+ * over the old one instead.  Indexes already open keep searching the old
+ * one until they are closed and opened again.
  */
 LWS_VISIBLE LWS_EXTERN struct lws_fts_file *
 lws_fts_open(const char *filepath);
@@ -161,9 +190,34 @@ lws_fts_open(const char *filepath);
 #define LWSFTS_F_QUERY_FILES		(1 << 1)
 #define LWSFTS_F_QUERY_FILE_LINES	(1 << 2)
 #define LWSFTS_F_QUERY_QUOTE_LINE	(1 << 3)
+/*
+ * These make the needle a list of terms, rather than one term to match and
+ * autocomplete.  It is split into terms wherever it has a character that
+ * can't be part of an indexed symbol, such as a space, and each term must then
+ * match a whole symbol.  The file and line results are for
+ *
+ *  - ALL_TERMS: files containing every term, with the lines containing any
+ *  - ANY_TERM: files containing any term, with the lines containing any
+ *  - PHRASE: lines containing every term next to each other, in order
+ *
+ * The index only records the lines symbols appear on, so a PHRASE can't cross
+ * a line break, and the order of the terms on a line is checked by reading the
+ * line from the original file.  If that can't be opened, the file is left out
+ * of the results, unless PHRASE_UNCHECKED is also given: then its lines
+ * containing all the terms are given instead, and PHRASE is cleared in the
+ * result's effective_flags to show some lines weren't checked.
+ * AUTOCOMPLETE doesn't apply to these.
+ */
+#define LWSFTS_F_QUERY_ALL_TERMS	(1 << 4)
+#define LWSFTS_F_QUERY_ANY_TERM		(1 << 5)
+#define LWSFTS_F_QUERY_PHRASE		(1 << 6)
+#define LWSFTS_F_QUERY_PHRASE_UNCHECKED	(1 << 7)
+
+/* the most terms a needle may be split into */
+#define LWSFTS_MAX_QUERY_TERMS		8
 
 struct lws_fts_search_params {
-	/* the actual search term */
+	/* the actual search term, or terms (see LWSFTS_F_QUERY_ALL_TERMS) */
 	const char *needle;
 	 /* if non-NULL, FILE results for this filepath only */
 	const char *only_filepath;
@@ -47,6 +47,11 @@
  * This uses a canned list of known filetypes first, if no match and m is
  * non-NULL, then tries a list of per-mount file suffix to mimtype mappings.
  *
+ * Each '.'-suffix of the filename is tried in turn, longest first, so
+ * "x.tar.bz2" tries ".tar.bz2" and then ".bz2".  Suffixes are compared
+ * case-insensitively.  If nothing matches, a per-mount mapping whose name
+ * starts with '*', eg, "*", matches any file.
+ *
  * Returns either NULL or a pointer to the mimetype matching the file.
  */
 LWS_VISIBLE LWS_EXTERN const char *
@@ -55,21 +55,94 @@ enum {
 	LWSSTATS_MS_SSL_RX_DELAY, /**< aggregate delay between ssl accept complete and first RX */
 	LWSSTATS_C_PEER_LIMIT_AH_DENIED, /**< number of times we would have given an ah but for the peer limit */
 	LWSSTATS_C_PEER_LIMIT_WSI_DENIED, /**< number of times we would have given a wsi but for the peer limit */
+	LWSSTATS_C_BUFLIST_POOL_HIT, /**< buflist segment allocations satisfied from the pt freelist */
+	LWSSTATS_C_BUFLIST_POOL_MISS, /**< buflist segment allocations that had to malloc */
+	LWSSTATS_C_H2_HEADER_BLOCKS_TX, /**< h2 header blocks sent */
+	LWSSTATS_B_H2_HEADER_BLOCKS_TX, /**< aggregate size of h2 header blocks sent */
+	LWSSTATS_C_PMD_ZS_POOL_HIT, /**< permessage-deflate zlib streams reused from the pt pool */
+	LWSSTATS_C_PMD_ZS_POOL_MISS, /**< permessage-deflate zlib streams that had to be created */
+	LWSSTATS_B_PMD_ZLIB_MEM, /**< bytes currently allocated for permessage-deflate zlib streams */
+	LWSSTATS_B_PMD_ZLIB_MEM_PEAK, /**< highest LWSSTATS_B_PMD_ZLIB_MEM seen by one service thread */
+	LWSSTATS_C_SSL_CLIENT_SESSION_HIT, /**< client tls handshakes that resumed a cached session */
+	LWSSTATS_C_SSL_CLIENT_SESSION_MISS, /**< client tls handshakes that had to do a full handshake */
+	LWSSTATS_C_SSL_SERVER_SESSION_HIT, /**< accepted tls handshakes that resumed a session */
+	LWSSTATS_C_SSL_SERVER_SESSION_MISS, /**< accepted tls handshakes that were full handshakes */
 
 	/* Add new things just above here ---^
 	 * This is part of the ABI, don't needlessly break compatibility */
 	LWSSTATS_SIZE
 };
 
+/*
+ * Latency histograms.  Each has LWSSTATS_HIST_BUCKETS power-of-two buckets
+ * of microseconds: bucket 0 counts 0us, bucket n counts samples of at least
+ * 2^(n - 1)us and less than 2^n us.  The last bucket also takes everything
+ * larger.
+ */
+
+enum {
+	LWSSTATS_H_WRITABLE_DELAY, /**< us between asking for writable and getting cb */
+	LWSSTATS_H_SSL_ACCEPT_DELAY, /**< us to complete ssl accept */
+	LWSSTATS_H_SSL_RX_DELAY, /**< us between ssl accept complete and first RX */
+
+	/* Add new things just above here ---^
+	 * This is part of the ABI, don't needlessly break compatibility */
+	LWSSTATS_H_SIZE
+};
+
+#define LWSSTATS_HIST_BUCKETS 32
+
+/**
+ * struct lws_stats_snapshot - stats summed across all service threads
+ *
+ * \param s: the LWSSTATS_ counters, as lws_stats_get() would return them
+ * \param hist: the LWSSTATS_H_ histogram bucket counts
+ */
+struct lws_stats_snapshot {
+	uint64_t s[LWSSTATS_SIZE];
+	uint64_t hist[LWSSTATS_H_SIZE][LWSSTATS_HIST_BUCKETS];
+};
+
 #if defined(LWS_WITH_STATS)
 
 LWS_VISIBLE LWS_EXTERN uint64_t
 lws_stats_get(struct lws_context *context, int index);
 LWS_VISIBLE LWS_EXTERN void
 lws_stats_log_dump(struct lws_context *context);
+/**
+ * lws_stats_snapshot() - collect the stats from all service threads
+ *
+ * \param context: the lws_context
+ * \param snap: the snapshot struct to fill
+ *
+ * Each service thread keeps its own stats without locking, this sums them
+ * into \p snap.  Since the threads may still be updating them, it's a
+ * consistent enough picture for monitoring but not an atomic one.
+ */
+LWS_VISIBLE LWS_EXTERN void
+lws_stats_snapshot(struct lws_context *context, struct lws_stats_snapshot *snap);
+/**
+ * lws_stats_hist_percentile() - approximate percentile from a histogram
+ *
+ * \param snap: a snapshot filled by lws_stats_snapshot()
+ * \param hist: the LWSSTATS_H_ index
+ * \param percent: 1 .. 100, eg, 50 for the median or 99 for p99
+ *
+ * Returns the upper bound in us of the bucket holding the percentile, or 0
+ * if there are no samples.
+ */
+LWS_VISIBLE LWS_EXTERN uint64_t
+lws_stats_hist_percentile(const struct lws_stats_snapshot *snap, int hist,
+			  int percent);
 #else
 static LWS_INLINE uint64_t
 lws_stats_get(struct lws_context *context, int index) { (void)context; (void)index;  return 0; }
 static LWS_INLINE void
 lws_stats_log_dump(struct lws_context *context) { (void)context; }
+static LWS_INLINE void
+lws_stats_snapshot(struct lws_context *context, struct lws_stats_snapshot *snap)
+{ (void)context; memset(snap, 0, sizeof(*snap)); }
+static LWS_INLINE uint64_t
+lws_stats_hist_percentile(const struct lws_stats_snapshot *snap, int hist,
+			  int percent) { (void)snap; (void)hist; (void)percent; return 0; }
 #endif
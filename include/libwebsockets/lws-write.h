@@ -244,6 +244,56 @@ lws_write_ws_flags(int initial, int is_start, int is_end)
 	return r;
 }
 
+/**
+ * lws_ws_broadcast() - Send one ws message to every connection on a protocol
+ *
+ * \param vh: the vhost
+ * \param prot: the protocol on \p vh whose ws connections get the message
+ * \param buf: the message payload, it's copied so no LWS_PRE is needed
+ * \param len: the payload length
+ * \param wp: LWS_WRITE_TEXT or LWS_WRITE_BINARY
+ *
+ * This is for fanning out the same message to many connections without each
+ * of them copying and framing it separately in its WRITEABLE callback.  The
+ * message is copied once into a complete ws frame shared by all the ws
+ * connections established on \p prot at the time, and each one sends it
+ * from there by itself when it's writeable.  Server connections without
+ * extensions send the shared frame as it is, others, eg, with
+ * permessage-deflate, still frame and send a copy of the payload the way
+ * lws_write() would.
+ *
+ * Broadcasts are sent in order, between the connection's own messages and
+ * ahead of its user WRITEABLE callback.  So you can't use this for messages
+ * you are sending in fragments with LWS_WRITE_NO_FIN yourself, and the
+ * connection's broadcasts are delayed while one of your messages is
+ * unfinished.  Connections that close, or change protocol, drop the
+ * broadcasts they had not sent.
+ *
+ * A connection that isn't reading holds on to every broadcast queued since
+ * the one it's stuck on.  So each protocol may only have the vhost's
+ * .ws_bcast_max_queued bytes of frames queued (default 16MiB), and when a
+ * broadcast takes it over that, the connections still to send the oldest
+ * queued frame are closed, then the next oldest, until it's back under.
+ * Slow readers are closed rather than skipped, so the ones left don't miss
+ * any messages.
+ *
+ * If lws was built with LWS_MAX_SMP > 1, it may be called from any thread,
+ * otherwise the vhost lock is a NOP and it must be called from the service
+ * thread, eg, from a callback.  Locking: it takes the vhost lock to
+ * queue the frame, and only after releasing that takes the service thread
+ * (pt) locks, one at a time, to mark the threads owning the connections as
+ * having broadcast work.  It never holds a pt lock and the vhost lock
+ * together.  The connections' own threads are woken as with
+ * lws_cancel_service_pt(), so they see LWS_CALLBACK_EVENT_WAIT_CANCELLED,
+ * and then ask for POLLOUT, or close the evicted connections, themselves.
+ *
+ * Returns the number of connections the message was queued for, or -1 on
+ * error.
+ */
+LWS_VISIBLE LWS_EXTERN int
+lws_ws_broadcast(struct lws_vhost *vh, const struct lws_protocols *prot,
+		 const void *buf, size_t len, enum lws_write_protocol wp);
+
 /**
  * lws_raw_transaction_completed() - Helper for flushing before close
  *
@@ -102,12 +102,18 @@ lws_create_new_server_wsi(struct lws_vhost *vhost, int fixed_tsi)
 }
 
 
-/* if not a socket, it's a raw, non-ssl file descriptor */
+/*
+ * if not a socket, it's a raw, non-ssl file descriptor
+ *
+ * fixed_tsi is the pt to bind the new wsi to, or -1 to let us choose the
+ * idlest one.  A parent always decides the pt.
+ */
 
-LWS_VISIBLE struct lws *
-lws_adopt_descriptor_vhost(struct lws_vhost *vh, lws_adoption_type type,
-			   lws_sock_file_fd_type fd, const char *vh_prot_name,
-			   struct lws *parent)
+struct lws *
+lws_adopt_descriptor_vhost_tsi(struct lws_vhost *vh, lws_adoption_type type,
+			       lws_sock_file_fd_type fd,
+			       const char *vh_prot_name, struct lws *parent,
+			       int fixed_tsi)
 {
 	struct lws_context *context = vh->context;
 	struct lws *new_wsi;
@@ -124,7 +130,7 @@ lws_adopt_descriptor_vhost(struct lws_vhost *vh, lws_adoption_type type,
 		    peer->count_wsi >= context->ip_limit_wsi) {
 			lwsl_notice("Peer reached wsi limit %d\n",
 					context->ip_limit_wsi);
-			lws_stats_atomic_bump(context, &context->pt[0],
+			lws_stats_shared_bump(&context->pt[0],
 					      LWSSTATS_C_PEER_LIMIT_WSI_DENIED,
 					      1);
 			return NULL;
@@ -132,7 +138,7 @@ lws_adopt_descriptor_vhost(struct lws_vhost *vh, lws_adoption_type type,
 	}
 #endif
 
-	n = -1;
+	n = fixed_tsi;
 	if (parent)
 		n = parent->tsi;
 	new_wsi = lws_create_new_server_wsi(vh, n);
@@ -146,7 +152,8 @@ lws_adopt_descriptor_vhost(struct lws_vhost *vh, lws_adoption_type type,
 		lws_peer_add_wsi(context, peer, new_wsi);
 #endif
 	pt = &context->pt[(int)new_wsi->tsi];
-	lws_stats_atomic_bump(context, pt, LWSSTATS_C_CONNECTIONS, 1);
+	/* we may be adopting it from another pt's service thread */
+	lws_stats_shared_bump(pt, LWSSTATS_C_CONNECTIONS, 1);
 
 	if (parent) {
 		new_wsi->parent = parent;
@@ -252,6 +259,15 @@ bail:
 	return NULL;
 }
 
+LWS_VISIBLE struct lws *
+lws_adopt_descriptor_vhost(struct lws_vhost *vh, lws_adoption_type type,
+			   lws_sock_file_fd_type fd, const char *vh_prot_name,
+			   struct lws *parent)
+{
+	return lws_adopt_descriptor_vhost_tsi(vh, type, fd, vh_prot_name,
+					      parent, -1);
+}
+
 LWS_VISIBLE struct lws *
 lws_adopt_socket_vhost(struct lws_vhost *vh, lws_sockfd_type accept_fd)
 {
@@ -287,8 +303,8 @@ adopt_socket_readbuf(struct lws *wsi, const char *readbuf, size_t len)
 
 	pt = &wsi->context->pt[(int)wsi->tsi];
 
-	n = lws_buflist_append_segment(&wsi->buflist, (const uint8_t *)readbuf,
-				       len);
+	n = lws_wsi_buflist_append(wsi, &wsi->buflist,
+				   (const uint8_t *)readbuf, len);
 	if (n < 0)
 		goto bail;
 	if (n)
@@ -0,0 +1,1205 @@
+/*
+ * libwebsockets - small server side websockets and web server implementation
+ *
+ * Copyright (C) 2010-2018 Andy Green <andy@warmcat.com>
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation:
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ *
+ * Nonblocking resolution of client connection addresses.
+ *
+ * getaddrinfo() blocks the whole event loop for as long as the nameserver
+ * takes to answer, which may be seconds.  Instead, when the peer address is
+ * not numeric, in /etc/hosts or in the context's cache, we send our own A
+ * (and with ipv6, AAAA) queries from a udp socket wsi on the pt, and park the
+ * client wsi until the answers come back through the event loop.  Then the
+ * client wsi continues at lws_client_connect_3(), or gets a CONNECTION_ERROR
+ * if there was no usable answer.
+ *
+ * Answers are cached for the lifetime the nameserver gave them, up to
+ * LWS_ADNS_MAX_TTL, so only the first connection to a host in that time pays
+ * the round trip.
+ *
+ * To make forged answers hard to get accepted, every attempt is sent from a
+ * new socket, so it has a fresh source port chosen at random by the kernel,
+ * with new random query ids, and the letters of the name in random case
+ * ("0x20"), which the answer must echo exactly.  If a nameserver doesn't
+ * keep the case, we ask it again without.
+ *
+ * From resolv.conf we use up to three nameservers, one after the other on
+ * each retry, and the search / domain list with options ndots.  There is no
+ * retry over TCP: a truncated answer is used for the complete address
+ * records it holds, and fails like an empty one if it holds none.
+ */
+
+#include "core/private.h"
+
+#include <fcntl.h>
+
+#define LWS_ADNS_MAX_NAME	256
+#define LWS_ADNS_CACHE_MAX	64
+#define LWS_ADNS_RETRY_SECS	1
+#define LWS_ADNS_MAX_TRIES	3
+#define LWS_ADNS_MAX_CNAME	8
+#define LWS_ADNS_MAX_TTL	3600
+#define LWS_ADNS_MAX_NDOTS	15
+
+enum {
+	LADNS_RRTYPE_A		= 1,
+	LADNS_RRTYPE_CNAME	= 5,
+	LADNS_RRTYPE_AAAA	= 28,
+
+	LADNS_CLASS_IN		= 1,
+};
+
+struct lws_adns_addrs {
+	uint8_t v4[4];
+	uint8_t v6[16];
+	uint8_t has4:1;
+	uint8_t has6:1;
+};
+
+struct lws_adns_host {
+	struct lws_adns_host *next;
+	struct lws_adns_addrs a;
+
+	/* name string follows */
+};
+
+struct lws_adns_cache {
+	struct lws_dll_lws list;	/* context async_dns.cache */
+	time_t expires;
+	struct lws_adns_addrs a;
+
+	/* name string follows */
+};
+
+struct lws_adns_q {
+	struct lws_dll_lws list;	/* pt async_dns.queries */
+	struct lws_dll_lws waiting;	/* wsi->dll_async_dns */
+	struct lws_adns_addrs a;
+	struct lws *wsi;		/* udp socket of the current attempt */
+	time_t sent;
+	uint32_t ttl;			/* smallest ttl of records we used */
+	uint16_t id[2];			/* A, AAAA query ids */
+	uint8_t pending;		/* bit per id[] we still want */
+	uint8_t tries;
+	uint8_t cand;			/* which search list candidate */
+	uint8_t no_0x20:1;		/* nameserver doesn't keep the case */
+	char qname[LWS_ADNS_MAX_NAME];	/* candidate, in the case we sent */
+
+	/* name string, as asked, follows */
+};
+
+static int
+lws_adns_numeric(const char *s, struct lws_adns_addrs *a)
+{
+	if (inet_pton(AF_INET, s, a->v4) == 1) {
+		a->has4 = 1;
+		return 0;
+	}
+#if defined(LWS_WITH_IPV6)
+	if (inet_pton(AF_INET6, s, a->v6) == 1) {
+		a->has6 = 1;
+		return 0;
+	}
+#endif
+
+	return 1;
+}
+
+/*
+ * turn what we learned into the sockaddr the wsi wants to connect() to,
+ * following the same rules as the getaddrinfo() path
+ */
+
+static int
+lws_adns_sa46(struct lws *wsi, const struct lws_adns_addrs *a,
+	      sockaddr46 *sa46)
+{
+	memset(sa46, 0, sizeof(*sa46));
+
+#if defined(LWS_WITH_IPV6)
+	if (wsi->ipv6) {
+		char ipv6only = lws_check_opt(wsi->vhost->options,
+				LWS_SERVER_OPTION_IPV6_V6ONLY_MODIFY |
+				LWS_SERVER_OPTION_IPV6_V6ONLY_VALUE);
+
+#if defined(__ANDROID__)
+		ipv6only = 0;
+#endif
+		sa46->sa6.sin6_family = AF_INET6;
+		if (a->has6) {
+			memcpy(&sa46->sa6.sin6_addr, a->v6, 16);
+
+			return 0;
+		}
+		if (!a->has4 || ipv6only)
+			return 1;
+
+		/* map IPv4 to IPv6 */
+		sa46->sa6.sin6_addr.s6_addr[10] = 0xff;
+		sa46->sa6.sin6_addr.s6_addr[11] = 0xff;
+		memcpy(&sa46->sa6.sin6_addr.s6_addr[12], a->v4, 4);
+
+		return 0;
+	}
+#endif
+
+	if (!a->has4)
+		return 1;
+
+	sa46->sa4.sin_family = AF_INET;
+	memcpy(&sa46->sa4.sin_addr, a->v4, 4);
+
+	return 0;
+}
+
+static void
+lws_adns_hosts_free(struct lws_context_async_dns *ad)
+{
+	struct lws_adns_host *h;
+
+	while (ad->hosts) {
+		h = ad->hosts;
+		ad->hosts = h->next;
+		lws_free(h);
+	}
+}
+
+/*
+ * Read /etc/hosts into a list of name and address pairs, in file order.  It's
+ * only read again when the file changes.  Call with the context lock held.
+ */
+
+static void
+lws_adns_hosts_load(struct lws_context_async_dns *ad)
+{
+	char line[256], *p, *addr, *tok, *save;
+	struct lws_adns_host *h, **tail;
+	struct lws_adns_addrs t;
+	struct stat st;
+	size_t n;
+	FILE *f;
+
+	if (stat("/etc/hosts", &st))
+		memset(&st, 0, sizeof(st));
+
+	if (ad->hosts_loaded && st.st_mtime == ad->hosts_mtime &&
+	    st.st_size == ad->hosts_size && st.st_ino == ad->hosts_ino)
+		return;
+
+	lws_adns_hosts_free(ad);
+	ad->hosts_loaded = 1;
+	ad->hosts_mtime = st.st_mtime;
+	ad->hosts_size = st.st_size;
+	ad->hosts_ino = st.st_ino;
+	tail = &ad->hosts;
+
+	f = fopen("/etc/hosts", "r");
+	if (!f)
+		return;
+
+	while (fgets(line, sizeof(line), f)) {
+		p = strchr(line, '#');
+		if (p)
+			*p = '\0';
+
+		addr = strtok_r(line, " \t\r\n", &save);
+		if (!addr)
+			continue;
+
+		memset(&t, 0, sizeof(t));
+		if (lws_adns_numeric(addr, &t))
+			continue;
+
+		while ((tok = strtok_r(NULL, " \t\r\n", &save))) {
+			n = strlen(tok);
+			h = lws_malloc(sizeof(*h) + n + 1, "adns hosts");
+			if (!h)
+				break;
+			h->next = NULL;
+			h->a = t;
+			memcpy(&h[1], tok, n + 1);
+			*tail = h;
+			tail = &h->next;
+		}
+	}
+	fclose(f);
+}
+
+static int
+lws_adns_hosts(struct lws_context *context, const char *name,
+	       struct lws_adns_addrs *a)
+{
+	struct lws_context_async_dns *ad = &context->async_dns;
+	struct lws_adns_host *h;
+
+	lws_context_lock(context, "adns hosts"); /* -------------- context { */
+
+	lws_adns_hosts_load(ad);
+
+	for (h = ad->hosts; h; h = h->next) {
+		if (strcasecmp((const char *)&h[1], name))
+			continue;
+
+		if (h->a.has4 && !a->has4) {
+			memcpy(a->v4, h->a.v4, 4);
+			a->has4 = 1;
+		}
+		if (h->a.has6 && !a->has6) {
+			memcpy(a->v6, h->a.v6, 16);
+			a->has6 = 1;
+		}
+	}
+
+	lws_context_unlock(context); /* } context ---------------------------- */
+
+	if (!a->has4 && !a->has6 && !strcasecmp(name, "localhost")) {
+		lws_adns_numeric("127.0.0.1", a);
+#if defined(LWS_WITH_IPV6)
+		lws_adns_numeric("::1", a);
+#endif
+	}
+
+	return !a->has4 && !a->has6;
+}
+
+static int
+lws_adns_cache_lookup(struct lws_context *context, const char *name,
+		      struct lws_adns_addrs *a, time_t now)
+{
+	struct lws_context_async_dns *ad = &context->async_dns;
+	int ret = 1;
+
+	lws_context_lock(context, "adns cache"); /* -------------- context { */
+
+	lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1, ad->cache.next) {
+		struct lws_adns_cache *c = lws_container_of(d,
+						struct lws_adns_cache, list);
+
+		if (now >= c->expires) {
+			lws_dll_lws_remove(d);
+			lws_free(c);
+			ad->cache_count--;
+		} else
+			if (!strcasecmp(name, (const char *)&c[1])) {
+				*a = c->a;
+				/* most recently used goes to the head */
+				lws_dll_lws_remove(d);
+				lws_dll_lws_add_front(d, &ad->cache);
+				ret = 0;
+				break;
+			}
+	} lws_end_foreach_dll_safe(d, d1);
+
+	lws_context_unlock(context); /* } context ---------------------------- */
+
+	return ret;
+}
+
+static void
+lws_adns_cache_add(struct lws_context *context, const char *name,
+		   const struct lws_adns_addrs *a, uint32_t ttl, time_t now)
+{
+	struct lws_context_async_dns *ad = &context->async_dns;
+	struct lws_dll_lws *tail = NULL;
+	struct lws_adns_cache *c;
+	size_t len = strlen(name);
+
+	if (!ttl)
+		return;
+	if (ttl > LWS_ADNS_MAX_TTL)
+		ttl = LWS_ADNS_MAX_TTL;
+
+	c = lws_malloc(sizeof(*c) + len + 1, "adns cache");
+	if (!c)
+		return;
+
+	memset(&c->list, 0, sizeof(c->list));
+	c->expires = now + ttl;
+	c->a = *a;
+	memcpy(&c[1], name, len + 1);
+
+	lws_context_lock(context, "adns cache"); /* -------------- context { */
+
+	/* drop any older entry for the same name, and find the LRU one */
+
+	lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1, ad->cache.next) {
+		struct lws_adns_cache *c1 = lws_container_of(d,
+						struct lws_adns_cache, list);
+
+		if (!strcasecmp(name, (const char *)&c1[1])) {
+			lws_dll_lws_remove(d);
+			lws_free(c1);
+			ad->cache_count--;
+		} else
+			tail = d;
+	} lws_end_foreach_dll_safe(d, d1);
+
+	if (ad->cache_count >= LWS_ADNS_CACHE_MAX && tail) {
+		lws_dll_lws_remove(tail);
+		lws_free(lws_container_of(tail, struct lws_adns_cache, list));
+		ad->cache_count--;
+	}
+
+	lws_dll_lws_add_front(&c->list, &ad->cache);
+	ad->cache_count++;
+
+	lws_context_unlock(context); /* } context ---------------------------- */
+}
+
+static int
+lws_adns_parse_server(const char *s, sockaddr46 *sa46)
+{
+	const char *p = NULL;
+	char host[64];
+	int port = 53;
+	size_t n;
+
+	if (*s == '[') {
+		p = strchr(++s, ']');
+		if (!p)
+			return 1;
+		n = p - s;
+		p = p[1] == ':' ? p + 2 : NULL;
+	} else {
+		p = strchr(s, ':');
+		if (p && !strchr(p + 1, ':'))
+			n = p++ - s;
+		else {
+			/* no port, or a bare ipv6 address */
+			n = strlen(s);
+			p = NULL;
+		}
+	}
+	if (n >= sizeof(host))
+		return 1;
+	memcpy(host, s, n);
+	host[n] = '\0';
+
+	if (p) {
+		port = atoi(p);
+		if (port <= 0 || port > 65535)
+			return 1;
+	}
+
+	memset(sa46, 0, sizeof(*sa46));
+
+	if (inet_pton(AF_INET, host, &sa46->sa4.sin_addr) == 1) {
+		sa46->sa4.sin_family = AF_INET;
+		sa46->sa4.sin_port = htons(port);
+
+		return 0;
+	}
+#if defined(LWS_WITH_IPV6)
+	if (inet_pton(AF_INET6, host, &sa46->sa6.sin6_addr) == 1) {
+		sa46->sa6.sin6_family = AF_INET6;
+		sa46->sa6.sin6_port = htons(port);
+
+		return 0;
+	}
+#endif
+
+	return 1;
+}
+
+static void
+lws_adns_resolv_conf(struct lws_context_async_dns *ad)
+{
+	char line[256], *tok, *save, *p = ad->search;
+	size_t n;
+	FILE *f;
+
+	f = fopen("/etc/resolv.conf", "r");
+	if (!f)
+		return;
+
+	while (fgets(line, sizeof(line), f)) {
+		tok = strtok_r(line, " \t\r\n", &save);
+		if (!tok || *tok == '#' || *tok == ';')
+			continue;
+
+		if (!strcmp(tok, "nameserver")) {
+			tok = strtok_r(NULL, " \t\r\n", &save);
+			if (tok && ad->server_count < LWS_ADNS_MAX_SERVERS &&
+			    !lws_adns_parse_server(tok,
+					&ad->server[ad->server_count]))
+				ad->server_count++;
+			continue;
+		}
+
+		if (!strcmp(tok, "options")) {
+			while ((tok = strtok_r(NULL, " \t\r\n", &save)))
+				if (!strncmp(tok, "ndots:", 6)) {
+					n = atoi(tok + 6);
+					ad->ndots = n > LWS_ADNS_MAX_NDOTS ?
+						LWS_ADNS_MAX_NDOTS : (uint8_t)n;
+				}
+			continue;
+		}
+
+		if (strcmp(tok, "search") && strcmp(tok, "domain"))
+			continue;
+
+		/* the last search or domain line is the one that counts */
+
+		p = ad->search;
+		while ((tok = strtok_r(NULL, " \t\r\n", &save))) {
+			n = strlen(tok);
+			if (n && tok[n - 1] == '.')
+				n--;
+			if (!n || lws_ptr_diff(p, ad->search) + n + 2 >
+							sizeof(ad->search))
+				continue;
+			memcpy(p, tok, n);
+			p += n;
+			*p++ = '\0';
+		}
+		*p = '\0';
+	}
+	fclose(f);
+}
+
+int
+lws_async_dns_init(struct lws_context *context,
+		   const struct lws_context_creation_info *info)
+{
+	struct lws_context_async_dns *ad = &context->async_dns;
+
+	ad->ndots = 1;
+
+	if (info->async_dns_server) {
+		if (lws_adns_parse_server(info->async_dns_server,
+					  &ad->server[0])) {
+			lwsl_err("%s: unusable async_dns_server %s\n", __func__,
+				 info->async_dns_server);
+			return 1;
+		}
+		ad->server_count = 1;
+
+		return 0;
+	}
+
+	lws_adns_resolv_conf(ad);
+	if (ad->server_count)
+		return 0;
+
+	lwsl_notice("%s: no nameserver in /etc/resolv.conf, using 127.0.0.1\n",
+		    __func__);
+	ad->server_count = 1;
+
+	return lws_adns_parse_server("127.0.0.1", &ad->server[0]);
+}
+
+void
+lws_async_dns_deinit(struct lws_context *context)
+{
+	struct lws_context_async_dns *ad = &context->async_dns;
+
+	lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1, ad->cache.next) {
+		lws_dll_lws_remove(d);
+		lws_free(lws_container_of(d, struct lws_adns_cache, list));
+	} lws_end_foreach_dll_safe(d, d1);
+
+	ad->cache_count = 0;
+	lws_adns_hosts_free(ad);
+	ad->hosts_loaded = 0;
+}
+
+static socklen_t
+lws_adns_server_len(const sockaddr46 *sa46)
+{
+#if defined(LWS_WITH_IPV6)
+	if (sa46->sa4.sin_family == AF_INET6)
+		return sizeof(struct sockaddr_in6);
+#endif
+
+	return sizeof(struct sockaddr_in);
+}
+
+static void
+lws_adns_wsi_destroy(struct lws_adns_q *q)
+{
+	struct lws *wsi = q->wsi;
+
+	if (!wsi)
+		return;
+
+	q->wsi = NULL;
+
+	if (wsi->position_in_fds_table != LWS_NO_FDS_POS)
+		__remove_wsi_socket_from_fds(wsi);
+
+	if (wsi->context->event_loop_ops->wsi_logical_close) {
+		wsi->context->event_loop_ops->wsi_logical_close(wsi);
+		compatible_close(wsi->desc.sockfd);
+		wsi->context->count_wsi_allocated--;
+		return;
+	}
+
+	if (wsi->context->event_loop_ops->destroy_wsi)
+		wsi->context->event_loop_ops->destroy_wsi(wsi);
+	compatible_close(wsi->desc.sockfd);
+	wsi->context->count_wsi_allocated--;
+	lws_free(wsi);
+}
+
+/*
+ * Replace the query's socket with a new one connected to server.  Connecting
+ * binds it to a new random source port, and means the kernel only passes us
+ * datagrams from that nameserver.
+ */
+
+static int
+lws_adns_socket(struct lws_context_per_thread *pt, struct lws_adns_q *q,
+		const sockaddr46 *server)
+{
+	struct lws_context *context = pt->context;
+	struct lws *wsi;
+
+	lws_adns_wsi_destroy(q);
+
+	wsi = lws_zalloc(sizeof(*wsi), "async dns wsi");
+	if (!wsi)
+		return 1;
+
+	wsi->context = context;
+	lws_role_transition(wsi, 0, LRS_UNCONNECTED, &role_ops_async_dns);
+	wsi->tsi = pt->tid;
+	wsi->position_in_fds_table = LWS_NO_FDS_POS;
+	wsi->opaque_user_data = q;
+	wsi->desc.sockfd = socket(server->sa4.sin_family, SOCK_DGRAM, 0);
+	if (!lws_socket_is_valid(wsi->desc.sockfd)) {
+		lwsl_err("%s: unable to create udp socket\n", __func__);
+		lws_free(wsi);
+
+		return 1;
+	}
+	fcntl(wsi->desc.sockfd, F_SETFL, O_NONBLOCK);
+
+	context->count_wsi_allocated++;
+	q->wsi = wsi;
+
+	if (connect(wsi->desc.sockfd, (const struct sockaddr *)server,
+		    lws_adns_server_len(server)) ||
+	    (context->event_loop_ops->accept &&
+	     context->event_loop_ops->accept(wsi)) ||
+	    __insert_wsi_socket_into_fds(context, wsi)) {
+		lws_adns_wsi_destroy(q);
+
+		return 1;
+	}
+
+	return 0;
+}
+
+static void
+lws_adns_send(struct lws_adns_q *q, int idx)
+{
+	uint8_t pkt[12 + LWS_ADNS_MAX_NAME + 4], *p = pkt;
+	uint16_t type = idx ? LADNS_RRTYPE_AAAA : LADNS_RRTYPE_A;
+	const char *name = q->qname;
+	size_t n;
+
+	*p++ = q->id[idx] >> 8;
+	*p++ = q->id[idx] & 0xff;
+	*p++ = 1; /* RD: recursion desired */
+	*p++ = 0;
+	*p++ = 0; /* one question, no other records */
+	*p++ = 1;
+	memset(p, 0, 6);
+	p += 6;
+
+	while (*name) {
+		n = strcspn(name, ".");
+		*p++ = (uint8_t)n;
+		memcpy(p, name, n);
+		p += n;
+		name += n;
+		if (*name)
+			name++;
+	}
+	*p++ = 0;
+
+	*p++ = type >> 8;
+	*p++ = type & 0xff;
+	*p++ = 0;
+	*p++ = LADNS_CLASS_IN;
+
+	if (send(q->wsi->desc.sockfd, (const char *)pkt, lws_ptr_diff(p, pkt),
+		 0) < 0)
+		/* not fatal, the retry will send it again */
+		lwsl_info("%s: send failed: errno %d\n", __func__, LWS_ERRNO);
+}
+
+/*
+ * Ask what we still want to know about the current candidate name again, from
+ * a new socket with new ids and case, to the next nameserver in turn
+ */
+
+static int
+lws_adns_try(struct lws_context_per_thread *pt, struct lws_adns_q *q)
+{
+	struct lws_context_async_dns *ad = &pt->context->async_dns;
+	uint8_t r[LWS_ADNS_MAX_NAME / 8];
+	char *p;
+	int n;
+
+	if (lws_adns_socket(pt, q, &ad->server[q->tries % ad->server_count]) ||
+	    lws_get_random(pt->context, q->id, sizeof(q->id)) !=
+							sizeof(q->id) ||
+	    lws_get_random(pt->context, r, sizeof(r)) != sizeof(r))
+		return 1;
+
+	for (p = q->qname, n = 0; *p; p++, n++)
+		if ((*p | 0x20) >= 'a' && (*p | 0x20) <= 'z') {
+			if (q->no_0x20 || !(r[n >> 3] & (1 << (n & 7))))
+				*p |= 0x20;
+			else
+				*p &= ~0x20;
+		}
+
+	time(&q->sent);
+
+	for (n = 0; n < 2; n++)
+		if (q->pending & (1 << n))
+			lws_adns_send(q, n);
+
+	return 0;
+}
+
+/*
+ * The nth name to look up for what we were asked, following the resolv.conf
+ * search list and ndots the same way as the libc resolver.  Returns nonzero
+ * if there are no more.  Sets out to "" if this one is too long to use.
+ */
+
+static int
+lws_adns_candidate(const struct lws_context_async_dns *ad, const char *name,
+		   int n, char *out, size_t olen)
+{
+	const char *s = ad->search, *p;
+	size_t len = strlen(name), sl;
+	int dots = 0;
+
+	if (name[len - 1] == '.') {
+		/* absolute, don't search */
+		if (n)
+			return 1;
+		lws_strncpy(out, name, len);
+
+		return 0;
+	}
+
+	for (p = name; *p; p++)
+		dots += *p == '.';
+
+	/* with enough dots, the name as it is comes first, otherwise last */
+
+	if (dots >= ad->ndots && !n--)
+		goto as_is;
+
+	while (*s) {
+		sl = strlen(s);
+		if (!n--) {
+			*out = '\0';
+			if (len + sl + 2 <= olen) {
+				memcpy(out, name, len);
+				out[len] = '.';
+				memcpy(out + len + 1, s, sl + 1);
+			}
+
+			return 0;
+		}
+		s += sl + 1;
+	}
+
+	if (dots >= ad->ndots || n)
+		return 1;
+
+as_is:
+	lws_strncpy(out, name, olen);
+
+	return 0;
+}
+
+static int
+lws_adns_check_name(const char *name)
+{
+	const char *start = name;
+	size_t n;
+
+	while (*name) {
+		n = strcspn(name, ".");
+		if (!n || n > 63)
+			return 1;
+		name += n;
+		if (*name)
+			name++;
+	}
+
+	return name == start || name - start > 253;
+}
+
+/* start asking about the next usable candidate name */
+
+static int
+lws_adns_start(struct lws_context_per_thread *pt, struct lws_adns_q *q)
+{
+	do {
+		if (lws_adns_candidate(&pt->context->async_dns,
+				       (const char *)&q[1], q->cand, q->qname,
+				       sizeof(q->qname)))
+			return 1;
+	} while (lws_adns_check_name(q->qname) && ++q->cand);
+
+	lwsl_info("%s: querying %s\n", __func__, q->qname);
+
+	memset(&q->a, 0, sizeof(q->a));
+	q->ttl = 0xffffffff;
+	q->tries = 0;
+	q->pending = 1;
+#if defined(LWS_WITH_IPV6)
+	q->pending |= 2;
+#endif
+
+	return lws_adns_try(pt, q);
+}
+
+static void
+lws_adns_fail_wsi(struct lws *wsi, const char *cce)
+{
+	lws_dll_lws_remove(&wsi->dll_async_dns);
+
+	wsi->protocol->callback(wsi, LWS_CALLBACK_CLIENT_CONNECTION_ERROR,
+				wsi->user_space, (void *)cce, strlen(cce));
+	wsi->already_did_cce = 1;
+
+	lws_close_free_wsi(wsi, LWS_CLOSE_STATUS_NOSTATUS, "async dns");
+}
+
+/*
+ * We are done with the current candidate name, either because every question
+ * was answered, or we gave up waiting.  If the nameserver said there is no
+ * address, we move on to the next name from the search list, if any.
+ */
+
+static void
+lws_adns_complete(struct lws_context_per_thread *pt, struct lws_adns_q *q,
+		  int answered)
+{
+	const char *name = (const char *)&q[1];
+	sockaddr46 sa46;
+	time_t now;
+
+	if (!q->a.has4 && !q->a.has6 && answered) {
+		q->cand++;
+		if (!lws_adns_start(pt, q))
+			return;
+	}
+
+	lws_adns_wsi_destroy(q);
+	lws_dll_lws_remove(&q->list);
+
+	if (q->a.has4 || q->a.has6) {
+		time(&now);
+		lws_adns_cache_add(pt->context, name, &q->a, q->ttl, now);
+	} else
+		lwsl_info("%s: no address for %s\n", __func__, name);
+
+	/*
+	 * Continuing or closing a waiter may close others too, eg, if they
+	 * were pipelined on it, so take them from the head each time
+	 */
+
+	while (q->waiting.next) {
+		struct lws *w = lws_container_of(q->waiting.next, struct lws,
+						 dll_async_dns);
+
+		lws_dll_lws_remove(&w->dll_async_dns);
+
+		if (lws_adns_sa46(w, &q->a, &sa46))
+			lws_adns_fail_wsi(w, "dns lookup failed");
+		else
+			lws_client_connect_3(w, &sa46);
+	}
+
+	lws_free(q);
+}
+
+/*
+ * Decode a possibly compressed name at pkt + p into dotted form.  Returns the
+ * offset just past the name where it started, or -1 if it's malformed.
+ * Each compression pointer must point before everywhere we have been so far,
+ * so they can't loop.
+ */
+
+static int
+lws_adns_name(const uint8_t *pkt, int len, int p, char *out, int olen)
+{
+	int end = -1, lim = p, o = 0, l;
+
+	while (1) {
+		if (p >= len)
+			return -1;
+		l = pkt[p];
+
+		if ((l & 0xc0) == 0xc0) {
+			int ptr;
+
+			if (p + 1 >= len)
+				return -1;
+			ptr = ((l & 0x3f) << 8) | pkt[p + 1];
+			if (ptr >= lim)
+				return -1;
+			if (end < 0)
+				end = p + 2;
+			p = lim = ptr;
+			continue;
+		}
+		if (l & 0xc0)
+			return -1;
+
+		p++;
+		if (!l)
+			break;
+
+		if (p + l > len || o + l + 2 > olen)
+			return -1;
+		if (o)
+			out[o++] = '.';
+		memcpy(out + o, pkt + p, l);
+		o += l;
+		p += l;
+	}
+	out[o] = '\0';
+
+	return end < 0 ? p : end;
+}
+
+/*
+ * Returns nonzero if the query has finished with the socket the answer came
+ * on, and destroyed it
+ */
+
+static int
+lws_adns_parse(struct lws_context_per_thread *pt, struct lws_adns_q *q,
+	       const uint8_t *pkt, int len)
+{
+	char rname[LWS_ADNS_MAX_NAME], target[LWS_ADNS_MAX_NAME],
+	     cname[LWS_ADNS_MAX_NAME];
+	int p, m, n, idx, hops, ancount, start, chained, found;
+	uint16_t id, flags, type, cls, rdlen;
+	uint32_t ttl;
+
+	if (len < 12)
+		return 0;
+
+	id = (pkt[0] << 8) | pkt[1];
+	flags = (pkt[2] << 8) | pkt[3];
+
+	/* must be a response, to one question */
+	if (!(flags & 0x8000) || pkt[4] || pkt[5] != 1)
+		return 0;
+
+	for (idx = 0; idx < 2; idx++)
+		if ((q->pending & (1 << idx)) && q->id[idx] == id)
+			break;
+	if (idx == 2)
+		return 0;
+
+	/* the question must be the one we asked with that id */
+
+	p = lws_adns_name(pkt, len, 12, rname, sizeof(rname));
+	if (p < 0 || p + 4 > len)
+		return 0;
+	type = (pkt[p] << 8) | pkt[p + 1];
+	cls = (pkt[p + 2] << 8) | pkt[p + 3];
+	if (type != (idx ? LADNS_RRTYPE_AAAA : LADNS_RRTYPE_A) ||
+	    cls != LADNS_CLASS_IN || strcasecmp(rname, q->qname))
+		return 0;
+	start = p + 4;
+
+	if (!q->no_0x20 && strcmp(rname, q->qname)) {
+		/*
+		 * Right name in the wrong case.  It's either forged, or the
+		 * nameserver doesn't keep the case of the question.  Ignore
+		 * it, and don't use random case when we ask again.
+		 */
+		lwsl_info("%s: %s: case mismatch\n", __func__, q->qname);
+		q->no_0x20 = 1;
+
+		return 0;
+	}
+
+	/* it answers our question, whatever the answer is */
+	q->pending &= ~(1 << idx);
+
+	if (flags & 0xf) {
+		lwsl_info("%s: %s: rcode %d\n", __func__, q->qname,
+			  flags & 0xf);
+		goto done;
+	}
+
+	/*
+	 * The rest of a truncated answer would need asking again over TCP,
+	 * but we only need one address, so any whole records in it will do
+	 */
+
+	if (flags & 0x0200)
+		lwsl_info("%s: %s: truncated\n", __func__, q->qname);
+
+	/*
+	 * The answer section may hold a CNAME chain before the address
+	 * records, in any order, so look for records about the name we are
+	 * currently interested in and follow any CNAME for it
+	 */
+
+	ancount = (pkt[6] << 8) | pkt[7];
+	lws_strncpy(target, q->qname, sizeof(target));
+
+	for (hops = 0; hops < LWS_ADNS_MAX_CNAME; hops++) {
+		chained = found = 0;
+		p = start;
+
+		for (n = 0; n < ancount; n++) {
+			m = lws_adns_name(pkt, len, p, rname, sizeof(rname));
+			if (m < 0 || m + 10 > len)
+				goto done;
+			type = (pkt[m] << 8) | pkt[m + 1];
+			cls = (pkt[m + 2] << 8) | pkt[m + 3];
+			ttl = ((uint32_t)pkt[m + 4] << 24) | (pkt[m + 5] << 16) |
+			      (pkt[m + 6] << 8) | pkt[m + 7];
+			rdlen = (pkt[m + 8] << 8) | pkt[m + 9];
+			m += 10;
+			if (m + rdlen > len)
+				goto done;
+			p = m + rdlen;
+
+			if (cls != LADNS_CLASS_IN || strcasecmp(rname, target))
+				continue;
+
+			switch (type) {
+			case LADNS_RRTYPE_A:
+				if (idx || rdlen != 4 || q->a.has4)
+					continue;
+				memcpy(q->a.v4, pkt + m, 4);
+				q->a.has4 = 1;
+				break;
+			case LADNS_RRTYPE_AAAA:
+				if (!idx || rdlen != 16 || q->a.has6)
+					continue;
+				memcpy(q->a.v6, pkt + m, 16);
+				q->a.has6 = 1;
+				break;
+			case LADNS_RRTYPE_CNAME:
+				if (chained || lws_adns_name(pkt, len, m, cname,
+							sizeof(cname)) < 0)
+					continue;
+				chained = 1;
+				break;
+			default:
+				continue;
+			}
+
+			if (type != LADNS_RRTYPE_CNAME)
+				found = 1;
+			if (ttl < q->ttl)
+				q->ttl = ttl;
+		}
+
+		if (found || !chained)
+			break;
+
+		lws_strncpy(target, cname, sizeof(target));
+	}
+
+done:
+	if (q->pending)
+		return 0;
+
+	lws_adns_complete(pt, q, 1);
+
+	return 1;
+}
+
+static int
+rops_handle_POLLIN_async_dns(struct lws_context_per_thread *pt,
+			     struct lws *wsi, struct lws_pollfd *pollfd)
+{
+	struct lws_adns_q *q = (struct lws_adns_q *)wsi->opaque_user_data;
+	uint8_t buf[512];
+	int n;
+
+	/* the socket is connected, so only the nameserver can reach us */
+
+	while (1) {
+		n = recv(wsi->desc.sockfd, (char *)buf, sizeof(buf), 0);
+		if (n < 0)
+			break;
+
+		if (lws_adns_parse(pt, q, buf, n))
+			return LWS_HPI_RET_WSI_ALREADY_DIED;
+	}
+
+	return LWS_HPI_RET_HANDLED;
+}
+
+enum lws_async_dns_ret
+lws_async_dns_query(struct lws *wsi, const char *name, sockaddr46 *sa46)
+{
+	struct lws_context_per_thread *pt = &wsi->context->pt[(int)wsi->tsi];
+	struct lws_adns_addrs a;
+	char host[LWS_ADNS_MAX_NAME];
+	struct lws_adns_q *q;
+	size_t len = strlen(name);
+	time_t now;
+
+	/*
+	 * We cache and share queries by the name as it was asked, since with a
+	 * search list, "host." and "host" may not be the same.  But numeric
+	 * and /etc/hosts lookups don't use the trailing dot.
+	 */
+	if (len > 254)
+		return LADNS_FAILED;
+	lws_strncpy(host, name, sizeof(host));
+	if (len && host[len - 1] == '.')
+		host[--len] = '\0';
+	if (!len || host[len - 1] == '.')
+		return LADNS_FAILED;
+
+	memset(&a, 0, sizeof(a));
+	time(&now);
+
+	if (!lws_adns_numeric(host, &a) ||
+	    !lws_adns_cache_lookup(wsi->context, name, &a, now) ||
+	    !lws_adns_hosts(wsi->context, host, &a))
+		return lws_adns_sa46(wsi, &a, sa46) ? LADNS_FAILED :
+						      LADNS_RESOLVED;
+
+	/* something on this pt already asking about the same name? */
+
+	lws_start_foreach_dll(struct lws_dll_lws *, d,
+			      pt->async_dns.queries.next) {
+		q = lws_container_of(d, struct lws_adns_q, list);
+
+		if (!strcasecmp(name, (const char *)&q[1])) {
+			lws_dll_lws_add_front(&wsi->dll_async_dns, &q->waiting);
+
+			return LADNS_QUEUED;
+		}
+	} lws_end_foreach_dll(d);
+
+	len = strlen(name);
+	q = lws_zalloc(sizeof(*q) + len + 1, "adns query");
+	if (!q)
+		return LADNS_FAILED;
+
+	memcpy(&q[1], name, len + 1);
+
+	lws_dll_lws_add_front(&q->list, &pt->async_dns.queries);
+	lws_dll_lws_add_front(&wsi->dll_async_dns, &q->waiting);
+
+	if (lws_adns_start(pt, q)) {
+		lws_adns_wsi_destroy(q);
+		lws_dll_lws_remove(&wsi->dll_async_dns);
+		lws_dll_lws_remove(&q->list);
+		lws_free(q);
+
+		return LADNS_FAILED;
+	}
+
+	return LADNS_QUEUED;
+}
+
+void
+lws_async_dns_periodic(struct lws_context_per_thread *pt, time_t now)
+{
+	lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1,
+				   pt->async_dns.queries.next) {
+		struct lws_adns_q *q = lws_container_of(d,
+						struct lws_adns_q, list);
+
+		if (now - q->sent < LWS_ADNS_RETRY_SECS)
+			goto next;
+
+		if (++q->tries >= LWS_ADNS_MAX_TRIES || lws_adns_try(pt, q)) {
+			/* settle for whatever we got by now */
+			lwsl_info("%s: %s timed out\n", __func__, q->qname);
+			lws_adns_complete(pt, q, 0);
+		}
+next:
+		;
+
+	} lws_end_foreach_dll_safe(d, d1);
+}
+
+void
+lws_async_dns_destroy_pt(struct lws_context_per_thread *pt)
+{
+	while (pt->async_dns.queries.next) {
+		struct lws_adns_q *q = lws_container_of(
+				pt->async_dns.queries.next,
+				struct lws_adns_q, list);
+
+		lws_dll_lws_remove(&q->list);
+		lws_adns_wsi_destroy(q);
+
+		while (q->waiting.next) {
+			struct lws *w = lws_container_of(q->waiting.next,
+						struct lws, dll_async_dns);
+
+			lws_dll_lws_remove(&w->dll_async_dns);
+			lws_close_free_wsi(w,
+				LWS_CLOSE_STATUS_NOSTATUS_CONTEXT_DESTROY,
+				"ctx destroy");
+		}
+
+		lws_free(q);
+	}
+}
+
+struct lws_role_ops role_ops_async_dns = {
+	/* role name */			"async-dns",
+	/* alpn id */			NULL,
+	/* check_upgrades */		NULL,
+	/* init_context */		NULL,
+	/* init_vhost */		NULL,
+	/* destroy_vhost */		NULL,
+	/* periodic_checks */		NULL,
+	/* service_flag_pending */	NULL,
+	/* handle_POLLIN */		rops_handle_POLLIN_async_dns,
+	/* handle_POLLOUT */		NULL,
+	/* perform_user_POLLOUT */	NULL,
+	/* callback_on_writable */	NULL,
+	/* tx_credit */			NULL,
+	/* write_role_protocol */	NULL,
+	/* encapsulation_parent */	NULL,
+	/* alpn_negotiated */		NULL,
+	/* close_via_role_protocol */	NULL,
+	/* close_role */		NULL,
+	/* close_kill_connection */	NULL,
+	/* destroy_role */		NULL,
+	/* adoption_bind */		NULL,
+	/* client_bind */		NULL,
+	/* adoption_cb clnt, srv */	{ 0, 0 },
+	/* rx_cb clnt, srv */		{ 0, 0 },
+	/* writeable cb clnt, srv */	{ 0, 0 },
+	/* close cb clnt, srv */	{ 0, 0 },
+	/* protocol_bind_cb c,s */	{ 0, 0 },
+	/* protocol_unbind_cb c,s */	{ 0, 0 },
+	/* file_handle */		0,
+};
@@ -44,6 +44,9 @@ __lws_free_wsi(struct lws *wsi)
 		wsi->vhost->lserv_wsi = NULL;
 #if !defined(LWS_NO_CLIENT)
 	lws_dll_lws_remove(&wsi->dll_active_client_conns);
+#endif
+#if defined(LWS_WITH_ASYNC_DNS)
+	lws_dll_lws_remove(&wsi->dll_async_dns);
 #endif
 	wsi->context->count_wsi_allocated--;
 
@@ -412,7 +415,11 @@ just_kill_connection:
 	 */
 	__lws_ssl_remove_wsi_from_buffered_list(wsi);
 	__lws_remove_from_timeout_list(wsi);
-	lws_dll_lws_remove(&wsi->dll_hrtimer);
+	__lws_set_timer_usecs(wsi, LWS_SET_TIMER_USEC_CANCEL);
+#if defined(LWS_WITH_ASYNC_DNS)
+	/* no longer interested in any dns answer we were waiting for */
+	lws_dll_lws_remove(&wsi->dll_async_dns);
+#endif
 
 	/* don't repeat event loop stuff */
 	if (wsi->told_event_loop_closed)
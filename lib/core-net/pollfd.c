@@ -253,7 +253,12 @@ __insert_wsi_socket_into_fds(struct lws_context *context, struct lws *wsi)
 #endif
 
 	assert(wsi);
+#if defined(LWS_WITH_ASYNC_DNS)
+	assert(wsi->event_pipe || wsi->vhost ||
+	       wsi->role_ops == &role_ops_async_dns);
+#else
 	assert(wsi->event_pipe || wsi->vhost);
+#endif
 	assert(lws_socket_is_valid(wsi->desc.sockfd));
 
 	if (wsi->vhost &&
@@ -434,6 +439,12 @@ lws_callback_on_writable(struct lws *wsi)
 
 	pt = &wsi->context->pt[(int)wsi->tsi];
 
+#if defined(LWS_ROLE_WS)
+	/* someone besides lws_ws_broadcast() wants it now */
+	if (lwsi_role_ws(wsi) && wsi->ws)
+		wsi->ws->bcast_pollout = 0;
+#endif
+
 	lws_stats_atomic_bump(wsi->context, pt, LWSSTATS_C_WRITEABLE_CB_REQ, 1);
 #if defined(LWS_WITH_STATS)
 	if (!wsi->active_writable_req_us) {
@@ -491,6 +502,12 @@ __lws_same_vh_protocol_remove(struct lws *wsi)
 {
 	if (!lws_dll_is_null(&wsi->same_vh_protocol))
 		lws_dll_lws_remove(&wsi->same_vh_protocol);
+#if defined(LWS_ROLE_WS)
+	/* it won't be sending any broadcasts it still had queued */
+	if (wsi->ws)
+		__lws_ws_bcast_detach(wsi);
+	lws_dll_lws_remove(&wsi->dll_bcast_kick);
+#endif
 }
 
 void
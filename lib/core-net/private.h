@@ -234,14 +234,90 @@ struct lws_timed_vh_protocol {
 	int tsi_req;
 };
 
+/*
+ * Hashed timer wheel: a pending timer lives on the slot for its deadline
+ * tick, modulo the number of slots.  Arm and cancel are O(1), and servicing
+ * only visits the slots for the ticks that elapsed since last time, so the
+ * cost is proportional to the timers that expire (plus any that share a slot
+ * with them from a later revolution).
+ */
+
+#if defined(LWS_WITH_ESP32)
+#define LWS_TIMER_WHEEL_SLOTS 16
+#else
+#define LWS_TIMER_WHEEL_SLOTS 256
+#endif
+
+/* hrtimer wheel ticks are 2^10us, so ~262ms per revolution with 256 slots */
+#define LWS_HRTIMER_WHEEL_SHIFT 10
+
+struct lws_timer_wheel {
+	struct lws_dll_lws slot[LWS_TIMER_WHEEL_SLOTS];
+	int64_t serviced; /* every tick up to this one has been serviced */
+	int count;
+};
+
 /*
  * so we can have n connections being serviced simultaneously,
  * these things need to be isolated per-thread.
  */
 
+#if defined(LWS_WITH_STATS)
+/*
+ * Each pt keeps its own stats, only written by its own service thread, so
+ * bumping them takes no lock.  The padding keeps them off cache lines that
+ * other threads write.  They're only summed when someone asks for them.
+ *
+ * The few counters bumped on a pt from outside its service thread, eg, by
+ * the thread that accepted a connection for another pt, must only ever be
+ * bumped with lws_stats_shared_bump().
+ */
+
+#define LWS_STATS_CACHELINE 64
+
+struct lws_pt_stats {
+	uint8_t pad_head[LWS_STATS_CACHELINE];
+	uint64_t s[LWSSTATS_SIZE];
+	uint64_t hist[LWSSTATS_H_SIZE][LWSSTATS_HIST_BUCKETS];
+	char updated;
+	uint8_t pad_tail[LWS_STATS_CACHELINE];
+};
+#endif
+
+#if defined(LWS_WITH_ASYNC_DNS)
+/*
+ * Each pt has its own list of queries in flight, each with its own udp socket
+ * wsi, so the answers are serviced on the pt that asked.  The cache of
+ * answers and what we read from /etc/hosts and /etc/resolv.conf are shared by
+ * the whole context.
+ */
+
+#define LWS_ADNS_MAX_SERVERS	3
+#define LWS_ADNS_MAX_SEARCH	256
+
+struct lws_adns_host;
+
+struct lws_pt_async_dns {
+	struct lws_dll_lws queries;	/* struct lws_adns_q in flight */
+};
+
+struct lws_context_async_dns {
+	sockaddr46 server[LWS_ADNS_MAX_SERVERS];
+	char search[LWS_ADNS_MAX_SEARCH]; /* NUL-separated, ends with "" */
+	struct lws_dll_lws cache;	/* struct lws_adns_cache, MRU first */
+	struct lws_adns_host *hosts;	/* /etc/hosts, in file order */
+	time_t hosts_mtime;		/* hosts file as we read it */
+	off_t hosts_size;
+	ino_t hosts_ino;
+	int cache_count;
+	uint8_t server_count;
+	uint8_t ndots;
+	uint8_t hosts_loaded:1;
+};
+#endif
+
 struct lws_context_per_thread {
 #if LWS_MAX_SMP > 1
-	pthread_mutex_t lock_stats;
 	struct lws_mutex_refcount mr;
 	pthread_t self;
 #endif
@@ -255,8 +331,12 @@ struct lws_context_per_thread {
 	 */
 	unsigned char *serv_buf;
 
-	struct lws_dll_lws dll_head_timeout;
-	struct lws_dll_lws dll_head_hrtimer;
+	struct lws_timer_wheel tw_timeout; /* second ticks */
+	struct lws_timer_wheel tw_hrtimer; /* 2^LWS_HRTIMER_WHEEL_SHIFT us ticks */
+	struct lws_buflist_pool buflist_pool;
+#if defined(LWS_WITH_STATS)
+	struct lws_pt_stats stats;
+#endif
 	struct lws_dll_lws dll_head_buflist; /* guys with pending rxflow */
 
 #if defined(LWS_WITH_TLS)
@@ -270,10 +350,13 @@ struct lws_context_per_thread {
 #endif
 	lws_sockfd_type dummy_pipe_fds[2];
 	struct lws *pipe_wsi;
+#if defined(LWS_WITH_ASYNC_DNS)
+	struct lws_pt_async_dns async_dns;
+#endif
 
 	/* --- role based members --- */
 
-#if defined(LWS_ROLE_WS) && !defined(LWS_WITHOUT_EXTENSIONS)
+#if defined(LWS_ROLE_WS)
 	struct lws_pt_role_ws ws;
 #endif
 #if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
@@ -294,6 +377,12 @@ struct lws_context_per_thread {
 #if defined(LWS_WITH_LIBEVENT)
 	struct lws_pt_eventlibs_libevent event;
 #endif
+#if defined(LWS_WITH_EPOLL)
+	struct lws_pt_eventlibs_epoll epoll;
+#endif
+#if defined(LWS_WITH_IO_URING)
+	struct lws_pt_eventlibs_io_uring io_uring;
+#endif
 
 #if defined(LWS_WITH_LIBEV) || defined(LWS_WITH_LIBUV) || \
     defined(LWS_WITH_LIBEVENT)
@@ -364,7 +453,7 @@ struct lws_vhost {
 #if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
 	struct lws_vhost_role_http http;
 #endif
-#if defined(LWS_ROLE_WS) && !defined(LWS_WITHOUT_EXTENSIONS)
+#if defined(LWS_ROLE_WS)
 	struct lws_vhost_role_ws ws;
 #endif
 
@@ -482,6 +571,10 @@ struct lws {
 	struct lws_dll_lws dll_timeout;
 	struct lws_dll_lws dll_hrtimer;
 	struct lws_dll_lws dll_buflist; /* guys with pending rxflow */
+#if defined(LWS_ROLE_WS)
+	/* on vhost ws.bcast_kick for our pt, under the vhost lock */
+	struct lws_dll_lws dll_bcast_kick;
+#endif
 
 #if defined(LWS_WITH_THREADPOOL)
 	struct lws_threadpool_task *tp_task;
@@ -498,6 +591,10 @@ struct lws {
 	struct lws_dll_lws dll_active_client_conns;
 	struct lws_dll_lws dll_client_transaction_queue_head;
 	struct lws_dll_lws dll_client_transaction_queue;
+#endif
+#if defined(LWS_WITH_ASYNC_DNS)
+	struct lws_dll_lws dll_async_dns; /* waiting on a pt dns query */
+	sockaddr46 sa46_peer; /* resolved peer, for connect completion */
 #endif
 	void *user_space;
 	void *opaque_parent_data;
@@ -518,6 +615,9 @@ struct lws {
 #endif
 #endif
 
+#if defined(LWS_WITH_IO_URING)
+	uint32_t uring_gen; /* identifies our live poll sqe */
+#endif
 	lws_usec_t pending_timer; /* hrtimer fires */
 	time_t pending_timeout_set; /* second-resolution timeout start */
 
@@ -571,6 +671,10 @@ struct lws {
 	unsigned int could_have_pending:1; /* detect back-to-back writes */
 	unsigned int outer_will_close:1;
 	unsigned int shadow:1; /* we do not control fd lifecycle at all */
+#if defined(LWS_WITH_EPOLL)
+	unsigned int epoll_added:1; /* fd is registered with pt epoll */
+	unsigned int epoll_events:2; /* b0 = POLLIN, b1 = POLLOUT */
+#endif
 
 #ifdef LWS_WITH_ACCESS_LOG
 	unsigned int access_log_pending:1;
@@ -620,6 +724,9 @@ struct lws {
 	char seen_rx;
 #endif
 	uint8_t immortal_substream_count;
+#if defined(LWS_WITH_IO_URING)
+	uint8_t uring_armed; /* LWS_POLLIN / OUT the live poll sqe waits for */
+#endif
 	/* volatile to make sure code is aware other thread can change */
 	volatile char handling_pollout;
 	volatile char leave_pollout_active;
@@ -656,30 +763,16 @@ static LWS_INLINE void
 lws_pt_mutex_init(struct lws_context_per_thread *pt)
 {
 	lws_mutex_refcount_init(&pt->mr);
-	pthread_mutex_init(&pt->lock_stats, NULL);
 }
 
 static LWS_INLINE void
 lws_pt_mutex_destroy(struct lws_context_per_thread *pt)
 {
-	pthread_mutex_destroy(&pt->lock_stats);
 	lws_mutex_refcount_destroy(&pt->mr);
 }
 
 #define lws_pt_lock(pt, reason) lws_mutex_refcount_lock(&pt->mr, reason)
 #define lws_pt_unlock(pt) lws_mutex_refcount_unlock(&pt->mr)
-
-static LWS_INLINE void
-lws_pt_stats_lock(struct lws_context_per_thread *pt)
-{
-	pthread_mutex_lock(&pt->lock_stats);
-}
-
-static LWS_INLINE void
-lws_pt_stats_unlock(struct lws_context_per_thread *pt)
-{
-	pthread_mutex_unlock(&pt->lock_stats);
-}
 #endif
 
 /*
@@ -748,6 +841,34 @@ lws_ensure_user_space(struct lws *wsi);
 LWS_EXTERN int
 lws_change_pollfd(struct lws *wsi, int _and, int _or);
 
+/*
+ * Index of vhost_list for lws_select_vhost(), so choosing the vhost for an
+ * SNI name or Host: header doesn't cost a walk of every vhost.  It's built
+ * on demand in one allocation, and freed whenever vhost_list changes.
+ */
+
+struct lws_vhost_index_name {
+	struct lws_vhost_index_name *next; /* hash bucket chain */
+	struct lws_vhost *vh;
+	uint32_t hash;
+	int seq; /* position in vhost_list, lowest wins like the old walk */
+	int len;
+};
+
+struct lws_vhost_index_port {
+	struct lws_vhost *first; /* first vhost in vhost_list on this port */
+	int port;
+};
+
+struct lws_vhost_index {
+	struct lws_vhost_index_name **bucket;
+	struct lws_vhost_index_port *ports;
+	int count_buckets; /* power of 2 */
+	int count_ports;
+};
+
+#define lws_vhost_index_invalidate(_c) lws_free_set_NULL((_c)->vhost_index)
+
 #ifndef LWS_NO_SERVER
  int _lws_vhost_init_server(const struct lws_context_creation_info *info,
 			      struct lws_vhost *vhost);
@@ -808,6 +929,11 @@ lws_restart_ws_ping_pong_timer(struct lws *wsi);
 
 struct lws *
 lws_adopt_socket_vhost(struct lws_vhost *vh, lws_sockfd_type accept_fd);
+struct lws *
+lws_adopt_descriptor_vhost_tsi(struct lws_vhost *vh, lws_adoption_type type,
+			       lws_sock_file_fd_type fd,
+			       const char *vh_prot_name, struct lws *parent,
+			       int fixed_tsi);
 
 void
 lws_vhost_bind_wsi(struct lws_vhost *vh, struct lws *wsi);
@@ -816,6 +942,8 @@ lws_vhost_unbind_wsi(struct lws *wsi);
 
 void
 __lws_set_timeout(struct lws *wsi, enum pending_timeout reason, int secs);
+void
+__lws_set_timer_usecs(struct lws *wsi, lws_usec_t usecs);
 int
 __lws_change_pollfd(struct lws *wsi, int _and, int _or);
 
@@ -871,6 +999,31 @@ lws_remove_from_timeout_list(struct lws *wsi);
 LWS_EXTERN struct lws * LWS_WARN_UNUSED_RESULT
 lws_client_connect_2(struct lws *wsi);
 
+LWS_EXTERN struct lws *
+lws_client_connect_3(struct lws *wsi, sockaddr46 *sa46);
+
+#if defined(LWS_WITH_ASYNC_DNS)
+extern struct lws_role_ops role_ops_async_dns;
+
+enum lws_async_dns_ret {
+	LADNS_RESOLVED,		/* sa46 filled already */
+	LADNS_QUEUED,		/* wsi will be continued or closed later */
+	LADNS_FAILED,		/* no usable address */
+};
+
+int
+lws_async_dns_init(struct lws_context *context,
+		   const struct lws_context_creation_info *info);
+void
+lws_async_dns_deinit(struct lws_context *context);
+enum lws_async_dns_ret
+lws_async_dns_query(struct lws *wsi, const char *name, sockaddr46 *sa46);
+void
+lws_async_dns_periodic(struct lws_context_per_thread *pt, time_t now);
+void
+lws_async_dns_destroy_pt(struct lws_context_per_thread *pt);
+#endif
+
 LWS_VISIBLE struct lws * LWS_WARN_UNUSED_RESULT
 lws_client_reset(struct lws **wsi, int ssl, const char *address, int port,
 		 const char *path, const char *host);
@@ -952,6 +1105,17 @@ int
 lws_plat_pipe_create(struct lws *wsi);
 int
 lws_plat_pipe_signal(struct lws *wsi);
+#if defined(LWS_HAVE_SYS_UIO_H)
+struct iovec;
+int
+lws_plat_send_iov(lws_sockfd_type sockfd, const struct iovec *iov, int count,
+		  size_t *amount);
+#endif
+#if defined(LWS_HAVE_SYS_SENDFILE_H)
+int
+lws_plat_file_sendfile(lws_fop_fd_t fop_fd, lws_sockfd_type sockfd,
+		       lws_filepos_t *amount, lws_filepos_t len);
+#endif
 void
 lws_plat_pipe_close(struct lws *wsi);
 
@@ -988,15 +1152,26 @@ lws_broadcast(struct lws_context *context, int reason, void *in, size_t len);
  lws_stats_atomic_bump(struct lws_context * context,
 		struct lws_context_per_thread *pt, int index, uint64_t bump);
  void
+ lws_stats_shared_bump(struct lws_context_per_thread *pt, int index,
+		uint64_t bump);
+ void
  lws_stats_atomic_max(struct lws_context * context,
 		struct lws_context_per_thread *pt, int index, uint64_t val);
+ void
+ lws_stats_hist_add(struct lws_context_per_thread *pt, int hist, uint64_t us);
 #else
  static LWS_INLINE uint64_t lws_stats_atomic_bump(struct lws_context * context,
 		struct lws_context_per_thread *pt, int index, uint64_t bump) {
 	(void)context; (void)pt; (void)index; (void)bump; return 0; }
+ static LWS_INLINE void lws_stats_shared_bump(
+		struct lws_context_per_thread *pt, int index, uint64_t bump) {
+	(void)pt; (void)index; (void)bump; }
  static LWS_INLINE uint64_t lws_stats_atomic_max(struct lws_context * context,
 		struct lws_context_per_thread *pt, int index, uint64_t val) {
 	(void)context; (void)pt; (void)index; (void)val; return 0; }
+ static LWS_INLINE void lws_stats_hist_add(struct lws_context_per_thread *pt,
+		int hist, uint64_t us) {
+	(void)pt; (void)hist; (void)us; }
 #endif
 
 
@@ -1030,10 +1205,17 @@ lws_threadpool_tsi_context(struct lws_context *context, int tsi);
 
 void
 __lws_remove_from_timeout_list(struct lws *wsi);
+void
+__lws_timeout_requeue(struct lws *wsi, time_t now);
 
 lws_usec_t
 __lws_hrtimer_service(struct lws_context_per_thread *pt);
 
+/* buflist append using the freelist of the pt the wsi is bound to */
+#define lws_wsi_buflist_append(_wsi, _head, _buf, _len) \
+	_lws_buflist_append_segment( \
+		&(_wsi)->context->pt[(int)(_wsi)->tsi].buflist_pool, \
+		_head, _buf, _len)
 
 int
 lws_buflist_aware_read(struct lws_context_per_thread *pt, struct lws *wsi,
@@ -37,6 +37,7 @@ lws_callback_as_writeable(struct lws *wsi)
 				      LWSSTATS_MS_WRITABLE_DELAY, ul);
 		lws_stats_atomic_max(wsi->context, pt,
 				     LWSSTATS_MS_WORST_WRITABLE_DELAY, ul);
+		lws_stats_hist_add(pt, LWSSTATS_H_WRITABLE_DELAY, ul);
 		wsi->active_writable_req_us = 0;
 	}
 #endif
@@ -317,7 +318,7 @@ int lws_rxflow_cache(struct lws *wsi, unsigned char *buf, int n, int len)
 
 	/* a new rxflow, buffer it and warn caller */
 
-	m = lws_buflist_append_segment(&wsi->buflist, buf + n, len - n);
+	m = lws_wsi_buflist_append(wsi, &wsi->buflist, buf + n, len - n);
 
 	if (m < 0)
 		return -1;
@@ -409,8 +410,8 @@ lws_buflist_aware_read(struct lws_context_per_thread *pt, struct lws *wsi,
 
 	/* stash what we read */
 
-	n = lws_buflist_append_segment(&wsi->buflist, (uint8_t *)ebuf->token,
-				       ebuf->len);
+	n = lws_wsi_buflist_append(wsi, &wsi->buflist,
+				   (uint8_t *)ebuf->token, ebuf->len);
 	if (n < 0)
 		return -1;
 	if (n) {
@@ -456,9 +457,9 @@ lws_buflist_aware_consume(struct lws *wsi, struct lws_tokens *ebuf, int used,
 	/* any remainder goes on the buflist */
 
 	if (used != ebuf->len) {
-		m = lws_buflist_append_segment(&wsi->buflist,
-					       (uint8_t *)ebuf->token + used,
-					       ebuf->len - used);
+		m = lws_wsi_buflist_append(wsi, &wsi->buflist,
+					   (uint8_t *)ebuf->token + used,
+					   ebuf->len - used);
 		if (m < 0)
 			return 1; /* OOM */
 		if (m) {
@@ -584,6 +585,7 @@ lws_service_periodic_checks(struct lws_context *context,
 	lws_sockfd_type our_fd = 0, tmp_fd;
 	struct lws *wsi;
 	int timed_out = 0;
+	int64_t tick;
 	time_t now;
 #if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
 	struct allocated_headers *ah;
@@ -664,23 +666,35 @@ lws_service_periodic_checks(struct lws_context *context,
 		our_fd = pollfd->fd;
 
 	/*
-	 * Phase 1: check every wsi on our pt's timeout check list
+	 * Phase 1: check the wsi on our pt's timeout wheel slots for each
+	 *	    second since we last looked
 	 */
 
 	lws_pt_lock(pt, __func__);
 
-	lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1,
-				   context->pt[tsi].dll_head_timeout.next) {
-		wsi = lws_container_of(d, struct lws, dll_timeout);
-		tmp_fd = wsi->desc.sockfd;
-		if (__lws_service_timeout_check(wsi, now)) {
-			/* he did time out... */
-			if (tmp_fd == our_fd)
-				/* it was the guy we came to service! */
-				timed_out = 1;
-			/* he's gone, no need to mark as handled */
-		}
-	} lws_end_foreach_dll_safe(d, d1);
+	if (pt->tw_timeout.serviced > now) /* wallclock went backwards */
+		pt->tw_timeout.serviced = now - 1;
+
+	tick = pt->tw_timeout.serviced + 1;
+	if (now - tick >= LWS_TIMER_WHEEL_SLOTS)
+		tick = now - LWS_TIMER_WHEEL_SLOTS + 1;
+
+	for (; tick <= now; tick++) {
+		lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1,
+			pt->tw_timeout.slot[tick & (LWS_TIMER_WHEEL_SLOTS - 1)].next) {
+			wsi = lws_container_of(d, struct lws, dll_timeout);
+			tmp_fd = wsi->desc.sockfd;
+			if (__lws_service_timeout_check(wsi, now)) {
+				/* he did time out... */
+				if (tmp_fd == our_fd)
+					/* it was the guy we came to service! */
+					timed_out = 1;
+				/* he's gone, no need to mark as handled */
+			} else
+				__lws_timeout_requeue(wsi, now);
+		} lws_end_foreach_dll_safe(d, d1);
+	}
+	pt->tw_timeout.serviced = now;
 
 #if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
 	/*
@@ -924,6 +938,9 @@ vh_timers_done:
 #if defined(LWS_ROLE_CGI)
 	role_ops_cgi.periodic_checks(context, tsi, now);
 #endif
+#if defined(LWS_WITH_ASYNC_DNS)
+	lws_async_dns_periodic(pt, now);
+#endif
 
 #if defined(LWS_WITH_TLS)
 	/*
@@ -24,25 +24,105 @@
 
 #if defined(LWS_WITH_STATS)
 
+/* stats that keep the worst value seen, instead of accumulating */
+
+static int
+lws_stats_is_max(int index)
+{
+	return index == LWSSTATS_MS_WORST_WRITABLE_DELAY ||
+	       index == LWSSTATS_B_PMD_ZLIB_MEM_PEAK;
+}
+
 LWS_VISIBLE LWS_EXTERN uint64_t
 lws_stats_get(struct lws_context *context, int index)
 {
+	uint64_t v = 0;
+	int n;
+
 	if (index >= LWSSTATS_SIZE)
 		return 0;
 
-	return context->lws_stats[index];
+	for (n = 0; n < context->count_threads; n++) {
+		uint64_t u = context->pt[n].stats.s[index];
+
+		if (!lws_stats_is_max(index))
+			v += u;
+		else
+			if (u > v)
+				v = u;
+	}
+
+	return v;
+}
+
+LWS_VISIBLE LWS_EXTERN void
+lws_stats_snapshot(struct lws_context *context, struct lws_stats_snapshot *snap)
+{
+	int n, m, b;
+
+	for (m = 0; m < LWSSTATS_SIZE; m++)
+		snap->s[m] = lws_stats_get(context, m);
+
+	memset(snap->hist, 0, sizeof(snap->hist));
+	for (n = 0; n < context->count_threads; n++)
+		for (m = 0; m < LWSSTATS_H_SIZE; m++)
+			for (b = 0; b < LWSSTATS_HIST_BUCKETS; b++)
+				snap->hist[m][b] +=
+					context->pt[n].stats.hist[m][b];
+}
+
+LWS_VISIBLE LWS_EXTERN uint64_t
+lws_stats_hist_percentile(const struct lws_stats_snapshot *snap, int hist,
+			  int percent)
+{
+	uint64_t total = 0, target, acc = 0;
+	int b;
+
+	if (hist < 0 || hist >= LWSSTATS_H_SIZE || percent < 1 || percent > 100)
+		return 0;
+
+	for (b = 0; b < LWSSTATS_HIST_BUCKETS; b++)
+		total += snap->hist[hist][b];
+
+	if (!total)
+		return 0;
+
+	/* the sample at the percentile's rank, rounding up */
+	target = ((total * (unsigned int)percent) + 99) / 100;
+
+	for (b = 0; b < LWSSTATS_HIST_BUCKETS; b++) {
+		acc += snap->hist[hist][b];
+		if (acc >= target)
+			break;
+	}
+
+	if (b == LWSSTATS_HIST_BUCKETS)
+		b--;
+
+	return b ? (uint64_t)1 << b : 0;
 }
 
 LWS_VISIBLE LWS_EXTERN void
 lws_stats_log_dump(struct lws_context *context)
 {
+	static const char * const hist_names[] = {
+		"LWSSTATS_H_WRITABLE_DELAY:  ",
+		"LWSSTATS_H_SSL_ACCEPT_DELAY:",
+		"LWSSTATS_H_SSL_RX_DELAY:    ",
+	};
 	struct lws_vhost *v = context->vhost_list;
-	int n;
+	struct lws_stats_snapshot *snap;
+	int n, updated = context->updated;
 #if defined(LWS_WITH_PEER_LIMITS)
 	int m;
 #endif
 
-	if (!context->updated)
+	for (n = 0; n < context->count_threads; n++) {
+		updated |= context->pt[n].stats.updated;
+		context->pt[n].stats.updated = 0;
+	}
+
+	if (!updated)
 		return;
 
 	context->updated = 0;
@@ -94,6 +174,54 @@ lws_stats_log_dump(struct lws_context *context)
 	lwsl_notice("LWSSTATS_C_PEER_LIMIT_WSI_DENIED:           %8llu\n",
 		(unsigned long long)lws_stats_get(context,
 					LWSSTATS_C_PEER_LIMIT_WSI_DENIED));
+	lwsl_notice("LWSSTATS_C_BUFLIST_POOL_HIT:                %8llu\n",
+		(unsigned long long)lws_stats_get(context,
+					LWSSTATS_C_BUFLIST_POOL_HIT));
+	lwsl_notice("LWSSTATS_C_BUFLIST_POOL_MISS:               %8llu\n",
+		(unsigned long long)lws_stats_get(context,
+					LWSSTATS_C_BUFLIST_POOL_MISS));
+	if (lws_stats_get(context, LWSSTATS_C_BUFLIST_POOL_HIT) +
+	    lws_stats_get(context, LWSSTATS_C_BUFLIST_POOL_MISS))
+		lwsl_notice("  Buflist pool hit rate:                    %8llu%%\n",
+			(unsigned long long)(lws_stats_get(context,
+				LWSSTATS_C_BUFLIST_POOL_HIT) * 100 /
+			(lws_stats_get(context, LWSSTATS_C_BUFLIST_POOL_HIT) +
+			 lws_stats_get(context, LWSSTATS_C_BUFLIST_POOL_MISS))));
+	lwsl_notice("LWSSTATS_C_H2_HEADER_BLOCKS_TX:             %8llu\n",
+		(unsigned long long)lws_stats_get(context,
+					LWSSTATS_C_H2_HEADER_BLOCKS_TX));
+	lwsl_notice("LWSSTATS_B_H2_HEADER_BLOCKS_TX:             %8llu\n",
+		(unsigned long long)lws_stats_get(context,
+					LWSSTATS_B_H2_HEADER_BLOCKS_TX));
+	if (lws_stats_get(context, LWSSTATS_C_H2_HEADER_BLOCKS_TX))
+		lwsl_notice("  Avg h2 header block:                      %8llu\n",
+			(unsigned long long)(lws_stats_get(context,
+				LWSSTATS_B_H2_HEADER_BLOCKS_TX) /
+			lws_stats_get(context, LWSSTATS_C_H2_HEADER_BLOCKS_TX)));
+	lwsl_notice("LWSSTATS_C_PMD_ZS_POOL_HIT:                 %8llu\n",
+		(unsigned long long)lws_stats_get(context,
+					LWSSTATS_C_PMD_ZS_POOL_HIT));
+	lwsl_notice("LWSSTATS_C_PMD_ZS_POOL_MISS:                %8llu\n",
+		(unsigned long long)lws_stats_get(context,
+					LWSSTATS_C_PMD_ZS_POOL_MISS));
+	lwsl_notice("LWSSTATS_B_PMD_ZLIB_MEM:                    %8llu\n",
+		(unsigned long long)lws_stats_get(context,
+					LWSSTATS_B_PMD_ZLIB_MEM));
+	lwsl_notice("LWSSTATS_B_PMD_ZLIB_MEM_PEAK:               %8llu\n",
+		(unsigned long long)lws_stats_get(context,
+					LWSSTATS_B_PMD_ZLIB_MEM_PEAK));
+	lwsl_notice("LWSSTATS_C_SSL_CLIENT_SESSION_HIT:          %8llu\n",
+		(unsigned long long)lws_stats_get(context,
+					LWSSTATS_C_SSL_CLIENT_SESSION_HIT));
+	lwsl_notice("LWSSTATS_C_SSL_CLIENT_SESSION_MISS:         %8llu\n",
+		(unsigned long long)lws_stats_get(context,
+					LWSSTATS_C_SSL_CLIENT_SESSION_MISS));
+	lwsl_notice("LWSSTATS_C_SSL_SERVER_SESSION_HIT:          %8llu\n",
+		(unsigned long long)lws_stats_get(context,
+					LWSSTATS_C_SSL_SERVER_SESSION_HIT));
+	lwsl_notice("LWSSTATS_C_SSL_SERVER_SESSION_MISS:         %8llu\n",
+		(unsigned long long)lws_stats_get(context,
+					LWSSTATS_C_SSL_SERVER_SESSION_MISS));
 
 	lwsl_notice("LWSSTATS_C_TIMEOUTS:                        %8llu\n",
 		(unsigned long long)lws_stats_get(context,
@@ -138,6 +266,33 @@ lws_stats_log_dump(struct lws_context *context)
 			(unsigned long long)(lws_stats_get(context,
 					LWSSTATS_MS_WRITABLE_DELAY) /
 			lws_stats_get(context, LWSSTATS_C_WRITEABLE_CB)));
+
+	snap = lws_malloc(sizeof(*snap), __func__);
+	if (snap) {
+		lws_stats_snapshot(context, snap);
+		for (n = 0; n < LWSSTATS_H_SIZE; n++) {
+			uint64_t count = 0;
+			int b;
+
+			for (b = 0; b < LWSSTATS_HIST_BUCKETS; b++)
+				count += snap->hist[n][b];
+
+			if (!count)
+				continue;
+
+			lwsl_notice("%s %8llu samples, p50 <%lluus, "
+				    "p90 <%lluus, p99 <%lluus\n", hist_names[n],
+				    (unsigned long long)count,
+				    (unsigned long long)
+				       lws_stats_hist_percentile(snap, n, 50),
+				    (unsigned long long)
+				       lws_stats_hist_percentile(snap, n, 90),
+				    (unsigned long long)
+				       lws_stats_hist_percentile(snap, n, 99));
+		}
+		lws_free(snap);
+	}
+
 	lwsl_notice("Simultaneous SSL restriction:               %8d/%d\n",
 			context->simultaneous_ssl,
 			context->simultaneous_ssl_restriction);
@@ -235,27 +390,68 @@ lws_stats_log_dump(struct lws_context *context)
 	lwsl_notice("\n");
 }
 
+/*
+ * These are only called from the pt's own service thread, which is the only
+ * writer of its stats, so no lock is needed.  Readers in other threads sum
+ * the pts without locking, so they may see a slightly stale value.
+ */
+
 void
 lws_stats_atomic_bump(struct lws_context * context,
 		struct lws_context_per_thread *pt, int index, uint64_t bump)
 {
-	lws_pt_stats_lock(pt);
-	context->lws_stats[index] += bump;
+	(void)context;
+
+	pt->stats.s[index] += bump;
 	if (index != LWSSTATS_C_SERVICE_ENTRY)
-		context->updated = 1;
-	lws_pt_stats_unlock(pt);
+		pt->stats.updated = 1;
+}
+
+/*
+ * For the counters that are bumped on a pt by threads other than its own,
+ * like the new connection count, which is bumped by whichever thread did the
+ * adoption.  All the bumps of such a counter must come through here so the
+ * adds can't be lost, the ordering doesn't matter so relaxed is enough.
+ */
+
+void
+lws_stats_shared_bump(struct lws_context_per_thread *pt, int index,
+		      uint64_t bump)
+{
+#if LWS_MAX_SMP > 1 && defined(__GNUC__)
+	__atomic_fetch_add(&pt->stats.s[index], bump, __ATOMIC_RELAXED);
+	__atomic_store_n(&pt->stats.updated, 1, __ATOMIC_RELAXED);
+#else
+	pt->stats.s[index] += bump;
+	pt->stats.updated = 1;
+#endif
 }
 
 void
 lws_stats_atomic_max(struct lws_context * context,
 		struct lws_context_per_thread *pt, int index, uint64_t val)
 {
-	lws_pt_stats_lock(pt);
-	if (val > context->lws_stats[index]) {
-		context->lws_stats[index] = val;
-		context->updated = 1;
+	(void)context;
+
+	if (val > pt->stats.s[index]) {
+		pt->stats.s[index] = val;
+		pt->stats.updated = 1;
 	}
-	lws_pt_stats_unlock(pt);
+}
+
+void
+lws_stats_hist_add(struct lws_context_per_thread *pt, int hist, uint64_t us)
+{
+	int b = 0;
+
+	/* bucket n is [2^(n - 1), 2^n) us */
+	while (us && b < LWSSTATS_HIST_BUCKETS - 1) {
+		us >>= 1;
+		b++;
+	}
+
+	pt->stats.hist[hist][b]++;
+	pt->stats.updated = 1;
 }
 
 #endif
@@ -52,6 +52,12 @@ const struct lws_event_loop_ops *available_event_libs[] = {
 #endif
 #if defined(LWS_WITH_LIBEV)
 	&event_loop_ops_ev,
+#endif
+#if defined(LWS_WITH_EPOLL)
+	&event_loop_ops_epoll,
+#endif
+#if defined(LWS_WITH_IO_URING)
+	&event_loop_ops_io_uring,
 #endif
 	NULL
 };
@@ -705,6 +711,15 @@ lws_create_vhost(struct lws_context *context,
 #endif
 	} else
 		vh->log_fd = (int)LWS_INVALID_FILE;
+#endif
+#if (defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)) && \
+    !defined(LWS_WITHOUT_SERVER)
+	if (lws_mount_trie_build(vh))
+		lwsl_warn("%s: no mount trie, using linear mount lookup\n",
+			  __func__);
+	if (lws_mimetype_index_build(vh))
+		lwsl_warn("%s: no mimetype index, using linear lookup\n",
+			  __func__);
 #endif
 	if (lws_context_init_server_ssl(info, vh)) {
 		lwsl_err("%s: lws_context_init_server_ssl failed\n", __func__);
@@ -722,6 +737,7 @@ lws_create_vhost(struct lws_context *context,
 		goto bail1;
 	}
 
+	lws_context_lock(context, "create_vhost");
 	while (1) {
 		if (!(*vh1)) {
 			*vh1 = vh;
@@ -729,6 +745,8 @@ lws_create_vhost(struct lws_context *context,
 		}
 		vh1 = &(*vh1)->vhost_next;
 	};
+	lws_vhost_index_invalidate(context);
+	lws_context_unlock(context);
 
 	/* for the case we are adding a vhost much later, after server init */
 
@@ -985,6 +1003,7 @@ __lws_vhost_destroy2(struct lws_vhost *vh)
 			break;
 		}
 	} lws_end_foreach_llp(pv, vhost_next);
+	lws_vhost_index_invalidate(context);
 
 	/* add ourselves to the pending destruction list */
 
@@ -1055,6 +1074,10 @@ __lws_vhost_destroy2(struct lws_vhost *vh)
 #if defined (LWS_WITH_TLS)
 	lws_free_set_NULL(vh->tls.alloc_cert_path);
 #endif
+#if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
+	lws_free_set_NULL(vh->http.mount_trie);
+	lws_free_set_NULL(vh->http.mimetypes);
+#endif
 
 #if LWS_MAX_SMP > 1
        pthread_mutex_destroy(&vh->lock);
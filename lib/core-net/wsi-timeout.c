@@ -22,10 +22,37 @@
 #include "core/private.h"
 
 
+static void
+__lws_timer_wheel_insert(struct lws_timer_wheel *tw, struct lws_dll_lws *d,
+			 int64_t tick)
+{
+	/*
+	 * If the deadline is on a tick we already serviced, it must go on the
+	 * next slot we will look at, otherwise it would wait a revolution
+	 */
+	if (tick <= tw->serviced)
+		tick = tw->serviced + 1;
+
+	lws_dll_lws_add_front(d, &tw->slot[tick & (LWS_TIMER_WHEEL_SLOTS - 1)]);
+	tw->count++;
+}
+
+static void
+__lws_timer_wheel_remove(struct lws_timer_wheel *tw, struct lws_dll_lws *d)
+{
+	if (!d->prev) /* not on the wheel */
+		return;
+
+	lws_dll_lws_remove(d);
+	tw->count--;
+}
+
 void
 __lws_remove_from_timeout_list(struct lws *wsi)
 {
-	lws_dll_lws_remove(&wsi->dll_timeout);
+	struct lws_context_per_thread *pt = &wsi->context->pt[(int)wsi->tsi];
+
+	__lws_timer_wheel_remove(&pt->tw_timeout, &wsi->dll_timeout);
 }
 
 void
@@ -43,12 +70,9 @@ void
 __lws_set_timer_usecs(struct lws *wsi, lws_usec_t usecs)
 {
 	struct lws_context_per_thread *pt = &wsi->context->pt[(int)wsi->tsi];
-	struct lws_dll_lws *dd = &pt->dll_head_hrtimer;
 	struct timeval now;
-	struct lws *wsi1;
-	int bef = 0;
 
-	lws_dll_lws_remove(&wsi->dll_hrtimer);
+	__lws_timer_wheel_remove(&pt->tw_hrtimer, &wsi->dll_hrtimer);
 
 	if (usecs == LWS_SET_TIMER_USEC_CANCEL)
 		return;
@@ -56,52 +80,8 @@ __lws_set_timer_usecs(struct lws *wsi, lws_usec_t usecs)
 	gettimeofday(&now, NULL);
 	wsi->pending_timer = ((now.tv_sec * 1000000ll) + now.tv_usec) + usecs;
 
-	/*
-	 * we sort the hrtimer list with the earliest timeout first
-	 */
-
-	lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1,
-				   pt->dll_head_hrtimer.next) {
-		dd = d;
-		wsi1 = lws_container_of(d, struct lws, dll_hrtimer);
-
-		if (wsi1->pending_timer >= wsi->pending_timer) {
-			/* d, dprev's next, is >= our time */
-			bef = 1;
-			break;
-		}
-	} lws_end_foreach_dll_safe(d, d1);
-
-	if (bef) {
-		/*
-		 *  we go before dd
-		 *  DDp <-> DD <-> DDn --> DDp <-> us <-> DD <-> DDn
-		 */
-		/* we point forward to dd */
-		wsi->dll_hrtimer.next = dd;
-		/* we point back to what dd used to point back to */
-		wsi->dll_hrtimer.prev = dd->prev;
-		/* DDp points forward to us now */
-		dd->prev->next = &wsi->dll_hrtimer;
-		/* DD points back to us now */
-		dd->prev = &wsi->dll_hrtimer;
-	} else {
-		/*
-		 *  we go after dd
-		 *  DDp <-> DD <-> DDn --> DDp <-> DD <-> us <-> DDn
-		 */
-		/* we point forward to what dd used to point forward to */
-		wsi->dll_hrtimer.next = dd->next;
-		/* we point back to dd */
-		wsi->dll_hrtimer.prev = dd;
-		/* DDn points back to us */
-		if (dd->next)
-			dd->next->prev = &wsi->dll_hrtimer;
-		/* DD points forward to us */
-		dd->next = &wsi->dll_hrtimer;
-	}
-
-//	lws_dll_dump(&pt->dll_head_hrtimer, "after set_timer_usec");
+	__lws_timer_wheel_insert(&pt->tw_hrtimer, &wsi->dll_hrtimer,
+				 wsi->pending_timer >> LWS_HRTIMER_WHEEL_SHIFT);
 }
 
 LWS_VISIBLE void
@@ -114,50 +94,87 @@ lws_set_timer_usecs(struct lws *wsi, lws_usec_t usecs)
 lws_usec_t
 __lws_hrtimer_service(struct lws_context_per_thread *pt)
 {
+	struct lws_timer_wheel *tw = &pt->tw_hrtimer;
+	lws_usec_t t, next = LWS_HRTIMER_NOWAIT;
+	int64_t tick, now_tick;
 	struct timeval now;
 	struct lws *wsi;
-	lws_usec_t t;
+
+	if (!tw->count)
+		return LWS_HRTIMER_NOWAIT;
 
 	gettimeofday(&now, NULL);
 	t = (now.tv_sec * 1000000ll) + now.tv_usec;
+	now_tick = t >> LWS_HRTIMER_WHEEL_SHIFT;
 
-	lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1,
-				   pt->dll_head_hrtimer.next) {
-		wsi = lws_container_of(d, struct lws, dll_hrtimer);
-
-		/*
-		 * if we met one in the future, we are done, because the list
-		 * is sorted by time in the future.
-		 */
-		if (wsi->pending_timer > t)
-			break;
-
-		lws_set_timer_usecs(wsi, LWS_SET_TIMER_USEC_CANCEL);
-
-		/* it's time for the timer to be serviced */
+	/*
+	 * Visit the slots for every tick since we were last here, including
+	 * the current one, at most once each
+	 */
 
-		if (wsi->protocol &&
-		    wsi->protocol->callback(wsi, LWS_CALLBACK_TIMER,
-					    wsi->user_space, NULL, 0))
-			__lws_close_free_wsi(wsi, LWS_CLOSE_STATUS_NOSTATUS,
-					     "timer cb errored");
-	} lws_end_foreach_dll_safe(d, d1);
+	tick = tw->serviced + 1;
+	if (now_tick - tick >= LWS_TIMER_WHEEL_SLOTS)
+		tick = now_tick - LWS_TIMER_WHEEL_SLOTS + 1;
+
+	for (; tick <= now_tick; tick++) {
+		lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1,
+			tw->slot[tick & (LWS_TIMER_WHEEL_SLOTS - 1)].next) {
+			wsi = lws_container_of(d, struct lws, dll_hrtimer);
+
+			/*
+			 * if it's due later in this tick, or on a later
+			 * revolution, leave it where it is
+			 */
+			if (wsi->pending_timer <= t) {
+				__lws_set_timer_usecs(wsi,
+						LWS_SET_TIMER_USEC_CANCEL);
+
+				/* it's time for the timer to be serviced */
+
+				if (wsi->protocol &&
+				    wsi->protocol->callback(wsi,
+						LWS_CALLBACK_TIMER,
+						wsi->user_space, NULL, 0))
+					__lws_close_free_wsi(wsi,
+						LWS_CLOSE_STATUS_NOSTATUS,
+						"timer cb errored");
+			}
+		} lws_end_foreach_dll_safe(d, d1);
+	}
 
-	/* return an estimate how many us until next timer hit */
+	/* the current tick may still have timers due later in it */
+	tw->serviced = now_tick - 1;
 
-	if (!pt->dll_head_hrtimer.next)
+	if (!tw->count)
 		return LWS_HRTIMER_NOWAIT;
 
-	wsi = lws_container_of(pt->dll_head_hrtimer.next, struct lws,
-			       dll_hrtimer);
+	/*
+	 * return an estimate how many us until next timer hit: the earliest
+	 * deadline on the first slot with anything due in this revolution
+	 */
 
-	gettimeofday(&now, NULL);
-	t = (now.tv_sec * 1000000ll) + now.tv_usec;
+	for (tick = now_tick; tick < now_tick + LWS_TIMER_WHEEL_SLOTS &&
+			      next == LWS_HRTIMER_NOWAIT; tick++) {
+		lws_start_foreach_dll(struct lws_dll_lws *, d,
+			tw->slot[tick & (LWS_TIMER_WHEEL_SLOTS - 1)].next) {
+			wsi = lws_container_of(d, struct lws, dll_hrtimer);
+
+			if ((wsi->pending_timer >> LWS_HRTIMER_WHEEL_SHIFT) <=
+								tick &&
+			    wsi->pending_timer < next)
+				next = wsi->pending_timer;
+		} lws_end_foreach_dll(d);
+	}
+
+	if (next == LWS_HRTIMER_NOWAIT)
+		/* everything is on a later revolution, come back after this one */
+		next = (now_tick + LWS_TIMER_WHEEL_SLOTS) <<
+						LWS_HRTIMER_WHEEL_SHIFT;
 
-	if (wsi->pending_timer < t)
+	if (next < t)
 		return 0;
 
-	return wsi->pending_timer - t;
+	return next - t;
 }
 
 void
@@ -173,10 +190,32 @@ __lws_set_timeout(struct lws *wsi, enum pending_timeout reason, int secs)
 	wsi->pending_timeout_set = now;
 	wsi->pending_timeout = reason;
 
+	__lws_timer_wheel_remove(&pt->tw_timeout, &wsi->dll_timeout);
 	if (!reason)
-		lws_dll_lws_remove(&wsi->dll_timeout);
-	else
-		lws_dll_lws_add_front(&wsi->dll_timeout, &pt->dll_head_timeout);
+		return;
+
+	/* it times out on the first second we see more than secs elapsed */
+	__lws_timer_wheel_insert(&pt->tw_timeout, &wsi->dll_timeout,
+				 (int64_t)now + secs + 1);
+}
+
+/*
+ * The periodic check found this guy on the timeout wheel but he is not due
+ * yet, either because he's on a later revolution or because a time
+ * discontiguity moved his effective deadline.  Put him on the slot for when
+ * he will actually be due.
+ */
+
+void
+__lws_timeout_requeue(struct lws *wsi, time_t now)
+{
+	struct lws_context_per_thread *pt = &wsi->context->pt[(int)wsi->tsi];
+	int elapsed = lws_compare_time_t(wsi->context, now,
+					 wsi->pending_timeout_set);
+
+	__lws_timer_wheel_remove(&pt->tw_timeout, &wsi->dll_timeout);
+	__lws_timer_wheel_insert(&pt->tw_timeout, &wsi->dll_timeout,
+		(int64_t)now + wsi->pending_timeout_limit - elapsed + 1);
 }
 
 LWS_VISIBLE void
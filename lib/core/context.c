@@ -220,6 +220,28 @@ lwsl_info("context created\n");
 		goto fail_event_libs;
 #endif
 
+	if (lws_check_opt(context->options, LWS_SERVER_OPTION_EPOLL))
+#if defined(LWS_WITH_EPOLL)
+		context->event_loop_ops = &event_loop_ops_epoll;
+#else
+		goto fail_event_libs;
+#endif
+
+	if (info->event_lib) {
+		extern const struct lws_event_loop_ops *available_event_libs[];
+		const struct lws_event_loop_ops **elops = available_event_libs;
+
+		context->event_loop_ops = NULL;
+		while (*elops) {
+			if (!strcmp((*elops)->name, info->event_lib)) {
+				context->event_loop_ops =
+					(struct lws_event_loop_ops *)*elops;
+				break;
+			}
+			elops++;
+		}
+	}
+
 	if (!context->event_loop_ops)
 		goto fail_event_libs;
 
@@ -257,6 +279,7 @@ lwsl_info("context created\n");
 		context->timeout_secs = AWAITING_TIMEOUT;
 
 	context->ws_ping_pong_interval = info->ws_ping_pong_interval;
+	context->listen_accept_own_pt = !!info->listen_accept_own_pt;
 
 	lwsl_info(" default timeout (secs): %u\n", context->timeout_secs);
 
@@ -390,6 +413,11 @@ lwsl_info("context created\n");
 
 	if (lws_create_event_pipes(context))
 		goto bail;
+
+#if defined(LWS_WITH_ASYNC_DNS)
+	if (lws_async_dns_init(context, info))
+		goto bail;
+#endif
 #endif
 
 	lws_context_init_ssl_library(info);
@@ -519,6 +547,10 @@ lws_context_destroy3(struct lws_context *context)
 			context->event_loop_ops->destroy_pt(context, n);
 
 		lws_free_set_NULL(context->pt[n].serv_buf);
+		lws_buflist_pool_destroy(&context->pt[n].buflist_pool);
+#if defined(LWS_ROLE_WS) && !defined(LWS_WITHOUT_EXTENSIONS)
+		lws_pmd_zs_pool_destroy(&context->pt[n]);
+#endif
 
 #if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
 		while (pt->http.ah_list)
@@ -528,6 +560,9 @@ lws_context_destroy3(struct lws_context *context)
 
 	if (context->pt[0].fds)
 		lws_free_set_NULL(context->pt[0].fds);
+#if defined(LWS_WITH_ASYNC_DNS)
+	lws_async_dns_deinit(context);
+#endif
 #endif
 	lws_free(context);
 	lwsl_info("%s: ctx %p freed\n", __func__, context);
@@ -572,6 +607,8 @@ lws_context_destroy2(struct lws_context *context)
 	while (context->vhost_pending_destruction_list)
 		/* removes itself from list */
 		__lws_vhost_destroy2(context->vhost_pending_destruction_list);
+
+	lws_vhost_index_invalidate(context);
 #endif
 
 	lws_stats_log_dump(context);
@@ -692,6 +729,10 @@ lws_context_destroy(struct lws_context *context)
 		}
 		vpt->foreign_pfd_list = NULL;
 
+#if defined(LWS_WITH_ASYNC_DNS)
+		lws_async_dns_destroy_pt(pt);
+#endif
+
 		for (n = 0; (unsigned int)n < context->pt[m].fds_count; n++) {
 			struct lws *wsi = wsi_from_fd(context, pt->fds[n].fd);
 			if (!wsi)
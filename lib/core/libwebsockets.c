@@ -183,34 +183,117 @@ lws_pthread_self_to_tsi(struct lws_context *context)
 
 /* lws_buflist */
 
+static void
+lws_buflist_pool_stat(struct lws_buflist_pool *pool, int idx)
+{
+#if defined(LWS_WITH_NETWORK) && defined(LWS_WITH_STATS)
+	/* pools only exist embedded in a pt */
+	struct lws_context_per_thread *pt = lws_container_of(pool,
+				struct lws_context_per_thread, buflist_pool);
+
+	lws_stats_atomic_bump(pt->context, pt, idx, 1);
+#else
+	(void)pool;
+	(void)idx;
+#endif
+}
+
+static struct lws_buflist *
+lws_buflist_alloc(struct lws_buflist_pool *pool, size_t len)
+{
+	struct lws_buflist *nbuf;
+	uint8_t c = 0;
+
+	if (!pool)
+		goto oversize;
+
+	while (c < LWS_BUFLIST_POOL_CLASSES && len > lws_buflist_class_size(c))
+		c++;
+
+	if (c == LWS_BUFLIST_POOL_CLASSES)
+		goto oversize;
+
+	nbuf = pool->free[c];
+	if (nbuf) {
+		pool->free[c] = nbuf->next;
+		pool->count_free[c]--;
+		lws_buflist_pool_stat(pool, LWSSTATS_C_BUFLIST_POOL_HIT);
+		return nbuf;
+	}
+
+	lws_buflist_pool_stat(pool, LWSSTATS_C_BUFLIST_POOL_MISS);
+
+	nbuf = (struct lws_buflist *)lws_malloc(sizeof(*nbuf) +
+					lws_buflist_class_size(c), __func__);
+	if (!nbuf)
+		return NULL;
+
+	nbuf->pool = pool;
+	nbuf->size_class = c;
+
+	return nbuf;
+
+oversize:
+	nbuf = (struct lws_buflist *)lws_malloc(sizeof(*nbuf) + len, __func__);
+	if (!nbuf)
+		return NULL;
+
+	nbuf->pool = NULL;
+	nbuf->size_class = 0;
+
+	return nbuf;
+}
+
+static void
+lws_buflist_free(struct lws_buflist *b)
+{
+	struct lws_buflist_pool *pool = b->pool;
+
+	if (pool && pool->count_free[b->size_class] <
+						LWS_BUFLIST_POOL_MAX_FREE) {
+		b->next = pool->free[b->size_class];
+		pool->free[b->size_class] = b;
+		pool->count_free[b->size_class]++;
+
+		return;
+	}
+
+	lws_free(b);
+}
+
+void
+lws_buflist_pool_destroy(struct lws_buflist_pool *pool)
+{
+	struct lws_buflist *p, *p1;
+	int n;
+
+	for (n = 0; n < LWS_BUFLIST_POOL_CLASSES; n++) {
+		p = pool->free[n];
+		while (p) {
+			p1 = p->next;
+			lws_free(p);
+			p = p1;
+		}
+		pool->free[n] = NULL;
+		pool->count_free[n] = 0;
+	}
+}
+
 int
-lws_buflist_append_segment(struct lws_buflist **head, const uint8_t *buf,
-			   size_t len)
+_lws_buflist_append_segment(struct lws_buflist_pool *pool,
+			    struct lws_buflist **head, const uint8_t *buf,
+			    size_t len)
 {
 	struct lws_buflist *nbuf;
 	int first = !*head;
-	void *p = *head;
-	int sanity = 1024;
 
 	assert(buf);
 	assert(len);
 
-	/* append at the tail */
-	while (*head) {
-		if (!--sanity) {
-			lwsl_err("%s: buflist reached sanity limit\n", __func__);
-			return -1;
-		}
-		if (*head == (*head)->next) {
-			lwsl_err("%s: corrupt list points to self\n", __func__);
-			return -1;
-		}
-		head = &((*head)->next);
-	}
-
-	lwsl_info("%s: len %u first %d %p\n", __func__, (uint32_t)len, first, p);
+	lwsl_info("%s: len %u first %d %p\n", __func__, (uint32_t)len, first,
+		  *head);
 
-	nbuf = (struct lws_buflist *)lws_malloc(sizeof(**head) + len, __func__);
+	nbuf = lws_buflist_alloc(pool, len);
 	if (!nbuf) {
 		lwsl_err("%s: OOM\n", __func__);
 		return -1;
@@ -219,13 +302,30 @@ lws_buflist_append_segment(struct lws_buflist **head, const uint8_t *buf,
 	nbuf->len = len;
 	nbuf->pos = 0;
 	nbuf->next = NULL;
+	nbuf->tail = nbuf;
+
+	memcpy((void *)nbuf->buf, buf, len);
+
+	if (first) {
+		*head = nbuf;
+
+		return 1; /* first segment just created */
+	}
 
-	p = (void *)nbuf->buf;
-	memcpy(p, buf, len);
+	/* append at the tail, which the head segment tracks */
 
-	*head = nbuf;
+	assert((*head)->tail && !(*head)->tail->next);
+	(*head)->tail->next = nbuf;
+	(*head)->tail = nbuf;
 
-	return first; /* returns 1 if first segment just created */
+	return 0;
+}
+
+int
+lws_buflist_append_segment(struct lws_buflist **head, const uint8_t *buf,
+			   size_t len)
+{
+	return _lws_buflist_append_segment(NULL, head, buf, len);
 }
 
 static int
@@ -235,8 +335,11 @@ lws_buflist_destroy_segment(struct lws_buflist **head)
 
 	assert(*head);
 	*head = old->next;
+	if (*head)
+		/* the new head segment inherits the tail */
+		(*head)->tail = old->tail;
 	old->next = NULL;
-	lws_free(old);
+	lws_buflist_free(old);
 
 	return !*head; /* returns 1 if last segment just destroyed */
 }
@@ -249,7 +352,7 @@ lws_buflist_destroy_all_segments(struct lws_buflist **head)
 	while (p) {
 		p1 = p->next;
 		p->next = NULL;
-		lws_free(p);
+		lws_buflist_free(p);
 		p = p1;
 	}
 
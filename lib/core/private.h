@@ -240,6 +240,26 @@ void
 lws_mutex_refcount_unlock(struct lws_mutex_refcount *mr);
 #endif
 
+/*
+ * buflist segments allocated on behalf of a pt come from a small per-pt
+ * freelist per size class, so steady-state buffering doesn't hit malloc.
+ * Class n holds payloads up to (256 << (2 * n)) bytes, ie, 256, 1K, 4K, 16K.
+ * Segments larger than the biggest class are malloc'd and freed as before.
+ */
+
+#define LWS_BUFLIST_POOL_CLASSES 4
+#define lws_buflist_class_size(_c) ((size_t)256 << (2 * (_c)))
+#if defined(LWS_WITH_ESP32)
+#define LWS_BUFLIST_POOL_MAX_FREE 4
+#else
+#define LWS_BUFLIST_POOL_MAX_FREE 32
+#endif
+
+struct lws_buflist_pool {
+	struct lws_buflist *free[LWS_BUFLIST_POOL_CLASSES];
+	uint16_t count_free[LWS_BUFLIST_POOL_CLASSES];
+};
+
 #if defined(LWS_WITH_NETWORK)
 #include "core-net/private.h"
 #endif
@@ -284,7 +304,11 @@ struct lws_context {
 	struct lws_vhost *vhost_list;
 	struct lws_vhost *no_listener_vhost_list;
 	struct lws_vhost *vhost_pending_destruction_list;
+	struct lws_vhost_index *vhost_index; /* NULL until needed / stale */
 	struct lws_plugin *plugin_list;
+#if defined(LWS_WITH_ASYNC_DNS)
+	struct lws_context_async_dns async_dns;
+#endif
 #ifdef _WIN32
 /* different implementation between unix and windows */
 	struct lws_fd_hashtable fd_hashtable[FD_HASHTABLE_MODULUS];
@@ -345,9 +369,8 @@ struct lws_context {
 #endif
 
 #if defined(LWS_WITH_STATS)
-	uint64_t lws_stats[LWSSTATS_SIZE];
 	uint64_t last_dump;
-	int updated;
+	int updated; /* the per-pt stats have their own flag */
 #endif
 #if defined(LWS_WITH_ESP32)
 	unsigned long time_last_state_dump;
@@ -388,6 +411,7 @@ struct lws_context {
 	unsigned int doing_protocol_init:1;
 	unsigned int done_protocol_destroy_cb:1;
 	unsigned int finalize_destroy_after_internal_loops_stopped:1;
+	unsigned int listen_accept_own_pt:1;
 
 	short count_threads;
 	short plugin_protocol_count;
@@ -423,13 +447,24 @@ signed char char_to_hex(const char c);
 
 struct lws_buflist {
 	struct lws_buflist *next;
+	struct lws_buflist *tail; /* only valid in the head segment */
+	struct lws_buflist_pool *pool; /* NULL if not from a pool */
 
 	size_t len;
 	size_t pos;
 
+	uint8_t size_class;
+
 	uint8_t buf[1]; /* true length of this is set by the oversize malloc */
 };
 
+int
+_lws_buflist_append_segment(struct lws_buflist_pool *pool,
+			    struct lws_buflist **head, const uint8_t *buf,
+			    size_t len);
+void
+lws_buflist_pool_destroy(struct lws_buflist_pool *pool);
+
 
 LWS_EXTERN char *
 lws_strdup(const char *s);
@@ -524,8 +559,6 @@ lws_vhost_unlock(struct lws_vhost *vhost)
 #define lws_context_unlock(_a) (void)(_a)
 #define lws_vhost_lock(_a) (void)(_a)
 #define lws_vhost_unlock(_a) (void)(_a)
-#define lws_pt_stats_lock(_a) (void)(_a)
-#define lws_pt_stats_unlock(_a) (void)(_a)
 #endif
 
 LWS_EXTERN int LWS_WARN_UNUSED_RESULT
@@ -556,6 +589,16 @@ lws_vhost_protocol_options(struct lws_vhost *vh, const char *name);
 const struct lws_http_mount *
 lws_find_mount(struct lws *wsi, const char *uri_ptr, int uri_len);
 
+int
+lws_mount_trie_build(struct lws_vhost *vh);
+
+int
+lws_mimetype_index_build(struct lws_vhost *vh);
+
+const char *
+lws_vhost_get_mimetype(struct lws_vhost *vh, const char *file,
+		       const struct lws_http_mount *m);
+
 /*
  * custom allocator
  */
@@ -0,0 +1,232 @@
+/*
+ * libwebsockets - small server side websockets and web server implementation
+ *
+ * Copyright (C) 2010-2018 Andy Green <andy@warmcat.com>
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation:
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ *
+ * The epoll event lib is not a foreign loop: it reuses the default lws
+ * service loop in the unix plat code, and the pt->fds[] table is maintained
+ * exactly as for poll().  The difference is the fd set lives in the kernel,
+ * so the wait and the walk of results afterwards only costs in proportion to
+ * the number of fds that are actually ready, not the number connected.
+ */
+
+#include "core/private.h"
+
+static int
+elops_init_pt_epoll(struct lws_context *context, void *_loop, int tsi)
+{
+	struct lws_context_per_thread *pt = &context->pt[tsi];
+
+	pt->epoll.fd = epoll_create1(EPOLL_CLOEXEC);
+	if (pt->epoll.fd < 0) {
+		lwsl_err("%s: epoll_create1 failed: errno %d\n", __func__,
+			 LWS_ERRNO);
+
+		return -1;
+	}
+
+	pt->epoll.events = lws_malloc(sizeof(struct epoll_event) *
+				      LWS_EPOLL_MAX_EVENTS, "epoll events");
+	if (!pt->epoll.events) {
+		close(pt->epoll.fd);
+		pt->epoll.fd = -1;
+
+		return -1;
+	}
+
+	pt->epoll.count_ready = 0;
+
+	return 0;
+}
+
+static void
+elops_destroy_pt_epoll(struct lws_context *context, int tsi)
+{
+	struct lws_context_per_thread *pt = &context->pt[tsi];
+
+	if (pt->epoll.fd >= 0)
+		close(pt->epoll.fd);
+	pt->epoll.fd = -1;
+
+	lws_free_set_NULL(pt->epoll.events);
+}
+
+/*
+ * Called by the generic code whenever the pollfd events for the wsi change,
+ * after pt->fds[] was updated; we just mirror the result into the kernel.
+ *
+ * A STOP for both READ and WRITE means the wsi is leaving the fds table.
+ */
+
+static void
+elops_io_epoll(struct lws *wsi, int flags)
+{
+	struct lws_context_per_thread *pt = &wsi->context->pt[(int)wsi->tsi];
+	struct epoll_event ev;
+	int op, events, bits;
+
+	if (pt->epoll.fd < 0)
+		return;
+
+	if ((flags & LWS_EV_PREPARE_DELETION) ||
+	    ((flags & LWS_EV_STOP) &&
+	     (flags & (LWS_EV_READ | LWS_EV_WRITE)) ==
+				(LWS_EV_READ | LWS_EV_WRITE))) {
+		if (!wsi->epoll_added)
+			return;
+
+		wsi->epoll_added = 0;
+		if (epoll_ctl(pt->epoll.fd, EPOLL_CTL_DEL, wsi->desc.sockfd,
+			      NULL) < 0 && LWS_ERRNO != ENOENT &&
+			      LWS_ERRNO != EBADF)
+			lwsl_info("%s: EPOLL_CTL_DEL fd %d: errno %d\n",
+				  __func__, wsi->desc.sockfd, LWS_ERRNO);
+		return;
+	}
+
+	if (wsi->position_in_fds_table == LWS_NO_FDS_POS)
+		return;
+
+	events = pt->fds[wsi->position_in_fds_table].events;
+	bits = (!!(events & LWS_POLLIN)) | ((!!(events & LWS_POLLOUT)) << 1);
+
+	/* the kernel already has what we want, eg, repeated POLLOUT req */
+	if (wsi->epoll_added && wsi->epoll_events == bits)
+		return;
+
+	memset(&ev, 0, sizeof(ev));
+	if (bits & 1)
+		ev.events |= EPOLLIN;
+	if (bits & 2)
+		ev.events |= EPOLLOUT;
+	ev.data.fd = wsi->desc.sockfd;
+
+	op = wsi->epoll_added ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+
+	if (epoll_ctl(pt->epoll.fd, op, wsi->desc.sockfd, &ev) < 0) {
+		/*
+		 * EPERM means it's something like a regular file that epoll
+		 * can't watch... poll() would always report it ready, and
+		 * we can't emulate that here.
+		 */
+		lwsl_err("%s: epoll_ctl %d fd %d failed: errno %d\n", __func__,
+			 op, wsi->desc.sockfd, LWS_ERRNO);
+		return;
+	}
+
+	wsi->epoll_added = 1;
+	wsi->epoll_events = bits;
+}
+
+/*
+ * Called from the default service loop in place of poll().  The kernel tells
+ * us which fds are ready, we transcribe that into the revents of the matching
+ * pt->fds[] entry so the generic forced-service path still sees it.
+ */
+
+static int
+lws_epoll_wait(struct lws_context_per_thread *pt, int timeout_ms)
+{
+	struct lws_pollfd *pfd;
+	struct lws *wsi;
+	int n, m;
+
+	pt->epoll.count_ready = 0;
+
+	n = epoll_wait(pt->epoll.fd, pt->epoll.events, LWS_EPOLL_MAX_EVENTS,
+		       timeout_ms);
+	if (n <= 0)
+		return n;
+
+	pt->epoll.count_ready = n;
+
+	for (m = 0; m < n; m++) {
+		wsi = wsi_from_fd(pt->context, pt->epoll.events[m].data.fd);
+		if (!wsi || wsi->position_in_fds_table == LWS_NO_FDS_POS)
+			continue;
+
+		pfd = &pt->fds[wsi->position_in_fds_table];
+
+		if (pt->epoll.events[m].events & EPOLLIN)
+			pfd->revents |= LWS_POLLIN;
+		if (pt->epoll.events[m].events & EPOLLOUT)
+			pfd->revents |= LWS_POLLOUT;
+		if (pt->epoll.events[m].events & EPOLLHUP)
+			pfd->revents |= LWS_POLLHUP;
+		if (pt->epoll.events[m].events & EPOLLERR)
+			pfd->revents |= LWS_POLLHUP;
+	}
+
+	return n;
+}
+
+/*
+ * Service just the fds reported by the last lws_epoll_wait().  Since we look
+ * up each one by fd, wsi closing and the pt->fds[] compaction that goes with
+ * it doesn't disturb the rest of the walk.
+ */
+
+static int
+lws_epoll_service_ready(struct lws_context_per_thread *pt)
+{
+	struct lws_pollfd *pfd;
+	struct lws *wsi;
+	int n, m;
+
+	for (n = 0; n < pt->epoll.count_ready; n++) {
+		wsi = wsi_from_fd(pt->context, pt->epoll.events[n].data.fd);
+		if (!wsi || wsi->position_in_fds_table == LWS_NO_FDS_POS)
+			continue;
+
+		pfd = &pt->fds[wsi->position_in_fds_table];
+		if (!pfd->revents)
+			continue;
+
+		m = lws_service_fd_tsi(pt->context, pfd, pt->tid);
+		if (m < 0) {
+			lwsl_err("%s: lws_service_fd_tsi returned %d\n",
+				 __func__, m);
+			return -1;
+		}
+	}
+
+	pt->epoll.count_ready = 0;
+
+	return 0;
+}
+
+struct lws_event_loop_ops event_loop_ops_epoll = {
+	/* name */			"epoll",
+	/* init_context */		NULL,
+	/* destroy_context1 */		NULL,
+	/* destroy_context2 */		NULL,
+	/* init_vhost_listen_wsi */	NULL,
+	/* init_pt */			elops_init_pt_epoll,
+	/* wsi_logical_close */		NULL,
+	/* check_client_connect_ok */	NULL,
+	/* close_handle_manually */	NULL,
+	/* accept */			NULL,
+	/* io */			elops_io_epoll,
+	/* run */			NULL,
+	/* destroy_pt */		elops_destroy_pt_epoll,
+	/* destroy wsi */		NULL,
+	/* wait_pt */			lws_epoll_wait,
+	/* service_ready */		lws_epoll_service_ready,
+
+	/* periodic_events_available */	1,
+};
@@ -0,0 +1,39 @@
+/*
+ * libwebsockets - small server side websockets and web server implementation
+ *
+ * Copyright (C) 2010 - 2018 Andy Green <andy@warmcat.com>
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation:
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ *
+ *  This is included from core/private.h if LWS_WITH_EPOLL
+ */
+
+#include <sys/epoll.h>
+
+/*
+ * Max number of ready events collected by one epoll_wait().  If more fds are
+ * ready than this, the remainder are reported on the next wait since we use
+ * level-triggered mode.
+ */
+#define LWS_EPOLL_MAX_EVENTS 256
+
+struct lws_pt_eventlibs_epoll {
+	struct epoll_event *events;
+	int fd;
+	int count_ready;
+};
+
+extern struct lws_event_loop_ops event_loop_ops_epoll;
@@ -0,0 +1,511 @@
+/*
+ * libwebsockets - small server side websockets and web server implementation
+ *
+ * Copyright (C) 2010-2018 Andy Green <andy@warmcat.com>
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation:
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ *
+ * Like epoll, this isn't a foreign loop, it plugs into the default service
+ * loop in the unix plat code and keeps pt->fds[] up to date as for poll().
+ *
+ * Interest in fds is expressed as one-shot IORING_OP_POLL_ADD sqes.  All the
+ * arming, rearming and cancelling that results from a service pass, eg, the
+ * POLLOUT requests from lws_callback_on_writable(), just queue sqes, which
+ * are then submitted in a batch by the same io_uring_enter() syscall that
+ * waits for the next completions.  So unlike poll() the wait costs nothing
+ * for idle fds, and unlike epoll there's no syscall per interest change.
+ *
+ * Only readiness comes through the ring.  When an fd is reported ready, the
+ * usual service code does its own recv() / send() / accept() on it as for
+ * poll(), there are no IORING_OP_RECV / SEND / ACCEPT sqes and no registered
+ * buffers.
+ *
+ * We talk to the kernel directly without liburing, and if the kernel is too
+ * old or io_uring is blocked, we quietly fall back to the poll() event loop.
+ */
+
+#include "core/private.h"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+/* user_data for sqes whose completion we don't care about */
+#define LWS_URING_UD_IGNORE ((uint64_t)0xffffffff)
+
+static int
+lws_uring_setup(unsigned int entries, struct io_uring_params *p)
+{
+	return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int
+lws_uring_enter(struct lws_context_per_thread *pt, unsigned int to_submit,
+		unsigned int min_complete, unsigned int flags, void *arg,
+		size_t argsz)
+{
+	return (int)syscall(__NR_io_uring_enter, pt->io_uring.fd, to_submit,
+			    min_complete, flags, arg, argsz);
+}
+
+static unsigned int
+lws_uring_sq_pending(struct lws_context_per_thread *pt)
+{
+	return *pt->io_uring.sq_tail -
+		__atomic_load_n(pt->io_uring.sq_head, __ATOMIC_ACQUIRE);
+}
+
+static struct io_uring_sqe *
+lws_uring_get_sqe(struct lws_context_per_thread *pt)
+{
+	struct io_uring_sqe *sqe;
+	unsigned int idx;
+
+	if (lws_uring_sq_pending(pt) >= pt->io_uring.sq_entries) {
+		/* SQ is full, we have to submit what we have so far */
+		if (lws_uring_enter(pt, lws_uring_sq_pending(pt), 0, 0,
+				    NULL, 0) < 0 ||
+		    lws_uring_sq_pending(pt) >= pt->io_uring.sq_entries) {
+			lwsl_err("%s: unable to flush SQ\n", __func__);
+
+			return NULL;
+		}
+	}
+
+	idx = *pt->io_uring.sq_tail & *pt->io_uring.sq_mask;
+	sqe = &pt->io_uring.sqes[idx];
+	memset(sqe, 0, sizeof(*sqe));
+	pt->io_uring.sq_array[idx] = idx;
+
+	return sqe;
+}
+
+static void
+lws_uring_commit_sqe(struct lws_context_per_thread *pt)
+{
+	__atomic_store_n(pt->io_uring.sq_tail, *pt->io_uring.sq_tail + 1,
+			 __ATOMIC_RELEASE);
+}
+
+/*
+ * The user_data for a poll sqe carries the fd and a per-wsi generation, so
+ * completions from polls we since cancelled, or that belonged to an earlier
+ * wsi on the same fd, can be recognized as stale
+ */
+
+static void
+lws_uring_arm(struct lws_context_per_thread *pt, struct lws *wsi, int events)
+{
+	struct io_uring_sqe *sqe;
+	uint32_t pe = 0;
+
+	if (events & LWS_POLLIN)
+		pe |= POLLIN;
+	if (events & LWS_POLLOUT)
+		pe |= POLLOUT;
+
+	sqe = lws_uring_get_sqe(pt);
+	if (!sqe)
+		return;
+
+	wsi->uring_gen++;
+
+	sqe->opcode = IORING_OP_POLL_ADD;
+	sqe->fd = wsi->desc.sockfd;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	pe = (pe << 16) | (pe >> 16);
+#endif
+	sqe->poll32_events = pe;
+	sqe->user_data = ((uint64_t)wsi->uring_gen << 32) |
+			 (uint32_t)wsi->desc.sockfd;
+	lws_uring_commit_sqe(pt);
+
+	wsi->uring_armed = events;
+}
+
+static void
+lws_uring_disarm(struct lws_context_per_thread *pt, struct lws *wsi)
+{
+	struct io_uring_sqe *sqe;
+
+	if (!wsi->uring_armed)
+		return;
+
+	sqe = lws_uring_get_sqe(pt);
+	if (!sqe)
+		return;
+
+	sqe->opcode = IORING_OP_POLL_REMOVE;
+	sqe->fd = -1;
+	sqe->addr = ((uint64_t)wsi->uring_gen << 32) |
+		    (uint32_t)wsi->desc.sockfd;
+	sqe->user_data = LWS_URING_UD_IGNORE;
+	lws_uring_commit_sqe(pt);
+
+	/* anything that completes from the old poll is now stale */
+	wsi->uring_gen++;
+	wsi->uring_armed = 0;
+}
+
+static void
+lws_uring_unmap(struct lws_context_per_thread *pt)
+{
+	if (pt->io_uring.sqes)
+		munmap(pt->io_uring.sqes, pt->io_uring.sqes_len);
+	if (pt->io_uring.cq_ring &&
+	    pt->io_uring.cq_ring != pt->io_uring.sq_ring)
+		munmap(pt->io_uring.cq_ring, pt->io_uring.cq_ring_len);
+	if (pt->io_uring.sq_ring)
+		munmap(pt->io_uring.sq_ring, pt->io_uring.sq_ring_len);
+
+	pt->io_uring.sqes = NULL;
+	pt->io_uring.sq_ring = NULL;
+	pt->io_uring.cq_ring = NULL;
+}
+
+static int
+elops_init_context_io_uring(struct lws_context *context,
+			    const struct lws_context_creation_info *info)
+{
+	struct io_uring_params p;
+	int fd;
+
+	/*
+	 * Confirm the kernel supports what we need before we commit to it,
+	 * otherwise switch the context over to the default poll() loop
+	 */
+
+	memset(&p, 0, sizeof(p));
+	fd = lws_uring_setup(8, &p);
+	if (fd >= 0) {
+		close(fd);
+		if ((p.features & IORING_FEAT_EXT_ARG) &&
+		    (p.features & IORING_FEAT_NODROP))
+			return 0;
+
+		lwsl_notice("%s: io_uring lacks EXT_ARG / NODROP\n", __func__);
+	} else
+		lwsl_notice("%s: io_uring unavailable, errno %d\n", __func__,
+			    LWS_ERRNO);
+
+#if defined(LWS_WITH_POLL)
+	lwsl_notice("%s: falling back to poll event loop\n", __func__);
+	context->event_loop_ops = &event_loop_ops_poll;
+
+	return 0;
+#else
+	return 1;
+#endif
+}
+
+static int
+elops_init_pt_io_uring(struct lws_context *context, void *_loop, int tsi)
+{
+	struct lws_context_per_thread *pt = &context->pt[tsi];
+	struct io_uring_params p;
+	char *sq, *cq;
+
+	memset(&p, 0, sizeof(p));
+	pt->io_uring.fd = lws_uring_setup(LWS_IO_URING_ENTRIES, &p);
+	if (pt->io_uring.fd < 0) {
+		lwsl_err("%s: io_uring_setup failed: errno %d\n", __func__,
+			 LWS_ERRNO);
+
+		return -1;
+	}
+
+	pt->io_uring.sq_ring_len = p.sq_off.array +
+				   (p.sq_entries * sizeof(unsigned int));
+	pt->io_uring.cq_ring_len = p.cq_off.cqes +
+				   (p.cq_entries * sizeof(struct io_uring_cqe));
+
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		if (pt->io_uring.cq_ring_len > pt->io_uring.sq_ring_len)
+			pt->io_uring.sq_ring_len = pt->io_uring.cq_ring_len;
+		pt->io_uring.cq_ring_len = pt->io_uring.sq_ring_len;
+	}
+
+	pt->io_uring.sq_ring = mmap(NULL, pt->io_uring.sq_ring_len,
+				    PROT_READ | PROT_WRITE,
+				    MAP_SHARED | MAP_POPULATE, pt->io_uring.fd,
+				    IORING_OFF_SQ_RING);
+	if (pt->io_uring.sq_ring == MAP_FAILED) {
+		pt->io_uring.sq_ring = NULL;
+		goto bail;
+	}
+
+	if (p.features & IORING_FEAT_SINGLE_MMAP)
+		pt->io_uring.cq_ring = pt->io_uring.sq_ring;
+	else {
+		pt->io_uring.cq_ring = mmap(NULL, pt->io_uring.cq_ring_len,
+					    PROT_READ | PROT_WRITE,
+					    MAP_SHARED | MAP_POPULATE,
+					    pt->io_uring.fd,
+					    IORING_OFF_CQ_RING);
+		if (pt->io_uring.cq_ring == MAP_FAILED) {
+			pt->io_uring.cq_ring = NULL;
+			goto bail;
+		}
+	}
+
+	pt->io_uring.sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+	pt->io_uring.sqes = mmap(NULL, pt->io_uring.sqes_len,
+				 PROT_READ | PROT_WRITE,
+				 MAP_SHARED | MAP_POPULATE, pt->io_uring.fd,
+				 IORING_OFF_SQES);
+	if (pt->io_uring.sqes == MAP_FAILED) {
+		pt->io_uring.sqes = NULL;
+		goto bail;
+	}
+
+	sq = (char *)pt->io_uring.sq_ring;
+	cq = (char *)pt->io_uring.cq_ring;
+
+	pt->io_uring.sq_head = (unsigned int *)(sq + p.sq_off.head);
+	pt->io_uring.sq_tail = (unsigned int *)(sq + p.sq_off.tail);
+	pt->io_uring.sq_mask = (unsigned int *)(sq + p.sq_off.ring_mask);
+	pt->io_uring.sq_array = (unsigned int *)(sq + p.sq_off.array);
+	pt->io_uring.sq_entries = p.sq_entries;
+
+	pt->io_uring.cq_head = (unsigned int *)(cq + p.cq_off.head);
+	pt->io_uring.cq_tail = (unsigned int *)(cq + p.cq_off.tail);
+	pt->io_uring.cq_mask = (unsigned int *)(cq + p.cq_off.ring_mask);
+	pt->io_uring.cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+
+	pt->io_uring.ready = lws_malloc(sizeof(int) * LWS_IO_URING_MAX_READY,
+					"io_uring ready");
+	if (!pt->io_uring.ready)
+		goto bail;
+
+	pt->io_uring.count_ready = 0;
+
+	return 0;
+
+bail:
+	lwsl_err("%s: io_uring ring setup failed\n", __func__);
+	lws_uring_unmap(pt);
+	close(pt->io_uring.fd);
+	pt->io_uring.fd = -1;
+
+	return -1;
+}
+
+static void
+elops_destroy_pt_io_uring(struct lws_context *context, int tsi)
+{
+	struct lws_context_per_thread *pt = &context->pt[tsi];
+
+	lws_uring_unmap(pt);
+	if (pt->io_uring.fd >= 0)
+		close(pt->io_uring.fd);
+	pt->io_uring.fd = -1;
+
+	lws_free_set_NULL(pt->io_uring.ready);
+}
+
+/*
+ * Called by the generic code whenever the pollfd events for the wsi change,
+ * after pt->fds[] was updated.  Nothing is sent to the kernel here, the sqes
+ * are submitted with the next wait.
+ */
+
+static void
+elops_io_io_uring(struct lws *wsi, int flags)
+{
+	struct lws_context_per_thread *pt = &wsi->context->pt[(int)wsi->tsi];
+	int events;
+
+	if (pt->io_uring.fd < 0)
+		return;
+
+	if ((flags & LWS_EV_PREPARE_DELETION) ||
+	    ((flags & LWS_EV_STOP) &&
+	     (flags & (LWS_EV_READ | LWS_EV_WRITE)) ==
+				(LWS_EV_READ | LWS_EV_WRITE))) {
+		/*
+		 * The kernel holds a ref on the file while the poll is armed,
+		 * the remove is what lets the socket actually close
+		 */
+		lws_uring_disarm(pt, wsi);
+
+		return;
+	}
+
+	if (wsi->position_in_fds_table == LWS_NO_FDS_POS)
+		return;
+
+	events = pt->fds[wsi->position_in_fds_table].events &
+						(LWS_POLLIN | LWS_POLLOUT);
+	if (events == wsi->uring_armed)
+		return;
+
+	/*
+	 * Even if we just want fewer events, we must replace the armed poll,
+	 * otherwise eg, a leftover POLLOUT would complete immediately each time
+	 */
+	lws_uring_disarm(pt, wsi);
+	if (events)
+		lws_uring_arm(pt, wsi, events);
+}
+
+/*
+ * Called from the default service loop in place of poll().  First we rearm
+ * the one-shot polls that completed last time, then one io_uring_enter()
+ * submits everything queued since the last wait and waits for completions.
+ */
+
+static int
+lws_io_uring_wait(struct lws_context_per_thread *pt, int timeout_ms)
+{
+	struct io_uring_getevents_arg arg;
+	struct __kernel_timespec ts;
+	unsigned int head, tail, flags = 0, min_complete = 0;
+	struct io_uring_cqe *cqe;
+	struct lws_pollfd *pfd;
+	struct lws *wsi;
+	uint32_t gen;
+	int n, fd;
+
+	for (n = 0; n < pt->io_uring.count_ready; n++) {
+		wsi = wsi_from_fd(pt->context, pt->io_uring.ready[n]);
+		if (!wsi || wsi->position_in_fds_table == LWS_NO_FDS_POS ||
+		    wsi->uring_armed)
+			continue;
+
+		pfd = &pt->fds[wsi->position_in_fds_table];
+		if (pfd->events & (LWS_POLLIN | LWS_POLLOUT))
+			lws_uring_arm(pt, wsi, pfd->events &
+					       (LWS_POLLIN | LWS_POLLOUT));
+	}
+	pt->io_uring.count_ready = 0;
+
+	memset(&arg, 0, sizeof(arg));
+
+	/* don't block if completions are already waiting for us */
+
+	if (timeout_ms &&
+	    *pt->io_uring.cq_head ==
+		    __atomic_load_n(pt->io_uring.cq_tail, __ATOMIC_ACQUIRE)) {
+		ts.tv_sec = timeout_ms / 1000;
+		ts.tv_nsec = (timeout_ms % 1000) * 1000000ll;
+		arg.ts = (uint64_t)(lws_intptr_t)&ts;
+		flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+		min_complete = 1;
+	}
+
+	if (flags || lws_uring_sq_pending(pt)) {
+		n = lws_uring_enter(pt, lws_uring_sq_pending(pt), min_complete,
+				    flags, flags ? &arg : NULL,
+				    flags ? sizeof(arg) : 0);
+		if (n < 0 && LWS_ERRNO != ETIME && LWS_ERRNO != EINTR &&
+		    LWS_ERRNO != EBUSY && LWS_ERRNO != EAGAIN)
+			return -1;
+	}
+
+	/* reap the completions into pt->fds[].revents */
+
+	head = *pt->io_uring.cq_head;
+	tail = __atomic_load_n(pt->io_uring.cq_tail, __ATOMIC_ACQUIRE);
+
+	while (head != tail &&
+	       pt->io_uring.count_ready < LWS_IO_URING_MAX_READY) {
+		cqe = &pt->io_uring.cqes[head & *pt->io_uring.cq_mask];
+		head++;
+
+		if (cqe->user_data == LWS_URING_UD_IGNORE)
+			continue;
+
+		fd = (int)(uint32_t)cqe->user_data;
+		gen = (uint32_t)(cqe->user_data >> 32);
+
+		wsi = wsi_from_fd(pt->context, fd);
+		if (!wsi || wsi->uring_gen != gen ||
+		    wsi->position_in_fds_table == LWS_NO_FDS_POS)
+			continue; /* stale */
+
+		/* the one-shot poll is used up either way */
+		wsi->uring_armed = 0;
+		pt->io_uring.ready[pt->io_uring.count_ready++] = fd;
+
+		pfd = &pt->fds[wsi->position_in_fds_table];
+
+		if (cqe->res < 0) {
+			/* our own cancels are stale by gen, this is real */
+			pfd->revents |= LWS_POLLHUP;
+			continue;
+		}
+
+		if (cqe->res & POLLIN)
+			pfd->revents |= LWS_POLLIN;
+		if (cqe->res & POLLOUT)
+			pfd->revents |= LWS_POLLOUT;
+		if (cqe->res & (POLLHUP | POLLERR))
+			pfd->revents |= LWS_POLLHUP;
+	}
+
+	__atomic_store_n(pt->io_uring.cq_head, head, __ATOMIC_RELEASE);
+
+	return pt->io_uring.count_ready;
+}
+
+static int
+lws_io_uring_service_ready(struct lws_context_per_thread *pt)
+{
+	struct lws_pollfd *pfd;
+	struct lws *wsi;
+	int n, m;
+
+	for (n = 0; n < pt->io_uring.count_ready; n++) {
+		wsi = wsi_from_fd(pt->context, pt->io_uring.ready[n]);
+		if (!wsi || wsi->position_in_fds_table == LWS_NO_FDS_POS)
+			continue;
+
+		pfd = &pt->fds[wsi->position_in_fds_table];
+		if (!pfd->revents)
+			continue;
+
+		m = lws_service_fd_tsi(pt->context, pfd, pt->tid);
+		if (m < 0) {
+			lwsl_err("%s: lws_service_fd_tsi returned %d\n",
+				 __func__, m);
+			return -1;
+		}
+	}
+
+	/* leave ready[] alone, it's needed to rearm at the next wait */
+
+	return 0;
+}
+
+struct lws_event_loop_ops event_loop_ops_io_uring = {
+	/* name */			"io_uring",
+	/* init_context */		elops_init_context_io_uring,
+	/* destroy_context1 */		NULL,
+	/* destroy_context2 */		NULL,
+	/* init_vhost_listen_wsi */	NULL,
+	/* init_pt */			elops_init_pt_io_uring,
+	/* wsi_logical_close */		NULL,
+	/* check_client_connect_ok */	NULL,
+	/* close_handle_manually */	NULL,
+	/* accept */			NULL,
+	/* io */			elops_io_io_uring,
+	/* run */			NULL,
+	/* destroy_pt */		elops_destroy_pt_io_uring,
+	/* destroy wsi */		NULL,
+	/* wait_pt */			lws_io_uring_wait,
+	/* service_ready */		lws_io_uring_service_ready,
+
+	/* periodic_events_available */	1,
+};
@@ -0,0 +1,57 @@
+/*
+ * libwebsockets - small server side websockets and web server implementation
+ *
+ * Copyright (C) 2010 - 2018 Andy Green <andy@warmcat.com>
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation:
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ *
+ *  This is included from core/private.h if LWS_WITH_IO_URING
+ */
+
+#include <linux/io_uring.h>
+
+/* SQ ring size, the CQ ring is created twice this by the kernel */
+#define LWS_IO_URING_ENTRIES 1024
+/* max completions we take from the CQ for one service pass */
+#define LWS_IO_URING_MAX_READY 256
+
+struct lws_pt_eventlibs_io_uring {
+	/* mmap'd from the kernel */
+	void *sq_ring;
+	void *cq_ring;
+	struct io_uring_sqe *sqes;
+	size_t sq_ring_len;
+	size_t cq_ring_len;
+	size_t sqes_len;
+
+	unsigned int *sq_head;
+	unsigned int *sq_tail;
+	unsigned int *sq_mask;
+	unsigned int *sq_array;
+	unsigned int *cq_head;
+	unsigned int *cq_tail;
+	unsigned int *cq_mask;
+	struct io_uring_cqe *cqes;
+	unsigned int sq_entries;
+
+	/* fds with completions from the last wait */
+	int *ready;
+	int count_ready;
+
+	int fd;
+};
+
+extern struct lws_event_loop_ops event_loop_ops_io_uring;
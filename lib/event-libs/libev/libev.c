@@ -375,6 +375,8 @@ struct lws_event_loop_ops event_loop_ops_ev = {
 	/* run_pt */			elops_run_pt_ev,
 	/* destroy_pt */		elops_destroy_pt_ev,
 	/* destroy wsi */		elops_destroy_wsi_ev,
+	/* wait_pt */			NULL,
+	/* service_ready */		NULL,
 
 	/* periodic_events_available */	0,
 };
@@ -409,6 +409,8 @@ struct lws_event_loop_ops event_loop_ops_event = {
 	/* run_pt */			elops_run_pt_event,
 	/* destroy_pt */		elops_destroy_pt_event,
 	/* destroy wsi */		elops_destroy_wsi_event,
+	/* wait_pt */			NULL,
+	/* service_ready */		NULL,
 
 	/* periodic_events_available */	0,
 };
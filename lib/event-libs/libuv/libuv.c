@@ -978,6 +978,8 @@ struct lws_event_loop_ops event_loop_ops_uv = {
 	/* run_pt */			elops_run_pt_uv,
 	/* destroy_pt */		elops_destroy_pt_uv,
 	/* destroy wsi */		NULL,
+	/* wait_pt */			NULL,
+	/* service_ready */		NULL,
 
 	/* periodic_events_available */	0,
 };
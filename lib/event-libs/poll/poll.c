@@ -38,6 +38,8 @@ struct lws_event_loop_ops event_loop_ops_poll = {
 	/* run */			NULL,
 	/* destroy_pt */		NULL,
 	/* destroy wsi */		NULL,
+	/* wait_pt */			NULL,
+	/* service_ready */		NULL,
 
 	/* periodic_events_available */	1,
 };
\ No newline at end of file
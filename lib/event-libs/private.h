@@ -21,6 +21,8 @@
  *  This is included from core/private.h
  */
 
+struct lws_context_per_thread;
+
 struct lws_event_loop_ops {
 	const char *name;
 	/* event loop-specific context init during context creation */
@@ -50,6 +52,10 @@ struct lws_event_loop_ops {
 	void (*destroy_pt)(struct lws_context *context, int tsi);
 	/* called just before wsi is freed  */
 	void (*destroy_wsi)(struct lws *wsi);
+	/* replace poll() wait in default service loop, return count ready */
+	int (*wait_pt)(struct lws_context_per_thread *pt, int timeout_ms);
+	/* service just the fds reported ready by wait_pt */
+	int (*service_ready)(struct lws_context_per_thread *pt);
 
 	unsigned int periodic_events_available:1;
 };
@@ -72,3 +78,10 @@ struct lws_event_loop_ops {
 #include "event-libs/libev/private.h"
 #endif
 
+#if defined(LWS_WITH_EPOLL)
+#include "event-libs/epoll/private.h"
+#endif
+
+#if defined(LWS_WITH_IO_URING)
+#include "event-libs/io_uring/private.h"
+#endif
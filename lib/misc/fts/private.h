@@ -6,6 +6,7 @@ typedef uint32_t jg2_file_offset;
 
 struct lws_fts_file {
 	int fd;
+	unsigned char *map; /* whole index mapped read-only, or NULL */
 	jg2_file_offset root, flen, filepath_table;
 	int max_direct_hits;
 	int max_completion_hits;
@@ -19,5 +20,18 @@ struct lws_fts_file {
 
 #define LWS_FTS_LINES_PER_CHUNK 200
 
+/* enough to cover the root trie entry and its child table */
+#define LWS_FTS_ROOT_WILLNEED 8192
+
+extern const char lws_fts_classify[];
+
 int
 rq32(unsigned char *b, uint32_t *d);
+
+int
+lws_fts_filepath(struct lws_fts_file *jtf, int filepath_index, char *result,
+		 size_t len, uint32_t *ofs_linetable, uint32_t *lines);
+
+unsigned char *
+lws_fts_file_peek(struct lws_fts_file *jtf, jg2_file_offset ofs,
+		  unsigned char *buf, size_t len);
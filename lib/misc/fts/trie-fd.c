@@ -28,9 +28,17 @@
 #include <fcntl.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#if defined(LWS_HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#endif
 
 #define AC_COUNT_STASHED_CHILDREN 8
 
+/* the flags that make the needle a list of terms */
+#define LWSFTS_F_QUERY_TERMS (LWSFTS_F_QUERY_ALL_TERMS | \
+			      LWSFTS_F_QUERY_ANY_TERM | \
+			      LWSFTS_F_QUERY_PHRASE)
+
 struct ch {
 	jg2_file_offset ofs;
 	char name[64];
@@ -78,11 +86,11 @@ b16(unsigned char *b)
 	return (b[0] << 8) | b[1];
 }
 
-static int
+int
 lws_fts_filepath(struct lws_fts_file *jtf, int filepath_index, char *result,
 		 size_t len, uint32_t *ofs_linetable, uint32_t *lines)
 {
-	unsigned char buf[256 + 15];
+	unsigned char fdbuf[256 + 15], *buf = fdbuf;
 	uint32_t flen;
 	int ra, bp = 0;
 	size_t m;
@@ -91,6 +99,19 @@ lws_fts_filepath(struct lws_fts_file *jtf, int filepath_index, char *result,
 	if (filepath_index > jtf->filepaths)
 		return 1;
 
+	if (jtf->map) {
+		if ((size_t)jtf->filepath_table +
+				(4 * (size_t)filepath_index) + 4 > jtf->flen)
+			return 1;
+		o = (unsigned int)b32(jtf->map + jtf->filepath_table +
+				      (4 * filepath_index));
+		if (o + 3 * MAX_VLI >= jtf->flen)
+			return 1;
+
+		buf = jtf->map + o;
+		goto parse;
+	}
+
 	if (lseek(jtf->fd, jtf->filepath_table + (4 * filepath_index),
 			SEEK_SET) < 0) {
 		lwsl_err("%s: unable to seek\n", __func__);
@@ -109,10 +130,11 @@ lws_fts_filepath(struct lws_fts_file *jtf, int filepath_index, char *result,
 		return 1;
 	}
 
-	ra = read(jtf->fd, buf, sizeof(buf));
+	ra = read(jtf->fd, fdbuf, sizeof(fdbuf));
 	if (ra < 0)
 		return 1;
 
+parse:
 	if (ofs_linetable)
 		bp += rq32(&buf[bp], ofs_linetable);
 	else
@@ -125,7 +147,15 @@ lws_fts_filepath(struct lws_fts_file *jtf, int filepath_index, char *result,
 
 	m = flen;
 	if (len - 1 < m)
-		m = flen - 1;
+		m = len - 1;
+
+	/* a truncated or corrupt index mustn't take us past the mapping */
+	if (jtf->map) {
+		if (o + bp >= (off_t)jtf->flen)
+			return 1;
+		if (m > (size_t)(jtf->flen - (o + bp)))
+			m = (size_t)(jtf->flen - (o + bp));
+	}
 
 	strncpy(result, (char *)&buf[bp], m);
 	result[m] = '\0';
@@ -134,6 +164,44 @@ lws_fts_filepath(struct lws_fts_file *jtf, int filepath_index, char *result,
 	return 0;
 }
 
+/*
+ * Returns a pointer to len bytes of the index starting at ofs, either in place
+ * in the mapping or read into buf.  Anything past the end of the file reads as
+ * zeros.  Returns NULL if ofs itself is past the end of the file.
+ */
+
+unsigned char *
+lws_fts_file_peek(struct lws_fts_file *jtf, jg2_file_offset ofs,
+		  unsigned char *buf, size_t len)
+{
+	int ra = 0;
+
+	if (ofs >= jtf->flen)
+		return NULL;
+
+	if (jtf->map) {
+		if (ofs + len <= jtf->flen)
+			return jtf->map + ofs;
+
+		ra = jtf->flen - ofs;
+		memcpy(buf, jtf->map + ofs, ra);
+	} else {
+		if (lseek(jtf->fd, ofs, SEEK_SET) < 0) {
+			lwsl_err("%s: unable to seek\n", __func__);
+
+			return NULL;
+		}
+
+		ra = read(jtf->fd, buf, len);
+		if (ra < 0)
+			return NULL;
+	}
+
+	memset(buf + ra, 0, len - ra);
+
+	return buf;
+}
+
 /*
  * returns -1 for fail or fd open on the trie file.
  *
@@ -193,6 +261,7 @@ lws_fts_open(const char *filepath)
 	if (!jtf)
 		goto bail1;
 
+	jtf->map = NULL;
 	jtf->fd = open(filepath, O_RDONLY);
 	if (jtf->fd < 0) {
 		lwsl_err("%s: unable to open %s\n", __func__, filepath);
@@ -202,6 +271,32 @@ lws_fts_open(const char *filepath)
 	if (lws_fts_adopt(jtf) < 0)
 		goto bail3;
 
+#if defined(LWS_HAVE_SYS_MMAN_H)
+	/*
+	 * Searches can then walk the index in place, rather than seeking and
+	 * reading it a trie node at a time.  If we can't map it, that's how we
+	 * will do it instead.
+	 */
+	jtf->map = mmap(NULL, jtf->flen, PROT_READ, MAP_SHARED, jtf->fd, 0);
+	if (jtf->map == MAP_FAILED) {
+		lwsl_info("%s: unable to mmap %s\n", __func__, filepath);
+		jtf->map = NULL;
+	} else {
+		size_t pg = getpagesize(), r = jtf->root & ~(pg - 1),
+		       e = jtf->root + LWS_FTS_ROOT_WILLNEED;
+
+		/*
+		 * Lookups hop all over the file, so readahead is mostly
+		 * wasted... except every search starts at the root entry and
+		 * its child table, so ask for just those pages to be read in
+		 */
+		if (e > jtf->flen)
+			e = jtf->flen;
+		madvise(jtf->map, jtf->flen, MADV_RANDOM);
+		madvise(jtf->map + r, e - r, MADV_WILLNEED);
+	}
+#endif
+
 	return jtf;
 
 bail3:
@@ -215,21 +310,40 @@ bail1:
 void
 lws_fts_close(struct lws_fts_file *jtf)
 {
+#if defined(LWS_HAVE_SYS_MMAN_H)
+	if (jtf->map)
+		munmap(jtf->map, jtf->flen);
+#endif
 	close(jtf->fd);
 	lws_free(jtf);
 }
 
+/*
+ * Points buf at the index content starting at _pos, with ra set to how much of
+ * it is valid.  If the index is mapped, that's everything to the end of the
+ * file without copying anything, otherwise it's up to _size bytes read into
+ * fdbuf.
+ */
+
 #define grab(_pos, _size) { \
 		bp = 0; \
-		if (lseek(jtf->fd, _pos, SEEK_SET) < 0) { \
-			lwsl_err("%s: unable to seek\n", __func__); \
+		if (jtf->map) { \
+			if ((jg2_file_offset)(_pos) >= jtf->flen) \
+				goto bail; \
+			buf = jtf->map + (_pos); \
+			ra = (int)(jtf->flen - (_pos)); \
+		} else { \
+			if (lseek(jtf->fd, _pos, SEEK_SET) < 0) { \
+				lwsl_err("%s: unable to seek\n", __func__); \
 \
-			goto bail; \
-		} \
+				goto bail; \
+			} \
 \
-		ra = read(jtf->fd, buf, _size); \
-		if (ra < 0) \
-			goto bail; \
+			buf = fdbuf; \
+			ra = read(jtf->fd, fdbuf, _size); \
+			if (ra < 0) \
+				goto bail; \
+		} \
 }
 
 static struct linetable *
@@ -237,14 +351,14 @@ lws_fts_cache_chunktable(struct lws_fts_file *jtf, uint32_t ofs_linetable,
 			 struct lwsac **linetable_head)
 {
 	struct linetable *lt, *first = NULL, **prev = NULL;
-	unsigned char buf[8];
+	unsigned char fdbuf[8], *buf;
 	int line = 1, bp, ra;
 	off_t cfs = 0;
 
 	*linetable_head = NULL;
 
 	do {
-		grab(ofs_linetable, sizeof(buf));
+		grab(ofs_linetable, sizeof(fdbuf));
 
 		lt = lwsac_use(linetable_head, sizeof(*lt), 0);
 		if (!lt)
@@ -282,7 +396,7 @@ lws_fts_getfileoffset(struct lws_fts_file *jtf, struct linetable *ltstart,
 		      int line, off_t *_ofs)
 {
 	struct linetable *lt = ltstart;
-	unsigned char buf[LWS_FTS_LINES_PER_CHUNK * 5];
+	unsigned char fdbuf[LWS_FTS_LINES_PER_CHUNK * 5], *buf;
 	uint32_t ll;
 	off_t ofs;
 	int bp, ra;
@@ -306,7 +420,7 @@ lws_fts_getfileoffset(struct lws_fts_file *jtf, struct linetable *ltstart,
 	ofs = lt->chunk_filepos_start;
 	line -= lt->chunk_line_number_start;
 
-	grab(lt->vli_ofs_in_index, sizeof(buf));
+	grab(lt->vli_ofs_in_index, sizeof(fdbuf));
 
 	bp = 0;
 	while (line) {
@@ -384,18 +498,696 @@ ac_record(struct lws_fts_file *jtf, struct lwsac **results_head,
 	return 0;
 }
 
+/*
+ * A cursor on one term's instance list.  That has a record for each file the
+ * term appears in, linked from the highest file index down, listing the lines
+ * the term is on in ascending order.
+ */
+
+struct lws_fts_term {
+	jg2_file_offset next;	/* the next record, or 0 at the end */
+	jg2_file_offset lines;	/* where this record's line numbers start */
+	uint32_t fi;		/* this record's file index */
+	uint32_t tot;		/* how many line numbers it has */
+	uint32_t *line;		/* and those line numbers, once decoded */
+	uint32_t line_alloc;
+	int cur;		/* merge position in line[] */
+	char done;
+};
+
+/* a needle split into terms */
+
+struct lws_fts_terms {
+	char buf[256];
+	const char *term[LWSFTS_MAX_QUERY_TERMS];
+	int len[LWSFTS_MAX_QUERY_TERMS];
+	int count;
+};
+
+static int
+lws_fts_split_terms(const char *needle, struct lws_fts_terms *q)
+{
+	int n = 0, m;
+
+	q->count = 0;
+
+	while (*needle) {
+		if (!lws_fts_classify[(unsigned char)*needle]) {
+			needle++;
+			continue;
+		}
+
+		if (q->count == LWSFTS_MAX_QUERY_TERMS)
+			return 1;
+
+		q->term[q->count] = &q->buf[n];
+		q->len[q->count] = 0;
+
+		/* the same way the indexer sees symbols */
+
+		while ((m = lws_fts_classify[(unsigned char)*needle])) {
+			if (n == (int)sizeof(q->buf) - 1)
+				return 1;
+
+			q->buf[n++] = m == 2 ? *needle + 'a' - 'A' : *needle;
+			q->len[q->count]++;
+			needle++;
+		}
+
+		q->buf[n++] = '\0';
+		q->count++;
+	}
+
+	return !q->count;
+}
+
+/*
+ * Returns the offset of the instance list for the symbol exactly matching
+ * term, or 0 if there are no instances of it
+ */
+
+static jg2_file_offset
+lws_fts_lookup(struct lws_fts_file *jtf, const char *term, int len)
+{
+	unsigned char ib[(5 * MAX_VLI) + 256], *p;
+	uint32_t tif, children, co = 0, slen = 0, u;
+	jg2_file_offset o = jtf->root;
+	int pos = 0, ip, n;
+
+	while (1) {
+		p = lws_fts_file_peek(jtf, o, ib, 4 * MAX_VLI);
+		if (!p)
+			return 0;
+
+		ip = rq32(p, &tif);
+		ip += rq32(p + ip, &children);
+		ip += rq32(p + ip, &u);
+		ip += rq32(p + ip, &u);
+
+		if (pos == len)
+			return tif;
+
+		o += ip;
+		for (n = 0; n < (int)children; n++) {
+			p = lws_fts_file_peek(jtf, o, ib, sizeof(ib));
+			if (!p)
+				return 0;
+
+			ip = rq32(p, &co);
+			ip += rq32(p + ip, &u);
+			ip += rq32(p + ip, &u);
+			ip += rq32(p + ip, &u);
+			ip += rq32(p + ip, &slen);
+
+			if (slen && p[ip] == (unsigned char)term[pos])
+				break;
+
+			o += ip + slen;
+		}
+
+		/*
+		 * siblings all start with a different char, so if this one
+		 * doesn't go on to match the term, nothing does
+		 */
+
+		if (n == (int)children || slen > (uint32_t)(len - pos) ||
+		    memcmp(p + ip, term + pos, slen))
+			return 0;
+
+		pos += slen;
+		o = co;
+	}
+}
+
+/* moves the cursor on to the next record, setting .done at the end */
+
+static int
+lws_fts_term_step(struct lws_fts_file *jtf, struct lws_fts_term *tm)
+{
+	unsigned char ib[3 * MAX_VLI], *p;
+	uint32_t prev;
+	int ip;
+
+	if (!tm->next) {
+		tm->done = 1;
+
+		return 0;
+	}
+
+	p = lws_fts_file_peek(jtf, tm->next, ib, sizeof(ib));
+	if (!p)
+		return 1;
+
+	ip = rq32(p, &prev);
+	ip += rq32(p + ip, &tm->fi);
+	ip += rq32(p + ip, &tm->tot);
+
+	if (tm->fi >= (uint32_t)jtf->filepaths) {
+		lwsl_err("%s: bad file index %u\n", __func__, tm->fi);
+
+		return 1;
+	}
+
+	tm->lines = tm->next + ip;
+	tm->next = prev;
+
+	return 0;
+}
+
+/* decodes the line numbers of the record the cursor is on into .line[] */
+
+static int
+lws_fts_term_lines(struct lws_fts_file *jtf, struct lws_fts_term *tm)
+{
+	jg2_file_offset o = tm->lines;
+	unsigned char ib[1024], *p;
+	uint32_t n = 0, *l;
+	int ip;
+
+	if (tm->tot > tm->line_alloc) {
+		l = lws_realloc(tm->line, tm->tot * sizeof(uint32_t),
+				"fts lines");
+		if (!l)
+			return 1;
+
+		tm->line = l;
+		tm->line_alloc = tm->tot;
+	}
+
+	while (n < tm->tot) {
+		p = lws_fts_file_peek(jtf, o, ib, sizeof(ib));
+		if (!p)
+			return 1;
+
+		ip = 0;
+		while (n < tm->tot && ip <= (int)sizeof(ib) - MAX_VLI)
+			ip += rq32(p + ip, &tm->line[n++]);
+		o += ip;
+	}
+
+	return 0;
+}
+
+/*
+ * Moves the cursors on to the next file index that can satisfy the query,
+ * setting *fi to it.  With any, that's just the highest one left.  Otherwise
+ * each cursor leapfrogs past the others until they all agree, so files not
+ * every term is in are skipped having only read their record headers.
+ *
+ * Returns 0 if *fi was set, 1 if there are no more, or -1 on error.
+ */
+
+static int
+lws_fts_terms_align(struct lws_fts_file *jtf, struct lws_fts_term *tm, int nt,
+		    int any, uint32_t *fi)
+{
+	int n, agree = 1;
+
+	if (any) {
+		for (n = 0; n < nt; n++)
+			if (!tm[n].done && (agree || tm[n].fi > *fi)) {
+				*fi = tm[n].fi;
+				agree = 0;
+			}
+
+		return agree;
+	}
+
+	for (n = 0; n < nt; n++)
+		if (tm[n].done)
+			return 1;
+
+	*fi = tm[0].fi;
+	n = 0;
+	while (agree < nt) {
+		n = (n + 1) % nt;
+
+		while (tm[n].fi > *fi) {
+			if (lws_fts_term_step(jtf, &tm[n]))
+				return -1;
+			if (tm[n].done)
+				return 1;
+		}
+
+		if (tm[n].fi == *fi)
+			agree++;
+		else {
+			*fi = tm[n].fi;
+			agree = 1;
+		}
+	}
+
+	return 0;
+}
+
+/* returns the first index from lo onwards in a[] where a[index] >= x */
+
+static int
+lws_fts_gallop(const uint32_t *a, int count, int lo, uint32_t x)
+{
+	int hi = lo, step = 1, mid;
+
+	while (hi < count && a[hi] < x) {
+		lo = hi + 1;
+		hi += step;
+		step <<= 1;
+	}
+
+	if (hi > count)
+		hi = count;
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (a[mid] < x)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+/*
+ * Collects the lines the cursors on file fi have in common into out[], once
+ * each, and returns how many.  The shortest list leads and the others are
+ * searched forwards from where they got to, so the cost follows the shortest
+ * list rather than the longest.
+ */
+
+static uint32_t
+lws_fts_lines_intersect(struct lws_fts_term *tm, int nt, uint32_t *out)
+{
+	struct lws_fts_term *lead = &tm[0];
+	uint32_t count = 0, x;
+	int n, i = 0;
+
+	for (n = 0; n < nt; n++) {
+		tm[n].cur = 0;
+		if (tm[n].tot < lead->tot)
+			lead = &tm[n];
+	}
+
+	while (i < (int)lead->tot) {
+		x = lead->line[i];
+
+		for (n = 0; n < nt; n++) {
+			if (&tm[n] == lead)
+				continue;
+
+			tm[n].cur = lws_fts_gallop(tm[n].line, tm[n].tot,
+						   tm[n].cur, x);
+			if (tm[n].cur == (int)tm[n].tot)
+				return count;
+			if (tm[n].line[tm[n].cur] != x)
+				break;
+		}
+
+		if (n == nt)
+			out[count++] = x++;
+		else
+			x = tm[n].line[tm[n].cur];
+
+		i = lws_fts_gallop(lead->line, lead->tot, i, x);
+	}
+
+	return count;
+}
+
+/* collects the lines any cursor on file fi has into out[], once each */
+
+static uint32_t
+lws_fts_lines_union(struct lws_fts_term *tm, int nt, uint32_t fi,
+		    uint32_t *out)
+{
+	struct lws_fts_term *lo;
+	uint32_t count = 0, x;
+	int n;
+
+	for (n = 0; n < nt; n++)
+		tm[n].cur = 0;
+
+	while (1) {
+		lo = NULL;
+		for (n = 0; n < nt; n++)
+			if (!tm[n].done && tm[n].fi == fi &&
+			    tm[n].cur < (int)tm[n].tot &&
+			    (!lo || tm[n].line[tm[n].cur] < lo->line[lo->cur]))
+				lo = &tm[n];
+		if (!lo)
+			return count;
+
+		x = lo->line[lo->cur++];
+		if (!count || out[count - 1] != x)
+			out[count++] = x;
+	}
+}
+
+/*
+ * Reads the line starting at ofs in the original file, returning nonzero if
+ * it has the terms as consecutive symbols.  Bit n of d is set while the last
+ * symbols seen matched the first n + 1 terms, so it's one pass over the line
+ * even when terms repeat.
+ */
+
+static int
+lws_fts_line_has_phrase(int fd, off_t ofs, const struct lws_fts_terms *q)
+{
+	unsigned char buf[256], sym[256];
+	uint32_t d = 0, mask;
+	int n, m, k, sl = 0;
+
+	if (lseek(fd, ofs, SEEK_SET) < 0)
+		return 0;
+
+	while (1) {
+		m = read(fd, buf, sizeof(buf));
+		if (m <= 0) {
+			/* the end of the file ends the line */
+			buf[0] = '\n';
+			m = 1;
+		}
+
+		for (n = 0; n < m; n++) {
+			k = lws_fts_classify[buf[n]];
+			if (k) {
+				if (sl < (int)sizeof(sym))
+					sym[sl] = k == 2 ? buf[n] + 'a' - 'A' :
+							   buf[n];
+				sl++;
+				continue;
+			}
+
+			if (sl) {
+				mask = 0;
+				for (k = 0; k < q->count; k++)
+					if (sl == q->len[k] &&
+					    !memcmp(sym, q->term[k], sl))
+						mask |= 1 << k;
+
+				d = ((d << 1) | 1) & mask;
+				if (d & (1 << (q->count - 1)))
+					return 1;
+				sl = 0;
+			}
+
+			if (buf[n] == '\n')
+				return 0;
+		}
+	}
+}
+
+/*
+ * Adds a filepath result for file index fi, with the count line numbers in
+ * line[] as the flags ask.  If phrase is given, lines without it are dropped,
+ * and so is the file if that leaves none.
+ *
+ * Returns 1 if the file was added, 0 if not, or -1 on error.
+ */
+
+static int
+lws_fts_result_file(struct lws_fts_file *jtf,
+		    struct lws_fts_search_params *ftsp,
+		    struct lws_fts_result *result, uint32_t fi,
+		    const uint32_t *line, uint32_t count,
+		    const struct lws_fts_terms *phrase)
+{
+	uint32_t ofs_linetable, lines, n, m = 0, *u;
+	struct lws_fts_result_filepath *fp;
+	int fplen, footprint, ofd = -1, ret = -1;
+	struct lwsac *lt_head = NULL;
+	struct linetable *ltst = NULL;
+	char path[256], *pp;
+	off_t fo;
+
+	if (lws_fts_filepath(jtf, fi, path, sizeof(path) - 1,
+			     &ofs_linetable, &lines)) {
+		lwsl_err("can't get filepath index %d\n", fi);
+		return -1;
+	}
+
+	if (ftsp->only_filepath && strcmp(path, ftsp->only_filepath))
+		return 0;
+
+	if (phrase || (ftsp->flags & LWSFTS_F_QUERY_FILE_LINES)) {
+		ltst = lws_fts_cache_chunktable(jtf, ofs_linetable, &lt_head);
+		if (!ltst)
+			return -1;
+	}
+
+	if (phrase || (ftsp->flags & LWSFTS_F_QUERY_QUOTE_LINE)) {
+		ofd = open(path, O_RDONLY);
+		if (ofd < 0 && (ftsp->flags & LWSFTS_F_QUERY_QUOTE_LINE))
+			goto bail;
+	}
+
+	/*
+	 * Without the original file we can't check the phrase, so only give
+	 * the lines with all the terms if the caller said that will do, and
+	 * then don't claim the results are all phrases
+	 */
+
+	if (phrase && ofd < 0) {
+		if (!(ftsp->flags & LWSFTS_F_QUERY_PHRASE_UNCHECKED)) {
+			lwsl_info("%s: can't check phrase in %s\n", __func__,
+				  path);
+			ret = 0;
+			goto bail;
+		}
+		result->effective_flags &= ~LWSFTS_F_QUERY_PHRASE;
+	}
+
+	fplen = (int)strlen(path);
+	footprint = sizeof(*fp) + fplen + 1;
+	if (ftsp->flags & LWSFTS_F_QUERY_FILE_LINES) {
+		/* line number and offset in file */
+		footprint += 2 * sizeof(uint32_t) * count;
+
+		if (ftsp->flags & LWSFTS_F_QUERY_QUOTE_LINE)
+			/* pointer to quote string */
+			footprint += sizeof(void *) * count;
+	}
+
+	fp = lwsac_use(&ftsp->results_head, footprint, 0);
+	if (!fp)
+		goto bail;
+
+	/* line table first so it can be aligned */
+
+	u = (uint32_t*)(fp + 1);
+
+	for (n = 0; n < count; n++) {
+		unsigned char lbuf[256], *p;
+		char ebuf[384];
+		const char **v;
+		int r;
+
+		fo = 0;
+		if (ltst && lws_fts_getfileoffset(jtf, ltst, line[n], &fo))
+			fo = -1;
+
+		if (phrase && ofd >= 0 &&
+		    (fo < 0 || !lws_fts_line_has_phrase(ofd, fo, phrase)))
+			continue;
+
+		m++;
+
+		if (!(ftsp->flags & LWSFTS_F_QUERY_FILE_LINES))
+			continue;
+
+		*u++ = line[n];
+		*u++ = fo < 0 ? 0 : (uint32_t)fo;
+
+		if (!(ftsp->flags & LWSFTS_F_QUERY_QUOTE_LINE))
+			continue;
+
+		v = (const char **)u;
+		*v = NULL;
+		u += sizeof(const char *) / sizeof(uint32_t);
+
+		if (fo < 0 || lseek(ofd, fo, SEEK_SET) < 0)
+			continue;
+
+		r = read(ofd, lbuf, sizeof(lbuf) - 1);
+		if (r < 0)
+			continue;
+		lbuf[r] = '\0';
+
+		p = (unsigned char *)strchr((char *)lbuf, '\n');
+		if (p)
+			r = lws_ptr_diff(p, lbuf);
+		lbuf[r] = '\0';
+		p = (unsigned char *)strchr((char *)lbuf, '\r');
+		if (p)
+			r = lws_ptr_diff(p, lbuf);
+		lbuf[r] = '\0';
+
+		lws_json_purify(ebuf, (const char *)lbuf, sizeof(ebuf) - 1);
+		r = (int)strlen(ebuf);
+
+		p = lwsac_use(&ftsp->results_head, r + 1, 0);
+		if (!p)
+			goto bail;
+
+		memcpy(p, ebuf, r);
+		p[r] = '\0';
+		*v = (const char *)p;
+	}
+
+	ret = 0;
+	if (!m)
+		goto bail;
+
+	fp->filepath_length = fplen;
+	fp->lines_in_file = lines;
+	fp->matches = m;
+	fp->matches_length = lws_ptr_diff(u, fp + 1);
+	fp->next = result->filepath_head;
+	result->filepath_head = fp;
+
+	pp = ((char *)&fp[1]) + fp->matches_length;
+	memcpy(pp, path, fplen);
+	pp[fplen] = '\0';
+
+	ret = 1;
+
+bail:
+	if (ofd >= 0)
+		close(ofd);
+	lwsac_free(&lt_head);
+
+	return ret;
+}
+
+/* sort the instance file list by results density */
+
+static void
+lws_fts_results_sort_files(struct lws_fts_result *result)
+{
+	struct lws_fts_result_filepath **prf, *rf1, *rf2;
+	char stasis;
+
+	do {
+		stasis = 1;
+
+		/* bubble sort keeps going until nothing changed */
+
+		prf = &result->filepath_head;
+		while (*prf) {
+
+			rf1 = *prf;
+			rf2 = rf1->next;
+
+			if (rf2 && rf1->lines_in_file && rf2->lines_in_file &&
+			    ((rf1->matches * 1000) / rf1->lines_in_file) <
+			    ((rf2->matches * 1000) / rf2->lines_in_file)) {
+				stasis = 0;
+
+				*prf = rf2;
+				rf1->next = rf2->next;
+				rf2->next = rf1;
+			}
+
+			prf = &(*prf)->next;
+		}
+
+	} while (!stasis);
+}
+
+/*
+ * ALL_TERMS, ANY_TERM and PHRASE queries: the terms' instance lists are walked
+ * together, in file index order, and the lines of each file that qualifies are
+ * merged from the sorted line lists of the terms that are in it.
+ */
+
+static struct lws_fts_result *
+lws_fts_search_terms(struct lws_fts_file *jtf,
+		     struct lws_fts_search_params *ftsp,
+		     struct lws_fts_result *result, unsigned long long tf)
+{
+	int phrase = !!(ftsp->flags & LWSFTS_F_QUERY_PHRASE),
+	    any = !phrase && (ftsp->flags & LWSFTS_F_QUERY_ANY_TERM), n;
+	struct lws_fts_term tm[LWSFTS_MAX_QUERY_TERMS];
+	uint32_t fi, count, out_alloc = 0, *out = NULL, *l;
+	struct lws_fts_terms q;
+
+	result->effective_flags &= ~LWSFTS_F_QUERY_AUTOCOMPLETE;
+	memset(tm, 0, sizeof(tm));
+
+	if (lws_fts_split_terms(ftsp->needle, &q) ||
+	    !(ftsp->flags & LWSFTS_F_QUERY_FILES))
+		goto done;
+
+	for (n = 0; n < q.count; n++) {
+		tm[n].next = lws_fts_lookup(jtf, q.term[n], q.len[n]);
+		if (!tm[n].next && !any)
+			/* no instances of one of the terms we need */
+			goto done;
+
+		if (lws_fts_term_step(jtf, &tm[n]))
+			goto done;
+	}
+
+	while (!lws_fts_terms_align(jtf, tm, q.count, any, &fi)) {
+
+		count = 0;
+		for (n = 0; n < q.count; n++)
+			if (!tm[n].done && tm[n].fi == fi) {
+				if (lws_fts_term_lines(jtf, &tm[n]))
+					goto done;
+				count += tm[n].tot;
+			}
+
+		if (count > out_alloc) {
+			l = lws_realloc(out, count * sizeof(uint32_t),
+					"fts lines");
+			if (!l)
+				goto done;
+			out = l;
+			out_alloc = count;
+		}
+
+		if (phrase)
+			count = lws_fts_lines_intersect(tm, q.count, out);
+		else
+			count = lws_fts_lines_union(tm, q.count, fi, out);
+
+		if (count) {
+			n = lws_fts_result_file(jtf, ftsp, result, fi, out,
+						count, phrase ? &q : NULL);
+			if (n < 0 || (n && ftsp->only_filepath))
+				break;
+		}
+
+		for (n = 0; n < q.count; n++)
+			if (!tm[n].done && tm[n].fi == fi &&
+			    lws_fts_term_step(jtf, &tm[n]))
+				goto done;
+	}
+
+	lws_fts_results_sort_files(result);
+
+done:
+	for (n = 0; n < (int)LWS_ARRAY_SIZE(tm); n++)
+		lws_free(tm[n].line);
+	lws_free(out);
+
+	result->duration_ms = (int)((lws_time_in_microseconds() - tf) / 1000);
+
+	return result;
+}
+
 struct lws_fts_result *
 lws_fts_search(struct lws_fts_file *jtf, struct lws_fts_search_params *ftsp)
 {
 	uint32_t children, instances, co, sl, agg, slt, chunk,
 		 fileofs_tif_start, desc, agg_instances;
-	int pos = 0, n, m, nl, bp, base = 0, ra, palm, budget, sp, ofd = -1;
+	int pos = 0, n, m, nl, bp, base = 0, ra, palm, budget, sp;
 	unsigned long long tf = lws_time_in_microseconds();
 	struct lws_fts_result_autocomplete **pac = NULL;
 	char stasis, nac = 0, credible, needle[32];
-	struct lws_fts_result_filepath *fp;
 	struct lws_fts_result *result;
-	unsigned char buf[4096];
+	struct lws_fts_term tm;
+	unsigned char fdbuf[4096], *buf;
 	off_t o, child_ofs;
 	struct wac s[128];
 
@@ -405,7 +1197,8 @@ lws_fts_search(struct lws_fts_file *jtf, struct lws_fts_search_params *ftsp)
 		return NULL;
 
 	nl = (int)strlen(ftsp->needle);
-	if ((size_t)nl > sizeof(needle) - 2)
+	if ((size_t)nl > sizeof(needle) - 2 &&
+	    !(ftsp->flags & LWSFTS_F_QUERY_TERMS))
 		return NULL;
 
 	result = lwsac_use(&ftsp->results_head, sizeof(*result), 0);
@@ -420,6 +1213,9 @@ lws_fts_search(struct lws_fts_file *jtf, struct lws_fts_search_params *ftsp)
 	result->duration_ms = 0;
 	result->effective_flags = ftsp->flags;
 
+	if (ftsp->flags & LWSFTS_F_QUERY_TERMS)
+		return lws_fts_search_terms(jtf, ftsp, result, tf);
+
 	palm = 0;
 
 	for (n = 0; n < nl; n++)
@@ -431,7 +1227,7 @@ lws_fts_search(struct lws_fts_file *jtf, struct lws_fts_search_params *ftsp)
 		bp = 0;
 		base = 0;
 
-		grab(o, sizeof(buf));
+		grab(o, sizeof(fdbuf));
 
 		child_ofs = o + bp;
 		bp += rq32(&buf[bp], &fileofs_tif_start);
@@ -456,7 +1252,7 @@ lws_fts_search(struct lws_fts_file *jtf, struct lws_fts_search_params *ftsp)
 			/* we leave with bp positioned at the instance list */
 
 			o = fileofs_tif_start;
-			grab(o, sizeof(buf));
+			grab(o, sizeof(fdbuf));
 			break;
 		}
 
@@ -468,7 +1264,7 @@ lws_fts_search(struct lws_fts_file *jtf, struct lws_fts_search_params *ftsp)
 			 */
 
 			base += bp;
-			grab(o + base, sizeof(buf));
+			grab(o + base, sizeof(fdbuf));
 		}
 
 		/* gets set if any child COULD match needle if it went on */
@@ -566,9 +1362,9 @@ ensure:
 				 * do we have at least buf more to match, or the
 				 * remainder of the string, whichever is less?
 				 *
-				 * bp may exceed sizeof(buf) on no match path
+				 * bp may exceed ra on no match path
 				 */
-				chunk = sizeof(buf);
+				chunk = sizeof(fdbuf);
 				if (slt < chunk)
 					chunk = slt;
 
@@ -580,7 +1376,7 @@ ensure:
 				 * at where we got to.
 				 */
 				base += bp;
-				grab(o + base, sizeof(buf));
+				grab(o + base, sizeof(fdbuf));
 
 			} /* while we are still comparing */
 
@@ -611,183 +1407,24 @@ ensure:
 	if (!(ftsp->flags & LWSFTS_F_QUERY_FILES))
 		goto autocomp;
 
-	do {
-		uint32_t fi, tot, line, ro, ofs_linetable, lines, fplen,
-			*u, _o;
-		struct lwsac *lt_head = NULL;
-		struct linetable *ltst;
-		char path[256], *pp;
-		int footprint;
-		off_t fo;
-
-		ofd = -1;
-		grab(o, sizeof(buf));
-
-		ro = o;
-		bp += rq32(&buf[bp], &_o);
-		o = _o;
-
-		assert(!o || o > TRIE_FILE_HDR_SIZE);
-
-		bp += rq32(&buf[bp], &fi);
-		bp += rq32(&buf[bp], &tot);
-
-		if (lws_fts_filepath(jtf, fi, path, sizeof(path) - 1,
-				     &ofs_linetable, &lines)) {
-			lwsl_err("can't get filepath index %d\n", fi);
-			goto bail;
-		}
-
-		if (ftsp->only_filepath && strcmp(path, ftsp->only_filepath))
-			continue;
-
-		ltst = lws_fts_cache_chunktable(jtf, ofs_linetable, &lt_head);
-		if (!ltst)
-			goto bail;
-
-		if (ftsp->flags & LWSFTS_F_QUERY_QUOTE_LINE) {
-			ofd = open(path, O_RDONLY);
-			if (ofd < 0) {
-				lwsac_free(&lt_head);
-				goto bail;
-			}
-		}
-
-		fplen = (int)strlen(path);
-		footprint = sizeof(*fp) + fplen + 1;
-		if (ftsp->flags & LWSFTS_F_QUERY_FILE_LINES) {
-			/* line number and offset in file */
-			footprint += 2 * sizeof(uint32_t) * tot;
-
-			if (ftsp->flags & LWSFTS_F_QUERY_QUOTE_LINE)
-				/* pointer to quote string */
-				footprint += sizeof(void *) * tot;
-		}
-
-		fp = lwsac_use(&ftsp->results_head, footprint, 0);
-		if (!fp) {
-			lwsac_free(&lt_head);
-			goto bail;
-		}
-
-		fp->filepath_length = fplen;
-		fp->lines_in_file = lines;
-		fp->matches = tot;
-		fp->matches_length = footprint - sizeof(*fp) - (fplen + 1);
-		fp->next = result->filepath_head;
-		result->filepath_head = fp;
-
-		/* line table first so it can be aligned */
-
-		u = (uint32_t*)(fp + 1);
-
-		if (ftsp->flags & LWSFTS_F_QUERY_FILE_LINES) {
-
-			/* for each line number */
-
-			for (n = 0; (uint32_t)n < tot; n++) {
-
-				unsigned char lbuf[256], *p;
-				char ebuf[384];
-				const char **v;
-				int m;
-
-				if ((ra - bp) < 8) {
-					base += bp;
-					grab(ro + base, sizeof(buf));
-				}
-
-				bp += rq32(&buf[bp], &line);
-				*u++ = line;
-
-				if (lws_fts_getfileoffset(jtf, ltst, line, &fo))
-					continue;
-
-				*u++ = (uint32_t)fo;
-
-				if (!(ftsp->flags & LWSFTS_F_QUERY_QUOTE_LINE))
-					continue;
-
-				if (lseek(ofd, fo, SEEK_SET) < 0)
-					continue;
-
-				m = read(ofd, lbuf, sizeof(lbuf) - 1);
-				if (m < 0)
-					continue;
-				lbuf[sizeof(lbuf) - 1] = '\0';
-
-				p = (unsigned char *)strchr((char *)lbuf, '\n');
-				if (p)
-					m = lws_ptr_diff(p, lbuf);
-				lbuf[m] = '\0';
-				p = (unsigned char *)strchr((char *)lbuf, '\r');
-				if (p)
-					m = lws_ptr_diff(p, lbuf);
-				lbuf[m] = '\0';
-
-				lws_json_purify(ebuf, (const char *)lbuf,
-						sizeof(ebuf) - 1);
-				m = (int)strlen(ebuf);
-
-				p = lwsac_use(&ftsp->results_head, m + 1, 0);
-				if (!p) {
-					lwsac_free(&lt_head);
-					goto bail;
-				}
-
-				memcpy(p, ebuf, m);
-				p[m] = '\0';
-				v = (const char **)u;
-				*v = (const char *)p;
-				u += sizeof(const char *) / sizeof(uint32_t);
-			}
-		}
-
-		pp = ((char *)&fp[1]) + fp->matches_length;
-		memcpy(pp, path, fplen);
-		pp[fplen] = '\0';
+	memset(&tm, 0, sizeof(tm));
+	tm.next = (jg2_file_offset)o;
 
-		if (ofd >= 0) {
-			close(ofd);
-			ofd = -1;
-		}
-
-		lwsac_free(&lt_head);
-
-		if (ftsp->only_filepath)
+	while (!lws_fts_term_step(jtf, &tm) && !tm.done) {
+		/* without lines, the count of them is all we need */
+		if ((ftsp->flags & LWSFTS_F_QUERY_FILE_LINES) &&
+		    lws_fts_term_lines(jtf, &tm))
 			break;
 
-	} while (o);
-
-	/* sort the instance file list by results density */
-
-	do {
-		struct lws_fts_result_filepath **prf, *rf1, *rf2;
-
-		stasis = 1;
-
-		/* bubble sort keeps going until nothing changed */
-
-		prf = &result->filepath_head;
-		while (*prf) {
-
-			rf1 = *prf;
-			rf2 = rf1->next;
-
-			if (rf2 && rf1->lines_in_file && rf2->lines_in_file &&
-			    ((rf1->matches * 1000) / rf1->lines_in_file) <
-			    ((rf2->matches * 1000) / rf2->lines_in_file)) {
-				stasis = 0;
-
-				*prf = rf2;
-				rf1->next = rf2->next;
-				rf2->next = rf1;
-			}
+		n = lws_fts_result_file(jtf, ftsp, result, tm.fi, tm.line,
+					tm.tot, NULL);
+		if (n < 0 || (n && ftsp->only_filepath))
+			break;
+	}
 
-			prf = &(*prf)->next;
-		}
+	lws_free(tm.line);
 
-	} while (!stasis);
+	lws_fts_results_sort_files(result);
 
 autocomp:
 
@@ -838,7 +1475,7 @@ autocomp:
 		int nobump = 0;
 		struct ch *tch = &s[sp].ch[s[sp].child - 1];
 
-		grab(child_ofs, sizeof(buf));
+		grab(child_ofs, sizeof(fdbuf));
 
 		bp += rq32(&buf[bp], &fileofs_tif_start);
 		bp += rq32(&buf[bp], &children);
@@ -992,9 +1629,6 @@ autocomp:
 	return result;
 
 bail:
-	if (ofd >= 0)
-		close(ofd);
-
 	lwsl_info("%s: search ended up at bail\n", __func__);
 
 	return result;
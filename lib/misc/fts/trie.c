@@ -388,6 +388,83 @@ lws_fts_entry_child_add(struct lws_fts *t, unsigned char c,
 	return e;
 }
 
+/*
+ * Split an entry with a string suffix, when a symbol only matches its first m
+ * chars.  For the "hello" / "help" case, e keeps "hel" and a new single child
+ * is created for the remainder "lo".
+ *
+ * Any instances or children (not siblings...) that were attached to e migrate
+ * to the new child that completes the original string.
+ *
+ * Returns the new child, or NULL if it couldn't be allocated.
+ */
+
+static struct lws_fts_entry *
+lws_fts_entry_split(struct lws_fts *t, struct lws_fts_entry *e, int m)
+{
+	struct lws_fts_entry *e1, *dcl;
+	unsigned int olen = e->suffix_len;
+	char *osuff = e->suffix;
+	int n;
+
+	/*
+	 * Truncate the suffix at the char before the mismatch (if that leaves
+	 * only the first char, remove the suffix string to turn it back to a
+	 * 1-char match)
+	 */
+
+	if (m == 1)
+		e->suffix = NULL;
+	else
+		e->suffix_len = m;
+
+	dcl = e->child_list;
+	n = e->child_count;
+
+	e->child_list = NULL;
+	e->child_count = 0;
+
+	e1 = lws_fts_entry_child_add(t, osuff[m], e);
+	if (!e1)
+		return NULL;
+
+	e1->child_list = dcl;
+	e1->child_count = n;
+
+	/*
+	 * any children we took over must point to us as the parent now they
+	 * appear on our child list
+	 */
+	dcl = e1->child_list;
+	while (dcl) {
+		dcl->parent = e1;
+		dcl = dcl->sibling;
+	}
+
+	/*
+	 * any instances that belonged to the original entry we are splitting
+	 * now must be reassigned to the end part
+	 */
+
+	e1->inst_file_list = e->inst_file_list;
+	if (e1->inst_file_list)
+		e1->inst_file_list->owner = e1;
+	e->inst_file_list = NULL;
+	e1->instance_count = e->instance_count;
+	e->instance_count = 0;
+
+	e1->ofs_last_inst_file = e->ofs_last_inst_file;
+	e->ofs_last_inst_file = 0;
+
+	if ((unsigned int)m + 1 != olen) {
+		/* we diverged partway */
+		e1->suffix = &osuff[m];
+		e1->suffix_len = olen - m;
+	}
+
+	return e1;
+}
+
 static int
 finalize_per_input(struct lws_fts *t)
 {
@@ -482,9 +559,11 @@ finalize_per_input(struct lws_fts *t)
  * 0 = punctuation, whitespace, brackets etc
  * 1 = character inside symbol set
  * 2 = upper-case character inside symbol set
+ *
+ * Searches split their queries into symbols using this too.
  */
 
-static char classify[] = {
+const char lws_fts_classify[] = {
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -542,17 +621,22 @@ lws_fts_fill(struct lws_fts *t, uint32_t file_index, const char *buf,
 {
 	unsigned long long tf = lws_time_in_microseconds();
 	unsigned char c, linetable[256], vlibuf[8];
-	struct lws_fts_entry *e, *e1, *dcl;
 	struct lws_fts_instance_file *tif;
-	int bp = 0, sline, chars, m;
-	char *osuff, skipline = 0;
+	int bp = 0, sline, chars, line, m;
 	struct lws_fts_lines *tl;
-	unsigned int olen, n;
+	struct lws_fts_entry *e;
+	char skipline = 0;
+	unsigned int n;
 	off_t lbh;
 
 	if ((int)file_index != t->last_file_index) {
 		if (t->last_file_index >= 0)
 			finalize_per_input(t);
+		/*
+		 * the previous input's instances went in after this filepath
+		 * was registered, its line table actually starts here
+		 */
+		t->fp->line_table_ofs = t->c;
 		t->last_file_index = file_index;
 		t->line_number = 1;
 		t->chars_in_line = 0;
@@ -627,7 +711,7 @@ resume:
 		if (skipline)
 			continue;
 
-		m = classify[(int)c];
+		m = lws_fts_classify[(int)c];
 		if (!m)
 			goto seal;
 		if (m == 2)
@@ -774,7 +858,8 @@ seal:
 			 * two child entries, for "lo" and 'p'.
 			 */
 
-			if (c == t->parser->suffix[t->str_match_pos++]) {
+			if (c == (unsigned char)
+				 t->parser->suffix[t->str_match_pos++]) {
 				if (t->str_match_pos < t->parser->suffix_len)
 					continue;
 
@@ -792,97 +877,24 @@ seal:
 			 * have to split this string entry.
 			 *
 			 * We know the first char actually matched in order to
-			 * start down this road.  So for the current trie entry,
-			 * we need to truncate his suffix at the char before
-			 * this mismatched one, where we diverged (if the
-			 * second char, simply remove the suffix string from the
-			 * current trie entry to turn it back to a 1-char match)
-			 *
-			 * The original entry, which becomes the lhs post-split,
-			 * is t->parser.
-			 */
-
-			olen = t->parser->suffix_len;
-			osuff = t->parser->suffix;
-
-			if (t->str_match_pos == 2)
-				t->parser->suffix = NULL;
-			else
-				t->parser->suffix_len = t->str_match_pos - 1;
-
-			/*
-			 * Then we need to create a new child trie entry that
-			 * represents the remainder of the original string
-			 * path that we didn't match.  For the "hello" /
-			 * "help" case, this guy will have "lo".
-			 *
-			 * Any instances or children (not siblings...) that were
-			 * attached to the original trie entry must be detached
-			 * first and then migrate to this new guy that completes
-			 * the original string.
+			 * start down this road, so str_match_pos - 1 chars of
+			 * the suffix matched.
 			 */
 
-			dcl = t->parser->child_list;
-			m = t->parser->child_count;
-
-			t->parser->child_list = NULL;
-			t->parser->child_count = 0;
-
-			e = lws_fts_entry_child_add(t,
-					osuff[t->str_match_pos - 1], t->parser);
+			e = lws_fts_entry_split(t, t->parser,
+						t->str_match_pos - 1);
 			if (!e) {
 				lwsl_err("%s: lws_fts_entry_child_add fail1\n",
 						__func__);
 				return 1;
 			}
 
-			e->child_list = dcl;
-			e->child_count = m;
-			/*
-			 * any children we took over must point to us as the
-			 * parent now they appear on our child list
-			 */
-			e1 = e->child_list;
-			while (e1) {
-				e1->parent = e;
-				e1 = e1->sibling;
-			}
-
-			/*
-			 * We detached any children, gave them to the new guy
-			 * and replaced them with just our new guy
-			 */
-			t->parser->child_count = 1;
-			t->parser->child_list = e;
-
-			/*
-			 * any instances that belonged to the original entry we
-			 * are splitting now must be reassigned to the end
-			 * part
-			 */
-
-			e->inst_file_list = t->parser->inst_file_list;
-			if (e->inst_file_list)
-				e->inst_file_list->owner = e;
-			t->parser->inst_file_list = NULL;
-			e->instance_count = t->parser->instance_count;
-			t->parser->instance_count = 0;
-
-			e->ofs_last_inst_file = t->parser->ofs_last_inst_file;
-			t->parser->ofs_last_inst_file = 0;
-
-			if (t->str_match_pos != olen) {
-				/* we diverged partway */
-				e->suffix = &osuff[t->str_match_pos - 1];
-				e->suffix_len = olen - (t->str_match_pos - 1);
-			}
-
 			/*
 			 * if the current char is a terminal, skip creating a
 			 * new way forward.
 			 */
 
-			if (classify[(int)c]) {
+			if (lws_fts_classify[(int)c]) {
 
 				/*
 				 * Lastly we need to create a new child trie
@@ -905,10 +917,15 @@ seal:
 						 __func__);
 					return 1;
 				}
+
+				/* go on following this path */
+				t->parser = e;
 			}
 
-			/* go on following this path */
-			t->parser = e;
+			/*
+			 * ...otherwise the symbol ended where we split, and
+			 * the instance belongs to t->parser, not the remainder
+			 */
 
 			t->aggregate = 1;
 			t->agg_pos = 0;
@@ -983,16 +1000,20 @@ seal:
 		 * stored in a small VLI array inside the filepath inst.  If the
 		 * next one won't fit, it allocates a line number struct with
 		 * more vli space and continues chaining those if needed.
+		 *
+		 * If the symbol was ended by a newline, we already moved on to
+		 * the next line, but the symbol is on the one it ended.
 		 */
 
-		n = wq32(vlibuf, t->line_number);
+		line = t->line_number - (c == '\n');
+		n = wq32(vlibuf, line);
 		tif = t->parser->inst_file_list;
 
 		if (!tif->lines_list) {
 			/* we are still trying to use the file inst vli */
 			if (LWS_ARRAY_SIZE(tif->vli) - tif->count >= n) {
 				tif->count += wq32(tif->vli + tif->count,
-						   t->line_number);
+						   line);
 				goto after;
 			}
 			/* we are going to have to allocate */
@@ -1004,7 +1025,7 @@ seal:
 		    	    tif->lines_tail->count >= n) {
 			tif->lines_tail->count += wq32(tif->lines_tail->vli +
 						       tif->lines_tail->count,
-						       t->line_number);
+						       line);
 			goto after;
 		}
 
@@ -1025,7 +1046,7 @@ seal:
 		if (!tif->lines_list)
 			tif->lines_list = tl;
 
-		tl->count = wq32(tl->vli, t->line_number);
+		tl->count = wq32(tl->vli, line);
 after:
 		tif->total++;
 #if 0
@@ -1366,4 +1387,320 @@ bail:
 	return 1;
 }
 
+/*
+ * Find the entry for the symbol s, adding it and splitting any string suffixes
+ * on the way as needed, so the trie ends up the same shape as if
+ * lws_fts_fill() had met the symbol.
+ */
+
+static struct lws_fts_entry *
+lws_fts_entry_find_add(struct lws_fts *t, const unsigned char *s, int len)
+{
+	struct lws_fts_entry *e, *p;
+	int pos = 1, m;
+
+	/* the root entry's children are always single chars */
+
+	e = t->root_lookup[s[0]];
+	if (!e) {
+		e = lws_fts_entry_child_add(t, s[0], t->root);
+		if (!e)
+			return NULL;
+		t->root_lookup[s[0]] = e;
+	}
+
+	while (pos < len) {
+		p = e;
+
+		/* since they're alpha ordered... */
+		e = p->child_list;
+		while (e && e->c < s[pos])
+			e = e->sibling;
+
+		if (!e || e->c != s[pos]) {
+			/* a new trail, the rest of the symbol is its suffix */
+			e = lws_fts_entry_child_add(t, s[pos], p);
+			if (!e)
+				return NULL;
+
+			if (len - pos > 1) {
+				e->suffix = lwsac_use(&t->lwsac_head, len - pos,
+						      TRIE_LWSAC_BLOCK_SIZE);
+				if (!e->suffix)
+					return NULL;
+				memcpy(e->suffix, s + pos, len - pos);
+				e->suffix_len = len - pos;
+			}
+
+			return e;
+		}
+
+		if (!e->suffix) {
+			pos++;
+			continue;
+		}
+
+		m = 1;
+		while ((unsigned int)m < e->suffix_len && pos + m < len &&
+		       (unsigned char)e->suffix[m] == s[pos + m])
+			m++;
+
+		pos += m;
+		if ((unsigned int)m != e->suffix_len &&
+		    !lws_fts_entry_split(t, e, m))
+			return NULL;
+	}
+
+	return e;
+}
+
+struct lws_fts_merge_stack {
+	jg2_file_offset next; /* fileoffset of next child entry to visit */
+	uint32_t left;	      /* child entries still to visit at this level */
+	int name_len;	      /* length of the symbol at this level */
+};
+
+/*
+ * Appends an existing index to the one being created.  The filepaths and
+ * their line tables are copied as they are.  The instance lists are rewritten
+ * with the new file indexes and chained onto the same symbol in our trie, which
+ * is built up from the symbols in the existing index that have instances.
+ *
+ * chain must have room for a fileoffset per filepath in jtf.
+ */
+
+static int
+lws_fts_merge_one(struct lws_fts *t, struct lws_fts_file *jtf,
+		  jg2_file_offset *chain)
+{
+	uint32_t tif, children, lt, lines, prev, fi, tot, slen, len, u;
+	unsigned char buf[8192], ib[4096], name[512], *p;
+	int base = t->next_file_index, bp = 0, ip, sp, nl, nc, n;
+	struct lws_fts_merge_stack s[256];
+	struct lws_fts_entry *e;
+	jg2_file_offset o;
+	char path[256];
+
+	/* the filepaths, each followed by its line table */
+
+	for (n = 0; n < jtf->filepaths; n++) {
+		if (lws_fts_filepath(jtf, n, path, sizeof(path), &lt, &lines))
+			goto corrupt;
+
+		if (lws_fts_file_index(t, path, (int)strlen(path), 1) < 0)
+			return 1;
+
+		t->fp->line_table_ofs = t->c + bp;
+		t->fp->total_lines = lines;
+
+		/* copy the chunks up to and including the empty one at the end */
+
+		do {
+			p = lws_fts_file_peek(jtf, lt, ib, 8);
+			if (!p)
+				goto corrupt;
+
+			len = (p[0] << 8) | p[1];
+			ip = len ? (int)len : 8;
+			if (ip < 8 || ip > (int)sizeof(ib))
+				goto corrupt;
+
+			p = lws_fts_file_peek(jtf, lt, ib, ip);
+			if (!p)
+				goto corrupt;
+
+			spill(ip, 0);
+			memcpy(&buf[bp], p, ip);
+			bp += ip;
+			lt += ip;
+		} while (len);
+	}
+
+	/* walk the trie for symbols that have instances */
+
+	p = lws_fts_file_peek(jtf, jtf->root, ib, 4 * MAX_VLI);
+	if (!p)
+		goto corrupt;
+
+	ip = rq32(p, &tif);
+	ip += rq32(p + ip, &children);
+	ip += rq32(p + ip, &u);
+	ip += rq32(p + ip, &u);
+
+	sp = 0;
+	s[0].next = jtf->root + ip;
+	s[0].left = children;
+	s[0].name_len = 0;
+
+	while (sp >= 0) {
+		if (!s[sp].left) {
+			sp--;
+			continue;
+		}
+		s[sp].left--;
+
+		/* the next child entry at this level gives us its name */
+
+		p = lws_fts_file_peek(jtf, s[sp].next, ib, (5 * MAX_VLI) + 256);
+		if (!p)
+			goto corrupt;
+
+		ip = rq32(p, &o);
+		ip += rq32(p + ip, &u);
+		ip += rq32(p + ip, &u);
+		ip += rq32(p + ip, &u);
+		ip += rq32(p + ip, &slen);
+
+		nl = s[sp].name_len + (int)slen;
+		if (!slen || ip + slen > (5 * MAX_VLI) + 256 ||
+		    nl > (int)sizeof(name))
+			goto corrupt;
+
+		memcpy(name + s[sp].name_len, p + ip, slen);
+		s[sp].next += ip + slen;
+
+		/* and the child itself */
+
+		p = lws_fts_file_peek(jtf, o, ib, 4 * MAX_VLI);
+		if (!p)
+			goto corrupt;
+
+		ip = rq32(p, &tif);
+		ip += rq32(p + ip, &children);
+		ip += rq32(p + ip, &u);
+		ip += rq32(p + ip, &u);
+
+		if (children) {
+			if (sp + 1 == LWS_ARRAY_SIZE(s)) {
+				lwsl_err("Stack too deep\n");
+
+				return 1;
+			}
+
+			sp++;
+			s[sp].next = o + ip;
+			s[sp].left = children;
+			s[sp].name_len = nl;
+		}
+
+		if (!tif)
+			continue;
+
+		e = lws_fts_entry_find_add(t, name, nl);
+		if (!e)
+			return 1;
+
+		/*
+		 * The instance list is linked newest first... collect it so we
+		 * can write it oldest first, chaining on to any instances of
+		 * the symbol we already wrote from earlier indexes.
+		 */
+
+		nc = 0;
+		while (tif) {
+			if (nc == jtf->filepaths)
+				goto corrupt;
+			chain[nc++] = tif;
+
+			p = lws_fts_file_peek(jtf, tif, ib, MAX_VLI);
+			if (!p)
+				goto corrupt;
+			rq32(p, &tif);
+		}
+
+		while (nc--) {
+			o = chain[nc];
+			p = lws_fts_file_peek(jtf, o, ib, 3 * MAX_VLI);
+			if (!p)
+				goto corrupt;
+
+			ip = rq32(p, &prev);
+			ip += rq32(p + ip, &fi);
+			ip += rq32(p + ip, &tot);
+			if (fi >= (uint32_t)jtf->filepaths)
+				goto corrupt;
+			o += ip;
+
+			spill(3 * MAX_VLI, 0);
+
+			prev = e->ofs_last_inst_file;
+			e->ofs_last_inst_file = t->c + bp;
+			e->instance_count += tot;
+
+			bp += wq32(&buf[bp], prev);
+			bp += wq32(&buf[bp], base + fi);
+			bp += wq32(&buf[bp], tot);
+
+			/* the line numbers are copied as they are */
+
+			while (tot) {
+				p = lws_fts_file_peek(jtf, o, ib, sizeof(ib));
+				if (!p)
+					goto corrupt;
+
+				ip = 0;
+				while (tot && ip < (int)sizeof(ib))
+					if (!(p[ip++] & 0x80))
+						tot--;
+
+				spill(ip, 0);
+				memcpy(&buf[bp], p, ip);
+				bp += ip;
+				o += ip;
+			}
+		}
+	}
+
+	spill(0, 1);
+
+	return 0;
+
+corrupt:
+	lwsl_err("%s: index is corrupt\n", __func__);
+
+	return 1;
+}
+
+/* refer to ./README.md */
+
+int
+lws_fts_merge(int fd, const char * const *paths, int count)
+{
+	struct lws_fts_file *jtf;
+	jg2_file_offset *chain;
+	struct lws_fts *t;
+	int n, m, ret = 1;
+
+	t = lws_fts_create(fd);
+	if (!t)
+		return 1;
 
+	for (n = 0; n < count; n++) {
+		jtf = lws_fts_open(paths[n]);
+		if (!jtf)
+			goto bail;
+
+		chain = lws_malloc(sizeof(*chain) * (jtf->filepaths + 1),
+				   "fts merge");
+		if (!chain) {
+			lws_fts_close(jtf);
+			goto bail;
+		}
+
+		m = lws_fts_merge_one(t, jtf, chain);
+		lws_free(chain);
+		lws_fts_close(jtf);
+		if (m) {
+			lwsl_err("%s: unable to merge %s\n", __func__,
+				 paths[n]);
+			goto bail;
+		}
+	}
+
+	ret = lws_fts_serialize(t);
+
+bail:
+	lws_fts_destroy(&t);
+
+	return ret;
+}
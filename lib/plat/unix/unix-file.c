@@ -29,6 +29,9 @@
 #include <dlfcn.h>
 #endif
 #include <dirent.h>
+#if defined(LWS_HAVE_SYS_SENDFILE_H)
+#include <sys/sendfile.h>
+#endif
 
 int lws_plat_apply_FD_CLOEXEC(int n)
 {
@@ -152,6 +155,36 @@ _lws_plat_file_read(lws_fop_fd_t fop_fd, lws_filepos_t *amount,
 	return 0;
 }
 
+#if defined(LWS_HAVE_SYS_SENDFILE_H)
+/*
+ * Send up to len bytes from the current file position directly to the socket,
+ * without bringing them into userland.  Like a truncated send, *amount may be
+ * less than len, or 0 if the socket can't take any more right now.
+ */
+
+int
+lws_plat_file_sendfile(lws_fop_fd_t fop_fd, lws_sockfd_type sockfd,
+		       lws_filepos_t *amount, lws_filepos_t len)
+{
+	ssize_t n;
+
+	n = sendfile(sockfd, (int)fop_fd->fd, NULL, len);
+	if (n < 0) {
+		*amount = 0;
+		if (LWS_ERRNO == LWS_EAGAIN || LWS_ERRNO == LWS_EWOULDBLOCK ||
+		    LWS_ERRNO == LWS_EINTR)
+			return 0;
+
+		return -1;
+	}
+
+	fop_fd->pos += n;
+	*amount = n;
+
+	return 0;
+}
+#endif
+
 int
 _lws_plat_file_write(lws_fop_fd_t fop_fd, lws_filepos_t *amount,
 		     uint8_t *buf, lws_filepos_t len)
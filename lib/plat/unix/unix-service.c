@@ -87,7 +87,10 @@ _lws_plat_service_tsi(struct lws_context *context, int timeout_ms, int tsi)
 
 	vpt->inside_poll = 1;
 	lws_memory_barrier();
-	n = poll(pt->fds, pt->fds_count, timeout_ms);
+	if (context->event_loop_ops->wait_pt)
+		n = context->event_loop_ops->wait_pt(pt, timeout_ms);
+	else
+		n = poll(pt->fds, pt->fds_count, timeout_ms);
 	vpt->inside_poll = 0;
 	lws_memory_barrier();
 
@@ -160,6 +163,20 @@ faked_service:
 		} else
 			c = n;
 
+	/*
+	 * Unless we have forced service pending that set revents on arbitrary
+	 * fds, event libs that replaced the wait only need us to visit the fds
+	 * the kernel told them about
+	 */
+	if (context->event_loop_ops->service_ready && c >= 0) {
+		if (context->event_loop_ops->service_ready(pt))
+			return -1;
+
+		lws_service_do_ripe_rxflow(pt);
+
+		return 0;
+	}
+
 	/* any socket with events to service? */
 	for (n = 0; n < (int)pt->fds_count && c; n++) {
 		if (!pt->fds[n].revents)
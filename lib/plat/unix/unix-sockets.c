@@ -163,6 +163,39 @@ lws_plat_set_socket_options(struct lws_vhost *vhost, int fd, int unix_skt)
 	return 0;
 }
 
+#if defined(LWS_HAVE_SYS_UIO_H)
+/*
+ * Send count buffers to the socket in one syscall.  Like a truncated send,
+ * *amount may be less than the total, or 0 if the socket can't take any more
+ * right now.
+ */
+
+int
+lws_plat_send_iov(lws_sockfd_type sockfd, const struct iovec *iov, int count,
+		  size_t *amount)
+{
+	struct msghdr mh;
+	ssize_t n;
+
+	memset(&mh, 0, sizeof(mh));
+	mh.msg_iov = (struct iovec *)iov;
+	mh.msg_iovlen = (size_t)count;
+
+	n = sendmsg(sockfd, &mh, MSG_NOSIGNAL);
+	if (n < 0) {
+		*amount = 0;
+		if (LWS_ERRNO == LWS_EAGAIN || LWS_ERRNO == LWS_EWOULDBLOCK ||
+		    LWS_ERRNO == LWS_EINTR)
+			return 0;
+
+		return -1;
+	}
+
+	*amount = (size_t)n;
+
+	return 0;
+}
+#endif
 
 /* cast a struct sockaddr_in6 * into addr for ipv6 */
 
@@ -471,6 +471,7 @@ try_pollout:
 					LWSSTATS_MS_WRITABLE_DELAY, ul);
 			lws_stats_atomic_max(wsi->context, pt,
 				  LWSSTATS_MS_WORST_WRITABLE_DELAY, ul);
+			lws_stats_hist_add(pt, LWSSTATS_H_WRITABLE_DELAY, ul);
 			wsi->active_writable_req_us = 0;
 		}
 #endif
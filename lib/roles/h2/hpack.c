@@ -190,16 +190,6 @@ static const char * const http2_canned[] = {
 
 #include "huftable.h"
 
-static int huftable_decode(int pos, char c)
-{
-	int q = pos + !!c;
-
-	if (lextable_terms[q >> 3] & (1 << (q & 7))) /* terminal */
-		return lextable[q] | 0x8000;
-
-	return pos + (lextable[q] << 1);
-}
-
 static int lws_frag_start(struct lws *wsi, int hdr_token_idx)
 {
 	struct allocated_headers *ah = wsi->http.ah;
@@ -355,6 +345,9 @@ static void lws_dump_header(struct lws *wsi, int hdr)
  * returns 0 if dynamic entry (arg and len are filled)
  * returns -1 if failure
  * returns nonzero token index if actually static token
+ *
+ * For a dynamic entry, arg points into the table's value ring and the value
+ * may wrap around the end of it, see lws_hpack_use_idx_hdr().
  */
 static int
 lws_token_from_index(struct lws *wsi, int index, const char **arg, int *len,
@@ -409,7 +402,7 @@ lws_token_from_index(struct lws *wsi, int index, const char **arg, int *len,
 		    dyn->entries[index].lws_hdr_idx);
 
 	if (arg && len) {
-		*arg = dyn->entries[index].value;
+		*arg = dyn->values + dyn->entries[index].value_ofs;
 		*len = dyn->entries[index].value_len;
 	}
 
@@ -447,10 +440,10 @@ lws_h2_dynamic_table_dump(struct lws *wsi)
 					dyn->entries[m].lws_hdr_idx);
 		else
 			p = "(ignored)";
-		lwsl_header("   %3d: tok %s: (len %d) val '%s'\n",
+		lwsl_header("   %3d: tok %s: (len %d) val ofs %u len %d\n",
 			    (int)(n + LWS_ARRAY_SIZE(static_token)), p,
-			    dyn->entries[m].hdr_len, dyn->entries[m].value ?
-			    dyn->entries[m].value : "null");
+			    dyn->entries[m].hdr_len, dyn->entries[m].value_ofs,
+			    dyn->entries[m].value_len);
 	}
 #endif
 	return 0;
@@ -462,8 +455,8 @@ lws_dynamic_free(struct hpack_dynamic_table *dyn, int idx)
 	lwsl_header("freeing %d for reuse\n", idx);
 	dyn->virtual_payload_usage -=  dyn->entries[idx].value_len +
 				dyn->entries[idx].hdr_len;
-	lws_free_set_NULL(dyn->entries[idx].value);
-	dyn->entries[idx].value = NULL;
+	/* it's always the oldest, so its value is at the tail of the ring */
+	dyn->values_used -= dyn->entries[idx].value_len;
 	dyn->entries[idx].value_len = 0;
 	dyn->entries[idx].hdr_len = 0;
 	dyn->entries[idx].lws_hdr_idx = LWS_HPACK_IGNORE_ENTRY;
@@ -484,12 +477,23 @@ lws_dynamic_free(struct hpack_dynamic_table *dyn, int idx)
  * becomes entry 1 etc.
  */
 
+static void
+lws_dynamic_evict_oldest(struct hpack_dynamic_table *dyn)
+{
+	int n = (dyn->pos - dyn->used_entries) % dyn->num_entries;
+
+	if (n < 0)
+		n += dyn->num_entries;
+	lws_dynamic_free(dyn, n);
+}
+
 static int
 lws_dynamic_token_insert(struct lws *wsi, int hdr_len,
 			 int lws_hdr_index, char *arg, int len)
 {
 	struct hpack_dynamic_table *dyn;
-	int new_index;
+	struct hpack_dt_entry *dte;
+	int new_index, n;
 
 	/* dynamic table only belongs to network wsi */
 	wsi = lws_get_network_wsi(wsi);
@@ -504,8 +508,12 @@ lws_dynamic_token_insert(struct lws *wsi, int hdr_len,
 	}
 	lws_h2_dynamic_table_dump(wsi);
 
+	/* a zero size table holds nothing */
+	if (!dyn->num_entries)
+		return 0;
+
 	new_index = (dyn->pos) % dyn->num_entries;
-	if (dyn->num_entries && dyn->used_entries == dyn->num_entries) {
+	if (dyn->used_entries == dyn->num_entries) {
 		if (dyn->virtual_payload_usage < dyn->virtual_payload_max)
 			lwsl_err("Dropping header content before limit!\n");
 		/* we have to drop the oldest to make space */
@@ -513,49 +521,61 @@ lws_dynamic_token_insert(struct lws *wsi, int hdr_len,
 	}
 
 	/*
-	 * evict guys to make room, allowing for some overage.  We have to
-	 * take care about getting a single huge header, and evicting
-	 * everything
+	 * A single header bigger than the whole table just empties it, and
+	 * isn't added (RFC7541 4.4)
 	 */
 
+	if ((uint32_t)(hdr_len + len) > dyn->virtual_payload_max + 1024) {
+		while (dyn->used_entries)
+			lws_dynamic_evict_oldest(dyn);
+
+		return 0;
+	}
+
+	/* evict guys to make room, allowing for some overage */
+
 	while (dyn->virtual_payload_usage &&
 	       dyn->used_entries &&
 	       dyn->virtual_payload_usage + hdr_len + len >
-				dyn->virtual_payload_max + 1024) {
-		int n = (dyn->pos - dyn->used_entries) % dyn->num_entries;
-		if (n < 0)
-			n += dyn->num_entries;
-		lws_dynamic_free(dyn, n);
-	}
+				dyn->virtual_payload_max + 1024)
+		lws_dynamic_evict_oldest(dyn);
 
-	if (dyn->used_entries < dyn->num_entries)
-		dyn->used_entries++;
-
-	dyn->entries[new_index].value_len = 0;
+	dte = &dyn->entries[new_index];
+	dte->value_ofs = dyn->values_head;
+	dte->value_len = 0;
 
 	if (lws_hdr_index != LWS_HPACK_IGNORE_ENTRY) {
-		if (dyn->entries[new_index].value)
-			lws_free_set_NULL(dyn->entries[new_index].value);
-		dyn->entries[new_index].value =
-				lws_malloc(len + 1, "hpack dyn");
-		if (!dyn->entries[new_index].value)
+		/*
+		 * The ring is sized to the usage limit, so after the eviction
+		 * above the value always fits
+		 */
+		if (dyn->values_used + len > dyn->values_size) {
+			lwsl_err("%s: value ring overflow\n", __func__);
 			return 1;
+		}
 
-		memcpy(dyn->entries[new_index].value, arg, len);
-		dyn->entries[new_index].value[len] = '\0';
-		dyn->entries[new_index].value_len = len;
-	} else
-		dyn->entries[new_index].value = NULL;
+		n = dyn->values_size - dyn->values_head;
+		if (n > len)
+			n = len;
+		memcpy(dyn->values + dyn->values_head, arg, n);
+		memcpy(dyn->values, arg + n, len - n);
+
+		dyn->values_head = (dyn->values_head + len) % dyn->values_size;
+		dyn->values_used += len;
+		dte->value_len = len;
+	}
+
+	if (dyn->used_entries < dyn->num_entries)
+		dyn->used_entries++;
 
-	dyn->entries[new_index].lws_hdr_idx = lws_hdr_index;
-	dyn->entries[new_index].hdr_len = hdr_len;
+	dte->lws_hdr_idx = lws_hdr_index;
+	dte->hdr_len = hdr_len;
 
 	dyn->virtual_payload_usage += hdr_len + len;
 
-	lwsl_info("%s: index %ld: lws_hdr_index 0x%x, hdr len %d, '%s' len %d\n",
+	lwsl_info("%s: index %ld: lws_hdr_index 0x%x, hdr len %d, len %d\n",
 		  __func__, (long)LWS_ARRAY_SIZE(static_token),
-		  lws_hdr_index, hdr_len, dyn->entries[new_index].value ?
-				 dyn->entries[new_index].value : "null", len);
+		  lws_hdr_index, hdr_len, len);
 
 	dyn->pos = (dyn->pos + 1) % dyn->num_entries;
 
@@ -569,8 +589,10 @@ lws_hpack_dynamic_size(struct lws *wsi, int size)
 {
 	struct hpack_dynamic_table *dyn;
 	struct hpack_dt_entry *dte;
+	uint32_t vsize, ofs = 0, k;
 	struct lws *nwsi;
-	int min, n = 0, m;
+	char *values;
+	int n = 0, m;
 
 	/*
 	 * "size" here is coming from the http/2 SETTING
@@ -597,7 +619,9 @@ lws_hpack_dynamic_size(struct lws *wsi, int size)
 		  (int)dyn->num_entries, size,
 		  nwsi->vhost->h2.set.s[H2SET_HEADER_TABLE_SIZE]);
 
-	if (size > (int)nwsi->vhost->h2.set.s[H2SET_HEADER_TABLE_SIZE]) {
+	/* a huge extended integer from the peer may look negative here */
+	if (size < 0 ||
+	    size > (int)nwsi->vhost->h2.set.s[H2SET_HEADER_TABLE_SIZE]) {
 		lwsl_info("rejecting hpack dyn size %u vs %u\n", size,
 				nwsi->vhost->h2.set.s[H2SET_HEADER_TABLE_SIZE]);
 
@@ -615,51 +639,62 @@ lws_hpack_dynamic_size(struct lws *wsi, int size)
 
 	dyn->virtual_payload_max = size;
 
+	/*
+	 * The ring holds the values of everything the usage accounting lets us
+	 * keep, which is up to the limit plus the overage allowed on insert
+	 */
+
+	vsize = size ? size + 1024 : 0;
 	size = size / 8;
-	min = size;
-	if (min > dyn->used_entries)
-		min = dyn->used_entries;
 
-	if (size == dyn->num_entries)
+	while (dyn->virtual_payload_usage && dyn->used_entries &&
+	       dyn->virtual_payload_usage > dyn->virtual_payload_max)
+		lws_dynamic_evict_oldest(dyn);
+
+	if (dyn->entries && size == dyn->num_entries &&
+	    vsize == dyn->values_size)
 		return 0;
 
-	if (dyn->num_entries < min)
-		min = dyn->num_entries;
+	while (dyn->used_entries > size)
+		lws_dynamic_evict_oldest(dyn);
 
 	// lwsl_notice("dte requested size %d\n", size);
 
-	dte = lws_zalloc(sizeof(*dte) * (size + 1), "dynamic table entries");
+	dte = lws_malloc(sizeof(*dte) * (size + 1) + vsize,
+			 "dynamic table entries");
 	if (!dte)
 		goto bail;
+	values = (char *)&dte[size + 1];
 
-	while (dyn->virtual_payload_usage && dyn->used_entries &&
-	       dyn->virtual_payload_usage > dyn->virtual_payload_max) {
-		n = (dyn->pos - dyn->used_entries) % dyn->num_entries;
-		if (n < 0)
-			n += dyn->num_entries;
-		lws_dynamic_free(dyn, n);
-	}
+	/* copy the survivors over oldest first, making their values linear */
 
-	if (min > dyn->used_entries)
-		min = dyn->used_entries;
+	for (n = 0; n < dyn->used_entries; n++) {
+		m = (dyn->pos - dyn->used_entries + n) % dyn->num_entries;
+		if (m < 0)
+			m += dyn->num_entries;
 
-	if (dyn->entries) {
-		for (n = 0; n < min; n++) {
-			m = (dyn->pos - dyn->used_entries + n) %
-						dyn->num_entries;
-			if (m < 0)
-				m += dyn->num_entries;
-			dte[n] = dyn->entries[m];
-		}
+		dte[n] = dyn->entries[m];
+		dte[n].value_ofs = ofs;
 
-		lws_free(dyn->entries);
+		k = dyn->values_size - dyn->entries[m].value_ofs;
+		if (k > dte[n].value_len)
+			k = dte[n].value_len;
+		memcpy(values + ofs, dyn->values + dyn->entries[m].value_ofs, k);
+		memcpy(values + ofs + k, dyn->values, dte[n].value_len - k);
+		ofs += dte[n].value_len;
 	}
 
+	if (dyn->entries)
+		lws_free(dyn->entries);
+
 	dyn->entries = dte;
+	dyn->values = values;
+	dyn->values_size = vsize;
+	dyn->values_used = ofs;
+	dyn->values_head = vsize ? ofs % vsize : 0;
 	dyn->num_entries = size;
-	dyn->used_entries = min;
 	if (size)
-		dyn->pos = min % size;
+		dyn->pos = dyn->used_entries % size;
 	else
 		dyn->pos = 0;
 
@@ -677,21 +712,28 @@ void
 lws_hpack_destroy_dynamic_header(struct lws *wsi)
 {
 	struct hpack_dynamic_table *dyn;
+	struct hpack_enc_table *enc;
 	int n;
 
 	if (!wsi->h2.h2n)
 		return;
 
-	dyn = &wsi->h2.h2n->hpack_dyn_table;
+	enc = &wsi->h2.h2n->hpack_enc;
+	if (enc->entries) {
+		for (n = 0; n < enc->num_entries; n++)
+			if (enc->entries[n].nv)
+				lws_free_set_NULL(enc->entries[n].nv);
 
-	if (!dyn->entries)
-		return;
+		lws_free_set_NULL(enc->entries);
+	}
+	if (enc->scratch)
+		lws_free_set_NULL(enc->scratch);
 
-	for (n = 0; n < dyn->num_entries; n++)
-		if (dyn->entries[n].value)
-			lws_free_set_NULL(dyn->entries[n].value);
+	dyn = &wsi->h2.h2n->hpack_dyn_table;
 
-	lws_free_set_NULL(dyn->entries);
+	/* the value ring is part of the same allocation */
+	if (dyn->entries)
+		lws_free_set_NULL(dyn->entries);
 }
 
 static int
@@ -716,8 +758,8 @@ lws_hpack_use_idx_hdr(struct lws *wsi, int idx, int known_token)
 		/* dynamic result */
 		if (known_token > 0)
 			tok = known_token;
-		lwsl_header("%s: dyn: idx %d '%s' tok %d\n", __func__, idx, arg,
-			   tok);
+		lwsl_header("%s: dyn: idx %d len %d tok %d\n", __func__, idx,
+			    len, tok);
 	} else
 		lwsl_header("writing indexed hdr %d (tok %d '%s')\n", idx, tok,
 				lws_token_to_string(tok));
@@ -734,10 +776,22 @@ lws_hpack_use_idx_hdr(struct lws *wsi, int idx, int known_token)
 	if (lws_frag_start(wsi, tok))
 		return 1;
 
-	if (p)
-		while (*p && len--)
+	if (p && idx >= (int)LWS_ARRAY_SIZE(static_token)) {
+		const struct hpack_dynamic_table *dyn =
+			&lws_get_network_wsi(wsi)->h2.h2n->hpack_dyn_table;
+
+		/* the value may wrap around the end of the ring */
+		while (len--) {
 			if (lws_frag_append(wsi, *p++))
 				return 1;
+			if (p == dyn->values + dyn->values_size)
+				p = dyn->values;
+		}
+	} else
+		if (p)
+			while (*p && len--)
+				if (lws_frag_append(wsi, *p++))
+					return 1;
 
 	if (lws_frag_end(wsi))
 		return 1;
@@ -784,9 +838,9 @@ int lws_hpack_interpret(struct lws *wsi, unsigned char c)
 	struct lws *nwsi = lws_get_network_wsi(wsi);
 	struct lws_h2_netconn *h2n = nwsi->h2.h2n;
 	struct allocated_headers *ah = wsi->http.ah;
-	unsigned int prev;
-	unsigned char c1;
-	int n, m, plen;
+	const struct huftable_nib *hn;
+	unsigned char c1, sym[2];
+	int n, m, plen, syms;
 
 	if (!h2n)
 		return -1;
@@ -804,8 +858,6 @@ int lws_hpack_interpret(struct lws *wsi, unsigned char c)
 
 	case HPKS_TYPE:
 		h2n->is_first_header_char = 1;
-		h2n->huff_pad = 0;
-		h2n->zero_huff_padding = 0;
 		h2n->last_action_dyntable_resize = 0;
 		h2n->ext_count = 0;
 		h2n->hpack_hdr_len = 0;
@@ -955,8 +1007,8 @@ int lws_hpack_interpret(struct lws *wsi, unsigned char c)
 
 		switch (h2n->hpack_type) {
 		case HPKT_INDEXED_HDR_7:
-			if (lws_hpack_use_idx_hdr(wsi, h2n->hpack_len,
-						  h2n->hdr_idx)) {
+			/* hdr_idx only holds the 7-bit prefix, not a token */
+			if (lws_hpack_use_idx_hdr(wsi, h2n->hpack_len, -1)) {
 				lwsl_notice("%s: hd7 use fail\n", __func__);
 				return 1;
 			}
@@ -986,6 +1038,7 @@ int lws_hpack_interpret(struct lws *wsi, unsigned char c)
 	case HPKS_HLEN: /* [ H | 7+ ] */
 		h2n->huff = !!(c & 0x80);
 		h2n->hpack_pos = 0;
+		h2n->huff_accept = 1;
 		h2n->hpack_len = c & 0x7f;
 
 		if (h2n->hpack_len == 0x7f) {
@@ -1043,6 +1096,10 @@ pre_data:
 			}
 			break;
 		}
+
+		/* an empty value has no data bytes to complete it */
+		if (!h2n->hpack_len)
+			goto string_done;
 		break;
 
 	case HPKS_HLEN_EXT:
@@ -1057,39 +1114,35 @@ pre_data:
 
 	case HPKS_DATA:
 		//lwsl_header(" 0x%02X huff %d\n", c, h2n->huff);
-			c1 = c;
-
-		for (n = 0; n < 8; n++) {
-			if (h2n->huff) {
-				char b = (c >> 7) & 1;
-				prev = h2n->hpack_pos;
-				h2n->hpack_pos = huftable_decode(
-						h2n->hpack_pos, b);
-				c <<= 1;
-				if (h2n->hpack_pos == 0xffff) {
-					lwsl_notice("Huffman err\n");
-					return 1;
-				}
-				if (!(h2n->hpack_pos & 0x8000)) {
-					if (!b)
-						h2n->zero_huff_padding = 1;
-					h2n->huff_pad++;
-					continue;
-				}
-				c1 = h2n->hpack_pos & 0x7fff;
-				h2n->hpack_pos = 0;
-				h2n->huff_pad = 0;
-				h2n->zero_huff_padding = 0;
+		sym[0] = c;
+		syms = 1;
 
+		if (h2n->huff) {
+			/*
+			 * One table step per nibble.  Codes are at least 5
+			 * bits, so each step completes at most one symbol
+			 */
+			syms = 0;
+			for (n = 0; n < 2; n++) {
+				hn = &huftable_nib[h2n->hpack_pos]
+						  [n ? c & 0xf : c >> 4];
 				/* EOS |11111111|11111111|11111111|111111 */
-				if (!c1 && prev == HUFTABLE_0x100_PREV) {
+				if (hn->flags & HUFTABLE_FAIL) {
 					lws_h2_goaway(nwsi,
 						H2_ERR_COMPRESSION_ERROR,
 						"Huffman EOT seen");
 					return 1;
 				}
-			} else
-				n = 8;
+				if (hn->flags & HUFTABLE_SYM)
+					sym[syms++] = hn->sym;
+				h2n->hpack_pos = hn->state;
+				h2n->huff_accept = !!(hn->flags &
+						      HUFTABLE_ACCEPT);
+			}
+		}
+
+		for (n = 0; n < syms; n++) {
+			c1 = sym[n];
 
 			if (h2n->value) { /* value */
 
@@ -1154,20 +1207,21 @@ pre_data:
 			}
 swallow:
 			(void)n;
-		} // for n
+		} // for syms
 
 		if (--h2n->hpack_len)
 			break;
 
+string_done:
+
 		/*
 		 * The header (h2n->value = 0) or the payload (h2n->value = 1)
 		 * is complete.
 		 */
 
-		if (h2n->huff && (h2n->huff_pad > 7 ||
-		    (h2n->zero_huff_padding && h2n->huff_pad))) {
-			lwsl_info("zero_huff_padding: %d huff_pad: %d\n",
-				    h2n->zero_huff_padding, h2n->huff_pad);
+		/* padding must be the msbs of EOS, ie, 1s, and < 8 bits */
+		if (h2n->huff && !h2n->huff_accept) {
+			lwsl_info("Huffman padding bad\n");
 			lws_h2_goaway(nwsi, H2_ERR_COMPRESSION_ERROR,
 				      "Huffman padding excessive or wrong");
 			return 1;
@@ -1203,8 +1257,6 @@ swallow:
 		if (!h2n->value) {
 			h2n->value = 1;
 			h2n->hpack = HPKS_HLEN;
-			h2n->huff_pad = 0;
-			h2n->zero_huff_padding = 0;
 			h2n->ext_count = 0;
 			break;
 		}
@@ -1298,40 +1350,234 @@ add_it:
 
 
 
+/*
+ * HPACK encoder
+ *
+ * lws_add_http2_header_...() only emit representations that don't depend on,
+ * or change, the dynamic table: static indexes where possible, otherwise
+ * literals without Huffman coding.  When the block is written, if it's all
+ * in one HEADERS frame, it's recoded using the dynamic table, choosing what
+ * to add to it and Huffman-coding strings where that is shorter.
+ */
+
 static int
-lws_h2_num_start(int starting_bits, unsigned long num)
+lws_hpack_int(unsigned int flags, int bits, unsigned long num,
+	      unsigned char **p, unsigned char *end)
 {
-	unsigned int mask = (1 << starting_bits) - 1;
+	unsigned long mask = (1ul << bits) - 1;
 
-	if (num < mask)
-		return (int)num;
+	if (*p >= end)
+		return 1;
 
-	return mask;
+	if (num < mask) {
+		*((*p)++) = (unsigned char)(flags | num);
+		return 0;
+	}
+
+	*((*p)++) = (unsigned char)(flags | mask);
+	num -= mask;
+	do {
+		if (*p >= end)
+			return 1;
+		*((*p)++) = (unsigned char)((num > 127 ? 0x80 : 0) |
+					    (num & 0x7f));
+		num >>= 7;
+	} while (num);
+
+	return 0;
 }
 
 static int
-lws_h2_num(int starting_bits, unsigned long num,
-			 unsigned char **p, unsigned char *end)
+lws_hpack_int_get(int bits, const unsigned char **p, const unsigned char *end,
+		  uint32_t *num)
 {
-	unsigned int mask = (1 << starting_bits) - 1;
+	uint32_t mask = (1u << bits) - 1;
+	int sh = 0;
+
+	if (*p >= end)
+		return 1;
 
-	if (num < mask)
+	*num = *((*p)++) & mask;
+	if (*num < mask)
 		return 0;
 
-	num -= mask;
 	do {
-		if (num > 127)
-			*((*p)++) = 0x80 | (num & 0x7f);
-		else
-			*((*p)++) = 0x00 | (num & 0x7f);
-		if (*p >= end)
+		if (*p >= end || sh > 21)
 			return 1;
-		num >>= 7;
-	} while (num);
+		*num += (uint32_t)(**p & 0x7f) << sh;
+		sh += 7;
+	} while (*((*p)++) & 0x80);
+
+	return 0;
+}
+
+static int
+lws_hpack_str(const unsigned char *str, int len, int lower, int huff,
+	      unsigned char **p, unsigned char *end)
+{
+	unsigned long bits = 0;
+	uint64_t acc = 0;
+	int n, nb = 0;
+
+	for (n = 0; huff && n < len; n++)
+		bits += huftable_enc_len[str[n]];
+	bits = (bits + 7) >> 3;
+
+	if (!huff || (int)bits >= len) {
+		/* Huffman doesn't help, send it as it is */
+		if (lws_hpack_int(0, 7, (unsigned long)len, p, end) ||
+		    end - *p < len)
+			return 1;
+
+		for (n = 0; n < len; n++)
+			*((*p)++) = lower ? (unsigned char)tolower(str[n]) :
+					    str[n];
+
+		return 0;
+	}
+
+	if (lws_hpack_int(0x80, 7, bits, p, end) ||
+	    end - *p < (int)bits)
+		return 1;
+
+	for (n = 0; n < len; n++) {
+		acc = (acc << huftable_enc_len[str[n]]) |
+		      huftable_enc_code[str[n]];
+		nb += huftable_enc_len[str[n]];
+		while (nb >= 8) {
+			nb -= 8;
+			*((*p)++) = (unsigned char)(acc >> nb);
+		}
+	}
+
+	/* pad with the msbs of EOS, ie, 1s */
+
+	if (nb)
+		*((*p)++) = (unsigned char)((acc << (8 - nb)) |
+					    ((1 << (8 - nb)) - 1));
+
+	return 0;
+}
+
+static int
+lws_hpack_str_get(const unsigned char **p, const unsigned char *end,
+		  const unsigned char **str, uint32_t *len)
+{
+	/* we only produce raw strings in the stateless encoding */
+
+	if (*p >= end || (**p & 0x80) ||
+	    lws_hpack_int_get(7, p, end, len) ||
+	    (uint32_t)lws_ptr_diff(end, *p) < *len)
+		return 1;
+
+	*str = *p;
+	*p += *len;
+
+	return 0;
+}
+
+static int
+lws_hpack_name_eq(const char *lc, const unsigned char *name, int nlen)
+{
+	while (nlen--)
+		if (*lc++ != tolower(*name++))
+			return 0;
+
+	return 1;
+}
+
+static int
+lws_hpack_static_idx_by_name(const unsigned char *name, int nlen)
+{
+	int n;
+
+	for (n = 1; n < (int)LWS_ARRAY_SIZE(static_token); n++)
+		if (static_hdr_len[n] == nlen &&
+		    lws_hpack_name_eq((const char *)lws_token_to_string(
+				     (enum lws_token_indexes)static_token[n]),
+				      name, nlen))
+			return n;
+
+	return 0;
+}
+
+static int
+lws_hpack_static_idx_by_token(enum lws_token_indexes token)
+{
+	int n;
+
+	for (n = 1; n < (int)LWS_ARRAY_SIZE(static_token); n++)
+		if (static_token[n] == token)
+			return n;
 
 	return 0;
 }
 
+/*
+ * Whether we would add a header with this static name index to the dynamic
+ * table: not if it's sensitive, nor if it's likely unique to this response
+ */
+
+enum {
+	LWS_HPACK_ENC_INDEX,
+	LWS_HPACK_ENC_NO_INDEX,
+	LWS_HPACK_ENC_NEVER_INDEX,
+};
+
+static int
+lws_hpack_static_idx_class(int sidx)
+{
+	switch (sidx) {
+	case 23: /* authorization */
+	case 32: /* cookie */
+	case 49: /* proxy-authorization */
+	case 55: /* set-cookie */
+		return LWS_HPACK_ENC_NEVER_INDEX;
+	case 4:  /* :path */
+	case 21: /* age */
+	case 28: /* content-length */
+	case 30: /* content-range */
+	case 33: /* date */
+	case 34: /* etag */
+	case 36: /* expires */
+	case 40: /* if-modified-since */
+	case 41: /* if-none-match */
+	case 44: /* last-modified */
+	case 46: /* location */
+		return LWS_HPACK_ENC_NO_INDEX;
+	}
+
+	return LWS_HPACK_ENC_INDEX;
+}
+
+static int
+lws_hpack_encode_stateless(int sidx, const unsigned char *name, int nlen,
+			   const unsigned char *value, int vlen,
+			   unsigned char **p, unsigned char *end)
+{
+	int n;
+
+	/* the static table also has some complete headers */
+
+	for (n = 1; sidx && n < (int)LWS_ARRAY_SIZE(http2_canned); n++)
+		if (static_token[n] == static_token[sidx] &&
+		    http2_canned[n][0] &&
+		    (int)strlen(http2_canned[n]) == vlen &&
+		    !memcmp(http2_canned[n], value, (unsigned int)vlen))
+			return lws_hpack_int(0x80, 7, (unsigned long)n, p, end);
+
+	/*
+	 * upper-case header names are verboten in h2, but OK on h1, so
+	 * they're not illegal per se.  Silently convert them for h2...
+	 */
+
+	return lws_hpack_int(lws_hpack_static_idx_class(sidx) ==
+				LWS_HPACK_ENC_NEVER_INDEX ? 0x10 : 0x00,
+			     4, (unsigned long)sidx, p, end) ||
+	       (!sidx && lws_hpack_str(name, nlen, 1, 0, p, end)) ||
+	       lws_hpack_str(value, vlen, 0, 0, p, end);
+}
+
 int lws_add_http2_header_by_name(struct lws *wsi, const unsigned char *name,
 				 const unsigned char *value, int length,
 				 unsigned char **p, unsigned char *end)
@@ -1352,42 +1598,292 @@ int lws_add_http2_header_by_name(struct lws *wsi, const unsigned char *name,
 		return 0;
 	}
 
-	if (end - *p < len + length + 8)
+	return lws_hpack_encode_stateless(
+			lws_hpack_static_idx_by_name(name, len),
+			name, len, value, length, p, end);
+}
+
+int lws_add_http2_header_by_token(struct lws *wsi, enum lws_token_indexes token,
+				  const unsigned char *value, int length,
+				  unsigned char **p, unsigned char *end)
+{
+	const unsigned char *name;
+	int len;
+
+	name = lws_token_to_string(token);
+	if (!name)
 		return 1;
 
-	*((*p)++) = 0; /* literal hdr, literal name,  */
+	len = (int)strlen((char *)name);
+	if (len && name[len - 1] == ':')
+		len--;
+
+	if (wsi->http2_substream && token == WSI_TOKEN_HTTP_TRANSFER_ENCODING) {
+		lwsl_header("rejecting %s\n", name);
 
-	*((*p)++) = 0 | lws_h2_num_start(7, len); /* non-HUF */
-	if (lws_h2_num(7, len, p, end))
+		return 0;
+	}
+
+	lwsl_header("%s: %p  %s:%s\n", __func__, *p, name, value);
+
+	return lws_hpack_encode_stateless(lws_hpack_static_idx_by_token(token),
+					  name, len, value, length, p, end);
+}
+
+#define lws_hpack_enc_ent(_e, _i) \
+		(&(_e)->entries[((_e)->first + (_i)) % (_e)->num_entries])
+
+static void
+lws_hpack_enc_evict_oldest(struct hpack_enc_table *enc)
+{
+	struct hpack_enc_entry *d = lws_hpack_enc_ent(enc, 0);
+
+	enc->size -= (uint32_t)d->name_len + d->value_len + 32;
+	lws_free_set_NULL(d->nv);
+	enc->first = (uint16_t)((enc->first + 1) % enc->num_entries);
+	enc->used--;
+}
+
+static int
+lws_hpack_enc_add(struct hpack_enc_table *enc, const unsigned char *name,
+		  uint32_t nlen, const unsigned char *value, uint32_t vlen)
+{
+	uint32_t sz = nlen + vlen + 32;
+	struct hpack_enc_entry *d;
+
+	/* don't let one header flush out everything else */
+
+	if (sz > enc->max / 2)
 		return 1;
 
-	/* upper-case header names are verboten in h2, but OK on h1, so
-	 * they're not illegal per se.  Silently convert them for h2... */
+	if (!enc->entries) {
+		enc->num_entries = (LWS_H2_HPACK_ENC_TABLE_MAX / 32) + 1;
+		enc->entries = lws_zalloc(sizeof(*enc->entries) *
+					  enc->num_entries, "hpack enc");
+		if (!enc->entries) {
+			enc->num_entries = 0;
+			return 1;
+		}
+	}
 
-	while(len--)
-		*((*p)++) = tolower((int)*name++);
+	while (enc->used && (enc->size + sz > enc->max ||
+			     enc->used == enc->num_entries))
+		lws_hpack_enc_evict_oldest(enc);
 
-	*((*p)++) = 0 | lws_h2_num_start(7, length); /* non-HUF */
-	if (lws_h2_num(7, length, p, end))
+	d = lws_hpack_enc_ent(enc, enc->used);
+	d->nv = lws_malloc(nlen + vlen, "hpack enc ent");
+	if (!d->nv)
 		return 1;
 
-	memcpy(*p, value, length);
-	*p += length;
+	memcpy(d->nv, name, nlen);
+	memcpy(d->nv + nlen, value, vlen);
+	d->name_len = (uint16_t)nlen;
+	d->value_len = (uint16_t)vlen;
+
+	enc->size += sz;
+	enc->used++;
 
 	return 0;
 }
 
-int lws_add_http2_header_by_token(struct lws *wsi, enum lws_token_indexes token,
-				  const unsigned char *value, int length,
-				  unsigned char **p, unsigned char *end)
+/*
+ * Parse a block made by lws_hpack_encode_stateless(), and unless dry, emit
+ * it recoded against, and updating, the dynamic table
+ */
+
+static int
+lws_hpack_enc_recode(struct hpack_enc_table *enc, const unsigned char *in,
+		     size_t len, unsigned char **p, unsigned char *end, int dry)
 {
-	const unsigned char *name;
+	const unsigned char *ie = in + len, *name, *value;
+	uint32_t sidx, nlen, vlen;
+	struct hpack_enc_entry *d;
+	int k, hi, nidx, cls;
+
+	while (in < ie) {
+		if (*in & 0x80) {
+			if (lws_hpack_int_get(7, &in, ie, &sidx) ||
+			    !sidx || sidx >= LWS_ARRAY_SIZE(static_token))
+				return 1;
+			if (!dry && lws_hpack_int(0x80, 7, sidx, p, end))
+				return 1;
+			continue;
+		}
+
+		if (*in & 0xe0)
+			return 1;
+
+		cls = *in & 0x10 ? LWS_HPACK_ENC_NEVER_INDEX :
+				   LWS_HPACK_ENC_INDEX;
+		if (lws_hpack_int_get(4, &in, ie, &sidx) ||
+		    sidx >= LWS_ARRAY_SIZE(static_token))
+			return 1;
+
+		if (sidx) {
+			name = lws_token_to_string(
+				     (enum lws_token_indexes)static_token[sidx]);
+			if (!name)
+				return 1;
+			nlen = static_hdr_len[sidx];
+			if (cls != LWS_HPACK_ENC_NEVER_INDEX)
+				cls = lws_hpack_static_idx_class((int)sidx);
+		} else
+			if (lws_hpack_str_get(&in, ie, &name, &nlen))
+				return 1;
+
+		if (lws_hpack_str_get(&in, ie, &value, &vlen))
+			return 1;
+
+		if (dry)
+			continue;
+
+		/* is it, or its name, in the dynamic table already? */
+
+		hi = 0;
+		nidx = (int)sidx;
+		for (k = enc->used - 1;
+		     cls != LWS_HPACK_ENC_NEVER_INDEX && k >= 0; k--) {
+			d = lws_hpack_enc_ent(enc, k);
+			if (d->name_len != nlen ||
+			    memcmp(d->nv, name, nlen))
+				continue;
+			if (!nidx)
+				nidx = 62 + (enc->used - 1 - k);
+			if (d->value_len == vlen &&
+			    !memcmp(d->nv + nlen, value, vlen)) {
+				hi = 62 + (enc->used - 1 - k);
+				break;
+			}
+		}
+
+		if (hi) {
+			if (lws_hpack_int(0x80, 7, (unsigned long)hi, p, end))
+				return 1;
+			continue;
+		}
+
+		/* the name index must refer to the table before the add */
+
+		if (cls == LWS_HPACK_ENC_NEVER_INDEX) {
+			if (lws_hpack_int(0x10, 4, (unsigned long)nidx, p, end))
+				return 1;
+		} else
+			if (cls == LWS_HPACK_ENC_INDEX &&
+			    !lws_hpack_enc_add(enc, name, nlen, value, vlen)) {
+				if (lws_hpack_int(0x40, 6, (unsigned long)nidx,
+						  p, end))
+					return 1;
+			} else
+				if (lws_hpack_int(0, 4, (unsigned long)nidx,
+						  p, end))
+					return 1;
+
+		if ((!nidx && lws_hpack_str(name, (int)nlen, 0, 1, p, end)) ||
+		    lws_hpack_str(value, (int)vlen, 0, 1, p, end))
+			return 1;
+	}
+
+	return 0;
+}
+
+void
+lws_hpack_enc_peer_table_size(struct lws *nwsi, uint32_t size)
+{
+	struct hpack_enc_table *enc = &nwsi->h2.h2n->hpack_enc;
+
+	if (!enc->initialized) {
+		enc->max = 4096; /* until we say otherwise, per RFC7541 */
+		enc->initialized = 1;
+	}
+
+	enc->peer_max = size;
+	if (size > LWS_H2_HPACK_ENC_TABLE_MAX)
+		size = LWS_H2_HPACK_ENC_TABLE_MAX;
+
+	enc->size_update = size != enc->max;
+}
+
+/*
+ * Called as a HEADERS or CONTINUATION frame is written, with the block or
+ * a fragment of it... *buf may be moved back by a few bytes into the LWS_PRE
+ * area and *len adjusted.  Blocks split over several frames are sent as they
+ * are, which is fine since they don't touch the dynamic table.
+ */
+
+int
+lws_hpack_enc_block(struct lws *wsi, int first, int end_headers,
+		    unsigned char **buf, size_t *len)
+{
+	struct lws *nwsi = lws_get_network_wsi(wsi);
+	unsigned char pre[8], *p = pre, *q;
+	struct hpack_enc_table *enc;
+	size_t olen;
+
+	if (!nwsi->h2.h2n || !first)
+		return 0;
+
+	enc = &nwsi->h2.h2n->hpack_enc;
+	if (!enc->initialized)
+		lws_hpack_enc_peer_table_size(nwsi, 4096);
+
+	if (enc->size_update) {
+		/*
+		 * A size update of 0 first empties the peer's table, if
+		 * we had to abandon our copy
+		 */
+		if (enc->size_update == 2)
+			*p++ = 0x20;
+		enc->max = enc->peer_max;
+		if (enc->max > LWS_H2_HPACK_ENC_TABLE_MAX)
+			enc->max = LWS_H2_HPACK_ENC_TABLE_MAX;
+		while (enc->used && enc->size > enc->max)
+			lws_hpack_enc_evict_oldest(enc);
+		lws_hpack_int(0x20, 5, enc->max, &p, pre + sizeof(pre));
+		enc->size_update = 0;
+	}
+
+	if (!end_headers ||
+	    lws_hpack_enc_recode(enc, *buf, *len, NULL, NULL, 1))
+		goto as_is;
+
+	/* the recoded block is never longer than the stateless one */
+
+	if (enc->scratch_len < *len + sizeof(pre)) {
+		q = lws_realloc(enc->scratch, *len + sizeof(pre), "hpack enc");
+		if (!q)
+			goto as_is;
+		enc->scratch = q;
+		enc->scratch_len = (uint32_t)(*len + sizeof(pre));
+	}
+
+	olen = (size_t)lws_ptr_diff(p, pre);
+	memcpy(enc->scratch, pre, olen);
+	q = enc->scratch + olen;
+	if (lws_hpack_enc_recode(enc, *buf, *len, &q,
+				 enc->scratch + enc->scratch_len, 0)) {
+		/* we may have changed the table, start it again */
+		while (enc->used)
+			lws_hpack_enc_evict_oldest(enc);
+		enc->size_update = 2;
 
-	name = lws_token_to_string(token);
-	if (!name)
 		return 1;
+	}
+
+	olen = (size_t)lws_ptr_diff(q, enc->scratch);
+	if (olen > *len)
+		*buf -= olen - *len;
+	memcpy(*buf, enc->scratch, olen);
+	*len = olen;
 
-	return lws_add_http2_header_by_name(wsi, name, value, length, p, end);
+	return 0;
+
+as_is:
+	olen = (size_t)lws_ptr_diff(p, pre);
+	*buf -= olen;
+	memcpy(*buf, pre, olen);
+	*len += olen;
+
+	return 0;
 }
 
 int lws_add_http2_header_status(struct lws *wsi, unsigned int code,
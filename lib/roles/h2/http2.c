@@ -131,7 +131,23 @@ lws_h2_new_pps(enum lws_h2_protocol_send_type type)
 
 void lws_h2_init(struct lws *wsi)
 {
+	int64_t rx_win = (int64_t)wsi->vhost->h2.set.s[
+				H2SET_INITIAL_WINDOW_SIZE] + LWS_H2_RX_WIN_OPEN;
+
 	wsi->h2.h2n->set = wsi->vhost->h2.set;
+	/*
+	 * Until the peer's SETTINGS say otherwise, its streams start with the
+	 * default window, not ours... a peer happy with the default never
+	 * sends it, and assuming ours overruns tx_cr on its first update
+	 */
+	wsi->h2.h2n->set.s[H2SET_INITIAL_WINDOW_SIZE] =
+			lws_h2_defaults.s[H2SET_INITIAL_WINDOW_SIZE];
+	/* our initial window may be up to 2^31 - 1 already */
+	if (rx_win > 0x7fffffff)
+		rx_win = 0x7fffffff;
+	wsi->h2.h2n->rx_win = (int)rx_win;
+	/* the connection's window always starts at 65535 (RFC7540 6.9.2) */
+	wsi->h2.peer_tx_cr_est = 65535;
 }
 
 void
@@ -195,6 +211,7 @@ lws_wsi_server_new(struct lws_vhost *vh, struct lws *parent_wsi,
 	parent_wsi->h2.child_count++;
 
 	wsi->h2.my_priority = 16;
+	wsi->h2.sched_pass = nwsi->h2.h2n->sched_vclock;
 	wsi->h2.tx_cr = nwsi->h2.h2n->set.s[H2SET_INITIAL_WINDOW_SIZE];
 	wsi->h2.peer_tx_cr_est =
 			nwsi->vhost->h2.set.s[H2SET_INITIAL_WINDOW_SIZE];
@@ -259,6 +276,7 @@ lws_wsi_h2_adopt(struct lws *parent_wsi, struct lws *wsi)
 	parent_wsi->h2.child_count++;
 
 	wsi->h2.my_priority = 16;
+	wsi->h2.sched_pass = nwsi->h2.h2n->sched_vclock;
 	wsi->h2.tx_cr = nwsi->h2.h2n->set.s[H2SET_INITIAL_WINDOW_SIZE];
 	wsi->h2.peer_tx_cr_est =
 			nwsi->vhost->h2.set.s[H2SET_INITIAL_WINDOW_SIZE];
@@ -430,6 +448,7 @@ lws_h2_settings(struct lws *wsi, struct http2_settings *settings,
 
 		switch (a) {
 		case H2SET_HEADER_TABLE_SIZE:
+			lws_hpack_enc_peer_table_size(nwsi, b);
 			break;
 		case H2SET_ENABLE_PUSH:
 			if (b > 1) {
@@ -551,8 +570,333 @@ lws_h2_tx_cr_consume(struct lws *wsi, int consumed)
 
 	wsi->h2.tx_cr -= consumed;
 
-	if (nwsi != wsi)
+	if (nwsi != wsi) {
 		nwsi->h2.tx_cr -= consumed;
+		/* streams pay for what they send, in proportion to weight */
+		wsi->h2.sched_pass += ((uint64_t)consumed << 8) /
+				      (unsigned int)wsi->h2.my_priority;
+	}
+}
+
+/*
+ * Receive windows
+ *
+ * We keep the peer's window for sending to us on each stream, and on the
+ * connection, topped up to the connection's rx_win.  That starts out as
+ * the initial window plus LWS_H2_RX_WIN_OPEN, which is fine locally but
+ * holds an upload to rx_win per RTT on a long fat link.
+ *
+ * So while DATA is arriving, we keep one PING outstanding and count the
+ * DATA that arrives until it's ACKed: that's about what the peer could send
+ * in one RTT, the bandwidth-delay product.  If that was most of rx_win and
+ * the bandwidth was the best seen, the window was what limited the peer, so
+ * rx_win grows to twice the sample, within LWS_H2_RX_WIN_MAX and what's
+ * left of the vhost's rx window budget.
+ */
+
+static const uint8_t bdp_ping_payload[] = { 'l', 'w', 's', '-', 'b', 'd', 'p', 0 };
+
+static void
+lws_h2_rtt_sample(struct lws_h2_netconn *h2n, lws_usec_t rtt)
+{
+	if (rtt < 1)
+		rtt = 1;
+	if (!h2n->rtt_min || rtt < h2n->rtt_min)
+		h2n->rtt_min = rtt;
+}
+
+static int
+lws_h2_rx_win_update(struct lws *nwsi, struct lws *wsi, int force)
+{
+	struct lws_h2_netconn *h2n = nwsi->h2.h2n;
+	struct lws_h2_protocol_send *pps;
+	int64_t credit = (int64_t)h2n->rx_win - wsi->h2.peer_tx_cr_est;
+
+	/* if the peer overran it, one update can still only be 2^31 - 1 */
+	if (credit > 0x7fffffff)
+		credit = 0x7fffffff;
+
+	/*
+	 * Unless forced, wait until a quarter of it was used... if we waited
+	 * for half, the peer could only keep half of it in flight
+	 */
+	if (credit <= 0 || (!force && credit < h2n->rx_win / 4))
+		return 0;
+
+	pps = lws_h2_new_pps(LWS_H2_PPS_UPDATE_WINDOW);
+	if (!pps)
+		return 1;
+
+	pps->u.update_window.sid = wsi == nwsi ? 0 : wsi->h2.my_sid;
+	pps->u.update_window.credit = (uint32_t)credit;
+	wsi->h2.peer_tx_cr_est += (int)credit;
+	lws_pps_schedule(nwsi, pps);
+
+	return 0;
+}
+
+static int
+lws_h2_bdp_rx(struct lws *nwsi, int n)
+{
+	struct lws_h2_netconn *h2n = nwsi->h2.h2n;
+	struct lws_vhost *vh = nwsi->vhost;
+	struct lws_h2_protocol_send *pps;
+
+	if (h2n->bdp_ping_inflight) {
+		h2n->bdp_bytes += (uint32_t)n;
+
+		return 0;
+	}
+
+	if (h2n->rx_win >= LWS_H2_RX_WIN_MAX ||
+	    vh->h2.rx_win_committed >= vh->h2.rx_win_budget)
+		/* nothing to gain by measuring */
+		return 0;
+
+	pps = lws_h2_new_pps(LWS_H2_PPS_PING);
+	if (!pps)
+		return 1;
+
+	memcpy(pps->u.ping.ping_payload, bdp_ping_payload, 8);
+	h2n->bdp_ping_inflight = 1;
+	/* the count and the clock start when it's actually sent */
+	lws_pps_schedule(nwsi, pps);
+
+	return 0;
+}
+
+static void
+lws_h2_bdp_pong(struct lws *nwsi)
+{
+	struct lws_h2_netconn *h2n = nwsi->h2.h2n;
+	struct lws_vhost *vh = nwsi->vhost;
+	uint64_t bw, target;
+	lws_usec_t rtt;
+	int grow;
+
+	if (!h2n->bdp_ping_inflight ||
+	    memcmp(h2n->ping_payload, bdp_ping_payload, 8))
+		return;
+
+	h2n->bdp_ping_inflight = 0;
+	rtt = lws_time_in_microseconds() - h2n->bdp_ping_us;
+	if (rtt < 1)
+		rtt = 1;
+	lws_h2_rtt_sample(h2n, rtt);
+
+	bw = ((uint64_t)h2n->bdp_bytes * 1000000) / (uint64_t)rtt;
+	if (bw > h2n->bdp_bw_max)
+		h2n->bdp_bw_max = bw;
+
+	if ((uint64_t)h2n->bdp_bytes * 3 < (uint64_t)h2n->rx_win * 2 ||
+	    bw < h2n->bdp_bw_max)
+		/* the window didn't hold it back, or the link got slower */
+		return;
+
+	/*
+	 * The ping RTT includes however long it queued behind DATA, growing
+	 * the window for that only queues more... so size it from the best
+	 * RTT we have seen
+	 */
+	target = (bw * (uint64_t)h2n->rtt_min * 2) / 1000000;
+	if (target > LWS_H2_RX_WIN_MAX)
+		target = LWS_H2_RX_WIN_MAX;
+	grow = (int)target - h2n->rx_win;
+	if (grow <= 0)
+		return;
+
+	lws_vhost_lock(vh);
+	if (vh->h2.rx_win_committed >= vh->h2.rx_win_budget)
+		grow = 0;
+	else
+		if ((uint32_t)grow > vh->h2.rx_win_budget -
+				     vh->h2.rx_win_committed)
+			grow = (int)(vh->h2.rx_win_budget -
+				     vh->h2.rx_win_committed);
+	vh->h2.rx_win_committed += (uint32_t)grow;
+	lws_vhost_unlock(vh);
+
+	if (!grow)
+		return;
+
+	h2n->rx_win += grow;
+	h2n->rx_win_grown += grow;
+
+	lwsl_info("%s: nwsi %p: rtt %dus (min %dus), %u rx in flight: "
+		  "rx_win %d\n", __func__, nwsi, (int)rtt, (int)h2n->rtt_min,
+		  h2n->bdp_bytes, h2n->rx_win);
+}
+
+void
+lws_h2_rx_win_release(struct lws *nwsi)
+{
+	struct lws_h2_netconn *h2n = nwsi->h2.h2n;
+	struct lws_vhost *vh = nwsi->vhost;
+
+	if (!h2n->rx_win_grown || !vh)
+		return;
+
+	lws_vhost_lock(vh);
+	vh->h2.rx_win_committed -= (uint32_t)h2n->rx_win_grown;
+	lws_vhost_unlock(vh);
+
+	h2n->rx_win_grown = 0;
+}
+
+/*
+ * Stream scheduling
+ *
+ * The streams on a network connection are scheduled by stride: each stream
+ * has a virtual time "pass" that advances by what it sent divided by its
+ * RFC7540 weight, and the stream with the lowest pass that wants to write
+ * goes next.  So over time streams share the connection in proportion to
+ * their weights, however much each tries to send at one go.
+ *
+ * The dependency tree from HEADERS and PRIORITY frames decides who is
+ * eligible: a stream only writes while no stream it depends on, directly or
+ * indirectly, is waiting to write itself.
+ *
+ * We only track streams we have a wsi for, a dependency on an idle or
+ * closed stream is treated as a dependency on the root.
+ */
+
+static int
+lws_h2_sched_depends_on(struct lws *wsi, struct lws *ancestor)
+{
+	struct lws *w = wsi->h2.sched_dep;
+	unsigned int hops = wsi->h2.parent_wsi->h2.child_count;
+
+	while (w && hops--) {
+		if (w == ancestor)
+			return 1;
+		w = w->h2.sched_dep;
+	}
+
+	return 0;
+}
+
+void
+lws_h2_sched_set_priority(struct lws *wsi, uint32_t dep, uint8_t weight)
+{
+	struct lws *nwsi = wsi->h2.parent_wsi, *p = NULL;
+	uint32_t sid = dep & ~(1u << 31);
+
+	if (!nwsi || sid == wsi->h2.my_sid)
+		return;
+
+	wsi->h2.my_priority = (int)weight + 1;
+
+	if (sid)
+		p = lws_h2_wsi_from_id(nwsi, sid);
+
+	/*
+	 * RFC7540 5.3.3: if the new parent depends on us, it first moves up to
+	 * where we were in the tree
+	 */
+	if (p && lws_h2_sched_depends_on(p, wsi))
+		p->h2.sched_dep = wsi->h2.sched_dep;
+
+	/* exclusive: we become the only dependent of p, adopting the others */
+	if (dep & (1u << 31))
+		lws_start_foreach_ll(struct lws *, w, nwsi->h2.child_list) {
+			if (w != wsi && w->h2.sched_dep == p)
+				w->h2.sched_dep = wsi;
+		} lws_end_foreach_ll(w, h2.sibling_list);
+
+	wsi->h2.sched_dep = p;
+
+	lwsl_info("%s: %p: sid %u depends on %u%s, weight %d\n", __func__,
+		  wsi, wsi->h2.my_sid, sid, dep & (1u << 31) ? " (excl)" : "",
+		  wsi->h2.my_priority);
+}
+
+/*
+ * RFC7540 5.3.4: when a stream goes away, its dependents take its place in
+ * the tree and share out its weight according to their own weights
+ */
+
+void
+lws_h2_sched_detach(struct lws *wsi)
+{
+	struct lws *nwsi = wsi->h2.parent_wsi;
+	int sum = 0, n;
+
+	if (!nwsi)
+		return;
+
+	lws_start_foreach_ll(struct lws *, w, nwsi->h2.child_list) {
+		if (w->h2.sched_dep == wsi)
+			sum += w->h2.my_priority;
+	} lws_end_foreach_ll(w, h2.sibling_list);
+
+	if (!sum)
+		return;
+
+	lws_start_foreach_ll(struct lws *, w, nwsi->h2.child_list) {
+		if (w->h2.sched_dep == wsi) {
+			w->h2.sched_dep = wsi->h2.sched_dep;
+			n = (wsi->h2.my_priority * w->h2.my_priority) / sum;
+			w->h2.my_priority = n ? n : 1;
+		}
+	} lws_end_foreach_ll(w, h2.sibling_list);
+}
+
+/*
+ * A stream that starts wanting to write again doesn't get to spend the time
+ * it was idle, it rejoins at the current virtual time
+ */
+
+void
+lws_h2_sched_wake(struct lws *wsi)
+{
+	struct lws *nwsi = lws_get_network_wsi(wsi);
+
+	if (nwsi == wsi || !nwsi->h2.h2n)
+		return;
+
+	if (wsi->h2.sched_pass < nwsi->h2.h2n->sched_vclock)
+		wsi->h2.sched_pass = nwsi->h2.h2n->sched_vclock;
+}
+
+static int
+lws_h2_sched_eligible(struct lws *wsi)
+{
+	struct lws *w = wsi->h2.sched_dep;
+	unsigned int hops = wsi->h2.parent_wsi->h2.child_count;
+
+	while (w && hops--) {
+		if (w->h2.requested_POLLOUT)
+			return 0;
+		w = w->h2.sched_dep;
+	}
+
+	return 1;
+}
+
+struct lws *
+lws_h2_sched_pick(struct lws *nwsi)
+{
+	struct lws_h2_netconn *h2n = nwsi->h2.h2n;
+	struct lws *best = NULL;
+
+	lws_start_foreach_ll(struct lws *, w, nwsi->h2.child_list) {
+		if (w->h2.requested_POLLOUT && lws_h2_sched_eligible(w) &&
+		    (!best || w->h2.sched_pass < best->h2.sched_pass ||
+		     (w->h2.sched_pass == best->h2.sched_pass &&
+		      w->h2.my_sid < best->h2.my_sid)))
+			best = w;
+	} lws_end_foreach_ll(w, h2.sibling_list);
+
+	if (!best)
+		return NULL;
+
+	if (best->h2.sched_pass > h2n->sched_vclock)
+		h2n->sched_vclock = best->h2.sched_pass;
+
+	best->h2.sched_pass += ((uint64_t)LWS_H2_SCHED_TURN_COST << 8) /
+			       (unsigned int)best->h2.my_priority;
+
+	return best;
 }
 
 int lws_h2_frame_write(struct lws *wsi, int type, int flags,
@@ -602,10 +946,10 @@ static void lws_h2_set_bin(struct lws *wsi, int n, unsigned char *buf)
 {
 	*buf++ = n >> 8;
 	*buf++ = n;
-	*buf++ = wsi->h2.h2n->set.s[n] >> 24;
-	*buf++ = wsi->h2.h2n->set.s[n] >> 16;
-	*buf++ = wsi->h2.h2n->set.s[n] >> 8;
-	*buf = wsi->h2.h2n->set.s[n];
+	*buf++ = wsi->vhost->h2.set.s[n] >> 24;
+	*buf++ = wsi->vhost->h2.set.s[n] >> 16;
+	*buf++ = wsi->vhost->h2.set.s[n] >> 8;
+	*buf = wsi->vhost->h2.set.s[n];
 }
 
 /* we get called on the network connection */
@@ -645,9 +989,9 @@ int lws_h2_do_pps_send(struct lws *wsi)
 		 * then we must inform the peer
 		 */
 		for (n = 1; n < H2SET_COUNT; n++)
-			if (h2n->set.s[n] != lws_h2_defaults.s[n]) {
+			if (wsi->vhost->h2.set.s[n] != lws_h2_defaults.s[n]) {
 				lwsl_debug("sending SETTING %d 0x%x\n", n,
-						wsi->h2.h2n->set.s[n]);
+						wsi->vhost->h2.set.s[n]);
 				lws_h2_set_bin(wsi, n, &set[LWS_PRE + m]);
 				m += sizeof(h2n->one_setting);
 			}
@@ -658,6 +1002,8 @@ int lws_h2_do_pps_send(struct lws *wsi)
 			lwsl_info("send %d %d\n", n, m);
 			goto bail;
 		}
+		/* the ACK gives us an RTT before anything is queued */
+		h2n->settings_us = lws_time_in_microseconds();
 		break;
 
 	case LWS_H2_PPS_ACK_SETTINGS:
@@ -719,6 +1065,17 @@ int lws_h2_do_pps_send(struct lws *wsi)
 		}
 		break;
 
+	case LWS_H2_PPS_PING:
+		memcpy(&set[LWS_PRE], pps->u.ping.ping_payload, 8);
+		n = lws_h2_frame_write(wsi, LWS_H2_FRAME_TYPE_PING, 0,
+				       LWS_H2_STREAM_ID_MASTER, 8,
+				       &set[LWS_PRE]);
+		if (n != 8)
+			goto bail;
+		h2n->bdp_ping_us = lws_time_in_microseconds();
+		h2n->bdp_bytes = 0;
+		break;
+
 	case LWS_H2_PPS_GOAWAY:
 		lwsl_info("LWS_H2_PPS_GOAWAY\n");
 		*p++ = pps->u.ga.highest_sid >> 24;
@@ -1012,6 +1369,11 @@ lws_h2_parse_frame_header(struct lws *wsi)
 				      "Settings with ACK not allowed payload");
 			break;
 		}
+		if (h2n->settings_us) {
+			lws_h2_rtt_sample(h2n, lws_time_in_microseconds() -
+					       h2n->settings_us);
+			h2n->settings_us = 0;
+		}
 		break;
 	case LWS_H2_FRAME_TYPE_PING:
 		if (h2n->sid) {
@@ -1093,22 +1455,9 @@ lws_h2_parse_frame_header(struct lws *wsi)
 				return 1;
 			}
 
-			pps = lws_h2_new_pps(LWS_H2_PPS_UPDATE_WINDOW);
-			if (!pps)
-				goto cleanup_wsi;
-			pps->u.update_window.sid = h2n->sid;
-			pps->u.update_window.credit = 4 * 65536;
-			h2n->swsi->h2.peer_tx_cr_est +=
-						pps->u.update_window.credit;
-			lws_pps_schedule(wsi, pps);
-
-			pps = lws_h2_new_pps(LWS_H2_PPS_UPDATE_WINDOW);
-			if (!pps)
+			if (lws_h2_rx_win_update(wsi, h2n->swsi, 1) ||
+			    lws_h2_rx_win_update(wsi, wsi, 1))
 				goto cleanup_wsi;
-			pps->u.update_window.sid = 0;
-			pps->u.update_window.credit = 4 * 65536;
-			wsi->h2.peer_tx_cr_est += pps->u.update_window.credit;
-			lws_pps_schedule(wsi, pps);
 		}
 
 		/*
@@ -1214,9 +1563,12 @@ lws_h2_parse_end_of_frame(struct lws *wsi)
 	if (h2n->sid > h2n->highest_sid)
 		h2n->highest_sid = h2n->sid;
 
-	/* set our initial window size */
+	/*
+	 * set our initial window size... SETTINGS_INITIAL_WINDOW_SIZE is only
+	 * for streams, the connection's always starts at 65535 (RFC7540 6.9.2)
+	 */
 	if (!wsi->h2.initialized) {
-		wsi->h2.tx_cr = h2n->set.s[H2SET_INITIAL_WINDOW_SIZE];
+		wsi->h2.tx_cr = 65535;
 		lwsl_info("initial tx credit on master %p: %d\n", wsi,
 			  wsi->h2.tx_cr);
 		wsi->h2.initialized = 1;
@@ -1325,18 +1677,19 @@ lws_h2_parse_end_of_frame(struct lws *wsi)
 
 		/* service the http request itself */
 
-		if (h2n->last_action_dyntable_resize) {
-			lws_h2_goaway(wsi, H2_ERR_COMPRESSION_ERROR,
-				"dyntable resize last in headers");
-			break;
-		}
-
 		if (!h2n->swsi->h2.END_HEADERS) {
 			/* we are not finished yet */
 			lwsl_info("witholding http action for continuation\n");
 			break;
 		}
 
+		/* a resize may end a HEADERS frame, but not the whole block */
+		if (h2n->last_action_dyntable_resize) {
+			lws_h2_goaway(wsi, H2_ERR_COMPRESSION_ERROR,
+				"dyntable resize last in headers");
+			break;
+		}
+
 		/* confirm the hpack stream state is reasonable for finishing */
 
 		if (h2n->hpack != HPKS_TYPE) {
@@ -1540,6 +1893,7 @@ lws_h2_parse_end_of_frame(struct lws *wsi)
 
 	case LWS_H2_FRAME_TYPE_PING:
 		if (h2n->flags & LWS_H2_FLAG_SETTINGS_ACK) { // ack
+			lws_h2_bdp_pong(wsi);
 		} else {/* they're sending us a ping request */
 			struct lws_h2_protocol_send *pps =
 					lws_h2_new_pps(LWS_H2_PPS_PONG);
@@ -1728,6 +2082,9 @@ lws_h2_parser(struct lws *wsi, unsigned char *in, lws_filepos_t inlen,
 				h2n->collected_priority = 1;
 				lwsl_debug("PRI FL: dep 0x%x, weight 0x%02X\n",
 					   h2n->dep, h2n->weight_temp);
+				if (h2n->swsi)
+					lws_h2_sched_set_priority(h2n->swsi,
+							h2n->dep, h2n->weight_temp);
 				break; /* we consumed this */
 			}
 			if (h2n->padding && h2n->count >
@@ -1870,14 +2227,14 @@ lws_h2_parser(struct lws *wsi, unsigned char *in, lws_filepos_t inlen,
 						goto close_swsi_and_return;
 					}
 
-					break;
+					goto do_windows;
 				} else
 #endif
 				{
 
 					if (lwsi_state(h2n->swsi) == LRS_DEFERRING_ACTION) {
 						// lwsl_notice("appending because we are in LRS_DEFERRING_ACTION\n");
-						m = lws_buflist_append_segment(
+						m = lws_wsi_buflist_append(h2n->swsi,
 							&h2n->swsi->buflist,
 								in - 1, n);
 						if (m < 0)
@@ -1938,24 +2295,10 @@ do_windows:
 	//			lwsl_notice("   peer_tx_cr_est %d, parent %d\n",
 	//				   h2n->swsi->h2.peer_tx_cr_est, wsi->h2.peer_tx_cr_est);
 
-				if (h2n->swsi->h2.peer_tx_cr_est < (int)(2 * h2n->length) + 65536) {
-					pps = lws_h2_new_pps(LWS_H2_PPS_UPDATE_WINDOW);
-					if (!pps)
-						return 1;
-					pps->u.update_window.sid = h2n->sid;
-					pps->u.update_window.credit = (2 * h2n->length + 65536);
-					h2n->swsi->h2.peer_tx_cr_est += pps->u.update_window.credit; 
-					lws_pps_schedule(wsi, pps);
-				}
-				if (wsi->h2.peer_tx_cr_est < (int)(2 * h2n->length) + 65536) {
-					pps = lws_h2_new_pps(LWS_H2_PPS_UPDATE_WINDOW);
-					if (!pps)
-						return 1;
-					pps->u.update_window.sid = 0;
-					pps->u.update_window.credit = (2 * h2n->length + 65536);
-					wsi->h2.peer_tx_cr_est += pps->u.update_window.credit;
-					lws_pps_schedule(wsi, pps);
-				}
+				if (lws_h2_bdp_rx(wsi, n) ||
+				    lws_h2_rx_win_update(wsi, h2n->swsi, 0) ||
+				    lws_h2_rx_win_update(wsi, wsi, 0))
+					return 1;
 
 				// lwsl_notice("%s: count %d len %d\n", __func__, (int)h2n->count, (int)h2n->length);
 
@@ -1975,6 +2318,10 @@ do_windows:
 							      "cant depend on own sid");
 						break;
 					}
+					if (h2n->swsi)
+						lws_h2_sched_set_priority(
+							h2n->swsi, h2n->dep,
+							h2n->weight_temp);
 				}
 				break;
 
@@ -1987,12 +2334,10 @@ do_windows:
 				break;
 
 			case LWS_H2_FRAME_TYPE_PING:
-				if (h2n->flags & LWS_H2_FLAG_SETTINGS_ACK) { // ack
-				} else { /* they're sending us a ping request */
-					if (h2n->count > 8)
-						return 1;
-					h2n->ping_payload[h2n->count - 1] = c;
-				}
+				/* a ping request, or the ack of one of ours */
+				if (h2n->count > 8)
+					return 1;
+				h2n->ping_payload[h2n->count - 1] = c;
 				break;
 
 			case LWS_H2_FRAME_TYPE_WINDOW_UPDATE:
@@ -2101,7 +2446,6 @@ lws_h2_client_handshake(struct lws *wsi)
 	char *meth = lws_hdr_simple_ptr(wsi, _WSI_TOKEN_CLIENT_METHOD),
 	     *uri = lws_hdr_simple_ptr(wsi, _WSI_TOKEN_CLIENT_URI);
 	struct lws *nwsi = lws_get_network_wsi(wsi);
-	struct lws_h2_protocol_send *pps;
 	int n;
 	/*
 	 * The identifier of a newly established stream MUST be numerically
@@ -2119,21 +2463,9 @@ lws_h2_client_handshake(struct lws *wsi)
 	lwsl_info("%s: CLIENT_WAITING_TO_SEND_HEADERS: pollout (sid %d)\n",
 			__func__, wsi->h2.my_sid);
 
-	pps = lws_h2_new_pps(LWS_H2_PPS_UPDATE_WINDOW);
-	if (!pps)
-		return 1;
-	pps->u.update_window.sid = sid;
-	pps->u.update_window.credit = 4 * 65536;
-	wsi->h2.peer_tx_cr_est += pps->u.update_window.credit;
-	lws_pps_schedule(wsi, pps);
-
-	pps = lws_h2_new_pps(LWS_H2_PPS_UPDATE_WINDOW);
-	if (!pps)
+	if (lws_h2_rx_win_update(nwsi, wsi, 1) ||
+	    lws_h2_rx_win_update(nwsi, nwsi, 1))
 		return 1;
-	pps->u.update_window.sid = 0;
-	pps->u.update_window.credit = 4 * 65536;
-	wsi->h2.peer_tx_cr_est += pps->u.update_window.credit;
-	lws_pps_schedule(wsi, pps);
 
 	p = start = buf = pt->serv_buf + LWS_PRE;
 	end = start + wsi->context->pt_serv_buf_size - LWS_PRE - 1;
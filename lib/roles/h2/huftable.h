@@ -1,530 +1,1662 @@
-static unsigned char lextable[] = {
-/* pos 0000:   0 */    /* 0 */ 0x42  /* (to 0x0084 state  98) */,
-                       /* 1 */ 0x01  /* (to 0x0002 state   1) */,
-/* pos 0002:   1 */    /* 0 */ 0x5C  /* (to 0x00BA state 151) */,
-                       /* 1 */ 0x01  /* (to 0x0004 state   2) */,
-/* pos 0004:   2 */    /* 0 */ 0x66  /* (to 0x00D0 state 173) */,
-                       /* 1 */ 0x01  /* (to 0x0006 state   3) */,
-/* pos 0006:   3 */    /* 0 */ 0x74  /* (to 0x00EE state 204) */,
-                       /* 1 */ 0x01  /* (to 0x0008 state   4) */,
-/* pos 0008:   4 */    /* 0 */ 0x8C  /* (to 0x0120 state 263) */,
-                       /* 1 */ 0x01  /* (to 0x000A state   5) */,
-/* pos 000a:   5 */    /* 0 */ 0x46  /* (to 0x0096 state 113) */,
-                       /* 1 */ 0x01  /* (to 0x000C state   6) */,
-/* pos 000c:   6 */    /* 0 */ 0x75  /* (to 0x00F6 state 211) */,
-                       /* 1 */ 0x01  /* (to 0x000E state   7) */,
-/* pos 000e:   7 */    /* 0 */ 0x40  /* (to 0x008E state 104) */,
-                       /* 1 */ 0x01  /* (to 0x0010 state   8) */,
-/* pos 0010:   8 */    /* 0 */ 0x45  /* (to 0x009A state 116) */,
-                       /* 1 */ 0x01  /* (to 0x0012 state   9) */,
-/* pos 0012:   9 */    /* 0 */ 0x40  /* (to 0x0092 state 108) */,
-                       /* 1 */ 0x01  /* (to 0x0014 state  10) */,
-/* pos 0014:  10 */    /* 0 */ 0x01  /* (to 0x0016 state  11) */,
-                       /* 1 */ 0x03  /* (to 0x001A state  14) */,
-/* pos 0016:  11 */    /* 0 */ 0x01  /* (to 0x0018 state  12) */,
-                       /* 1 */ 0x5B  /* (to 0x00CC state 166) */,
-/* pos 0018:  12 */     /* terminal 0 */ 0x00,
-                        /* terminal 36 */ 0x24,
-/* pos 001a:  14 */    /* 0 */ 0x72  /* (to 0x00FE state 220) */,
-                       /* 1 */ 0x01  /* (to 0x001C state  15) */,
-/* pos 001c:  15 */    /* 0 */ 0x72  /* (to 0x0100 state 222) */,
-                       /* 1 */ 0x01  /* (to 0x001E state  16) */,
-/* pos 001e:  16 */    /* 0 */ 0x53  /* (to 0x00C4 state 158) */,
-                       /* 1 */ 0x01  /* (to 0x0020 state  17) */,
-/* pos 0020:  17 */     /* terminal 123 */ 0x7B,
-                       /* 1 */ 0x01  /* (to 0x0022 state  18) */,
-/* pos 0022:  18 */    /* 0 */ 0x6B  /* (to 0x00F8 state 216) */,
-                       /* 1 */ 0x01  /* (to 0x0024 state  19) */,
-/* pos 0024:  19 */    /* 0 */ 0x84  /* (to 0x012C state 279) */,
-                       /* 1 */ 0x01  /* (to 0x0026 state  20) */,
-/* pos 0026:  20 */    /* 0 */ 0x01  /* (to 0x0028 state  21) */,
-                       /* 1 */ 0x06  /* (to 0x0032 state  27) */,
-/* pos 0028:  21 */    /* 0 */ 0xB3  /* (to 0x018E state 377) */,
-                       /* 1 */ 0x01  /* (to 0x002A state  22) */,
-/* pos 002a:  22 */    /* 0 */ 0xC3  /* (to 0x01B0 state 414) */,
-                       /* 1 */ 0x01  /* (to 0x002C state  23) */,
-/* pos 002c:  23 */    /* 0 */ 0x01  /* (to 0x002E state  24) */,
-                       /* 1 */ 0x8C  /* (to 0x0144 state 301) */,
-/* pos 002e:  24 */    /* 0 */ 0x01  /* (to 0x0030 state  25) */,
-                       /* 1 */ 0x8A  /* (to 0x0142 state 298) */,
-/* pos 0030:  25 */     /* terminal 1 */ 0x01,
-                        /* terminal 135 */ 0x87,
-/* pos 0032:  27 */    /* 0 */ 0x8E  /* (to 0x014E state 314) */,
-                       /* 1 */ 0x01  /* (to 0x0034 state  28) */,
-/* pos 0034:  28 */    /* 0 */ 0x0F  /* (to 0x0052 state  50) */,
-                       /* 1 */ 0x01  /* (to 0x0036 state  29) */,
-/* pos 0036:  29 */    /* 0 */ 0xA4  /* (to 0x017E state 362) */,
-                       /* 1 */ 0x01  /* (to 0x0038 state  30) */,
-/* pos 0038:  30 */    /* 0 */ 0xB7  /* (to 0x01A6 state 403) */,
-                       /* 1 */ 0x01  /* (to 0x003A state  31) */,
-/* pos 003a:  31 */    /* 0 */ 0xC8  /* (to 0x01CA state 440) */,
-                       /* 1 */ 0x01  /* (to 0x003C state  32) */,
-/* pos 003c:  32 */    /* 0 */ 0x01  /* (to 0x003E state  33) */,
-                       /* 1 */ 0x0F  /* (to 0x005A state  55) */,
-/* pos 003e:  33 */    /* 0 */ 0x01  /* (to 0x0040 state  34) */,
-                       /* 1 */ 0x07  /* (to 0x004C state  46) */,
-/* pos 0040:  34 */    /* 0 */ 0x01  /* (to 0x0042 state  35) */,
-                       /* 1 */ 0x03  /* (to 0x0046 state  39) */,
-/* pos 0042:  35 */     /* terminal 254 */ 0xFE,
-                       /* 1 */ 0x01  /* (to 0x0044 state  36) */,
-/* pos 0044:  36 */     /* terminal 2 */ 0x02,
-                        /* terminal 3 */ 0x03,
-/* pos 0046:  39 */    /* 0 */ 0x01  /* (to 0x0048 state  40) */,
-                       /* 1 */ 0x02  /* (to 0x004A state  43) */,
-/* pos 0048:  40 */     /* terminal 4 */ 0x04,
-                        /* terminal 5 */ 0x05,
-/* pos 004a:  43 */     /* terminal 6 */ 0x06,
-                        /* terminal 7 */ 0x07,
-/* pos 004c:  46 */    /* 0 */ 0x01  /* (to 0x004E state  47) */,
-                       /* 1 */ 0x0E  /* (to 0x0068 state  67) */,
-/* pos 004e:  47 */    /* 0 */ 0x01  /* (to 0x0050 state  48) */,
-                       /* 1 */ 0x0C  /* (to 0x0066 state  63) */,
-/* pos 0050:  48 */     /* terminal 8 */ 0x08,
-                        /* terminal 11 */ 0x0B,
-/* pos 0052:  50 */    /* 0 */ 0xA7  /* (to 0x01A0 state 396) */,
-                       /* 1 */ 0x01  /* (to 0x0054 state  51) */,
-/* pos 0054:  51 */    /* 0 */ 0x01  /* (to 0x0056 state  52) */,
-                       /* 1 */ 0x7B  /* (to 0x014A state 309) */,
-/* pos 0056:  52 */     /* terminal 239 */ 0xEF,
-                       /* 1 */ 0x01  /* (to 0x0058 state  53) */,
-/* pos 0058:  53 */     /* terminal 9 */ 0x09,
-                        /* terminal 142 */ 0x8E,
-/* pos 005a:  55 */    /* 0 */ 0x0A  /* (to 0x006E state  74) */,
-                       /* 1 */ 0x01  /* (to 0x005C state  56) */,
-/* pos 005c:  56 */    /* 0 */ 0x11  /* (to 0x007E state  91) */,
-                       /* 1 */ 0x01  /* (to 0x005E state  57) */,
-/* pos 005e:  57 */    /* 0 */ 0x64  /* (to 0x0126 state 274) */,
-                       /* 1 */ 0x01  /* (to 0x0060 state  58) */,
-/* pos 0060:  58 */     /* terminal 249 */ 0xF9,
-                       /* 1 */ 0x01  /* (to 0x0062 state  59) */,
-/* pos 0062:  59 */    /* 0 */ 0x01  /* (to 0x0064 state  60) */,
-                       /* 1 */ 0x0A  /* (to 0x0076 state  81) */,
-/* pos 0064:  60 */     /* terminal 10 */ 0x0A,
-                        /* terminal 13 */ 0x0D,
-/* pos 0066:  63 */     /* terminal 12 */ 0x0C,
-                        /* terminal 14 */ 0x0E,
-/* pos 0068:  67 */    /* 0 */ 0x01  /* (to 0x006A state  68) */,
-                       /* 1 */ 0x02  /* (to 0x006C state  71) */,
-/* pos 006a:  68 */     /* terminal 15 */ 0x0F,
-                        /* terminal 16 */ 0x10,
-/* pos 006c:  71 */     /* terminal 17 */ 0x11,
-                        /* terminal 18 */ 0x12,
-/* pos 006e:  74 */    /* 0 */ 0x01  /* (to 0x0070 state  75) */,
-                       /* 1 */ 0x05  /* (to 0x0078 state  84) */,
-/* pos 0070:  75 */    /* 0 */ 0x01  /* (to 0x0072 state  76) */,
-                       /* 1 */ 0x02  /* (to 0x0074 state  79) */,
-/* pos 0072:  76 */     /* terminal 19 */ 0x13,
-                        /* terminal 20 */ 0x14,
-/* pos 0074:  79 */     /* terminal 21 */ 0x15,
-                        /* terminal 23 */ 0x17,
-/* pos 0076:  81 */     /* terminal 22 */ 0x16,
-                        /* terminal 256 */ 0x00,
-/* pos 0078:  84 */    /* 0 */ 0x01  /* (to 0x007A state  85) */,
-                       /* 1 */ 0x02  /* (to 0x007C state  88) */,
-/* pos 007a:  85 */     /* terminal 24 */ 0x18,
-                        /* terminal 25 */ 0x19,
-/* pos 007c:  88 */     /* terminal 26 */ 0x1A,
-                        /* terminal 27 */ 0x1B,
-/* pos 007e:  91 */    /* 0 */ 0x01  /* (to 0x0080 state  92) */,
-                       /* 1 */ 0x02  /* (to 0x0082 state  95) */,
-/* pos 0080:  92 */     /* terminal 28 */ 0x1C,
-                        /* terminal 29 */ 0x1D,
-/* pos 0082:  95 */     /* terminal 30 */ 0x1E,
-                        /* terminal 31 */ 0x1F,
-/* pos 0084:  98 */    /* 0 */ 0x13  /* (to 0x00AA state 133) */,
-                       /* 1 */ 0x01  /* (to 0x0086 state  99) */,
-/* pos 0086:  99 */    /* 0 */ 0x01  /* (to 0x0088 state 100) */,
-                       /* 1 */ 0x0F  /* (to 0x00A4 state 129) */,
-/* pos 0088: 100 */    /* 0 */ 0x4B  /* (to 0x011E state 258) */,
-                       /* 1 */ 0x01  /* (to 0x008A state 101) */,
-/* pos 008a: 101 */    /* 0 */ 0x01  /* (to 0x008C state 102) */,
-                       /* 1 */ 0x0C  /* (to 0x00A2 state 126) */,
-/* pos 008c: 102 */     /* terminal 32 */ 0x20,
-                        /* terminal 37 */ 0x25,
-/* pos 008e: 104 */    /* 0 */ 0x01  /* (to 0x0090 state 105) */,
-                       /* 1 */ 0x08  /* (to 0x009E state 119) */,
-/* pos 0090: 105 */     /* terminal 33 */ 0x21,
-                        /* terminal 34 */ 0x22,
-/* pos 0092: 108 */     /* terminal 124 */ 0x7C,
-                       /* 1 */ 0x01  /* (to 0x0094 state 109) */,
-/* pos 0094: 109 */     /* terminal 35 */ 0x23,
-                        /* terminal 62 */ 0x3E,
-/* pos 0096: 113 */    /* 0 */ 0x01  /* (to 0x0098 state 114) */,
-                       /* 1 */ 0x05  /* (to 0x00A0 state 124) */,
-/* pos 0098: 114 */     /* terminal 38 */ 0x26,
-                        /* terminal 42 */ 0x2A,
-/* pos 009a: 116 */     /* terminal 63 */ 0x3F,
-                       /* 1 */ 0x01  /* (to 0x009C state 117) */,
-/* pos 009c: 117 */     /* terminal 39 */ 0x27,
-                        /* terminal 43 */ 0x2B,
-/* pos 009e: 119 */     /* terminal 40 */ 0x28,
-                        /* terminal 41 */ 0x29,
-/* pos 00a0: 124 */     /* terminal 44 */ 0x2C,
-                        /* terminal 59 */ 0x3B,
-/* pos 00a2: 126 */     /* terminal 45 */ 0x2D,
-                        /* terminal 46 */ 0x2E,
-/* pos 00a4: 129 */    /* 0 */ 0x01  /* (to 0x00A6 state 130) */,
-                       /* 1 */ 0x08  /* (to 0x00B4 state 144) */,
-/* pos 00a6: 130 */    /* 0 */ 0x01  /* (to 0x00A8 state 131) */,
-                       /* 1 */ 0x06  /* (to 0x00B2 state 141) */,
-/* pos 00a8: 131 */     /* terminal 47 */ 0x2F,
-                        /* terminal 51 */ 0x33,
-/* pos 00aa: 133 */    /* 0 */ 0x01  /* (to 0x00AC state 134) */,
-                       /* 1 */ 0x2D  /* (to 0x0104 state 229) */,
-/* pos 00ac: 134 */    /* 0 */ 0x01  /* (to 0x00AE state 135) */,
-                       /* 1 */ 0x02  /* (to 0x00B0 state 138) */,
-/* pos 00ae: 135 */     /* terminal 48 */ 0x30,
-                        /* terminal 49 */ 0x31,
-/* pos 00b0: 138 */     /* terminal 50 */ 0x32,
-                        /* terminal 97 */ 0x61,
-/* pos 00b2: 141 */     /* terminal 52 */ 0x34,
-                        /* terminal 53 */ 0x35,
-/* pos 00b4: 144 */    /* 0 */ 0x01  /* (to 0x00B6 state 145) */,
-                       /* 1 */ 0x02  /* (to 0x00B8 state 148) */,
-/* pos 00b6: 145 */     /* terminal 54 */ 0x36,
-                        /* terminal 55 */ 0x37,
-/* pos 00b8: 148 */     /* terminal 56 */ 0x38,
-                        /* terminal 57 */ 0x39,
-/* pos 00ba: 151 */    /* 0 */ 0x06  /* (to 0x00C6 state 160) */,
-                       /* 1 */ 0x01  /* (to 0x00BC state 152) */,
-/* pos 00bc: 152 */    /* 0 */ 0x2C  /* (to 0x0114 state 246) */,
-                       /* 1 */ 0x01  /* (to 0x00BE state 153) */,
-/* pos 00be: 153 */    /* 0 */ 0x2F  /* (to 0x011C state 256) */,
-                       /* 1 */ 0x01  /* (to 0x00C0 state 154) */,
-/* pos 00c0: 154 */    /* 0 */ 0x01  /* (to 0x00C2 state 155) */,
-                       /* 1 */ 0x07  /* (to 0x00CE state 170) */,
-/* pos 00c2: 155 */     /* terminal 58 */ 0x3A,
-                        /* terminal 66 */ 0x42,
-/* pos 00c4: 158 */     /* terminal 60 */ 0x3C,
-                        /* terminal 96 */ 0x60,
-/* pos 00c6: 160 */    /* 0 */ 0x01  /* (to 0x00C8 state 161) */,
-                       /* 1 */ 0x21  /* (to 0x0108 state 232) */,
-/* pos 00c8: 161 */    /* 0 */ 0x01  /* (to 0x00CA state 162) */,
-                       /* 1 */ 0x1D  /* (to 0x0102 state 224) */,
-/* pos 00ca: 162 */     /* terminal 61 */ 0x3D,
-                        /* terminal 65 */ 0x41,
-/* pos 00cc: 166 */     /* terminal 64 */ 0x40,
-                        /* terminal 91 */ 0x5B,
-/* pos 00ce: 170 */     /* terminal 67 */ 0x43,
-                        /* terminal 68 */ 0x44,
-/* pos 00d0: 173 */    /* 0 */ 0x01  /* (to 0x00D2 state 174) */,
-                       /* 1 */ 0x08  /* (to 0x00E0 state 189) */,
-/* pos 00d2: 174 */    /* 0 */ 0x01  /* (to 0x00D4 state 175) */,
-                       /* 1 */ 0x04  /* (to 0x00DA state 182) */,
-/* pos 00d4: 175 */    /* 0 */ 0x01  /* (to 0x00D6 state 176) */,
-                       /* 1 */ 0x02  /* (to 0x00D8 state 179) */,
-/* pos 00d6: 176 */     /* terminal 69 */ 0x45,
-                        /* terminal 70 */ 0x46,
-/* pos 00d8: 179 */     /* terminal 71 */ 0x47,
-                        /* terminal 72 */ 0x48,
-/* pos 00da: 182 */    /* 0 */ 0x01  /* (to 0x00DC state 183) */,
-                       /* 1 */ 0x02  /* (to 0x00DE state 186) */,
-/* pos 00dc: 183 */     /* terminal 73 */ 0x49,
-                        /* terminal 74 */ 0x4A,
-/* pos 00de: 186 */     /* terminal 75 */ 0x4B,
-                        /* terminal 76 */ 0x4C,
-/* pos 00e0: 189 */    /* 0 */ 0x01  /* (to 0x00E2 state 190) */,
-                       /* 1 */ 0x04  /* (to 0x00E8 state 197) */,
-/* pos 00e2: 190 */    /* 0 */ 0x01  /* (to 0x00E4 state 191) */,
-                       /* 1 */ 0x02  /* (to 0x00E6 state 194) */,
-/* pos 00e4: 191 */     /* terminal 77 */ 0x4D,
-                        /* terminal 78 */ 0x4E,
-/* pos 00e6: 194 */     /* terminal 79 */ 0x4F,
-                        /* terminal 80 */ 0x50,
-/* pos 00e8: 197 */    /* 0 */ 0x01  /* (to 0x00EA state 198) */,
-                       /* 1 */ 0x02  /* (to 0x00EC state 201) */,
-/* pos 00ea: 198 */     /* terminal 81 */ 0x51,
-                        /* terminal 82 */ 0x52,
-/* pos 00ec: 201 */     /* terminal 83 */ 0x53,
-                        /* terminal 84 */ 0x54,
-/* pos 00ee: 204 */    /* 0 */ 0x01  /* (to 0x00F0 state 205) */,
-                       /* 1 */ 0x11  /* (to 0x0110 state 242) */,
-/* pos 00f0: 205 */    /* 0 */ 0x01  /* (to 0x00F2 state 206) */,
-                       /* 1 */ 0x02  /* (to 0x00F4 state 209) */,
-/* pos 00f2: 206 */     /* terminal 85 */ 0x55,
-                        /* terminal 86 */ 0x56,
-/* pos 00f4: 209 */     /* terminal 87 */ 0x57,
-                        /* terminal 89 */ 0x59,
-/* pos 00f6: 211 */     /* terminal 88 */ 0x58,
-                        /* terminal 90 */ 0x5A,
-/* pos 00f8: 216 */    /* 0 */ 0x01  /* (to 0x00FA state 217) */,
-                       /* 1 */ 0x1F  /* (to 0x0136 state 286) */,
-/* pos 00fa: 217 */    /* 0 */ 0x01  /* (to 0x00FC state 218) */,
-                       /* 1 */ 0x17  /* (to 0x0128 state 276) */,
-/* pos 00fc: 218 */     /* terminal 92 */ 0x5C,
-                        /* terminal 195 */ 0xC3,
-/* pos 00fe: 220 */     /* terminal 93 */ 0x5D,
-                        /* terminal 126 */ 0x7E,
-/* pos 0100: 222 */     /* terminal 94 */ 0x5E,
-                        /* terminal 125 */ 0x7D,
-/* pos 0102: 224 */     /* terminal 95 */ 0x5F,
-                        /* terminal 98 */ 0x62,
-/* pos 0104: 229 */    /* 0 */ 0x01  /* (to 0x0106 state 230) */,
-                       /* 1 */ 0x05  /* (to 0x010E state 240) */,
-/* pos 0106: 230 */     /* terminal 99 */ 0x63,
-                        /* terminal 101 */ 0x65,
-/* pos 0108: 232 */    /* 0 */ 0x01  /* (to 0x010A state 233) */,
-                       /* 1 */ 0x02  /* (to 0x010C state 237) */,
-/* pos 010a: 233 */     /* terminal 100 */ 0x64,
-                        /* terminal 102 */ 0x66,
-/* pos 010c: 237 */     /* terminal 103 */ 0x67,
-                        /* terminal 104 */ 0x68,
-/* pos 010e: 240 */     /* terminal 105 */ 0x69,
-                        /* terminal 111 */ 0x6F,
-/* pos 0110: 242 */    /* 0 */ 0x01  /* (to 0x0112 state 243) */,
-                       /* 1 */ 0x05  /* (to 0x011A state 254) */,
-/* pos 0112: 243 */     /* terminal 106 */ 0x6A,
-                        /* terminal 107 */ 0x6B,
-/* pos 0114: 246 */    /* 0 */ 0x01  /* (to 0x0116 state 247) */,
-                       /* 1 */ 0x02  /* (to 0x0118 state 250) */,
-/* pos 0116: 247 */     /* terminal 108 */ 0x6C,
-                        /* terminal 109 */ 0x6D,
-/* pos 0118: 250 */     /* terminal 110 */ 0x6E,
-                        /* terminal 112 */ 0x70,
-/* pos 011a: 254 */     /* terminal 113 */ 0x71,
-                        /* terminal 118 */ 0x76,
-/* pos 011c: 256 */     /* terminal 114 */ 0x72,
-                        /* terminal 117 */ 0x75,
-/* pos 011e: 258 */     /* terminal 115 */ 0x73,
-                        /* terminal 116 */ 0x74,
-/* pos 0120: 263 */    /* 0 */ 0x01  /* (to 0x0122 state 264) */,
-                       /* 1 */ 0x02  /* (to 0x0124 state 267) */,
-/* pos 0122: 264 */     /* terminal 119 */ 0x77,
-                        /* terminal 120 */ 0x78,
-/* pos 0124: 267 */     /* terminal 121 */ 0x79,
-                        /* terminal 122 */ 0x7A,
-/* pos 0126: 274 */     /* terminal 127 */ 0x7F,
-                        /* terminal 220 */ 0xDC,
-/* pos 0128: 276 */     /* terminal 208 */ 0xD0,
-                       /* 1 */ 0x01  /* (to 0x012A state 277) */,
-/* pos 012a: 277 */     /* terminal 128 */ 0x80,
-                        /* terminal 130 */ 0x82,
-/* pos 012c: 279 */    /* 0 */ 0x2E  /* (to 0x0188 state 372) */,
-                       /* 1 */ 0x01  /* (to 0x012E state 280) */,
-/* pos 012e: 280 */    /* 0 */ 0x01  /* (to 0x0130 state 281) */,
-                       /* 1 */ 0x1B  /* (to 0x0164 state 332) */,
-/* pos 0130: 281 */    /* 0 */ 0x01  /* (to 0x0132 state 282) */,
-                       /* 1 */ 0x06  /* (to 0x013C state 291) */,
-/* pos 0132: 282 */     /* terminal 230 */ 0xE6,
-                       /* 1 */ 0x01  /* (to 0x0134 state 283) */,
-/* pos 0134: 283 */     /* terminal 129 */ 0x81,
-                        /* terminal 132 */ 0x84,
-/* pos 0136: 286 */    /* 0 */ 0x01  /* (to 0x0138 state 287) */,
-                       /* 1 */ 0x14  /* (to 0x015E state 328) */,
-/* pos 0138: 287 */    /* 0 */ 0x01  /* (to 0x013A state 288) */,
-                       /* 1 */ 0x30  /* (to 0x0198 state 388) */,
-/* pos 013a: 288 */     /* terminal 131 */ 0x83,
-                        /* terminal 162 */ 0xA2,
-/* pos 013c: 291 */    /* 0 */ 0x01  /* (to 0x013E state 292) */,
-                       /* 1 */ 0x02  /* (to 0x0140 state 296) */,
-/* pos 013e: 292 */     /* terminal 133 */ 0x85,
-                        /* terminal 134 */ 0x86,
-/* pos 0140: 296 */     /* terminal 136 */ 0x88,
-                        /* terminal 146 */ 0x92,
-/* pos 0142: 298 */     /* terminal 137 */ 0x89,
-                        /* terminal 138 */ 0x8A,
-/* pos 0144: 301 */    /* 0 */ 0x01  /* (to 0x0146 state 302) */,
-                       /* 1 */ 0x02  /* (to 0x0148 state 305) */,
-/* pos 0146: 302 */     /* terminal 139 */ 0x8B,
-                        /* terminal 140 */ 0x8C,
-/* pos 0148: 305 */     /* terminal 141 */ 0x8D,
-                        /* terminal 143 */ 0x8F,
-/* pos 014a: 309 */    /* 0 */ 0x01  /* (to 0x014C state 310) */,
-                       /* 1 */ 0x06  /* (to 0x0156 state 319) */,
-/* pos 014c: 310 */     /* terminal 144 */ 0x90,
-                        /* terminal 145 */ 0x91,
-/* pos 014e: 314 */    /* 0 */ 0x01  /* (to 0x0150 state 315) */,
-                       /* 1 */ 0x12  /* (to 0x0172 state 350) */,
-/* pos 0150: 315 */    /* 0 */ 0x01  /* (to 0x0152 state 316) */,
-                       /* 1 */ 0x05  /* (to 0x015A state 325) */,
-/* pos 0152: 316 */    /* 0 */ 0x01  /* (to 0x0154 state 317) */,
-                       /* 1 */ 0x03  /* (to 0x0158 state 322) */,
-/* pos 0154: 317 */     /* terminal 147 */ 0x93,
-                        /* terminal 149 */ 0x95,
-/* pos 0156: 319 */     /* terminal 148 */ 0x94,
-                        /* terminal 159 */ 0x9F,
-/* pos 0158: 322 */     /* terminal 150 */ 0x96,
-                        /* terminal 151 */ 0x97,
-/* pos 015a: 325 */    /* 0 */ 0x01  /* (to 0x015C state 326) */,
-                       /* 1 */ 0x08  /* (to 0x016A state 338) */,
-/* pos 015c: 326 */     /* terminal 152 */ 0x98,
-                        /* terminal 155 */ 0x9B,
-/* pos 015e: 328 */    /* 0 */ 0x42  /* (to 0x01E2 state 465) */,
-                       /* 1 */ 0x01  /* (to 0x0160 state 329) */,
-/* pos 0160: 329 */    /* 0 */ 0x01  /* (to 0x0162 state 330) */,
-                       /* 1 */ 0x0C  /* (to 0x0178 state 355) */,
-/* pos 0162: 330 */     /* terminal 153 */ 0x99,
-                        /* terminal 161 */ 0xA1,
-/* pos 0164: 332 */    /* 0 */ 0x01  /* (to 0x0166 state 333) */,
-                       /* 1 */ 0x05  /* (to 0x016E state 347) */,
-/* pos 0166: 333 */    /* 0 */ 0x01  /* (to 0x0168 state 334) */,
-                       /* 1 */ 0x03  /* (to 0x016C state 342) */,
-/* pos 0168: 334 */     /* terminal 154 */ 0x9A,
-                        /* terminal 156 */ 0x9C,
-/* pos 016a: 338 */     /* terminal 157 */ 0x9D,
-                        /* terminal 158 */ 0x9E,
-/* pos 016c: 342 */     /* terminal 160 */ 0xA0,
-                        /* terminal 163 */ 0xA3,
-/* pos 016e: 347 */    /* 0 */ 0x01  /* (to 0x0170 state 348) */,
-                       /* 1 */ 0x07  /* (to 0x017C state 360) */,
-/* pos 0170: 348 */     /* terminal 164 */ 0xA4,
-                        /* terminal 169 */ 0xA9,
-/* pos 0172: 350 */    /* 0 */ 0x01  /* (to 0x0174 state 351) */,
-                       /* 1 */ 0x09  /* (to 0x0184 state 369) */,
-/* pos 0174: 351 */    /* 0 */ 0x01  /* (to 0x0176 state 352) */,
-                       /* 1 */ 0x03  /* (to 0x017A state 357) */,
-/* pos 0176: 352 */     /* terminal 165 */ 0xA5,
-                        /* terminal 166 */ 0xA6,
-/* pos 0178: 355 */     /* terminal 167 */ 0xA7,
-                        /* terminal 172 */ 0xAC,
-/* pos 017a: 357 */     /* terminal 168 */ 0xA8,
-                        /* terminal 174 */ 0xAE,
-/* pos 017c: 360 */     /* terminal 170 */ 0xAA,
-                        /* terminal 173 */ 0xAD,
-/* pos 017e: 362 */    /* 0 */ 0x01  /* (to 0x0180 state 363) */,
-                       /* 1 */ 0x1B  /* (to 0x01B4 state 417) */,
-/* pos 0180: 363 */    /* 0 */ 0x01  /* (to 0x0182 state 364) */,
-                       /* 1 */ 0x2A  /* (to 0x01D4 state 449) */,
-/* pos 0182: 364 */     /* terminal 171 */ 0xAB,
-                        /* terminal 206 */ 0xCE,
-/* pos 0184: 369 */    /* 0 */ 0x01  /* (to 0x0186 state 370) */,
-                       /* 1 */ 0x09  /* (to 0x0196 state 385) */,
-/* pos 0186: 370 */     /* terminal 175 */ 0xAF,
-                        /* terminal 180 */ 0xB4,
-/* pos 0188: 372 */    /* 0 */ 0x01  /* (to 0x018A state 373) */,
-                       /* 1 */ 0x27  /* (to 0x01D6 state 451) */,
-/* pos 018a: 373 */    /* 0 */ 0x01  /* (to 0x018C state 374) */,
-                       /* 1 */ 0x05  /* (to 0x0194 state 381) */,
-/* pos 018c: 374 */     /* terminal 176 */ 0xB0,
-                        /* terminal 177 */ 0xB1,
-/* pos 018e: 377 */    /* 0 */ 0x01  /* (to 0x0190 state 378) */,
-                       /* 1 */ 0x07  /* (to 0x019C state 393) */,
-/* pos 0190: 378 */    /* 0 */ 0x01  /* (to 0x0192 state 379) */,
-                       /* 1 */ 0x05  /* (to 0x019A state 390) */,
-/* pos 0192: 379 */     /* terminal 178 */ 0xB2,
-                        /* terminal 181 */ 0xB5,
-/* pos 0194: 381 */     /* terminal 179 */ 0xB3,
-                        /* terminal 209 */ 0xD1,
-/* pos 0196: 385 */     /* terminal 182 */ 0xB6,
-                        /* terminal 183 */ 0xB7,
-/* pos 0198: 388 */     /* terminal 184 */ 0xB8,
-                        /* terminal 194 */ 0xC2,
-/* pos 019a: 390 */     /* terminal 185 */ 0xB9,
-                        /* terminal 186 */ 0xBA,
-/* pos 019c: 393 */    /* 0 */ 0x01  /* (to 0x019E state 394) */,
-                       /* 1 */ 0x04  /* (to 0x01A4 state 400) */,
-/* pos 019e: 394 */     /* terminal 187 */ 0xBB,
-                        /* terminal 189 */ 0xBD,
-/* pos 01a0: 396 */    /* 0 */ 0x01  /* (to 0x01A2 state 397) */,
-                       /* 1 */ 0x07  /* (to 0x01AE state 412) */,
-/* pos 01a2: 397 */     /* terminal 188 */ 0xBC,
-                        /* terminal 191 */ 0xBF,
-/* pos 01a4: 400 */     /* terminal 190 */ 0xBE,
-                        /* terminal 196 */ 0xC4,
-/* pos 01a6: 403 */    /* 0 */ 0x01  /* (to 0x01A8 state 404) */,
-                       /* 1 */ 0x0D  /* (to 0x01C0 state 427) */,
-/* pos 01a8: 404 */    /* 0 */ 0x01  /* (to 0x01AA state 405) */,
-                       /* 1 */ 0x0A  /* (to 0x01BC state 424) */,
-/* pos 01aa: 405 */    /* 0 */ 0x01  /* (to 0x01AC state 406) */,
-                       /* 1 */ 0x08  /* (to 0x01BA state 421) */,
-/* pos 01ac: 406 */     /* terminal 192 */ 0xC0,
-                        /* terminal 193 */ 0xC1,
-/* pos 01ae: 412 */     /* terminal 197 */ 0xC5,
-                        /* terminal 231 */ 0xE7,
-/* pos 01b0: 414 */    /* 0 */ 0x01  /* (to 0x01B2 state 415) */,
-                       /* 1 */ 0x1B  /* (to 0x01E6 state 475) */,
-/* pos 01b2: 415 */     /* terminal 198 */ 0xC6,
-                        /* terminal 228 */ 0xE4,
-/* pos 01b4: 417 */    /* 0 */ 0x1B  /* (to 0x01EA state 481) */,
-                       /* 1 */ 0x01  /* (to 0x01B6 state 418) */,
-/* pos 01b6: 418 */    /* 0 */ 0x01  /* (to 0x01B8 state 419) */,
-                       /* 1 */ 0x19  /* (to 0x01E8 state 478) */,
-/* pos 01b8: 419 */     /* terminal 199 */ 0xC7,
-                        /* terminal 207 */ 0xCF,
-/* pos 01ba: 421 */     /* terminal 200 */ 0xC8,
-                        /* terminal 201 */ 0xC9,
-/* pos 01bc: 424 */    /* 0 */ 0x01  /* (to 0x01BE state 425) */,
-                       /* 1 */ 0x06  /* (to 0x01C8 state 438) */,
-/* pos 01be: 425 */     /* terminal 202 */ 0xCA,
-                        /* terminal 205 */ 0xCD,
-/* pos 01c0: 427 */    /* 0 */ 0x0D  /* (to 0x01DA state 455) */,
-                       /* 1 */ 0x01  /* (to 0x01C2 state 428) */,
-/* pos 01c2: 428 */    /* 0 */ 0x17  /* (to 0x01F0 state 490) */,
-                       /* 1 */ 0x01  /* (to 0x01C4 state 429) */,
-/* pos 01c4: 429 */     /* terminal 255 */ 0xFF,
-                       /* 1 */ 0x01  /* (to 0x01C6 state 430) */,
-/* pos 01c6: 430 */     /* terminal 203 */ 0xCB,
-                        /* terminal 204 */ 0xCC,
-/* pos 01c8: 438 */     /* terminal 210 */ 0xD2,
-                        /* terminal 213 */ 0xD5,
-/* pos 01ca: 440 */    /* 0 */ 0x01  /* (to 0x01CC state 441) */,
-                       /* 1 */ 0x14  /* (to 0x01F2 state 494) */,
-/* pos 01cc: 441 */    /* 0 */ 0x01  /* (to 0x01CE state 442) */,
-                       /* 1 */ 0x09  /* (to 0x01DE state 461) */,
-/* pos 01ce: 442 */    /* 0 */ 0x01  /* (to 0x01D0 state 443) */,
-                       /* 1 */ 0x02  /* (to 0x01D2 state 447) */,
-/* pos 01d0: 443 */     /* terminal 211 */ 0xD3,
-                        /* terminal 212 */ 0xD4,
-/* pos 01d2: 447 */     /* terminal 214 */ 0xD6,
-                        /* terminal 221 */ 0xDD,
-/* pos 01d4: 449 */     /* terminal 215 */ 0xD7,
-                        /* terminal 225 */ 0xE1,
-/* pos 01d6: 451 */    /* 0 */ 0x01  /* (to 0x01D8 state 452) */,
-                       /* 1 */ 0x07  /* (to 0x01E4 state 469) */,
-/* pos 01d8: 452 */     /* terminal 216 */ 0xD8,
-                        /* terminal 217 */ 0xD9,
-/* pos 01da: 455 */    /* 0 */ 0x01  /* (to 0x01DC state 456) */,
-                       /* 1 */ 0x09  /* (to 0x01EC state 484) */,
-/* pos 01dc: 456 */     /* terminal 218 */ 0xDA,
-                        /* terminal 219 */ 0xDB,
-/* pos 01de: 461 */    /* 0 */ 0x01  /* (to 0x01E0 state 462) */,
-                       /* 1 */ 0x08  /* (to 0x01EE state 488) */,
-/* pos 01e0: 462 */     /* terminal 222 */ 0xDE,
-                        /* terminal 223 */ 0xDF,
-/* pos 01e2: 465 */     /* terminal 224 */ 0xE0,
-                        /* terminal 226 */ 0xE2,
-/* pos 01e4: 469 */     /* terminal 227 */ 0xE3,
-                        /* terminal 229 */ 0xE5,
-/* pos 01e6: 475 */     /* terminal 232 */ 0xE8,
-                        /* terminal 233 */ 0xE9,
-/* pos 01e8: 478 */     /* terminal 234 */ 0xEA,
-                        /* terminal 235 */ 0xEB,
-/* pos 01ea: 481 */     /* terminal 236 */ 0xEC,
-                        /* terminal 237 */ 0xED,
-/* pos 01ec: 484 */     /* terminal 238 */ 0xEE,
-                        /* terminal 240 */ 0xF0,
-/* pos 01ee: 488 */     /* terminal 241 */ 0xF1,
-                        /* terminal 244 */ 0xF4,
-/* pos 01f0: 490 */     /* terminal 242 */ 0xF2,
-                        /* terminal 243 */ 0xF3,
-/* pos 01f2: 494 */    /* 0 */ 0x01  /* (to 0x01F4 state 495) */,
-                       /* 1 */ 0x04  /* (to 0x01FA state 503) */,
-/* pos 01f4: 495 */    /* 0 */ 0x01  /* (to 0x01F6 state 496) */,
-                       /* 1 */ 0x02  /* (to 0x01F8 state 499) */,
-/* pos 01f6: 496 */     /* terminal 245 */ 0xF5,
-                        /* terminal 246 */ 0xF6,
-/* pos 01f8: 499 */     /* terminal 247 */ 0xF7,
-                        /* terminal 248 */ 0xF8,
-/* pos 01fa: 503 */    /* 0 */ 0x01  /* (to 0x01FC state 504) */,
-                       /* 1 */ 0x02  /* (to 0x01FE state 507) */,
-/* pos 01fc: 504 */     /* terminal 250 */ 0xFA,
-                        /* terminal 251 */ 0xFB,
-/* pos 01fe: 507 */     /* terminal 252 */ 0xFC,
-                        /* terminal 253 */ 0xFD,
-/* total size 512 bytes, biggest jump 200/256, fails=0 */
+/*
+ * Generated by minihuf.c, do not edit
+ *
+ * HPACK Huffman decoder, taking 4 bits at a time.  Index with the
+ * current state (starting at 0) and the next nibble of input, msb
+ * first.
+ */
+
+#define HUFTABLE_ACCEPT	1 /* the string may end here */
+#define HUFTABLE_SYM	2 /* .sym was decoded */
+#define HUFTABLE_FAIL	4 /* EOS was decoded */
+
+struct huftable_nib {
+	uint8_t state;
+	uint8_t flags;
+	uint8_t sym;
 };
 
- static unsigned char lextable_terms[] = {
+static const struct huftable_nib huftable_nib[256][16] = {
+	{ /* state 0 */
+		{  87, 0, 0x00 }, {  88, 0, 0x00 }, { 131, 0, 0x00 }, { 135, 0, 0x00 }, 
+		{ 143, 0, 0x00 }, {  69, 0, 0x00 }, {  83, 0, 0x00 }, {  90, 0, 0x00 }, 
+		{ 100, 0, 0x00 }, { 132, 0, 0x00 }, { 138, 0, 0x00 }, {  95, 0, 0x00 }, 
+		{ 105, 0, 0x00 }, { 112, 0, 0x00 }, { 119, 0, 0x00 }, {   4, 1, 0x00 }, 
+	},
+	{ /* state 1 */
+		{ 101, 0, 0x00 }, { 129, 0, 0x00 }, { 133, 0, 0x00 }, { 134, 0, 0x00 }, 
+		{ 139, 0, 0x00 }, { 140, 0, 0x00 }, { 142, 0, 0x00 }, {  96, 0, 0x00 }, 
+		{ 106, 0, 0x00 }, { 109, 0, 0x00 }, { 113, 0, 0x00 }, { 116, 0, 0x00 }, 
+		{ 120, 0, 0x00 }, { 136, 0, 0x00 }, { 144, 0, 0x00 }, {   5, 1, 0x00 }, 
+	},
+	{ /* state 2 */
+		{ 107, 0, 0x00 }, { 108, 0, 0x00 }, { 110, 0, 0x00 }, { 111, 0, 0x00 }, 
+		{ 114, 0, 0x00 }, { 115, 0, 0x00 }, { 117, 0, 0x00 }, { 118, 0, 0x00 }, 
+		{ 121, 0, 0x00 }, { 122, 0, 0x00 }, { 137, 0, 0x00 }, { 141, 0, 0x00 }, 
+		{ 145, 0, 0x00 }, { 146, 0, 0x00 }, {  75, 0, 0x00 }, {   6, 1, 0x00 }, 
+	},
+	{ /* state 3 */
+		{   0, 3, 0x55 }, {   0, 3, 0x56 }, {   0, 3, 0x57 }, {   0, 3, 0x59 }, 
+		{   0, 3, 0x6a }, {   0, 3, 0x6b }, {   0, 3, 0x71 }, {   0, 3, 0x76 }, 
+		{   0, 3, 0x77 }, {   0, 3, 0x78 }, {   0, 3, 0x79 }, {   0, 3, 0x7a }, 
+		{  76, 0, 0x00 }, {  80, 0, 0x00 }, { 123, 0, 0x00 }, {   7, 1, 0x00 }, 
+	},
+	{ /* state 4 */
+		{  66, 2, 0x77 }, {   1, 3, 0x77 }, {  66, 2, 0x78 }, {   1, 3, 0x78 }, 
+		{  66, 2, 0x79 }, {   1, 3, 0x79 }, {  66, 2, 0x7a }, {   1, 3, 0x7a }, 
+		{   0, 3, 0x26 }, {   0, 3, 0x2a }, {   0, 3, 0x2c }, {   0, 3, 0x3b }, 
+		{   0, 3, 0x58 }, {   0, 3, 0x5a }, {  71, 0, 0x00 }, {   8, 0, 0x00 }, 
+	},
+	{ /* state 5 */
+		{  66, 2, 0x26 }, {   1, 3, 0x26 }, {  66, 2, 0x2a }, {   1, 3, 0x2a }, 
+		{  66, 2, 0x2c }, {   1, 3, 0x2c }, {  66, 2, 0x3b }, {   1, 3, 0x3b }, 
+		{  66, 2, 0x58 }, {   1, 3, 0x58 }, {  66, 2, 0x5a }, {   1, 3, 0x5a }, 
+		{  72, 0, 0x00 }, {  79, 0, 0x00 }, {  77, 0, 0x00 }, {   9, 0, 0x00 }, 
+	},
+	{ /* state 6 */
+		{  85, 2, 0x58 }, {  67, 2, 0x58 }, {  93, 2, 0x58 }, {   2, 3, 0x58 }, 
+		{  85, 2, 0x5a }, {  67, 2, 0x5a }, {  93, 2, 0x5a }, {   2, 3, 0x5a }, 
+		{   0, 3, 0x21 }, {   0, 3, 0x22 }, {   0, 3, 0x28 }, {   0, 3, 0x29 }, 
+		{   0, 3, 0x3f }, {  78, 0, 0x00 }, {  73, 0, 0x00 }, {  10, 0, 0x00 }, 
+	},
+	{ /* state 7 */
+		{  66, 2, 0x21 }, {   1, 3, 0x21 }, {  66, 2, 0x22 }, {   1, 3, 0x22 }, 
+		{  66, 2, 0x28 }, {   1, 3, 0x28 }, {  66, 2, 0x29 }, {   1, 3, 0x29 }, 
+		{  66, 2, 0x3f }, {   1, 3, 0x3f }, {   0, 3, 0x27 }, {   0, 3, 0x2b }, 
+		{   0, 3, 0x7c }, {  74, 0, 0x00 }, {  11, 0, 0x00 }, {  13, 0, 0x00 }, 
+	},
+	{ /* state 8 */
+		{  85, 2, 0x3f }, {  67, 2, 0x3f }, {  93, 2, 0x3f }, {   2, 3, 0x3f }, 
+		{  66, 2, 0x27 }, {   1, 3, 0x27 }, {  66, 2, 0x2b }, {   1, 3, 0x2b }, 
+		{  66, 2, 0x7c }, {   1, 3, 0x7c }, {   0, 3, 0x23 }, {   0, 3, 0x3e }, 
+		{  12, 0, 0x00 }, { 102, 0, 0x00 }, { 127, 0, 0x00 }, {  14, 0, 0x00 }, 
+	},
+	{ /* state 9 */
+		{  85, 2, 0x7c }, {  67, 2, 0x7c }, {  93, 2, 0x7c }, {   2, 3, 0x7c }, 
+		{  66, 2, 0x23 }, {   1, 3, 0x23 }, {  66, 2, 0x3e }, {   1, 3, 0x3e }, 
+		{   0, 3, 0x00 }, {   0, 3, 0x24 }, {   0, 3, 0x40 }, {   0, 3, 0x5b }, 
+		{   0, 3, 0x5d }, {   0, 3, 0x7e }, { 128, 0, 0x00 }, {  15, 0, 0x00 }, 
+	},
+	{ /* state 10 */
+		{  66, 2, 0x00 }, {   1, 3, 0x00 }, {  66, 2, 0x24 }, {   1, 3, 0x24 }, 
+		{  66, 2, 0x40 }, {   1, 3, 0x40 }, {  66, 2, 0x5b }, {   1, 3, 0x5b }, 
+		{  66, 2, 0x5d }, {   1, 3, 0x5d }, {  66, 2, 0x7e }, {   1, 3, 0x7e }, 
+		{   0, 3, 0x5e }, {   0, 3, 0x7d }, {  98, 0, 0x00 }, {  16, 0, 0x00 }, 
+	},
+	{ /* state 11 */
+		{  85, 2, 0x00 }, {  67, 2, 0x00 }, {  93, 2, 0x00 }, {   2, 3, 0x00 }, 
+		{  85, 2, 0x24 }, {  67, 2, 0x24 }, {  93, 2, 0x24 }, {   2, 3, 0x24 }, 
+		{  85, 2, 0x40 }, {  67, 2, 0x40 }, {  93, 2, 0x40 }, {   2, 3, 0x40 }, 
+		{  85, 2, 0x5b }, {  67, 2, 0x5b }, {  93, 2, 0x5b }, {   2, 3, 0x5b }, 
+	},
+	{ /* state 12 */
+		{  86, 2, 0x00 }, { 130, 2, 0x00 }, {  68, 2, 0x00 }, {  82, 2, 0x00 }, 
+		{  99, 2, 0x00 }, {  94, 2, 0x00 }, { 104, 2, 0x00 }, {   3, 3, 0x00 }, 
+		{  86, 2, 0x24 }, { 130, 2, 0x24 }, {  68, 2, 0x24 }, {  82, 2, 0x24 }, 
+		{  99, 2, 0x24 }, {  94, 2, 0x24 }, { 104, 2, 0x24 }, {   3, 3, 0x24 }, 
+	},
+	{ /* state 13 */
+		{  85, 2, 0x5d }, {  67, 2, 0x5d }, {  93, 2, 0x5d }, {   2, 3, 0x5d }, 
+		{  85, 2, 0x7e }, {  67, 2, 0x7e }, {  93, 2, 0x7e }, {   2, 3, 0x7e }, 
+		{  66, 2, 0x5e }, {   1, 3, 0x5e }, {  66, 2, 0x7d }, {   1, 3, 0x7d }, 
+		{   0, 3, 0x3c }, {   0, 3, 0x60 }, {   0, 3, 0x7b }, {  17, 0, 0x00 }, 
+	},
+	{ /* state 14 */
+		{  85, 2, 0x5e }, {  67, 2, 0x5e }, {  93, 2, 0x5e }, {   2, 3, 0x5e }, 
+		{  85, 2, 0x7d }, {  67, 2, 0x7d }, {  93, 2, 0x7d }, {   2, 3, 0x7d }, 
+		{  66, 2, 0x3c }, {   1, 3, 0x3c }, {  66, 2, 0x60 }, {   1, 3, 0x60 }, 
+		{  66, 2, 0x7b }, {   1, 3, 0x7b }, { 124, 0, 0x00 }, {  18, 0, 0x00 }, 
+	},
+	{ /* state 15 */
+		{  85, 2, 0x3c }, {  67, 2, 0x3c }, {  93, 2, 0x3c }, {   2, 3, 0x3c }, 
+		{  85, 2, 0x60 }, {  67, 2, 0x60 }, {  93, 2, 0x60 }, {   2, 3, 0x60 }, 
+		{  85, 2, 0x7b }, {  67, 2, 0x7b }, {  93, 2, 0x7b }, {   2, 3, 0x7b }, 
+		{ 125, 0, 0x00 }, { 155, 0, 0x00 }, { 150, 0, 0x00 }, {  19, 0, 0x00 }, 
+	},
+	{ /* state 16 */
+		{  86, 2, 0x7b }, { 130, 2, 0x7b }, {  68, 2, 0x7b }, {  82, 2, 0x7b }, 
+		{  99, 2, 0x7b }, {  94, 2, 0x7b }, { 104, 2, 0x7b }, {   3, 3, 0x7b }, 
+		{ 126, 0, 0x00 }, { 148, 0, 0x00 }, { 156, 0, 0x00 }, { 175, 0, 0x00 }, 
+		{ 196, 0, 0x00 }, { 151, 0, 0x00 }, {  20, 0, 0x00 }, {  25, 0, 0x00 }, 
+	},
+	{ /* state 17 */
+		{   0, 3, 0x5c }, {   0, 3, 0xc3 }, {   0, 3, 0xd0 }, { 149, 0, 0x00 }, 
+		{ 157, 0, 0x00 }, { 204, 0, 0x00 }, { 241, 0, 0x00 }, { 176, 0, 0x00 }, 
+		{ 197, 0, 0x00 }, { 235, 0, 0x00 }, { 152, 0, 0x00 }, { 178, 0, 0x00 }, 
+		{ 199, 0, 0x00 }, {  21, 0, 0x00 }, { 167, 0, 0x00 }, {  26, 0, 0x00 }, 
+	},
+	{ /* state 18 */
+		{ 198, 0, 0x00 }, { 202, 0, 0x00 }, { 236, 0, 0x00 }, { 242, 0, 0x00 }, 
+		{ 153, 0, 0x00 }, { 158, 0, 0x00 }, { 179, 0, 0x00 }, { 183, 0, 0x00 }, 
+		{ 200, 0, 0x00 }, { 206, 0, 0x00 }, { 216, 0, 0x00 }, {  22, 0, 0x00 }, 
+		{ 168, 0, 0x00 }, { 185, 0, 0x00 }, {  41, 0, 0x00 }, {  27, 0, 0x00 }, 
+	},
+	{ /* state 19 */
+		{ 201, 0, 0x00 }, { 205, 0, 0x00 }, { 207, 0, 0x00 }, { 210, 0, 0x00 }, 
+		{ 217, 0, 0x00 }, { 243, 0, 0x00 }, {  23, 0, 0x00 }, { 162, 0, 0x00 }, 
+		{ 169, 0, 0x00 }, { 173, 0, 0x00 }, { 186, 0, 0x00 }, { 194, 0, 0x00 }, 
+		{ 208, 0, 0x00 }, {  42, 0, 0x00 }, { 191, 0, 0x00 }, {  28, 0, 0x00 }, 
+	},
+	{ /* state 20 */
+		{   0, 3, 0xb2 }, {   0, 3, 0xb5 }, {   0, 3, 0xb9 }, {   0, 3, 0xba }, 
+		{   0, 3, 0xbb }, {   0, 3, 0xbd }, {   0, 3, 0xbe }, {   0, 3, 0xc4 }, 
+		{   0, 3, 0xc6 }, {   0, 3, 0xe4 }, {   0, 3, 0xe8 }, {   0, 3, 0xe9 }, 
+		{  24, 0, 0x00 }, { 161, 0, 0x00 }, { 163, 0, 0x00 }, { 164, 0, 0x00 }, 
+	},
+	{ /* state 21 */
+		{  66, 2, 0xc6 }, {   1, 3, 0xc6 }, {  66, 2, 0xe4 }, {   1, 3, 0xe4 }, 
+		{  66, 2, 0xe8 }, {   1, 3, 0xe8 }, {  66, 2, 0xe9 }, {   1, 3, 0xe9 }, 
+		{   0, 3, 0x01 }, {   0, 3, 0x87 }, {   0, 3, 0x89 }, {   0, 3, 0x8a }, 
+		{   0, 3, 0x8b }, {   0, 3, 0x8c }, {   0, 3, 0x8d }, {   0, 3, 0x8f }, 
+	},
+	{ /* state 22 */
+		{  66, 2, 0x01 }, {   1, 3, 0x01 }, {  66, 2, 0x87 }, {   1, 3, 0x87 }, 
+		{  66, 2, 0x89 }, {   1, 3, 0x89 }, {  66, 2, 0x8a }, {   1, 3, 0x8a }, 
+		{  66, 2, 0x8b }, {   1, 3, 0x8b }, {  66, 2, 0x8c }, {   1, 3, 0x8c }, 
+		{  66, 2, 0x8d }, {   1, 3, 0x8d }, {  66, 2, 0x8f }, {   1, 3, 0x8f }, 
+	},
+	{ /* state 23 */
+		{  85, 2, 0x01 }, {  67, 2, 0x01 }, {  93, 2, 0x01 }, {   2, 3, 0x01 }, 
+		{  85, 2, 0x87 }, {  67, 2, 0x87 }, {  93, 2, 0x87 }, {   2, 3, 0x87 }, 
+		{  85, 2, 0x89 }, {  67, 2, 0x89 }, {  93, 2, 0x89 }, {   2, 3, 0x89 }, 
+		{  85, 2, 0x8a }, {  67, 2, 0x8a }, {  93, 2, 0x8a }, {   2, 3, 0x8a }, 
+	},
+	{ /* state 24 */
+		{  86, 2, 0x01 }, { 130, 2, 0x01 }, {  68, 2, 0x01 }, {  82, 2, 0x01 }, 
+		{  99, 2, 0x01 }, {  94, 2, 0x01 }, { 104, 2, 0x01 }, {   3, 3, 0x01 }, 
+		{  86, 2, 0x87 }, { 130, 2, 0x87 }, {  68, 2, 0x87 }, {  82, 2, 0x87 }, 
+		{  99, 2, 0x87 }, {  94, 2, 0x87 }, { 104, 2, 0x87 }, {   3, 3, 0x87 }, 
+	},
+	{ /* state 25 */
+		{ 170, 0, 0x00 }, { 172, 0, 0x00 }, { 174, 0, 0x00 }, { 181, 0, 0x00 }, 
+		{ 187, 0, 0x00 }, { 189, 0, 0x00 }, { 195, 0, 0x00 }, { 203, 0, 0x00 }, 
+		{ 209, 0, 0x00 }, { 215, 0, 0x00 }, {  43, 0, 0x00 }, { 165, 0, 0x00 }, 
+		{ 192, 0, 0x00 }, { 218, 0, 0x00 }, { 211, 0, 0x00 }, {  29, 0, 0x00 }, 
+	},
+	{ /* state 26 */
+		{   0, 3, 0xbc }, {   0, 3, 0xbf }, {   0, 3, 0xc5 }, {   0, 3, 0xe7 }, 
+		{   0, 3, 0xef }, {  44, 0, 0x00 }, { 166, 0, 0x00 }, { 171, 0, 0x00 }, 
+		{ 193, 0, 0x00 }, { 234, 0, 0x00 }, { 245, 0, 0x00 }, { 219, 0, 0x00 }, 
+		{ 212, 0, 0x00 }, { 224, 0, 0x00 }, { 229, 0, 0x00 }, {  30, 0, 0x00 }, 
+	},
+	{ /* state 27 */
+		{   0, 3, 0xab }, {   0, 3, 0xce }, {   0, 3, 0xd7 }, {   0, 3, 0xe1 }, 
+		{   0, 3, 0xec }, {   0, 3, 0xed }, { 220, 0, 0x00 }, { 244, 0, 0x00 }, 
+		{ 213, 0, 0x00 }, { 222, 0, 0x00 }, { 237, 0, 0x00 }, { 225, 0, 0x00 }, 
+		{ 230, 0, 0x00 }, { 249, 0, 0x00 }, {  31, 0, 0x00 }, {  45, 0, 0x00 }, 
+	},
+	{ /* state 28 */
+		{ 214, 0, 0x00 }, { 221, 0, 0x00 }, { 223, 0, 0x00 }, { 228, 0, 0x00 }, 
+		{ 238, 0, 0x00 }, { 246, 0, 0x00 }, { 248, 0, 0x00 }, { 226, 0, 0x00 }, 
+		{ 231, 0, 0x00 }, { 239, 0, 0x00 }, { 250, 0, 0x00 }, { 253, 0, 0x00 }, 
+		{  32, 0, 0x00 }, {  38, 0, 0x00 }, {  55, 0, 0x00 }, {  46, 0, 0x00 }, 
+	},
+	{ /* state 29 */
+		{ 232, 0, 0x00 }, { 233, 0, 0x00 }, { 240, 0, 0x00 }, { 247, 0, 0x00 }, 
+		{ 251, 0, 0x00 }, { 252, 0, 0x00 }, { 254, 0, 0x00 }, { 255, 0, 0x00 }, 
+		{  33, 0, 0x00 }, {  35, 0, 0x00 }, {  39, 0, 0x00 }, {  52, 0, 0x00 }, 
+		{  56, 0, 0x00 }, {  60, 0, 0x00 }, {  63, 0, 0x00 }, {  47, 0, 0x00 }, 
+	},
+	{ /* state 30 */
+		{   0, 3, 0xfe }, {  34, 0, 0x00 }, {  36, 0, 0x00 }, {  37, 0, 0x00 }, 
+		{  40, 0, 0x00 }, {  51, 0, 0x00 }, {  53, 0, 0x00 }, {  54, 0, 0x00 }, 
+		{  57, 0, 0x00 }, {  58, 0, 0x00 }, {  61, 0, 0x00 }, {  62, 0, 0x00 }, 
+		{  64, 0, 0x00 }, {  65, 0, 0x00 }, { 147, 0, 0x00 }, {  48, 0, 0x00 }, 
+	},
+	{ /* state 31 */
+		{  66, 2, 0xfe }, {   1, 3, 0xfe }, {   0, 3, 0x02 }, {   0, 3, 0x03 }, 
+		{   0, 3, 0x04 }, {   0, 3, 0x05 }, {   0, 3, 0x06 }, {   0, 3, 0x07 }, 
+		{   0, 3, 0x08 }, {   0, 3, 0x0b }, {   0, 3, 0x0c }, {   0, 3, 0x0e }, 
+		{   0, 3, 0x0f }, {   0, 3, 0x10 }, {   0, 3, 0x11 }, {   0, 3, 0x12 }, 
+	},
+	{ /* state 32 */
+		{  85, 2, 0xfe }, {  67, 2, 0xfe }, {  93, 2, 0xfe }, {   2, 3, 0xfe }, 
+		{  66, 2, 0x02 }, {   1, 3, 0x02 }, {  66, 2, 0x03 }, {   1, 3, 0x03 }, 
+		{  66, 2, 0x04 }, {   1, 3, 0x04 }, {  66, 2, 0x05 }, {   1, 3, 0x05 }, 
+		{  66, 2, 0x06 }, {   1, 3, 0x06 }, {  66, 2, 0x07 }, {   1, 3, 0x07 }, 
+	},
+	{ /* state 33 */
+		{  86, 2, 0xfe }, { 130, 2, 0xfe }, {  68, 2, 0xfe }, {  82, 2, 0xfe }, 
+		{  99, 2, 0xfe }, {  94, 2, 0xfe }, { 104, 2, 0xfe }, {   3, 3, 0xfe }, 
+		{  85, 2, 0x02 }, {  67, 2, 0x02 }, {  93, 2, 0x02 }, {   2, 3, 0x02 }, 
+		{  85, 2, 0x03 }, {  67, 2, 0x03 }, {  93, 2, 0x03 }, {   2, 3, 0x03 }, 
+	},
+	{ /* state 34 */
+		{  86, 2, 0x02 }, { 130, 2, 0x02 }, {  68, 2, 0x02 }, {  82, 2, 0x02 }, 
+		{  99, 2, 0x02 }, {  94, 2, 0x02 }, { 104, 2, 0x02 }, {   3, 3, 0x02 }, 
+		{  86, 2, 0x03 }, { 130, 2, 0x03 }, {  68, 2, 0x03 }, {  82, 2, 0x03 }, 
+		{  99, 2, 0x03 }, {  94, 2, 0x03 }, { 104, 2, 0x03 }, {   3, 3, 0x03 }, 
+	},
+	{ /* state 35 */
+		{  85, 2, 0x04 }, {  67, 2, 0x04 }, {  93, 2, 0x04 }, {   2, 3, 0x04 }, 
+		{  85, 2, 0x05 }, {  67, 2, 0x05 }, {  93, 2, 0x05 }, {   2, 3, 0x05 }, 
+		{  85, 2, 0x06 }, {  67, 2, 0x06 }, {  93, 2, 0x06 }, {   2, 3, 0x06 }, 
+		{  85, 2, 0x07 }, {  67, 2, 0x07 }, {  93, 2, 0x07 }, {   2, 3, 0x07 }, 
+	},
+	{ /* state 36 */
+		{  86, 2, 0x04 }, { 130, 2, 0x04 }, {  68, 2, 0x04 }, {  82, 2, 0x04 }, 
+		{  99, 2, 0x04 }, {  94, 2, 0x04 }, { 104, 2, 0x04 }, {   3, 3, 0x04 }, 
+		{  86, 2, 0x05 }, { 130, 2, 0x05 }, {  68, 2, 0x05 }, {  82, 2, 0x05 }, 
+		{  99, 2, 0x05 }, {  94, 2, 0x05 }, { 104, 2, 0x05 }, {   3, 3, 0x05 }, 
+	},
+	{ /* state 37 */
+		{  86, 2, 0x06 }, { 130, 2, 0x06 }, {  68, 2, 0x06 }, {  82, 2, 0x06 }, 
+		{  99, 2, 0x06 }, {  94, 2, 0x06 }, { 104, 2, 0x06 }, {   3, 3, 0x06 }, 
+		{  86, 2, 0x07 }, { 130, 2, 0x07 }, {  68, 2, 0x07 }, {  82, 2, 0x07 }, 
+		{  99, 2, 0x07 }, {  94, 2, 0x07 }, { 104, 2, 0x07 }, {   3, 3, 0x07 }, 
+	},
+	{ /* state 38 */
+		{  66, 2, 0x08 }, {   1, 3, 0x08 }, {  66, 2, 0x0b }, {   1, 3, 0x0b }, 
+		{  66, 2, 0x0c }, {   1, 3, 0x0c }, {  66, 2, 0x0e }, {   1, 3, 0x0e }, 
+		{  66, 2, 0x0f }, {   1, 3, 0x0f }, {  66, 2, 0x10 }, {   1, 3, 0x10 }, 
+		{  66, 2, 0x11 }, {   1, 3, 0x11 }, {  66, 2, 0x12 }, {   1, 3, 0x12 }, 
+	},
+	{ /* state 39 */
+		{  85, 2, 0x08 }, {  67, 2, 0x08 }, {  93, 2, 0x08 }, {   2, 3, 0x08 }, 
+		{  85, 2, 0x0b }, {  67, 2, 0x0b }, {  93, 2, 0x0b }, {   2, 3, 0x0b }, 
+		{  85, 2, 0x0c }, {  67, 2, 0x0c }, {  93, 2, 0x0c }, {   2, 3, 0x0c }, 
+		{  85, 2, 0x0e }, {  67, 2, 0x0e }, {  93, 2, 0x0e }, {   2, 3, 0x0e }, 
+	},
+	{ /* state 40 */
+		{  86, 2, 0x08 }, { 130, 2, 0x08 }, {  68, 2, 0x08 }, {  82, 2, 0x08 }, 
+		{  99, 2, 0x08 }, {  94, 2, 0x08 }, { 104, 2, 0x08 }, {   3, 3, 0x08 }, 
+		{  86, 2, 0x0b }, { 130, 2, 0x0b }, {  68, 2, 0x0b }, {  82, 2, 0x0b }, 
+		{  99, 2, 0x0b }, {  94, 2, 0x0b }, { 104, 2, 0x0b }, {   3, 3, 0x0b }, 
+	},
+	{ /* state 41 */
+		{  66, 2, 0xbc }, {   1, 3, 0xbc }, {  66, 2, 0xbf }, {   1, 3, 0xbf }, 
+		{  66, 2, 0xc5 }, {   1, 3, 0xc5 }, {  66, 2, 0xe7 }, {   1, 3, 0xe7 }, 
+		{  66, 2, 0xef }, {   1, 3, 0xef }, {   0, 3, 0x09 }, {   0, 3, 0x8e }, 
+		{   0, 3, 0x90 }, {   0, 3, 0x91 }, {   0, 3, 0x94 }, {   0, 3, 0x9f }, 
+	},
+	{ /* state 42 */
+		{  85, 2, 0xef }, {  67, 2, 0xef }, {  93, 2, 0xef }, {   2, 3, 0xef }, 
+		{  66, 2, 0x09 }, {   1, 3, 0x09 }, {  66, 2, 0x8e }, {   1, 3, 0x8e }, 
+		{  66, 2, 0x90 }, {   1, 3, 0x90 }, {  66, 2, 0x91 }, {   1, 3, 0x91 }, 
+		{  66, 2, 0x94 }, {   1, 3, 0x94 }, {  66, 2, 0x9f }, {   1, 3, 0x9f }, 
+	},
+	{ /* state 43 */
+		{  86, 2, 0xef }, { 130, 2, 0xef }, {  68, 2, 0xef }, {  82, 2, 0xef }, 
+		{  99, 2, 0xef }, {  94, 2, 0xef }, { 104, 2, 0xef }, {   3, 3, 0xef }, 
+		{  85, 2, 0x09 }, {  67, 2, 0x09 }, {  93, 2, 0x09 }, {   2, 3, 0x09 }, 
+		{  85, 2, 0x8e }, {  67, 2, 0x8e }, {  93, 2, 0x8e }, {   2, 3, 0x8e }, 
+	},
+	{ /* state 44 */
+		{  86, 2, 0x09 }, { 130, 2, 0x09 }, {  68, 2, 0x09 }, {  82, 2, 0x09 }, 
+		{  99, 2, 0x09 }, {  94, 2, 0x09 }, { 104, 2, 0x09 }, {   3, 3, 0x09 }, 
+		{  86, 2, 0x8e }, { 130, 2, 0x8e }, {  68, 2, 0x8e }, {  82, 2, 0x8e }, 
+		{  99, 2, 0x8e }, {  94, 2, 0x8e }, { 104, 2, 0x8e }, {   3, 3, 0x8e }, 
+	},
+	{ /* state 45 */
+		{   0, 3, 0x13 }, {   0, 3, 0x14 }, {   0, 3, 0x15 }, {   0, 3, 0x17 }, 
+		{   0, 3, 0x18 }, {   0, 3, 0x19 }, {   0, 3, 0x1a }, {   0, 3, 0x1b }, 
+		{   0, 3, 0x1c }, {   0, 3, 0x1d }, {   0, 3, 0x1e }, {   0, 3, 0x1f }, 
+		{   0, 3, 0x7f }, {   0, 3, 0xdc }, {   0, 3, 0xf9 }, {  49, 0, 0x00 }, 
+	},
+	{ /* state 46 */
+		{  66, 2, 0x1c }, {   1, 3, 0x1c }, {  66, 2, 0x1d }, {   1, 3, 0x1d }, 
+		{  66, 2, 0x1e }, {   1, 3, 0x1e }, {  66, 2, 0x1f }, {   1, 3, 0x1f }, 
+		{  66, 2, 0x7f }, {   1, 3, 0x7f }, {  66, 2, 0xdc }, {   1, 3, 0xdc }, 
+		{  66, 2, 0xf9 }, {   1, 3, 0xf9 }, {  50, 0, 0x00 }, {  59, 0, 0x00 }, 
+	},
+	{ /* state 47 */
+		{  85, 2, 0x7f }, {  67, 2, 0x7f }, {  93, 2, 0x7f }, {   2, 3, 0x7f }, 
+		{  85, 2, 0xdc }, {  67, 2, 0xdc }, {  93, 2, 0xdc }, {   2, 3, 0xdc }, 
+		{  85, 2, 0xf9 }, {  67, 2, 0xf9 }, {  93, 2, 0xf9 }, {   2, 3, 0xf9 }, 
+		{   0, 3, 0x0a }, {   0, 3, 0x0d }, {   0, 3, 0x16 }, {   0, 5, 0x00 }, 
+	},
+	{ /* state 48 */
+		{  86, 2, 0xf9 }, { 130, 2, 0xf9 }, {  68, 2, 0xf9 }, {  82, 2, 0xf9 }, 
+		{  99, 2, 0xf9 }, {  94, 2, 0xf9 }, { 104, 2, 0xf9 }, {   3, 3, 0xf9 }, 
+		{  66, 2, 0x0a }, {   1, 3, 0x0a }, {  66, 2, 0x0d }, {   1, 3, 0x0d }, 
+		{  66, 2, 0x16 }, {   1, 3, 0x16 }, {  66, 4, 0x00 }, {   1, 5, 0x00 }, 
+	},
+	{ /* state 49 */
+		{  85, 2, 0x0a }, {  67, 2, 0x0a }, {  93, 2, 0x0a }, {   2, 3, 0x0a }, 
+		{  85, 2, 0x0d }, {  67, 2, 0x0d }, {  93, 2, 0x0d }, {   2, 3, 0x0d }, 
+		{  85, 2, 0x16 }, {  67, 2, 0x16 }, {  93, 2, 0x16 }, {   2, 3, 0x16 }, 
+		{  85, 4, 0x00 }, {  67, 4, 0x00 }, {  93, 4, 0x00 }, {   2, 5, 0x00 }, 
+	},
+	{ /* state 50 */
+		{  86, 2, 0x0a }, { 130, 2, 0x0a }, {  68, 2, 0x0a }, {  82, 2, 0x0a }, 
+		{  99, 2, 0x0a }, {  94, 2, 0x0a }, { 104, 2, 0x0a }, {   3, 3, 0x0a }, 
+		{  86, 2, 0x0d }, { 130, 2, 0x0d }, {  68, 2, 0x0d }, {  82, 2, 0x0d }, 
+		{  99, 2, 0x0d }, {  94, 2, 0x0d }, { 104, 2, 0x0d }, {   3, 3, 0x0d }, 
+	},
+	{ /* state 51 */
+		{  86, 2, 0x0c }, { 130, 2, 0x0c }, {  68, 2, 0x0c }, {  82, 2, 0x0c }, 
+		{  99, 2, 0x0c }, {  94, 2, 0x0c }, { 104, 2, 0x0c }, {   3, 3, 0x0c }, 
+		{  86, 2, 0x0e }, { 130, 2, 0x0e }, {  68, 2, 0x0e }, {  82, 2, 0x0e }, 
+		{  99, 2, 0x0e }, {  94, 2, 0x0e }, { 104, 2, 0x0e }, {   3, 3, 0x0e }, 
+	},
+	{ /* state 52 */
+		{  85, 2, 0x0f }, {  67, 2, 0x0f }, {  93, 2, 0x0f }, {   2, 3, 0x0f }, 
+		{  85, 2, 0x10 }, {  67, 2, 0x10 }, {  93, 2, 0x10 }, {   2, 3, 0x10 }, 
+		{  85, 2, 0x11 }, {  67, 2, 0x11 }, {  93, 2, 0x11 }, {   2, 3, 0x11 }, 
+		{  85, 2, 0x12 }, {  67, 2, 0x12 }, {  93, 2, 0x12 }, {   2, 3, 0x12 }, 
+	},
+	{ /* state 53 */
+		{  86, 2, 0x0f }, { 130, 2, 0x0f }, {  68, 2, 0x0f }, {  82, 2, 0x0f }, 
+		{  99, 2, 0x0f }, {  94, 2, 0x0f }, { 104, 2, 0x0f }, {   3, 3, 0x0f }, 
+		{  86, 2, 0x10 }, { 130, 2, 0x10 }, {  68, 2, 0x10 }, {  82, 2, 0x10 }, 
+		{  99, 2, 0x10 }, {  94, 2, 0x10 }, { 104, 2, 0x10 }, {   3, 3, 0x10 }, 
+	},
+	{ /* state 54 */
+		{  86, 2, 0x11 }, { 130, 2, 0x11 }, {  68, 2, 0x11 }, {  82, 2, 0x11 }, 
+		{  99, 2, 0x11 }, {  94, 2, 0x11 }, { 104, 2, 0x11 }, {   3, 3, 0x11 }, 
+		{  86, 2, 0x12 }, { 130, 2, 0x12 }, {  68, 2, 0x12 }, {  82, 2, 0x12 }, 
+		{  99, 2, 0x12 }, {  94, 2, 0x12 }, { 104, 2, 0x12 }, {   3, 3, 0x12 }, 
+	},
+	{ /* state 55 */
+		{  66, 2, 0x13 }, {   1, 3, 0x13 }, {  66, 2, 0x14 }, {   1, 3, 0x14 }, 
+		{  66, 2, 0x15 }, {   1, 3, 0x15 }, {  66, 2, 0x17 }, {   1, 3, 0x17 }, 
+		{  66, 2, 0x18 }, {   1, 3, 0x18 }, {  66, 2, 0x19 }, {   1, 3, 0x19 }, 
+		{  66, 2, 0x1a }, {   1, 3, 0x1a }, {  66, 2, 0x1b }, {   1, 3, 0x1b }, 
+	},
+	{ /* state 56 */
+		{  85, 2, 0x13 }, {  67, 2, 0x13 }, {  93, 2, 0x13 }, {   2, 3, 0x13 }, 
+		{  85, 2, 0x14 }, {  67, 2, 0x14 }, {  93, 2, 0x14 }, {   2, 3, 0x14 }, 
+		{  85, 2, 0x15 }, {  67, 2, 0x15 }, {  93, 2, 0x15 }, {   2, 3, 0x15 }, 
+		{  85, 2, 0x17 }, {  67, 2, 0x17 }, {  93, 2, 0x17 }, {   2, 3, 0x17 }, 
+	},
+	{ /* state 57 */
+		{  86, 2, 0x13 }, { 130, 2, 0x13 }, {  68, 2, 0x13 }, {  82, 2, 0x13 }, 
+		{  99, 2, 0x13 }, {  94, 2, 0x13 }, { 104, 2, 0x13 }, {   3, 3, 0x13 }, 
+		{  86, 2, 0x14 }, { 130, 2, 0x14 }, {  68, 2, 0x14 }, {  82, 2, 0x14 }, 
+		{  99, 2, 0x14 }, {  94, 2, 0x14 }, { 104, 2, 0x14 }, {   3, 3, 0x14 }, 
+	},
+	{ /* state 58 */
+		{  86, 2, 0x15 }, { 130, 2, 0x15 }, {  68, 2, 0x15 }, {  82, 2, 0x15 }, 
+		{  99, 2, 0x15 }, {  94, 2, 0x15 }, { 104, 2, 0x15 }, {   3, 3, 0x15 }, 
+		{  86, 2, 0x17 }, { 130, 2, 0x17 }, {  68, 2, 0x17 }, {  82, 2, 0x17 }, 
+		{  99, 2, 0x17 }, {  94, 2, 0x17 }, { 104, 2, 0x17 }, {   3, 3, 0x17 }, 
+	},
+	{ /* state 59 */
+		{  86, 2, 0x16 }, { 130, 2, 0x16 }, {  68, 2, 0x16 }, {  82, 2, 0x16 }, 
+		{  99, 2, 0x16 }, {  94, 2, 0x16 }, { 104, 2, 0x16 }, {   3, 3, 0x16 }, 
+		{  86, 4, 0x00 }, { 130, 4, 0x00 }, {  68, 4, 0x00 }, {  82, 4, 0x00 }, 
+		{  99, 4, 0x00 }, {  94, 4, 0x00 }, { 104, 4, 0x00 }, {   3, 5, 0x00 }, 
+	},
+	{ /* state 60 */
+		{  85, 2, 0x18 }, {  67, 2, 0x18 }, {  93, 2, 0x18 }, {   2, 3, 0x18 }, 
+		{  85, 2, 0x19 }, {  67, 2, 0x19 }, {  93, 2, 0x19 }, {   2, 3, 0x19 }, 
+		{  85, 2, 0x1a }, {  67, 2, 0x1a }, {  93, 2, 0x1a }, {   2, 3, 0x1a }, 
+		{  85, 2, 0x1b }, {  67, 2, 0x1b }, {  93, 2, 0x1b }, {   2, 3, 0x1b }, 
+	},
+	{ /* state 61 */
+		{  86, 2, 0x18 }, { 130, 2, 0x18 }, {  68, 2, 0x18 }, {  82, 2, 0x18 }, 
+		{  99, 2, 0x18 }, {  94, 2, 0x18 }, { 104, 2, 0x18 }, {   3, 3, 0x18 }, 
+		{  86, 2, 0x19 }, { 130, 2, 0x19 }, {  68, 2, 0x19 }, {  82, 2, 0x19 }, 
+		{  99, 2, 0x19 }, {  94, 2, 0x19 }, { 104, 2, 0x19 }, {   3, 3, 0x19 }, 
+	},
+	{ /* state 62 */
+		{  86, 2, 0x1a }, { 130, 2, 0x1a }, {  68, 2, 0x1a }, {  82, 2, 0x1a }, 
+		{  99, 2, 0x1a }, {  94, 2, 0x1a }, { 104, 2, 0x1a }, {   3, 3, 0x1a }, 
+		{  86, 2, 0x1b }, { 130, 2, 0x1b }, {  68, 2, 0x1b }, {  82, 2, 0x1b }, 
+		{  99, 2, 0x1b }, {  94, 2, 0x1b }, { 104, 2, 0x1b }, {   3, 3, 0x1b }, 
+	},
+	{ /* state 63 */
+		{  85, 2, 0x1c }, {  67, 2, 0x1c }, {  93, 2, 0x1c }, {   2, 3, 0x1c }, 
+		{  85, 2, 0x1d }, {  67, 2, 0x1d }, {  93, 2, 0x1d }, {   2, 3, 0x1d }, 
+		{  85, 2, 0x1e }, {  67, 2, 0x1e }, {  93, 2, 0x1e }, {   2, 3, 0x1e }, 
+		{  85, 2, 0x1f }, {  67, 2, 0x1f }, {  93, 2, 0x1f }, {   2, 3, 0x1f }, 
+	},
+	{ /* state 64 */
+		{  86, 2, 0x1c }, { 130, 2, 0x1c }, {  68, 2, 0x1c }, {  82, 2, 0x1c }, 
+		{  99, 2, 0x1c }, {  94, 2, 0x1c }, { 104, 2, 0x1c }, {   3, 3, 0x1c }, 
+		{  86, 2, 0x1d }, { 130, 2, 0x1d }, {  68, 2, 0x1d }, {  82, 2, 0x1d }, 
+		{  99, 2, 0x1d }, {  94, 2, 0x1d }, { 104, 2, 0x1d }, {   3, 3, 0x1d }, 
+	},
+	{ /* state 65 */
+		{  86, 2, 0x1e }, { 130, 2, 0x1e }, {  68, 2, 0x1e }, {  82, 2, 0x1e }, 
+		{  99, 2, 0x1e }, {  94, 2, 0x1e }, { 104, 2, 0x1e }, {   3, 3, 0x1e }, 
+		{  86, 2, 0x1f }, { 130, 2, 0x1f }, {  68, 2, 0x1f }, {  82, 2, 0x1f }, 
+		{  99, 2, 0x1f }, {  94, 2, 0x1f }, { 104, 2, 0x1f }, {   3, 3, 0x1f }, 
+	},
+	{ /* state 66 */
+		{   0, 3, 0x30 }, {   0, 3, 0x31 }, {   0, 3, 0x32 }, {   0, 3, 0x61 }, 
+		{   0, 3, 0x63 }, {   0, 3, 0x65 }, {   0, 3, 0x69 }, {   0, 3, 0x6f }, 
+		{   0, 3, 0x73 }, {   0, 3, 0x74 }, {  70, 0, 0x00 }, {  81, 0, 0x00 }, 
+		{  84, 0, 0x00 }, {  89, 0, 0x00 }, {  91, 0, 0x00 }, {  92, 0, 0x00 }, 
+	},
+	{ /* state 67 */
+		{  66, 2, 0x73 }, {   1, 3, 0x73 }, {  66, 2, 0x74 }, {   1, 3, 0x74 }, 
+		{   0, 3, 0x20 }, {   0, 3, 0x25 }, {   0, 3, 0x2d }, {   0, 3, 0x2e }, 
+		{   0, 3, 0x2f }, {   0, 3, 0x33 }, {   0, 3, 0x34 }, {   0, 3, 0x35 }, 
+		{   0, 3, 0x36 }, {   0, 3, 0x37 }, {   0, 3, 0x38 }, {   0, 3, 0x39 }, 
+	},
+	{ /* state 68 */
+		{  85, 2, 0x73 }, {  67, 2, 0x73 }, {  93, 2, 0x73 }, {   2, 3, 0x73 }, 
+		{  85, 2, 0x74 }, {  67, 2, 0x74 }, {  93, 2, 0x74 }, {   2, 3, 0x74 }, 
+		{  66, 2, 0x20 }, {   1, 3, 0x20 }, {  66, 2, 0x25 }, {   1, 3, 0x25 }, 
+		{  66, 2, 0x2d }, {   1, 3, 0x2d }, {  66, 2, 0x2e }, {   1, 3, 0x2e }, 
+	},
+	{ /* state 69 */
+		{  85, 2, 0x20 }, {  67, 2, 0x20 }, {  93, 2, 0x20 }, {   2, 3, 0x20 }, 
+		{  85, 2, 0x25 }, {  67, 2, 0x25 }, {  93, 2, 0x25 }, {   2, 3, 0x25 }, 
+		{  85, 2, 0x2d }, {  67, 2, 0x2d }, {  93, 2, 0x2d }, {   2, 3, 0x2d }, 
+		{  85, 2, 0x2e }, {  67, 2, 0x2e }, {  93, 2, 0x2e }, {   2, 3, 0x2e }, 
+	},
+	{ /* state 70 */
+		{  86, 2, 0x20 }, { 130, 2, 0x20 }, {  68, 2, 0x20 }, {  82, 2, 0x20 }, 
+		{  99, 2, 0x20 }, {  94, 2, 0x20 }, { 104, 2, 0x20 }, {   3, 3, 0x20 }, 
+		{  86, 2, 0x25 }, { 130, 2, 0x25 }, {  68, 2, 0x25 }, {  82, 2, 0x25 }, 
+		{  99, 2, 0x25 }, {  94, 2, 0x25 }, { 104, 2, 0x25 }, {   3, 3, 0x25 }, 
+	},
+	{ /* state 71 */
+		{  85, 2, 0x21 }, {  67, 2, 0x21 }, {  93, 2, 0x21 }, {   2, 3, 0x21 }, 
+		{  85, 2, 0x22 }, {  67, 2, 0x22 }, {  93, 2, 0x22 }, {   2, 3, 0x22 }, 
+		{  85, 2, 0x28 }, {  67, 2, 0x28 }, {  93, 2, 0x28 }, {   2, 3, 0x28 }, 
+		{  85, 2, 0x29 }, {  67, 2, 0x29 }, {  93, 2, 0x29 }, {   2, 3, 0x29 }, 
+	},
+	{ /* state 72 */
+		{  86, 2, 0x21 }, { 130, 2, 0x21 }, {  68, 2, 0x21 }, {  82, 2, 0x21 }, 
+		{  99, 2, 0x21 }, {  94, 2, 0x21 }, { 104, 2, 0x21 }, {   3, 3, 0x21 }, 
+		{  86, 2, 0x22 }, { 130, 2, 0x22 }, {  68, 2, 0x22 }, {  82, 2, 0x22 }, 
+		{  99, 2, 0x22 }, {  94, 2, 0x22 }, { 104, 2, 0x22 }, {   3, 3, 0x22 }, 
+	},
+	{ /* state 73 */
+		{  86, 2, 0x7c }, { 130, 2, 0x7c }, {  68, 2, 0x7c }, {  82, 2, 0x7c }, 
+		{  99, 2, 0x7c }, {  94, 2, 0x7c }, { 104, 2, 0x7c }, {   3, 3, 0x7c }, 
+		{  85, 2, 0x23 }, {  67, 2, 0x23 }, {  93, 2, 0x23 }, {   2, 3, 0x23 }, 
+		{  85, 2, 0x3e }, {  67, 2, 0x3e }, {  93, 2, 0x3e }, {   2, 3, 0x3e }, 
+	},
+	{ /* state 74 */
+		{  86, 2, 0x23 }, { 130, 2, 0x23 }, {  68, 2, 0x23 }, {  82, 2, 0x23 }, 
+		{  99, 2, 0x23 }, {  94, 2, 0x23 }, { 104, 2, 0x23 }, {   3, 3, 0x23 }, 
+		{  86, 2, 0x3e }, { 130, 2, 0x3e }, {  68, 2, 0x3e }, {  82, 2, 0x3e }, 
+		{  99, 2, 0x3e }, {  94, 2, 0x3e }, { 104, 2, 0x3e }, {   3, 3, 0x3e }, 
+	},
+	{ /* state 75 */
+		{  85, 2, 0x26 }, {  67, 2, 0x26 }, {  93, 2, 0x26 }, {   2, 3, 0x26 }, 
+		{  85, 2, 0x2a }, {  67, 2, 0x2a }, {  93, 2, 0x2a }, {   2, 3, 0x2a }, 
+		{  85, 2, 0x2c }, {  67, 2, 0x2c }, {  93, 2, 0x2c }, {   2, 3, 0x2c }, 
+		{  85, 2, 0x3b }, {  67, 2, 0x3b }, {  93, 2, 0x3b }, {   2, 3, 0x3b }, 
+	},
+	{ /* state 76 */
+		{  86, 2, 0x26 }, { 130, 2, 0x26 }, {  68, 2, 0x26 }, {  82, 2, 0x26 }, 
+		{  99, 2, 0x26 }, {  94, 2, 0x26 }, { 104, 2, 0x26 }, {   3, 3, 0x26 }, 
+		{  86, 2, 0x2a }, { 130, 2, 0x2a }, {  68, 2, 0x2a }, {  82, 2, 0x2a }, 
+		{  99, 2, 0x2a }, {  94, 2, 0x2a }, { 104, 2, 0x2a }, {   3, 3, 0x2a }, 
+	},
+	{ /* state 77 */
+		{  86, 2, 0x3f }, { 130, 2, 0x3f }, {  68, 2, 0x3f }, {  82, 2, 0x3f }, 
+		{  99, 2, 0x3f }, {  94, 2, 0x3f }, { 104, 2, 0x3f }, {   3, 3, 0x3f }, 
+		{  85, 2, 0x27 }, {  67, 2, 0x27 }, {  93, 2, 0x27 }, {   2, 3, 0x27 }, 
+		{  85, 2, 0x2b }, {  67, 2, 0x2b }, {  93, 2, 0x2b }, {   2, 3, 0x2b }, 
+	},
+	{ /* state 78 */
+		{  86, 2, 0x27 }, { 130, 2, 0x27 }, {  68, 2, 0x27 }, {  82, 2, 0x27 }, 
+		{  99, 2, 0x27 }, {  94, 2, 0x27 }, { 104, 2, 0x27 }, {   3, 3, 0x27 }, 
+		{  86, 2, 0x2b }, { 130, 2, 0x2b }, {  68, 2, 0x2b }, {  82, 2, 0x2b }, 
+		{  99, 2, 0x2b }, {  94, 2, 0x2b }, { 104, 2, 0x2b }, {   3, 3, 0x2b }, 
+	},
+	{ /* state 79 */
+		{  86, 2, 0x28 }, { 130, 2, 0x28 }, {  68, 2, 0x28 }, {  82, 2, 0x28 }, 
+		{  99, 2, 0x28 }, {  94, 2, 0x28 }, { 104, 2, 0x28 }, {   3, 3, 0x28 }, 
+		{  86, 2, 0x29 }, { 130, 2, 0x29 }, {  68, 2, 0x29 }, {  82, 2, 0x29 }, 
+		{  99, 2, 0x29 }, {  94, 2, 0x29 }, { 104, 2, 0x29 }, {   3, 3, 0x29 }, 
+	},
+	{ /* state 80 */
+		{  86, 2, 0x2c }, { 130, 2, 0x2c }, {  68, 2, 0x2c }, {  82, 2, 0x2c }, 
+		{  99, 2, 0x2c }, {  94, 2, 0x2c }, { 104, 2, 0x2c }, {   3, 3, 0x2c }, 
+		{  86, 2, 0x3b }, { 130, 2, 0x3b }, {  68, 2, 0x3b }, {  82, 2, 0x3b }, 
+		{  99, 2, 0x3b }, {  94, 2, 0x3b }, { 104, 2, 0x3b }, {   3, 3, 0x3b }, 
+	},
+	{ /* state 81 */
+		{  86, 2, 0x2d }, { 130, 2, 0x2d }, {  68, 2, 0x2d }, {  82, 2, 0x2d }, 
+		{  99, 2, 0x2d }, {  94, 2, 0x2d }, { 104, 2, 0x2d }, {   3, 3, 0x2d }, 
+		{  86, 2, 0x2e }, { 130, 2, 0x2e }, {  68, 2, 0x2e }, {  82, 2, 0x2e }, 
+		{  99, 2, 0x2e }, {  94, 2, 0x2e }, { 104, 2, 0x2e }, {   3, 3, 0x2e }, 
+	},
+	{ /* state 82 */
+		{  66, 2, 0x2f }, {   1, 3, 0x2f }, {  66, 2, 0x33 }, {   1, 3, 0x33 }, 
+		{  66, 2, 0x34 }, {   1, 3, 0x34 }, {  66, 2, 0x35 }, {   1, 3, 0x35 }, 
+		{  66, 2, 0x36 }, {   1, 3, 0x36 }, {  66, 2, 0x37 }, {   1, 3, 0x37 }, 
+		{  66, 2, 0x38 }, {   1, 3, 0x38 }, {  66, 2, 0x39 }, {   1, 3, 0x39 }, 
+	},
+	{ /* state 83 */
+		{  85, 2, 0x2f }, {  67, 2, 0x2f }, {  93, 2, 0x2f }, {   2, 3, 0x2f }, 
+		{  85, 2, 0x33 }, {  67, 2, 0x33 }, {  93, 2, 0x33 }, {   2, 3, 0x33 }, 
+		{  85, 2, 0x34 }, {  67, 2, 0x34 }, {  93, 2, 0x34 }, {   2, 3, 0x34 }, 
+		{  85, 2, 0x35 }, {  67, 2, 0x35 }, {  93, 2, 0x35 }, {   2, 3, 0x35 }, 
+	},
+	{ /* state 84 */
+		{  86, 2, 0x2f }, { 130, 2, 0x2f }, {  68, 2, 0x2f }, {  82, 2, 0x2f }, 
+		{  99, 2, 0x2f }, {  94, 2, 0x2f }, { 104, 2, 0x2f }, {   3, 3, 0x2f }, 
+		{  86, 2, 0x33 }, { 130, 2, 0x33 }, {  68, 2, 0x33 }, {  82, 2, 0x33 }, 
+		{  99, 2, 0x33 }, {  94, 2, 0x33 }, { 104, 2, 0x33 }, {   3, 3, 0x33 }, 
+	},
+	{ /* state 85 */
+		{  66, 2, 0x30 }, {   1, 3, 0x30 }, {  66, 2, 0x31 }, {   1, 3, 0x31 }, 
+		{  66, 2, 0x32 }, {   1, 3, 0x32 }, {  66, 2, 0x61 }, {   1, 3, 0x61 }, 
+		{  66, 2, 0x63 }, {   1, 3, 0x63 }, {  66, 2, 0x65 }, {   1, 3, 0x65 }, 
+		{  66, 2, 0x69 }, {   1, 3, 0x69 }, {  66, 2, 0x6f }, {   1, 3, 0x6f }, 
+	},
+	{ /* state 86 */
+		{  85, 2, 0x30 }, {  67, 2, 0x30 }, {  93, 2, 0x30 }, {   2, 3, 0x30 }, 
+		{  85, 2, 0x31 }, {  67, 2, 0x31 }, {  93, 2, 0x31 }, {   2, 3, 0x31 }, 
+		{  85, 2, 0x32 }, {  67, 2, 0x32 }, {  93, 2, 0x32 }, {   2, 3, 0x32 }, 
+		{  85, 2, 0x61 }, {  67, 2, 0x61 }, {  93, 2, 0x61 }, {   2, 3, 0x61 }, 
+	},
+	{ /* state 87 */
+		{  86, 2, 0x30 }, { 130, 2, 0x30 }, {  68, 2, 0x30 }, {  82, 2, 0x30 }, 
+		{  99, 2, 0x30 }, {  94, 2, 0x30 }, { 104, 2, 0x30 }, {   3, 3, 0x30 }, 
+		{  86, 2, 0x31 }, { 130, 2, 0x31 }, {  68, 2, 0x31 }, {  82, 2, 0x31 }, 
+		{  99, 2, 0x31 }, {  94, 2, 0x31 }, { 104, 2, 0x31 }, {   3, 3, 0x31 }, 
+	},
+	{ /* state 88 */
+		{  86, 2, 0x32 }, { 130, 2, 0x32 }, {  68, 2, 0x32 }, {  82, 2, 0x32 }, 
+		{  99, 2, 0x32 }, {  94, 2, 0x32 }, { 104, 2, 0x32 }, {   3, 3, 0x32 }, 
+		{  86, 2, 0x61 }, { 130, 2, 0x61 }, {  68, 2, 0x61 }, {  82, 2, 0x61 }, 
+		{  99, 2, 0x61 }, {  94, 2, 0x61 }, { 104, 2, 0x61 }, {   3, 3, 0x61 }, 
+	},
+	{ /* state 89 */
+		{  86, 2, 0x34 }, { 130, 2, 0x34 }, {  68, 2, 0x34 }, {  82, 2, 0x34 }, 
+		{  99, 2, 0x34 }, {  94, 2, 0x34 }, { 104, 2, 0x34 }, {   3, 3, 0x34 }, 
+		{  86, 2, 0x35 }, { 130, 2, 0x35 }, {  68, 2, 0x35 }, {  82, 2, 0x35 }, 
+		{  99, 2, 0x35 }, {  94, 2, 0x35 }, { 104, 2, 0x35 }, {   3, 3, 0x35 }, 
+	},
+	{ /* state 90 */
+		{  85, 2, 0x36 }, {  67, 2, 0x36 }, {  93, 2, 0x36 }, {   2, 3, 0x36 }, 
+		{  85, 2, 0x37 }, {  67, 2, 0x37 }, {  93, 2, 0x37 }, {   2, 3, 0x37 }, 
+		{  85, 2, 0x38 }, {  67, 2, 0x38 }, {  93, 2, 0x38 }, {   2, 3, 0x38 }, 
+		{  85, 2, 0x39 }, {  67, 2, 0x39 }, {  93, 2, 0x39 }, {   2, 3, 0x39 }, 
+	},
+	{ /* state 91 */
+		{  86, 2, 0x36 }, { 130, 2, 0x36 }, {  68, 2, 0x36 }, {  82, 2, 0x36 }, 
+		{  99, 2, 0x36 }, {  94, 2, 0x36 }, { 104, 2, 0x36 }, {   3, 3, 0x36 }, 
+		{  86, 2, 0x37 }, { 130, 2, 0x37 }, {  68, 2, 0x37 }, {  82, 2, 0x37 }, 
+		{  99, 2, 0x37 }, {  94, 2, 0x37 }, { 104, 2, 0x37 }, {   3, 3, 0x37 }, 
+	},
+	{ /* state 92 */
+		{  86, 2, 0x38 }, { 130, 2, 0x38 }, {  68, 2, 0x38 }, {  82, 2, 0x38 }, 
+		{  99, 2, 0x38 }, {  94, 2, 0x38 }, { 104, 2, 0x38 }, {   3, 3, 0x38 }, 
+		{  86, 2, 0x39 }, { 130, 2, 0x39 }, {  68, 2, 0x39 }, {  82, 2, 0x39 }, 
+		{  99, 2, 0x39 }, {  94, 2, 0x39 }, { 104, 2, 0x39 }, {   3, 3, 0x39 }, 
+	},
+	{ /* state 93 */
+		{   0, 3, 0x3d }, {   0, 3, 0x41 }, {   0, 3, 0x5f }, {   0, 3, 0x62 }, 
+		{   0, 3, 0x64 }, {   0, 3, 0x66 }, {   0, 3, 0x67 }, {   0, 3, 0x68 }, 
+		{   0, 3, 0x6c }, {   0, 3, 0x6d }, {   0, 3, 0x6e }, {   0, 3, 0x70 }, 
+		{   0, 3, 0x72 }, {   0, 3, 0x75 }, {  97, 0, 0x00 }, { 103, 0, 0x00 }, 
+	},
+	{ /* state 94 */
+		{  66, 2, 0x6c }, {   1, 3, 0x6c }, {  66, 2, 0x6d }, {   1, 3, 0x6d }, 
+		{  66, 2, 0x6e }, {   1, 3, 0x6e }, {  66, 2, 0x70 }, {   1, 3, 0x70 }, 
+		{  66, 2, 0x72 }, {   1, 3, 0x72 }, {  66, 2, 0x75 }, {   1, 3, 0x75 }, 
+		{   0, 3, 0x3a }, {   0, 3, 0x42 }, {   0, 3, 0x43 }, {   0, 3, 0x44 }, 
+	},
+	{ /* state 95 */
+		{  85, 2, 0x72 }, {  67, 2, 0x72 }, {  93, 2, 0x72 }, {   2, 3, 0x72 }, 
+		{  85, 2, 0x75 }, {  67, 2, 0x75 }, {  93, 2, 0x75 }, {   2, 3, 0x75 }, 
+		{  66, 2, 0x3a }, {   1, 3, 0x3a }, {  66, 2, 0x42 }, {   1, 3, 0x42 }, 
+		{  66, 2, 0x43 }, {   1, 3, 0x43 }, {  66, 2, 0x44 }, {   1, 3, 0x44 }, 
+	},
+	{ /* state 96 */
+		{  85, 2, 0x3a }, {  67, 2, 0x3a }, {  93, 2, 0x3a }, {   2, 3, 0x3a }, 
+		{  85, 2, 0x42 }, {  67, 2, 0x42 }, {  93, 2, 0x42 }, {   2, 3, 0x42 }, 
+		{  85, 2, 0x43 }, {  67, 2, 0x43 }, {  93, 2, 0x43 }, {   2, 3, 0x43 }, 
+		{  85, 2, 0x44 }, {  67, 2, 0x44 }, {  93, 2, 0x44 }, {   2, 3, 0x44 }, 
+	},
+	{ /* state 97 */
+		{  86, 2, 0x3a }, { 130, 2, 0x3a }, {  68, 2, 0x3a }, {  82, 2, 0x3a }, 
+		{  99, 2, 0x3a }, {  94, 2, 0x3a }, { 104, 2, 0x3a }, {   3, 3, 0x3a }, 
+		{  86, 2, 0x42 }, { 130, 2, 0x42 }, {  68, 2, 0x42 }, {  82, 2, 0x42 }, 
+		{  99, 2, 0x42 }, {  94, 2, 0x42 }, { 104, 2, 0x42 }, {   3, 3, 0x42 }, 
+	},
+	{ /* state 98 */
+		{  86, 2, 0x3c }, { 130, 2, 0x3c }, {  68, 2, 0x3c }, {  82, 2, 0x3c }, 
+		{  99, 2, 0x3c }, {  94, 2, 0x3c }, { 104, 2, 0x3c }, {   3, 3, 0x3c }, 
+		{  86, 2, 0x60 }, { 130, 2, 0x60 }, {  68, 2, 0x60 }, {  82, 2, 0x60 }, 
+		{  99, 2, 0x60 }, {  94, 2, 0x60 }, { 104, 2, 0x60 }, {   3, 3, 0x60 }, 
+	},
+	{ /* state 99 */
+		{  66, 2, 0x3d }, {   1, 3, 0x3d }, {  66, 2, 0x41 }, {   1, 3, 0x41 }, 
+		{  66, 2, 0x5f }, {   1, 3, 0x5f }, {  66, 2, 0x62 }, {   1, 3, 0x62 }, 
+		{  66, 2, 0x64 }, {   1, 3, 0x64 }, {  66, 2, 0x66 }, {   1, 3, 0x66 }, 
+		{  66, 2, 0x67 }, {   1, 3, 0x67 }, {  66, 2, 0x68 }, {   1, 3, 0x68 }, 
+	},
+	{ /* state 100 */
+		{  85, 2, 0x3d }, {  67, 2, 0x3d }, {  93, 2, 0x3d }, {   2, 3, 0x3d }, 
+		{  85, 2, 0x41 }, {  67, 2, 0x41 }, {  93, 2, 0x41 }, {   2, 3, 0x41 }, 
+		{  85, 2, 0x5f }, {  67, 2, 0x5f }, {  93, 2, 0x5f }, {   2, 3, 0x5f }, 
+		{  85, 2, 0x62 }, {  67, 2, 0x62 }, {  93, 2, 0x62 }, {   2, 3, 0x62 }, 
+	},
+	{ /* state 101 */
+		{  86, 2, 0x3d }, { 130, 2, 0x3d }, {  68, 2, 0x3d }, {  82, 2, 0x3d }, 
+		{  99, 2, 0x3d }, {  94, 2, 0x3d }, { 104, 2, 0x3d }, {   3, 3, 0x3d }, 
+		{  86, 2, 0x41 }, { 130, 2, 0x41 }, {  68, 2, 0x41 }, {  82, 2, 0x41 }, 
+		{  99, 2, 0x41 }, {  94, 2, 0x41 }, { 104, 2, 0x41 }, {   3, 3, 0x41 }, 
+	},
+	{ /* state 102 */
+		{  86, 2, 0x40 }, { 130, 2, 0x40 }, {  68, 2, 0x40 }, {  82, 2, 0x40 }, 
+		{  99, 2, 0x40 }, {  94, 2, 0x40 }, { 104, 2, 0x40 }, {   3, 3, 0x40 }, 
+		{  86, 2, 0x5b }, { 130, 2, 0x5b }, {  68, 2, 0x5b }, {  82, 2, 0x5b }, 
+		{  99, 2, 0x5b }, {  94, 2, 0x5b }, { 104, 2, 0x5b }, {   3, 3, 0x5b }, 
+	},
+	{ /* state 103 */
+		{  86, 2, 0x43 }, { 130, 2, 0x43 }, {  68, 2, 0x43 }, {  82, 2, 0x43 }, 
+		{  99, 2, 0x43 }, {  94, 2, 0x43 }, { 104, 2, 0x43 }, {   3, 3, 0x43 }, 
+		{  86, 2, 0x44 }, { 130, 2, 0x44 }, {  68, 2, 0x44 }, {  82, 2, 0x44 }, 
+		{  99, 2, 0x44 }, {  94, 2, 0x44 }, { 104, 2, 0x44 }, {   3, 3, 0x44 }, 
+	},
+	{ /* state 104 */
+		{   0, 3, 0x45 }, {   0, 3, 0x46 }, {   0, 3, 0x47 }, {   0, 3, 0x48 }, 
+		{   0, 3, 0x49 }, {   0, 3, 0x4a }, {   0, 3, 0x4b }, {   0, 3, 0x4c }, 
+		{   0, 3, 0x4d }, {   0, 3, 0x4e }, {   0, 3, 0x4f }, {   0, 3, 0x50 }, 
+		{   0, 3, 0x51 }, {   0, 3, 0x52 }, {   0, 3, 0x53 }, {   0, 3, 0x54 }, 
+	},
+	{ /* state 105 */
+		{  66, 2, 0x45 }, {   1, 3, 0x45 }, {  66, 2, 0x46 }, {   1, 3, 0x46 }, 
+		{  66, 2, 0x47 }, {   1, 3, 0x47 }, {  66, 2, 0x48 }, {   1, 3, 0x48 }, 
+		{  66, 2, 0x49 }, {   1, 3, 0x49 }, {  66, 2, 0x4a }, {   1, 3, 0x4a }, 
+		{  66, 2, 0x4b }, {   1, 3, 0x4b }, {  66, 2, 0x4c }, {   1, 3, 0x4c }, 
+	},
+	{ /* state 106 */
+		{  85, 2, 0x45 }, {  67, 2, 0x45 }, {  93, 2, 0x45 }, {   2, 3, 0x45 }, 
+		{  85, 2, 0x46 }, {  67, 2, 0x46 }, {  93, 2, 0x46 }, {   2, 3, 0x46 }, 
+		{  85, 2, 0x47 }, {  67, 2, 0x47 }, {  93, 2, 0x47 }, {   2, 3, 0x47 }, 
+		{  85, 2, 0x48 }, {  67, 2, 0x48 }, {  93, 2, 0x48 }, {   2, 3, 0x48 }, 
+	},
+	{ /* state 107 */
+		{  86, 2, 0x45 }, { 130, 2, 0x45 }, {  68, 2, 0x45 }, {  82, 2, 0x45 }, 
+		{  99, 2, 0x45 }, {  94, 2, 0x45 }, { 104, 2, 0x45 }, {   3, 3, 0x45 }, 
+		{  86, 2, 0x46 }, { 130, 2, 0x46 }, {  68, 2, 0x46 }, {  82, 2, 0x46 }, 
+		{  99, 2, 0x46 }, {  94, 2, 0x46 }, { 104, 2, 0x46 }, {   3, 3, 0x46 }, 
+	},
+	{ /* state 108 */
+		{  86, 2, 0x47 }, { 130, 2, 0x47 }, {  68, 2, 0x47 }, {  82, 2, 0x47 }, 
+		{  99, 2, 0x47 }, {  94, 2, 0x47 }, { 104, 2, 0x47 }, {   3, 3, 0x47 }, 
+		{  86, 2, 0x48 }, { 130, 2, 0x48 }, {  68, 2, 0x48 }, {  82, 2, 0x48 }, 
+		{  99, 2, 0x48 }, {  94, 2, 0x48 }, { 104, 2, 0x48 }, {   3, 3, 0x48 }, 
+	},
+	{ /* state 109 */
+		{  85, 2, 0x49 }, {  67, 2, 0x49 }, {  93, 2, 0x49 }, {   2, 3, 0x49 }, 
+		{  85, 2, 0x4a }, {  67, 2, 0x4a }, {  93, 2, 0x4a }, {   2, 3, 0x4a }, 
+		{  85, 2, 0x4b }, {  67, 2, 0x4b }, {  93, 2, 0x4b }, {   2, 3, 0x4b }, 
+		{  85, 2, 0x4c }, {  67, 2, 0x4c }, {  93, 2, 0x4c }, {   2, 3, 0x4c }, 
+	},
+	{ /* state 110 */
+		{  86, 2, 0x49 }, { 130, 2, 0x49 }, {  68, 2, 0x49 }, {  82, 2, 0x49 }, 
+		{  99, 2, 0x49 }, {  94, 2, 0x49 }, { 104, 2, 0x49 }, {   3, 3, 0x49 }, 
+		{  86, 2, 0x4a }, { 130, 2, 0x4a }, {  68, 2, 0x4a }, {  82, 2, 0x4a }, 
+		{  99, 2, 0x4a }, {  94, 2, 0x4a }, { 104, 2, 0x4a }, {   3, 3, 0x4a }, 
+	},
+	{ /* state 111 */
+		{  86, 2, 0x4b }, { 130, 2, 0x4b }, {  68, 2, 0x4b }, {  82, 2, 0x4b }, 
+		{  99, 2, 0x4b }, {  94, 2, 0x4b }, { 104, 2, 0x4b }, {   3, 3, 0x4b }, 
+		{  86, 2, 0x4c }, { 130, 2, 0x4c }, {  68, 2, 0x4c }, {  82, 2, 0x4c }, 
+		{  99, 2, 0x4c }, {  94, 2, 0x4c }, { 104, 2, 0x4c }, {   3, 3, 0x4c }, 
+	},
+	{ /* state 112 */
+		{  66, 2, 0x4d }, {   1, 3, 0x4d }, {  66, 2, 0x4e }, {   1, 3, 0x4e }, 
+		{  66, 2, 0x4f }, {   1, 3, 0x4f }, {  66, 2, 0x50 }, {   1, 3, 0x50 }, 
+		{  66, 2, 0x51 }, {   1, 3, 0x51 }, {  66, 2, 0x52 }, {   1, 3, 0x52 }, 
+		{  66, 2, 0x53 }, {   1, 3, 0x53 }, {  66, 2, 0x54 }, {   1, 3, 0x54 }, 
+	},
+	{ /* state 113 */
+		{  85, 2, 0x4d }, {  67, 2, 0x4d }, {  93, 2, 0x4d }, {   2, 3, 0x4d }, 
+		{  85, 2, 0x4e }, {  67, 2, 0x4e }, {  93, 2, 0x4e }, {   2, 3, 0x4e }, 
+		{  85, 2, 0x4f }, {  67, 2, 0x4f }, {  93, 2, 0x4f }, {   2, 3, 0x4f }, 
+		{  85, 2, 0x50 }, {  67, 2, 0x50 }, {  93, 2, 0x50 }, {   2, 3, 0x50 }, 
+	},
+	{ /* state 114 */
+		{  86, 2, 0x4d }, { 130, 2, 0x4d }, {  68, 2, 0x4d }, {  82, 2, 0x4d }, 
+		{  99, 2, 0x4d }, {  94, 2, 0x4d }, { 104, 2, 0x4d }, {   3, 3, 0x4d }, 
+		{  86, 2, 0x4e }, { 130, 2, 0x4e }, {  68, 2, 0x4e }, {  82, 2, 0x4e }, 
+		{  99, 2, 0x4e }, {  94, 2, 0x4e }, { 104, 2, 0x4e }, {   3, 3, 0x4e }, 
+	},
+	{ /* state 115 */
+		{  86, 2, 0x4f }, { 130, 2, 0x4f }, {  68, 2, 0x4f }, {  82, 2, 0x4f }, 
+		{  99, 2, 0x4f }, {  94, 2, 0x4f }, { 104, 2, 0x4f }, {   3, 3, 0x4f }, 
+		{  86, 2, 0x50 }, { 130, 2, 0x50 }, {  68, 2, 0x50 }, {  82, 2, 0x50 }, 
+		{  99, 2, 0x50 }, {  94, 2, 0x50 }, { 104, 2, 0x50 }, {   3, 3, 0x50 }, 
+	},
+	{ /* state 116 */
+		{  85, 2, 0x51 }, {  67, 2, 0x51 }, {  93, 2, 0x51 }, {   2, 3, 0x51 }, 
+		{  85, 2, 0x52 }, {  67, 2, 0x52 }, {  93, 2, 0x52 }, {   2, 3, 0x52 }, 
+		{  85, 2, 0x53 }, {  67, 2, 0x53 }, {  93, 2, 0x53 }, {   2, 3, 0x53 }, 
+		{  85, 2, 0x54 }, {  67, 2, 0x54 }, {  93, 2, 0x54 }, {   2, 3, 0x54 }, 
+	},
+	{ /* state 117 */
+		{  86, 2, 0x51 }, { 130, 2, 0x51 }, {  68, 2, 0x51 }, {  82, 2, 0x51 }, 
+		{  99, 2, 0x51 }, {  94, 2, 0x51 }, { 104, 2, 0x51 }, {   3, 3, 0x51 }, 
+		{  86, 2, 0x52 }, { 130, 2, 0x52 }, {  68, 2, 0x52 }, {  82, 2, 0x52 }, 
+		{  99, 2, 0x52 }, {  94, 2, 0x52 }, { 104, 2, 0x52 }, {   3, 3, 0x52 }, 
+	},
+	{ /* state 118 */
+		{  86, 2, 0x53 }, { 130, 2, 0x53 }, {  68, 2, 0x53 }, {  82, 2, 0x53 }, 
+		{  99, 2, 0x53 }, {  94, 2, 0x53 }, { 104, 2, 0x53 }, {   3, 3, 0x53 }, 
+		{  86, 2, 0x54 }, { 130, 2, 0x54 }, {  68, 2, 0x54 }, {  82, 2, 0x54 }, 
+		{  99, 2, 0x54 }, {  94, 2, 0x54 }, { 104, 2, 0x54 }, {   3, 3, 0x54 }, 
+	},
+	{ /* state 119 */
+		{  66, 2, 0x55 }, {   1, 3, 0x55 }, {  66, 2, 0x56 }, {   1, 3, 0x56 }, 
+		{  66, 2, 0x57 }, {   1, 3, 0x57 }, {  66, 2, 0x59 }, {   1, 3, 0x59 }, 
+		{  66, 2, 0x6a }, {   1, 3, 0x6a }, {  66, 2, 0x6b }, {   1, 3, 0x6b }, 
+		{  66, 2, 0x71 }, {   1, 3, 0x71 }, {  66, 2, 0x76 }, {   1, 3, 0x76 }, 
+	},
+	{ /* state 120 */
+		{  85, 2, 0x55 }, {  67, 2, 0x55 }, {  93, 2, 0x55 }, {   2, 3, 0x55 }, 
+		{  85, 2, 0x56 }, {  67, 2, 0x56 }, {  93, 2, 0x56 }, {   2, 3, 0x56 }, 
+		{  85, 2, 0x57 }, {  67, 2, 0x57 }, {  93, 2, 0x57 }, {   2, 3, 0x57 }, 
+		{  85, 2, 0x59 }, {  67, 2, 0x59 }, {  93, 2, 0x59 }, {   2, 3, 0x59 }, 
+	},
+	{ /* state 121 */
+		{  86, 2, 0x55 }, { 130, 2, 0x55 }, {  68, 2, 0x55 }, {  82, 2, 0x55 }, 
+		{  99, 2, 0x55 }, {  94, 2, 0x55 }, { 104, 2, 0x55 }, {   3, 3, 0x55 }, 
+		{  86, 2, 0x56 }, { 130, 2, 0x56 }, {  68, 2, 0x56 }, {  82, 2, 0x56 }, 
+		{  99, 2, 0x56 }, {  94, 2, 0x56 }, { 104, 2, 0x56 }, {   3, 3, 0x56 }, 
+	},
+	{ /* state 122 */
+		{  86, 2, 0x57 }, { 130, 2, 0x57 }, {  68, 2, 0x57 }, {  82, 2, 0x57 }, 
+		{  99, 2, 0x57 }, {  94, 2, 0x57 }, { 104, 2, 0x57 }, {   3, 3, 0x57 }, 
+		{  86, 2, 0x59 }, { 130, 2, 0x59 }, {  68, 2, 0x59 }, {  82, 2, 0x59 }, 
+		{  99, 2, 0x59 }, {  94, 2, 0x59 }, { 104, 2, 0x59 }, {   3, 3, 0x59 }, 
+	},
+	{ /* state 123 */
+		{  86, 2, 0x58 }, { 130, 2, 0x58 }, {  68, 2, 0x58 }, {  82, 2, 0x58 }, 
+		{  99, 2, 0x58 }, {  94, 2, 0x58 }, { 104, 2, 0x58 }, {   3, 3, 0x58 }, 
+		{  86, 2, 0x5a }, { 130, 2, 0x5a }, {  68, 2, 0x5a }, {  82, 2, 0x5a }, 
+		{  99, 2, 0x5a }, {  94, 2, 0x5a }, { 104, 2, 0x5a }, {   3, 3, 0x5a }, 
+	},
+	{ /* state 124 */
+		{  66, 2, 0x5c }, {   1, 3, 0x5c }, {  66, 2, 0xc3 }, {   1, 3, 0xc3 }, 
+		{  66, 2, 0xd0 }, {   1, 3, 0xd0 }, {   0, 3, 0x80 }, {   0, 3, 0x82 }, 
+		{   0, 3, 0x83 }, {   0, 3, 0xa2 }, {   0, 3, 0xb8 }, {   0, 3, 0xc2 }, 
+		{   0, 3, 0xe0 }, {   0, 3, 0xe2 }, { 177, 0, 0x00 }, { 188, 0, 0x00 }, 
+	},
+	{ /* state 125 */
+		{  85, 2, 0x5c }, {  67, 2, 0x5c }, {  93, 2, 0x5c }, {   2, 3, 0x5c }, 
+		{  85, 2, 0xc3 }, {  67, 2, 0xc3 }, {  93, 2, 0xc3 }, {   2, 3, 0xc3 }, 
+		{  85, 2, 0xd0 }, {  67, 2, 0xd0 }, {  93, 2, 0xd0 }, {   2, 3, 0xd0 }, 
+		{  66, 2, 0x80 }, {   1, 3, 0x80 }, {  66, 2, 0x82 }, {   1, 3, 0x82 }, 
+	},
+	{ /* state 126 */
+		{  86, 2, 0x5c }, { 130, 2, 0x5c }, {  68, 2, 0x5c }, {  82, 2, 0x5c }, 
+		{  99, 2, 0x5c }, {  94, 2, 0x5c }, { 104, 2, 0x5c }, {   3, 3, 0x5c }, 
+		{  86, 2, 0xc3 }, { 130, 2, 0xc3 }, {  68, 2, 0xc3 }, {  82, 2, 0xc3 }, 
+		{  99, 2, 0xc3 }, {  94, 2, 0xc3 }, { 104, 2, 0xc3 }, {   3, 3, 0xc3 }, 
+	},
+	{ /* state 127 */
+		{  86, 2, 0x5d }, { 130, 2, 0x5d }, {  68, 2, 0x5d }, {  82, 2, 0x5d }, 
+		{  99, 2, 0x5d }, {  94, 2, 0x5d }, { 104, 2, 0x5d }, {   3, 3, 0x5d }, 
+		{  86, 2, 0x7e }, { 130, 2, 0x7e }, {  68, 2, 0x7e }, {  82, 2, 0x7e }, 
+		{  99, 2, 0x7e }, {  94, 2, 0x7e }, { 104, 2, 0x7e }, {   3, 3, 0x7e }, 
+	},
+	{ /* state 128 */
+		{  86, 2, 0x5e }, { 130, 2, 0x5e }, {  68, 2, 0x5e }, {  82, 2, 0x5e }, 
+		{  99, 2, 0x5e }, {  94, 2, 0x5e }, { 104, 2, 0x5e }, {   3, 3, 0x5e }, 
+		{  86, 2, 0x7d }, { 130, 2, 0x7d }, {  68, 2, 0x7d }, {  82, 2, 0x7d }, 
+		{  99, 2, 0x7d }, {  94, 2, 0x7d }, { 104, 2, 0x7d }, {   3, 3, 0x7d }, 
+	},
+	{ /* state 129 */
+		{  86, 2, 0x5f }, { 130, 2, 0x5f }, {  68, 2, 0x5f }, {  82, 2, 0x5f }, 
+		{  99, 2, 0x5f }, {  94, 2, 0x5f }, { 104, 2, 0x5f }, {   3, 3, 0x5f }, 
+		{  86, 2, 0x62 }, { 130, 2, 0x62 }, {  68, 2, 0x62 }, {  82, 2, 0x62 }, 
+		{  99, 2, 0x62 }, {  94, 2, 0x62 }, { 104, 2, 0x62 }, {   3, 3, 0x62 }, 
+	},
+	{ /* state 130 */
+		{  85, 2, 0x63 }, {  67, 2, 0x63 }, {  93, 2, 0x63 }, {   2, 3, 0x63 }, 
+		{  85, 2, 0x65 }, {  67, 2, 0x65 }, {  93, 2, 0x65 }, {   2, 3, 0x65 }, 
+		{  85, 2, 0x69 }, {  67, 2, 0x69 }, {  93, 2, 0x69 }, {   2, 3, 0x69 }, 
+		{  85, 2, 0x6f }, {  67, 2, 0x6f }, {  93, 2, 0x6f }, {   2, 3, 0x6f }, 
+	},
+	{ /* state 131 */
+		{  86, 2, 0x63 }, { 130, 2, 0x63 }, {  68, 2, 0x63 }, {  82, 2, 0x63 }, 
+		{  99, 2, 0x63 }, {  94, 2, 0x63 }, { 104, 2, 0x63 }, {   3, 3, 0x63 }, 
+		{  86, 2, 0x65 }, { 130, 2, 0x65 }, {  68, 2, 0x65 }, {  82, 2, 0x65 }, 
+		{  99, 2, 0x65 }, {  94, 2, 0x65 }, { 104, 2, 0x65 }, {   3, 3, 0x65 }, 
+	},
+	{ /* state 132 */
+		{  85, 2, 0x64 }, {  67, 2, 0x64 }, {  93, 2, 0x64 }, {   2, 3, 0x64 }, 
+		{  85, 2, 0x66 }, {  67, 2, 0x66 }, {  93, 2, 0x66 }, {   2, 3, 0x66 }, 
+		{  85, 2, 0x67 }, {  67, 2, 0x67 }, {  93, 2, 0x67 }, {   2, 3, 0x67 }, 
+		{  85, 2, 0x68 }, {  67, 2, 0x68 }, {  93, 2, 0x68 }, {   2, 3, 0x68 }, 
+	},
+	{ /* state 133 */
+		{  86, 2, 0x64 }, { 130, 2, 0x64 }, {  68, 2, 0x64 }, {  82, 2, 0x64 }, 
+		{  99, 2, 0x64 }, {  94, 2, 0x64 }, { 104, 2, 0x64 }, {   3, 3, 0x64 }, 
+		{  86, 2, 0x66 }, { 130, 2, 0x66 }, {  68, 2, 0x66 }, {  82, 2, 0x66 }, 
+		{  99, 2, 0x66 }, {  94, 2, 0x66 }, { 104, 2, 0x66 }, {   3, 3, 0x66 }, 
+	},
+	{ /* state 134 */
+		{  86, 2, 0x67 }, { 130, 2, 0x67 }, {  68, 2, 0x67 }, {  82, 2, 0x67 }, 
+		{  99, 2, 0x67 }, {  94, 2, 0x67 }, { 104, 2, 0x67 }, {   3, 3, 0x67 }, 
+		{  86, 2, 0x68 }, { 130, 2, 0x68 }, {  68, 2, 0x68 }, {  82, 2, 0x68 }, 
+		{  99, 2, 0x68 }, {  94, 2, 0x68 }, { 104, 2, 0x68 }, {   3, 3, 0x68 }, 
+	},
+	{ /* state 135 */
+		{  86, 2, 0x69 }, { 130, 2, 0x69 }, {  68, 2, 0x69 }, {  82, 2, 0x69 }, 
+		{  99, 2, 0x69 }, {  94, 2, 0x69 }, { 104, 2, 0x69 }, {   3, 3, 0x69 }, 
+		{  86, 2, 0x6f }, { 130, 2, 0x6f }, {  68, 2, 0x6f }, {  82, 2, 0x6f }, 
+		{  99, 2, 0x6f }, {  94, 2, 0x6f }, { 104, 2, 0x6f }, {   3, 3, 0x6f }, 
+	},
+	{ /* state 136 */
+		{  85, 2, 0x6a }, {  67, 2, 0x6a }, {  93, 2, 0x6a }, {   2, 3, 0x6a }, 
+		{  85, 2, 0x6b }, {  67, 2, 0x6b }, {  93, 2, 0x6b }, {   2, 3, 0x6b }, 
+		{  85, 2, 0x71 }, {  67, 2, 0x71 }, {  93, 2, 0x71 }, {   2, 3, 0x71 }, 
+		{  85, 2, 0x76 }, {  67, 2, 0x76 }, {  93, 2, 0x76 }, {   2, 3, 0x76 }, 
+	},
+	{ /* state 137 */
+		{  86, 2, 0x6a }, { 130, 2, 0x6a }, {  68, 2, 0x6a }, {  82, 2, 0x6a }, 
+		{  99, 2, 0x6a }, {  94, 2, 0x6a }, { 104, 2, 0x6a }, {   3, 3, 0x6a }, 
+		{  86, 2, 0x6b }, { 130, 2, 0x6b }, {  68, 2, 0x6b }, {  82, 2, 0x6b }, 
+		{  99, 2, 0x6b }, {  94, 2, 0x6b }, { 104, 2, 0x6b }, {   3, 3, 0x6b }, 
+	},
+	{ /* state 138 */
+		{  85, 2, 0x6c }, {  67, 2, 0x6c }, {  93, 2, 0x6c }, {   2, 3, 0x6c }, 
+		{  85, 2, 0x6d }, {  67, 2, 0x6d }, {  93, 2, 0x6d }, {   2, 3, 0x6d }, 
+		{  85, 2, 0x6e }, {  67, 2, 0x6e }, {  93, 2, 0x6e }, {   2, 3, 0x6e }, 
+		{  85, 2, 0x70 }, {  67, 2, 0x70 }, {  93, 2, 0x70 }, {   2, 3, 0x70 }, 
+	},
+	{ /* state 139 */
+		{  86, 2, 0x6c }, { 130, 2, 0x6c }, {  68, 2, 0x6c }, {  82, 2, 0x6c }, 
+		{  99, 2, 0x6c }, {  94, 2, 0x6c }, { 104, 2, 0x6c }, {   3, 3, 0x6c }, 
+		{  86, 2, 0x6d }, { 130, 2, 0x6d }, {  68, 2, 0x6d }, {  82, 2, 0x6d }, 
+		{  99, 2, 0x6d }, {  94, 2, 0x6d }, { 104, 2, 0x6d }, {   3, 3, 0x6d }, 
+	},
+	{ /* state 140 */
+		{  86, 2, 0x6e }, { 130, 2, 0x6e }, {  68, 2, 0x6e }, {  82, 2, 0x6e }, 
+		{  99, 2, 0x6e }, {  94, 2, 0x6e }, { 104, 2, 0x6e }, {   3, 3, 0x6e }, 
+		{  86, 2, 0x70 }, { 130, 2, 0x70 }, {  68, 2, 0x70 }, {  82, 2, 0x70 }, 
+		{  99, 2, 0x70 }, {  94, 2, 0x70 }, { 104, 2, 0x70 }, {   3, 3, 0x70 }, 
+	},
+	{ /* state 141 */
+		{  86, 2, 0x71 }, { 130, 2, 0x71 }, {  68, 2, 0x71 }, {  82, 2, 0x71 }, 
+		{  99, 2, 0x71 }, {  94, 2, 0x71 }, { 104, 2, 0x71 }, {   3, 3, 0x71 }, 
+		{  86, 2, 0x76 }, { 130, 2, 0x76 }, {  68, 2, 0x76 }, {  82, 2, 0x76 }, 
+		{  99, 2, 0x76 }, {  94, 2, 0x76 }, { 104, 2, 0x76 }, {   3, 3, 0x76 }, 
+	},
+	{ /* state 142 */
+		{  86, 2, 0x72 }, { 130, 2, 0x72 }, {  68, 2, 0x72 }, {  82, 2, 0x72 }, 
+		{  99, 2, 0x72 }, {  94, 2, 0x72 }, { 104, 2, 0x72 }, {   3, 3, 0x72 }, 
+		{  86, 2, 0x75 }, { 130, 2, 0x75 }, {  68, 2, 0x75 }, {  82, 2, 0x75 }, 
+		{  99, 2, 0x75 }, {  94, 2, 0x75 }, { 104, 2, 0x75 }, {   3, 3, 0x75 }, 
+	},
+	{ /* state 143 */
+		{  86, 2, 0x73 }, { 130, 2, 0x73 }, {  68, 2, 0x73 }, {  82, 2, 0x73 }, 
+		{  99, 2, 0x73 }, {  94, 2, 0x73 }, { 104, 2, 0x73 }, {   3, 3, 0x73 }, 
+		{  86, 2, 0x74 }, { 130, 2, 0x74 }, {  68, 2, 0x74 }, {  82, 2, 0x74 }, 
+		{  99, 2, 0x74 }, {  94, 2, 0x74 }, { 104, 2, 0x74 }, {   3, 3, 0x74 }, 
+	},
+	{ /* state 144 */
+		{  85, 2, 0x77 }, {  67, 2, 0x77 }, {  93, 2, 0x77 }, {   2, 3, 0x77 }, 
+		{  85, 2, 0x78 }, {  67, 2, 0x78 }, {  93, 2, 0x78 }, {   2, 3, 0x78 }, 
+		{  85, 2, 0x79 }, {  67, 2, 0x79 }, {  93, 2, 0x79 }, {   2, 3, 0x79 }, 
+		{  85, 2, 0x7a }, {  67, 2, 0x7a }, {  93, 2, 0x7a }, {   2, 3, 0x7a }, 
+	},
+	{ /* state 145 */
+		{  86, 2, 0x77 }, { 130, 2, 0x77 }, {  68, 2, 0x77 }, {  82, 2, 0x77 }, 
+		{  99, 2, 0x77 }, {  94, 2, 0x77 }, { 104, 2, 0x77 }, {   3, 3, 0x77 }, 
+		{  86, 2, 0x78 }, { 130, 2, 0x78 }, {  68, 2, 0x78 }, {  82, 2, 0x78 }, 
+		{  99, 2, 0x78 }, {  94, 2, 0x78 }, { 104, 2, 0x78 }, {   3, 3, 0x78 }, 
+	},
+	{ /* state 146 */
+		{  86, 2, 0x79 }, { 130, 2, 0x79 }, {  68, 2, 0x79 }, {  82, 2, 0x79 }, 
+		{  99, 2, 0x79 }, {  94, 2, 0x79 }, { 104, 2, 0x79 }, {   3, 3, 0x79 }, 
+		{  86, 2, 0x7a }, { 130, 2, 0x7a }, {  68, 2, 0x7a }, {  82, 2, 0x7a }, 
+		{  99, 2, 0x7a }, {  94, 2, 0x7a }, { 104, 2, 0x7a }, {   3, 3, 0x7a }, 
+	},
+	{ /* state 147 */
+		{  86, 2, 0x7f }, { 130, 2, 0x7f }, {  68, 2, 0x7f }, {  82, 2, 0x7f }, 
+		{  99, 2, 0x7f }, {  94, 2, 0x7f }, { 104, 2, 0x7f }, {   3, 3, 0x7f }, 
+		{  86, 2, 0xdc }, { 130, 2, 0xdc }, {  68, 2, 0xdc }, {  82, 2, 0xdc }, 
+		{  99, 2, 0xdc }, {  94, 2, 0xdc }, { 104, 2, 0xdc }, {   3, 3, 0xdc }, 
+	},
+	{ /* state 148 */
+		{  86, 2, 0xd0 }, { 130, 2, 0xd0 }, {  68, 2, 0xd0 }, {  82, 2, 0xd0 }, 
+		{  99, 2, 0xd0 }, {  94, 2, 0xd0 }, { 104, 2, 0xd0 }, {   3, 3, 0xd0 }, 
+		{  85, 2, 0x80 }, {  67, 2, 0x80 }, {  93, 2, 0x80 }, {   2, 3, 0x80 }, 
+		{  85, 2, 0x82 }, {  67, 2, 0x82 }, {  93, 2, 0x82 }, {   2, 3, 0x82 }, 
+	},
+	{ /* state 149 */
+		{  86, 2, 0x80 }, { 130, 2, 0x80 }, {  68, 2, 0x80 }, {  82, 2, 0x80 }, 
+		{  99, 2, 0x80 }, {  94, 2, 0x80 }, { 104, 2, 0x80 }, {   3, 3, 0x80 }, 
+		{  86, 2, 0x82 }, { 130, 2, 0x82 }, {  68, 2, 0x82 }, {  82, 2, 0x82 }, 
+		{  99, 2, 0x82 }, {  94, 2, 0x82 }, { 104, 2, 0x82 }, {   3, 3, 0x82 }, 
+	},
+	{ /* state 150 */
+		{   0, 3, 0xb0 }, {   0, 3, 0xb1 }, {   0, 3, 0xb3 }, {   0, 3, 0xd1 }, 
+		{   0, 3, 0xd8 }, {   0, 3, 0xd9 }, {   0, 3, 0xe3 }, {   0, 3, 0xe5 }, 
+		{   0, 3, 0xe6 }, { 154, 0, 0x00 }, { 159, 0, 0x00 }, { 160, 0, 0x00 }, 
+		{ 180, 0, 0x00 }, { 182, 0, 0x00 }, { 184, 0, 0x00 }, { 190, 0, 0x00 }, 
+	},
+	{ /* state 151 */
+		{  66, 2, 0xe6 }, {   1, 3, 0xe6 }, {   0, 3, 0x81 }, {   0, 3, 0x84 }, 
+		{   0, 3, 0x85 }, {   0, 3, 0x86 }, {   0, 3, 0x88 }, {   0, 3, 0x92 }, 
+		{   0, 3, 0x9a }, {   0, 3, 0x9c }, {   0, 3, 0xa0 }, {   0, 3, 0xa3 }, 
+		{   0, 3, 0xa4 }, {   0, 3, 0xa9 }, {   0, 3, 0xaa }, {   0, 3, 0xad }, 
+	},
+	{ /* state 152 */
+		{  85, 2, 0xe6 }, {  67, 2, 0xe6 }, {  93, 2, 0xe6 }, {   2, 3, 0xe6 }, 
+		{  66, 2, 0x81 }, {   1, 3, 0x81 }, {  66, 2, 0x84 }, {   1, 3, 0x84 }, 
+		{  66, 2, 0x85 }, {   1, 3, 0x85 }, {  66, 2, 0x86 }, {   1, 3, 0x86 }, 
+		{  66, 2, 0x88 }, {   1, 3, 0x88 }, {  66, 2, 0x92 }, {   1, 3, 0x92 }, 
+	},
+	{ /* state 153 */
+		{  86, 2, 0xe6 }, { 130, 2, 0xe6 }, {  68, 2, 0xe6 }, {  82, 2, 0xe6 }, 
+		{  99, 2, 0xe6 }, {  94, 2, 0xe6 }, { 104, 2, 0xe6 }, {   3, 3, 0xe6 }, 
+		{  85, 2, 0x81 }, {  67, 2, 0x81 }, {  93, 2, 0x81 }, {   2, 3, 0x81 }, 
+		{  85, 2, 0x84 }, {  67, 2, 0x84 }, {  93, 2, 0x84 }, {   2, 3, 0x84 }, 
+	},
+	{ /* state 154 */
+		{  86, 2, 0x81 }, { 130, 2, 0x81 }, {  68, 2, 0x81 }, {  82, 2, 0x81 }, 
+		{  99, 2, 0x81 }, {  94, 2, 0x81 }, { 104, 2, 0x81 }, {   3, 3, 0x81 }, 
+		{  86, 2, 0x84 }, { 130, 2, 0x84 }, {  68, 2, 0x84 }, {  82, 2, 0x84 }, 
+		{  99, 2, 0x84 }, {  94, 2, 0x84 }, { 104, 2, 0x84 }, {   3, 3, 0x84 }, 
+	},
+	{ /* state 155 */
+		{  66, 2, 0x83 }, {   1, 3, 0x83 }, {  66, 2, 0xa2 }, {   1, 3, 0xa2 }, 
+		{  66, 2, 0xb8 }, {   1, 3, 0xb8 }, {  66, 2, 0xc2 }, {   1, 3, 0xc2 }, 
+		{  66, 2, 0xe0 }, {   1, 3, 0xe0 }, {  66, 2, 0xe2 }, {   1, 3, 0xe2 }, 
+		{   0, 3, 0x99 }, {   0, 3, 0xa1 }, {   0, 3, 0xa7 }, {   0, 3, 0xac }, 
+	},
+	{ /* state 156 */
+		{  85, 2, 0x83 }, {  67, 2, 0x83 }, {  93, 2, 0x83 }, {   2, 3, 0x83 }, 
+		{  85, 2, 0xa2 }, {  67, 2, 0xa2 }, {  93, 2, 0xa2 }, {   2, 3, 0xa2 }, 
+		{  85, 2, 0xb8 }, {  67, 2, 0xb8 }, {  93, 2, 0xb8 }, {   2, 3, 0xb8 }, 
+		{  85, 2, 0xc2 }, {  67, 2, 0xc2 }, {  93, 2, 0xc2 }, {   2, 3, 0xc2 }, 
+	},
+	{ /* state 157 */
+		{  86, 2, 0x83 }, { 130, 2, 0x83 }, {  68, 2, 0x83 }, {  82, 2, 0x83 }, 
+		{  99, 2, 0x83 }, {  94, 2, 0x83 }, { 104, 2, 0x83 }, {   3, 3, 0x83 }, 
+		{  86, 2, 0xa2 }, { 130, 2, 0xa2 }, {  68, 2, 0xa2 }, {  82, 2, 0xa2 }, 
+		{  99, 2, 0xa2 }, {  94, 2, 0xa2 }, { 104, 2, 0xa2 }, {   3, 3, 0xa2 }, 
+	},
+	{ /* state 158 */
+		{  85, 2, 0x85 }, {  67, 2, 0x85 }, {  93, 2, 0x85 }, {   2, 3, 0x85 }, 
+		{  85, 2, 0x86 }, {  67, 2, 0x86 }, {  93, 2, 0x86 }, {   2, 3, 0x86 }, 
+		{  85, 2, 0x88 }, {  67, 2, 0x88 }, {  93, 2, 0x88 }, {   2, 3, 0x88 }, 
+		{  85, 2, 0x92 }, {  67, 2, 0x92 }, {  93, 2, 0x92 }, {   2, 3, 0x92 }, 
+	},
+	{ /* state 159 */
+		{  86, 2, 0x85 }, { 130, 2, 0x85 }, {  68, 2, 0x85 }, {  82, 2, 0x85 }, 
+		{  99, 2, 0x85 }, {  94, 2, 0x85 }, { 104, 2, 0x85 }, {   3, 3, 0x85 }, 
+		{  86, 2, 0x86 }, { 130, 2, 0x86 }, {  68, 2, 0x86 }, {  82, 2, 0x86 }, 
+		{  99, 2, 0x86 }, {  94, 2, 0x86 }, { 104, 2, 0x86 }, {   3, 3, 0x86 }, 
+	},
+	{ /* state 160 */
+		{  86, 2, 0x88 }, { 130, 2, 0x88 }, {  68, 2, 0x88 }, {  82, 2, 0x88 }, 
+		{  99, 2, 0x88 }, {  94, 2, 0x88 }, { 104, 2, 0x88 }, {   3, 3, 0x88 }, 
+		{  86, 2, 0x92 }, { 130, 2, 0x92 }, {  68, 2, 0x92 }, {  82, 2, 0x92 }, 
+		{  99, 2, 0x92 }, {  94, 2, 0x92 }, { 104, 2, 0x92 }, {   3, 3, 0x92 }, 
+	},
+	{ /* state 161 */
+		{  86, 2, 0x89 }, { 130, 2, 0x89 }, {  68, 2, 0x89 }, {  82, 2, 0x89 }, 
+		{  99, 2, 0x89 }, {  94, 2, 0x89 }, { 104, 2, 0x89 }, {   3, 3, 0x89 }, 
+		{  86, 2, 0x8a }, { 130, 2, 0x8a }, {  68, 2, 0x8a }, {  82, 2, 0x8a }, 
+		{  99, 2, 0x8a }, {  94, 2, 0x8a }, { 104, 2, 0x8a }, {   3, 3, 0x8a }, 
+	},
+	{ /* state 162 */
+		{  85, 2, 0x8b }, {  67, 2, 0x8b }, {  93, 2, 0x8b }, {   2, 3, 0x8b }, 
+		{  85, 2, 0x8c }, {  67, 2, 0x8c }, {  93, 2, 0x8c }, {   2, 3, 0x8c }, 
+		{  85, 2, 0x8d }, {  67, 2, 0x8d }, {  93, 2, 0x8d }, {   2, 3, 0x8d }, 
+		{  85, 2, 0x8f }, {  67, 2, 0x8f }, {  93, 2, 0x8f }, {   2, 3, 0x8f }, 
+	},
+	{ /* state 163 */
+		{  86, 2, 0x8b }, { 130, 2, 0x8b }, {  68, 2, 0x8b }, {  82, 2, 0x8b }, 
+		{  99, 2, 0x8b }, {  94, 2, 0x8b }, { 104, 2, 0x8b }, {   3, 3, 0x8b }, 
+		{  86, 2, 0x8c }, { 130, 2, 0x8c }, {  68, 2, 0x8c }, {  82, 2, 0x8c }, 
+		{  99, 2, 0x8c }, {  94, 2, 0x8c }, { 104, 2, 0x8c }, {   3, 3, 0x8c }, 
+	},
+	{ /* state 164 */
+		{  86, 2, 0x8d }, { 130, 2, 0x8d }, {  68, 2, 0x8d }, {  82, 2, 0x8d }, 
+		{  99, 2, 0x8d }, {  94, 2, 0x8d }, { 104, 2, 0x8d }, {   3, 3, 0x8d }, 
+		{  86, 2, 0x8f }, { 130, 2, 0x8f }, {  68, 2, 0x8f }, {  82, 2, 0x8f }, 
+		{  99, 2, 0x8f }, {  94, 2, 0x8f }, { 104, 2, 0x8f }, {   3, 3, 0x8f }, 
+	},
+	{ /* state 165 */
+		{  85, 2, 0x90 }, {  67, 2, 0x90 }, {  93, 2, 0x90 }, {   2, 3, 0x90 }, 
+		{  85, 2, 0x91 }, {  67, 2, 0x91 }, {  93, 2, 0x91 }, {   2, 3, 0x91 }, 
+		{  85, 2, 0x94 }, {  67, 2, 0x94 }, {  93, 2, 0x94 }, {   2, 3, 0x94 }, 
+		{  85, 2, 0x9f }, {  67, 2, 0x9f }, {  93, 2, 0x9f }, {   2, 3, 0x9f }, 
+	},
+	{ /* state 166 */
+		{  86, 2, 0x90 }, { 130, 2, 0x90 }, {  68, 2, 0x90 }, {  82, 2, 0x90 }, 
+		{  99, 2, 0x90 }, {  94, 2, 0x90 }, { 104, 2, 0x90 }, {   3, 3, 0x90 }, 
+		{  86, 2, 0x91 }, { 130, 2, 0x91 }, {  68, 2, 0x91 }, {  82, 2, 0x91 }, 
+		{  99, 2, 0x91 }, {  94, 2, 0x91 }, { 104, 2, 0x91 }, {   3, 3, 0x91 }, 
+	},
+	{ /* state 167 */
+		{   0, 3, 0x93 }, {   0, 3, 0x95 }, {   0, 3, 0x96 }, {   0, 3, 0x97 }, 
+		{   0, 3, 0x98 }, {   0, 3, 0x9b }, {   0, 3, 0x9d }, {   0, 3, 0x9e }, 
+		{   0, 3, 0xa5 }, {   0, 3, 0xa6 }, {   0, 3, 0xa8 }, {   0, 3, 0xae }, 
+		{   0, 3, 0xaf }, {   0, 3, 0xb4 }, {   0, 3, 0xb6 }, {   0, 3, 0xb7 }, 
+	},
+	{ /* state 168 */
+		{  66, 2, 0x93 }, {   1, 3, 0x93 }, {  66, 2, 0x95 }, {   1, 3, 0x95 }, 
+		{  66, 2, 0x96 }, {   1, 3, 0x96 }, {  66, 2, 0x97 }, {   1, 3, 0x97 }, 
+		{  66, 2, 0x98 }, {   1, 3, 0x98 }, {  66, 2, 0x9b }, {   1, 3, 0x9b }, 
+		{  66, 2, 0x9d }, {   1, 3, 0x9d }, {  66, 2, 0x9e }, {   1, 3, 0x9e }, 
+	},
+	{ /* state 169 */
+		{  85, 2, 0x93 }, {  67, 2, 0x93 }, {  93, 2, 0x93 }, {   2, 3, 0x93 }, 
+		{  85, 2, 0x95 }, {  67, 2, 0x95 }, {  93, 2, 0x95 }, {   2, 3, 0x95 }, 
+		{  85, 2, 0x96 }, {  67, 2, 0x96 }, {  93, 2, 0x96 }, {   2, 3, 0x96 }, 
+		{  85, 2, 0x97 }, {  67, 2, 0x97 }, {  93, 2, 0x97 }, {   2, 3, 0x97 }, 
+	},
+	{ /* state 170 */
+		{  86, 2, 0x93 }, { 130, 2, 0x93 }, {  68, 2, 0x93 }, {  82, 2, 0x93 }, 
+		{  99, 2, 0x93 }, {  94, 2, 0x93 }, { 104, 2, 0x93 }, {   3, 3, 0x93 }, 
+		{  86, 2, 0x95 }, { 130, 2, 0x95 }, {  68, 2, 0x95 }, {  82, 2, 0x95 }, 
+		{  99, 2, 0x95 }, {  94, 2, 0x95 }, { 104, 2, 0x95 }, {   3, 3, 0x95 }, 
+	},
+	{ /* state 171 */
+		{  86, 2, 0x94 }, { 130, 2, 0x94 }, {  68, 2, 0x94 }, {  82, 2, 0x94 }, 
+		{  99, 2, 0x94 }, {  94, 2, 0x94 }, { 104, 2, 0x94 }, {   3, 3, 0x94 }, 
+		{  86, 2, 0x9f }, { 130, 2, 0x9f }, {  68, 2, 0x9f }, {  82, 2, 0x9f }, 
+		{  99, 2, 0x9f }, {  94, 2, 0x9f }, { 104, 2, 0x9f }, {   3, 3, 0x9f }, 
+	},
+	{ /* state 172 */
+		{  86, 2, 0x96 }, { 130, 2, 0x96 }, {  68, 2, 0x96 }, {  82, 2, 0x96 }, 
+		{  99, 2, 0x96 }, {  94, 2, 0x96 }, { 104, 2, 0x96 }, {   3, 3, 0x96 }, 
+		{  86, 2, 0x97 }, { 130, 2, 0x97 }, {  68, 2, 0x97 }, {  82, 2, 0x97 }, 
+		{  99, 2, 0x97 }, {  94, 2, 0x97 }, { 104, 2, 0x97 }, {   3, 3, 0x97 }, 
+	},
+	{ /* state 173 */
+		{  85, 2, 0x98 }, {  67, 2, 0x98 }, {  93, 2, 0x98 }, {   2, 3, 0x98 }, 
+		{  85, 2, 0x9b }, {  67, 2, 0x9b }, {  93, 2, 0x9b }, {   2, 3, 0x9b }, 
+		{  85, 2, 0x9d }, {  67, 2, 0x9d }, {  93, 2, 0x9d }, {   2, 3, 0x9d }, 
+		{  85, 2, 0x9e }, {  67, 2, 0x9e }, {  93, 2, 0x9e }, {   2, 3, 0x9e }, 
+	},
+	{ /* state 174 */
+		{  86, 2, 0x98 }, { 130, 2, 0x98 }, {  68, 2, 0x98 }, {  82, 2, 0x98 }, 
+		{  99, 2, 0x98 }, {  94, 2, 0x98 }, { 104, 2, 0x98 }, {   3, 3, 0x98 }, 
+		{  86, 2, 0x9b }, { 130, 2, 0x9b }, {  68, 2, 0x9b }, {  82, 2, 0x9b }, 
+		{  99, 2, 0x9b }, {  94, 2, 0x9b }, { 104, 2, 0x9b }, {   3, 3, 0x9b }, 
+	},
+	{ /* state 175 */
+		{  85, 2, 0xe0 }, {  67, 2, 0xe0 }, {  93, 2, 0xe0 }, {   2, 3, 0xe0 }, 
+		{  85, 2, 0xe2 }, {  67, 2, 0xe2 }, {  93, 2, 0xe2 }, {   2, 3, 0xe2 }, 
+		{  66, 2, 0x99 }, {   1, 3, 0x99 }, {  66, 2, 0xa1 }, {   1, 3, 0xa1 }, 
+		{  66, 2, 0xa7 }, {   1, 3, 0xa7 }, {  66, 2, 0xac }, {   1, 3, 0xac }, 
+	},
+	{ /* state 176 */
+		{  85, 2, 0x99 }, {  67, 2, 0x99 }, {  93, 2, 0x99 }, {   2, 3, 0x99 }, 
+		{  85, 2, 0xa1 }, {  67, 2, 0xa1 }, {  93, 2, 0xa1 }, {   2, 3, 0xa1 }, 
+		{  85, 2, 0xa7 }, {  67, 2, 0xa7 }, {  93, 2, 0xa7 }, {   2, 3, 0xa7 }, 
+		{  85, 2, 0xac }, {  67, 2, 0xac }, {  93, 2, 0xac }, {   2, 3, 0xac }, 
+	},
+	{ /* state 177 */
+		{  86, 2, 0x99 }, { 130, 2, 0x99 }, {  68, 2, 0x99 }, {  82, 2, 0x99 }, 
+		{  99, 2, 0x99 }, {  94, 2, 0x99 }, { 104, 2, 0x99 }, {   3, 3, 0x99 }, 
+		{  86, 2, 0xa1 }, { 130, 2, 0xa1 }, {  68, 2, 0xa1 }, {  82, 2, 0xa1 }, 
+		{  99, 2, 0xa1 }, {  94, 2, 0xa1 }, { 104, 2, 0xa1 }, {   3, 3, 0xa1 }, 
+	},
+	{ /* state 178 */
+		{  66, 2, 0x9a }, {   1, 3, 0x9a }, {  66, 2, 0x9c }, {   1, 3, 0x9c }, 
+		{  66, 2, 0xa0 }, {   1, 3, 0xa0 }, {  66, 2, 0xa3 }, {   1, 3, 0xa3 }, 
+		{  66, 2, 0xa4 }, {   1, 3, 0xa4 }, {  66, 2, 0xa9 }, {   1, 3, 0xa9 }, 
+		{  66, 2, 0xaa }, {   1, 3, 0xaa }, {  66, 2, 0xad }, {   1, 3, 0xad }, 
+	},
+	{ /* state 179 */
+		{  85, 2, 0x9a }, {  67, 2, 0x9a }, {  93, 2, 0x9a }, {   2, 3, 0x9a }, 
+		{  85, 2, 0x9c }, {  67, 2, 0x9c }, {  93, 2, 0x9c }, {   2, 3, 0x9c }, 
+		{  85, 2, 0xa0 }, {  67, 2, 0xa0 }, {  93, 2, 0xa0 }, {   2, 3, 0xa0 }, 
+		{  85, 2, 0xa3 }, {  67, 2, 0xa3 }, {  93, 2, 0xa3 }, {   2, 3, 0xa3 }, 
+	},
+	{ /* state 180 */
+		{  86, 2, 0x9a }, { 130, 2, 0x9a }, {  68, 2, 0x9a }, {  82, 2, 0x9a }, 
+		{  99, 2, 0x9a }, {  94, 2, 0x9a }, { 104, 2, 0x9a }, {   3, 3, 0x9a }, 
+		{  86, 2, 0x9c }, { 130, 2, 0x9c }, {  68, 2, 0x9c }, {  82, 2, 0x9c }, 
+		{  99, 2, 0x9c }, {  94, 2, 0x9c }, { 104, 2, 0x9c }, {   3, 3, 0x9c }, 
+	},
+	{ /* state 181 */
+		{  86, 2, 0x9d }, { 130, 2, 0x9d }, {  68, 2, 0x9d }, {  82, 2, 0x9d }, 
+		{  99, 2, 0x9d }, {  94, 2, 0x9d }, { 104, 2, 0x9d }, {   3, 3, 0x9d }, 
+		{  86, 2, 0x9e }, { 130, 2, 0x9e }, {  68, 2, 0x9e }, {  82, 2, 0x9e }, 
+		{  99, 2, 0x9e }, {  94, 2, 0x9e }, { 104, 2, 0x9e }, {   3, 3, 0x9e }, 
+	},
+	{ /* state 182 */
+		{  86, 2, 0xa0 }, { 130, 2, 0xa0 }, {  68, 2, 0xa0 }, {  82, 2, 0xa0 }, 
+		{  99, 2, 0xa0 }, {  94, 2, 0xa0 }, { 104, 2, 0xa0 }, {   3, 3, 0xa0 }, 
+		{  86, 2, 0xa3 }, { 130, 2, 0xa3 }, {  68, 2, 0xa3 }, {  82, 2, 0xa3 }, 
+		{  99, 2, 0xa3 }, {  94, 2, 0xa3 }, { 104, 2, 0xa3 }, {   3, 3, 0xa3 }, 
+	},
+	{ /* state 183 */
+		{  85, 2, 0xa4 }, {  67, 2, 0xa4 }, {  93, 2, 0xa4 }, {   2, 3, 0xa4 }, 
+		{  85, 2, 0xa9 }, {  67, 2, 0xa9 }, {  93, 2, 0xa9 }, {   2, 3, 0xa9 }, 
+		{  85, 2, 0xaa }, {  67, 2, 0xaa }, {  93, 2, 0xaa }, {   2, 3, 0xaa }, 
+		{  85, 2, 0xad }, {  67, 2, 0xad }, {  93, 2, 0xad }, {   2, 3, 0xad }, 
+	},
+	{ /* state 184 */
+		{  86, 2, 0xa4 }, { 130, 2, 0xa4 }, {  68, 2, 0xa4 }, {  82, 2, 0xa4 }, 
+		{  99, 2, 0xa4 }, {  94, 2, 0xa4 }, { 104, 2, 0xa4 }, {   3, 3, 0xa4 }, 
+		{  86, 2, 0xa9 }, { 130, 2, 0xa9 }, {  68, 2, 0xa9 }, {  82, 2, 0xa9 }, 
+		{  99, 2, 0xa9 }, {  94, 2, 0xa9 }, { 104, 2, 0xa9 }, {   3, 3, 0xa9 }, 
+	},
+	{ /* state 185 */
+		{  66, 2, 0xa5 }, {   1, 3, 0xa5 }, {  66, 2, 0xa6 }, {   1, 3, 0xa6 }, 
+		{  66, 2, 0xa8 }, {   1, 3, 0xa8 }, {  66, 2, 0xae }, {   1, 3, 0xae }, 
+		{  66, 2, 0xaf }, {   1, 3, 0xaf }, {  66, 2, 0xb4 }, {   1, 3, 0xb4 }, 
+		{  66, 2, 0xb6 }, {   1, 3, 0xb6 }, {  66, 2, 0xb7 }, {   1, 3, 0xb7 }, 
+	},
+	{ /* state 186 */
+		{  85, 2, 0xa5 }, {  67, 2, 0xa5 }, {  93, 2, 0xa5 }, {   2, 3, 0xa5 }, 
+		{  85, 2, 0xa6 }, {  67, 2, 0xa6 }, {  93, 2, 0xa6 }, {   2, 3, 0xa6 }, 
+		{  85, 2, 0xa8 }, {  67, 2, 0xa8 }, {  93, 2, 0xa8 }, {   2, 3, 0xa8 }, 
+		{  85, 2, 0xae }, {  67, 2, 0xae }, {  93, 2, 0xae }, {   2, 3, 0xae }, 
+	},
+	{ /* state 187 */
+		{  86, 2, 0xa5 }, { 130, 2, 0xa5 }, {  68, 2, 0xa5 }, {  82, 2, 0xa5 }, 
+		{  99, 2, 0xa5 }, {  94, 2, 0xa5 }, { 104, 2, 0xa5 }, {   3, 3, 0xa5 }, 
+		{  86, 2, 0xa6 }, { 130, 2, 0xa6 }, {  68, 2, 0xa6 }, {  82, 2, 0xa6 }, 
+		{  99, 2, 0xa6 }, {  94, 2, 0xa6 }, { 104, 2, 0xa6 }, {   3, 3, 0xa6 }, 
+	},
+	{ /* state 188 */
+		{  86, 2, 0xa7 }, { 130, 2, 0xa7 }, {  68, 2, 0xa7 }, {  82, 2, 0xa7 }, 
+		{  99, 2, 0xa7 }, {  94, 2, 0xa7 }, { 104, 2, 0xa7 }, {   3, 3, 0xa7 }, 
+		{  86, 2, 0xac }, { 130, 2, 0xac }, {  68, 2, 0xac }, {  82, 2, 0xac }, 
+		{  99, 2, 0xac }, {  94, 2, 0xac }, { 104, 2, 0xac }, {   3, 3, 0xac }, 
+	},
+	{ /* state 189 */
+		{  86, 2, 0xa8 }, { 130, 2, 0xa8 }, {  68, 2, 0xa8 }, {  82, 2, 0xa8 }, 
+		{  99, 2, 0xa8 }, {  94, 2, 0xa8 }, { 104, 2, 0xa8 }, {   3, 3, 0xa8 }, 
+		{  86, 2, 0xae }, { 130, 2, 0xae }, {  68, 2, 0xae }, {  82, 2, 0xae }, 
+		{  99, 2, 0xae }, {  94, 2, 0xae }, { 104, 2, 0xae }, {   3, 3, 0xae }, 
+	},
+	{ /* state 190 */
+		{  86, 2, 0xaa }, { 130, 2, 0xaa }, {  68, 2, 0xaa }, {  82, 2, 0xaa }, 
+		{  99, 2, 0xaa }, {  94, 2, 0xaa }, { 104, 2, 0xaa }, {   3, 3, 0xaa }, 
+		{  86, 2, 0xad }, { 130, 2, 0xad }, {  68, 2, 0xad }, {  82, 2, 0xad }, 
+		{  99, 2, 0xad }, {  94, 2, 0xad }, { 104, 2, 0xad }, {   3, 3, 0xad }, 
+	},
+	{ /* state 191 */
+		{  66, 2, 0xab }, {   1, 3, 0xab }, {  66, 2, 0xce }, {   1, 3, 0xce }, 
+		{  66, 2, 0xd7 }, {   1, 3, 0xd7 }, {  66, 2, 0xe1 }, {   1, 3, 0xe1 }, 
+		{  66, 2, 0xec }, {   1, 3, 0xec }, {  66, 2, 0xed }, {   1, 3, 0xed }, 
+		{   0, 3, 0xc7 }, {   0, 3, 0xcf }, {   0, 3, 0xea }, {   0, 3, 0xeb }, 
+	},
+	{ /* state 192 */
+		{  85, 2, 0xab }, {  67, 2, 0xab }, {  93, 2, 0xab }, {   2, 3, 0xab }, 
+		{  85, 2, 0xce }, {  67, 2, 0xce }, {  93, 2, 0xce }, {   2, 3, 0xce }, 
+		{  85, 2, 0xd7 }, {  67, 2, 0xd7 }, {  93, 2, 0xd7 }, {   2, 3, 0xd7 }, 
+		{  85, 2, 0xe1 }, {  67, 2, 0xe1 }, {  93, 2, 0xe1 }, {   2, 3, 0xe1 }, 
+	},
+	{ /* state 193 */
+		{  86, 2, 0xab }, { 130, 2, 0xab }, {  68, 2, 0xab }, {  82, 2, 0xab }, 
+		{  99, 2, 0xab }, {  94, 2, 0xab }, { 104, 2, 0xab }, {   3, 3, 0xab }, 
+		{  86, 2, 0xce }, { 130, 2, 0xce }, {  68, 2, 0xce }, {  82, 2, 0xce }, 
+		{  99, 2, 0xce }, {  94, 2, 0xce }, { 104, 2, 0xce }, {   3, 3, 0xce }, 
+	},
+	{ /* state 194 */
+		{  85, 2, 0xaf }, {  67, 2, 0xaf }, {  93, 2, 0xaf }, {   2, 3, 0xaf }, 
+		{  85, 2, 0xb4 }, {  67, 2, 0xb4 }, {  93, 2, 0xb4 }, {   2, 3, 0xb4 }, 
+		{  85, 2, 0xb6 }, {  67, 2, 0xb6 }, {  93, 2, 0xb6 }, {   2, 3, 0xb6 }, 
+		{  85, 2, 0xb7 }, {  67, 2, 0xb7 }, {  93, 2, 0xb7 }, {   2, 3, 0xb7 }, 
+	},
+	{ /* state 195 */
+		{  86, 2, 0xaf }, { 130, 2, 0xaf }, {  68, 2, 0xaf }, {  82, 2, 0xaf }, 
+		{  99, 2, 0xaf }, {  94, 2, 0xaf }, { 104, 2, 0xaf }, {   3, 3, 0xaf }, 
+		{  86, 2, 0xb4 }, { 130, 2, 0xb4 }, {  68, 2, 0xb4 }, {  82, 2, 0xb4 }, 
+		{  99, 2, 0xb4 }, {  94, 2, 0xb4 }, { 104, 2, 0xb4 }, {   3, 3, 0xb4 }, 
+	},
+	{ /* state 196 */
+		{  66, 2, 0xb0 }, {   1, 3, 0xb0 }, {  66, 2, 0xb1 }, {   1, 3, 0xb1 }, 
+		{  66, 2, 0xb3 }, {   1, 3, 0xb3 }, {  66, 2, 0xd1 }, {   1, 3, 0xd1 }, 
+		{  66, 2, 0xd8 }, {   1, 3, 0xd8 }, {  66, 2, 0xd9 }, {   1, 3, 0xd9 }, 
+		{  66, 2, 0xe3 }, {   1, 3, 0xe3 }, {  66, 2, 0xe5 }, {   1, 3, 0xe5 }, 
+	},
+	{ /* state 197 */
+		{  85, 2, 0xb0 }, {  67, 2, 0xb0 }, {  93, 2, 0xb0 }, {   2, 3, 0xb0 }, 
+		{  85, 2, 0xb1 }, {  67, 2, 0xb1 }, {  93, 2, 0xb1 }, {   2, 3, 0xb1 }, 
+		{  85, 2, 0xb3 }, {  67, 2, 0xb3 }, {  93, 2, 0xb3 }, {   2, 3, 0xb3 }, 
+		{  85, 2, 0xd1 }, {  67, 2, 0xd1 }, {  93, 2, 0xd1 }, {   2, 3, 0xd1 }, 
+	},
+	{ /* state 198 */
+		{  86, 2, 0xb0 }, { 130, 2, 0xb0 }, {  68, 2, 0xb0 }, {  82, 2, 0xb0 }, 
+		{  99, 2, 0xb0 }, {  94, 2, 0xb0 }, { 104, 2, 0xb0 }, {   3, 3, 0xb0 }, 
+		{  86, 2, 0xb1 }, { 130, 2, 0xb1 }, {  68, 2, 0xb1 }, {  82, 2, 0xb1 }, 
+		{  99, 2, 0xb1 }, {  94, 2, 0xb1 }, { 104, 2, 0xb1 }, {   3, 3, 0xb1 }, 
+	},
+	{ /* state 199 */
+		{  66, 2, 0xb2 }, {   1, 3, 0xb2 }, {  66, 2, 0xb5 }, {   1, 3, 0xb5 }, 
+		{  66, 2, 0xb9 }, {   1, 3, 0xb9 }, {  66, 2, 0xba }, {   1, 3, 0xba }, 
+		{  66, 2, 0xbb }, {   1, 3, 0xbb }, {  66, 2, 0xbd }, {   1, 3, 0xbd }, 
+		{  66, 2, 0xbe }, {   1, 3, 0xbe }, {  66, 2, 0xc4 }, {   1, 3, 0xc4 }, 
+	},
+	{ /* state 200 */
+		{  85, 2, 0xb2 }, {  67, 2, 0xb2 }, {  93, 2, 0xb2 }, {   2, 3, 0xb2 }, 
+		{  85, 2, 0xb5 }, {  67, 2, 0xb5 }, {  93, 2, 0xb5 }, {   2, 3, 0xb5 }, 
+		{  85, 2, 0xb9 }, {  67, 2, 0xb9 }, {  93, 2, 0xb9 }, {   2, 3, 0xb9 }, 
+		{  85, 2, 0xba }, {  67, 2, 0xba }, {  93, 2, 0xba }, {   2, 3, 0xba }, 
+	},
+	{ /* state 201 */
+		{  86, 2, 0xb2 }, { 130, 2, 0xb2 }, {  68, 2, 0xb2 }, {  82, 2, 0xb2 }, 
+		{  99, 2, 0xb2 }, {  94, 2, 0xb2 }, { 104, 2, 0xb2 }, {   3, 3, 0xb2 }, 
+		{  86, 2, 0xb5 }, { 130, 2, 0xb5 }, {  68, 2, 0xb5 }, {  82, 2, 0xb5 }, 
+		{  99, 2, 0xb5 }, {  94, 2, 0xb5 }, { 104, 2, 0xb5 }, {   3, 3, 0xb5 }, 
+	},
+	{ /* state 202 */
+		{  86, 2, 0xb3 }, { 130, 2, 0xb3 }, {  68, 2, 0xb3 }, {  82, 2, 0xb3 }, 
+		{  99, 2, 0xb3 }, {  94, 2, 0xb3 }, { 104, 2, 0xb3 }, {   3, 3, 0xb3 }, 
+		{  86, 2, 0xd1 }, { 130, 2, 0xd1 }, {  68, 2, 0xd1 }, {  82, 2, 0xd1 }, 
+		{  99, 2, 0xd1 }, {  94, 2, 0xd1 }, { 104, 2, 0xd1 }, {   3, 3, 0xd1 }, 
+	},
+	{ /* state 203 */
+		{  86, 2, 0xb6 }, { 130, 2, 0xb6 }, {  68, 2, 0xb6 }, {  82, 2, 0xb6 }, 
+		{  99, 2, 0xb6 }, {  94, 2, 0xb6 }, { 104, 2, 0xb6 }, {   3, 3, 0xb6 }, 
+		{  86, 2, 0xb7 }, { 130, 2, 0xb7 }, {  68, 2, 0xb7 }, {  82, 2, 0xb7 }, 
+		{  99, 2, 0xb7 }, {  94, 2, 0xb7 }, { 104, 2, 0xb7 }, {   3, 3, 0xb7 }, 
+	},
+	{ /* state 204 */
+		{  86, 2, 0xb8 }, { 130, 2, 0xb8 }, {  68, 2, 0xb8 }, {  82, 2, 0xb8 }, 
+		{  99, 2, 0xb8 }, {  94, 2, 0xb8 }, { 104, 2, 0xb8 }, {   3, 3, 0xb8 }, 
+		{  86, 2, 0xc2 }, { 130, 2, 0xc2 }, {  68, 2, 0xc2 }, {  82, 2, 0xc2 }, 
+		{  99, 2, 0xc2 }, {  94, 2, 0xc2 }, { 104, 2, 0xc2 }, {   3, 3, 0xc2 }, 
+	},
+	{ /* state 205 */
+		{  86, 2, 0xb9 }, { 130, 2, 0xb9 }, {  68, 2, 0xb9 }, {  82, 2, 0xb9 }, 
+		{  99, 2, 0xb9 }, {  94, 2, 0xb9 }, { 104, 2, 0xb9 }, {   3, 3, 0xb9 }, 
+		{  86, 2, 0xba }, { 130, 2, 0xba }, {  68, 2, 0xba }, {  82, 2, 0xba }, 
+		{  99, 2, 0xba }, {  94, 2, 0xba }, { 104, 2, 0xba }, {   3, 3, 0xba }, 
+	},
+	{ /* state 206 */
+		{  85, 2, 0xbb }, {  67, 2, 0xbb }, {  93, 2, 0xbb }, {   2, 3, 0xbb }, 
+		{  85, 2, 0xbd }, {  67, 2, 0xbd }, {  93, 2, 0xbd }, {   2, 3, 0xbd }, 
+		{  85, 2, 0xbe }, {  67, 2, 0xbe }, {  93, 2, 0xbe }, {   2, 3, 0xbe }, 
+		{  85, 2, 0xc4 }, {  67, 2, 0xc4 }, {  93, 2, 0xc4 }, {   2, 3, 0xc4 }, 
+	},
+	{ /* state 207 */
+		{  86, 2, 0xbb }, { 130, 2, 0xbb }, {  68, 2, 0xbb }, {  82, 2, 0xbb }, 
+		{  99, 2, 0xbb }, {  94, 2, 0xbb }, { 104, 2, 0xbb }, {   3, 3, 0xbb }, 
+		{  86, 2, 0xbd }, { 130, 2, 0xbd }, {  68, 2, 0xbd }, {  82, 2, 0xbd }, 
+		{  99, 2, 0xbd }, {  94, 2, 0xbd }, { 104, 2, 0xbd }, {   3, 3, 0xbd }, 
+	},
+	{ /* state 208 */
+		{  85, 2, 0xbc }, {  67, 2, 0xbc }, {  93, 2, 0xbc }, {   2, 3, 0xbc }, 
+		{  85, 2, 0xbf }, {  67, 2, 0xbf }, {  93, 2, 0xbf }, {   2, 3, 0xbf }, 
+		{  85, 2, 0xc5 }, {  67, 2, 0xc5 }, {  93, 2, 0xc5 }, {   2, 3, 0xc5 }, 
+		{  85, 2, 0xe7 }, {  67, 2, 0xe7 }, {  93, 2, 0xe7 }, {   2, 3, 0xe7 }, 
+	},
+	{ /* state 209 */
+		{  86, 2, 0xbc }, { 130, 2, 0xbc }, {  68, 2, 0xbc }, {  82, 2, 0xbc }, 
+		{  99, 2, 0xbc }, {  94, 2, 0xbc }, { 104, 2, 0xbc }, {   3, 3, 0xbc }, 
+		{  86, 2, 0xbf }, { 130, 2, 0xbf }, {  68, 2, 0xbf }, {  82, 2, 0xbf }, 
+		{  99, 2, 0xbf }, {  94, 2, 0xbf }, { 104, 2, 0xbf }, {   3, 3, 0xbf }, 
+	},
+	{ /* state 210 */
+		{  86, 2, 0xbe }, { 130, 2, 0xbe }, {  68, 2, 0xbe }, {  82, 2, 0xbe }, 
+		{  99, 2, 0xbe }, {  94, 2, 0xbe }, { 104, 2, 0xbe }, {   3, 3, 0xbe }, 
+		{  86, 2, 0xc4 }, { 130, 2, 0xc4 }, {  68, 2, 0xc4 }, {  82, 2, 0xc4 }, 
+		{  99, 2, 0xc4 }, {  94, 2, 0xc4 }, { 104, 2, 0xc4 }, {   3, 3, 0xc4 }, 
+	},
+	{ /* state 211 */
+		{   0, 3, 0xc0 }, {   0, 3, 0xc1 }, {   0, 3, 0xc8 }, {   0, 3, 0xc9 }, 
+		{   0, 3, 0xca }, {   0, 3, 0xcd }, {   0, 3, 0xd2 }, {   0, 3, 0xd5 }, 
+		{   0, 3, 0xda }, {   0, 3, 0xdb }, {   0, 3, 0xee }, {   0, 3, 0xf0 }, 
+		{   0, 3, 0xf2 }, {   0, 3, 0xf3 }, {   0, 3, 0xff }, { 227, 0, 0x00 }, 
+	},
+	{ /* state 212 */
+		{  66, 2, 0xc0 }, {   1, 3, 0xc0 }, {  66, 2, 0xc1 }, {   1, 3, 0xc1 }, 
+		{  66, 2, 0xc8 }, {   1, 3, 0xc8 }, {  66, 2, 0xc9 }, {   1, 3, 0xc9 }, 
+		{  66, 2, 0xca }, {   1, 3, 0xca }, {  66, 2, 0xcd }, {   1, 3, 0xcd }, 
+		{  66, 2, 0xd2 }, {   1, 3, 0xd2 }, {  66, 2, 0xd5 }, {   1, 3, 0xd5 }, 
+	},
+	{ /* state 213 */
+		{  85, 2, 0xc0 }, {  67, 2, 0xc0 }, {  93, 2, 0xc0 }, {   2, 3, 0xc0 }, 
+		{  85, 2, 0xc1 }, {  67, 2, 0xc1 }, {  93, 2, 0xc1 }, {   2, 3, 0xc1 }, 
+		{  85, 2, 0xc8 }, {  67, 2, 0xc8 }, {  93, 2, 0xc8 }, {   2, 3, 0xc8 }, 
+		{  85, 2, 0xc9 }, {  67, 2, 0xc9 }, {  93, 2, 0xc9 }, {   2, 3, 0xc9 }, 
+	},
+	{ /* state 214 */
+		{  86, 2, 0xc0 }, { 130, 2, 0xc0 }, {  68, 2, 0xc0 }, {  82, 2, 0xc0 }, 
+		{  99, 2, 0xc0 }, {  94, 2, 0xc0 }, { 104, 2, 0xc0 }, {   3, 3, 0xc0 }, 
+		{  86, 2, 0xc1 }, { 130, 2, 0xc1 }, {  68, 2, 0xc1 }, {  82, 2, 0xc1 }, 
+		{  99, 2, 0xc1 }, {  94, 2, 0xc1 }, { 104, 2, 0xc1 }, {   3, 3, 0xc1 }, 
+	},
+	{ /* state 215 */
+		{  86, 2, 0xc5 }, { 130, 2, 0xc5 }, {  68, 2, 0xc5 }, {  82, 2, 0xc5 }, 
+		{  99, 2, 0xc5 }, {  94, 2, 0xc5 }, { 104, 2, 0xc5 }, {   3, 3, 0xc5 }, 
+		{  86, 2, 0xe7 }, { 130, 2, 0xe7 }, {  68, 2, 0xe7 }, {  82, 2, 0xe7 }, 
+		{  99, 2, 0xe7 }, {  94, 2, 0xe7 }, { 104, 2, 0xe7 }, {   3, 3, 0xe7 }, 
+	},
+	{ /* state 216 */
+		{  85, 2, 0xc6 }, {  67, 2, 0xc6 }, {  93, 2, 0xc6 }, {   2, 3, 0xc6 }, 
+		{  85, 2, 0xe4 }, {  67, 2, 0xe4 }, {  93, 2, 0xe4 }, {   2, 3, 0xe4 }, 
+		{  85, 2, 0xe8 }, {  67, 2, 0xe8 }, {  93, 2, 0xe8 }, {   2, 3, 0xe8 }, 
+		{  85, 2, 0xe9 }, {  67, 2, 0xe9 }, {  93, 2, 0xe9 }, {   2, 3, 0xe9 }, 
+	},
+	{ /* state 217 */
+		{  86, 2, 0xc6 }, { 130, 2, 0xc6 }, {  68, 2, 0xc6 }, {  82, 2, 0xc6 }, 
+		{  99, 2, 0xc6 }, {  94, 2, 0xc6 }, { 104, 2, 0xc6 }, {   3, 3, 0xc6 }, 
+		{  86, 2, 0xe4 }, { 130, 2, 0xe4 }, {  68, 2, 0xe4 }, {  82, 2, 0xe4 }, 
+		{  99, 2, 0xe4 }, {  94, 2, 0xe4 }, { 104, 2, 0xe4 }, {   3, 3, 0xe4 }, 
+	},
+	{ /* state 218 */
+		{  85, 2, 0xec }, {  67, 2, 0xec }, {  93, 2, 0xec }, {   2, 3, 0xec }, 
+		{  85, 2, 0xed }, {  67, 2, 0xed }, {  93, 2, 0xed }, {   2, 3, 0xed }, 
+		{  66, 2, 0xc7 }, {   1, 3, 0xc7 }, {  66, 2, 0xcf }, {   1, 3, 0xcf }, 
+		{  66, 2, 0xea }, {   1, 3, 0xea }, {  66, 2, 0xeb }, {   1, 3, 0xeb }, 
+	},
+	{ /* state 219 */
+		{  85, 2, 0xc7 }, {  67, 2, 0xc7 }, {  93, 2, 0xc7 }, {   2, 3, 0xc7 }, 
+		{  85, 2, 0xcf }, {  67, 2, 0xcf }, {  93, 2, 0xcf }, {   2, 3, 0xcf }, 
+		{  85, 2, 0xea }, {  67, 2, 0xea }, {  93, 2, 0xea }, {   2, 3, 0xea }, 
+		{  85, 2, 0xeb }, {  67, 2, 0xeb }, {  93, 2, 0xeb }, {   2, 3, 0xeb }, 
+	},
+	{ /* state 220 */
+		{  86, 2, 0xc7 }, { 130, 2, 0xc7 }, {  68, 2, 0xc7 }, {  82, 2, 0xc7 }, 
+		{  99, 2, 0xc7 }, {  94, 2, 0xc7 }, { 104, 2, 0xc7 }, {   3, 3, 0xc7 }, 
+		{  86, 2, 0xcf }, { 130, 2, 0xcf }, {  68, 2, 0xcf }, {  82, 2, 0xcf }, 
+		{  99, 2, 0xcf }, {  94, 2, 0xcf }, { 104, 2, 0xcf }, {   3, 3, 0xcf }, 
+	},
+	{ /* state 221 */
+		{  86, 2, 0xc8 }, { 130, 2, 0xc8 }, {  68, 2, 0xc8 }, {  82, 2, 0xc8 }, 
+		{  99, 2, 0xc8 }, {  94, 2, 0xc8 }, { 104, 2, 0xc8 }, {   3, 3, 0xc8 }, 
+		{  86, 2, 0xc9 }, { 130, 2, 0xc9 }, {  68, 2, 0xc9 }, {  82, 2, 0xc9 }, 
+		{  99, 2, 0xc9 }, {  94, 2, 0xc9 }, { 104, 2, 0xc9 }, {   3, 3, 0xc9 }, 
+	},
+	{ /* state 222 */
+		{  85, 2, 0xca }, {  67, 2, 0xca }, {  93, 2, 0xca }, {   2, 3, 0xca }, 
+		{  85, 2, 0xcd }, {  67, 2, 0xcd }, {  93, 2, 0xcd }, {   2, 3, 0xcd }, 
+		{  85, 2, 0xd2 }, {  67, 2, 0xd2 }, {  93, 2, 0xd2 }, {   2, 3, 0xd2 }, 
+		{  85, 2, 0xd5 }, {  67, 2, 0xd5 }, {  93, 2, 0xd5 }, {   2, 3, 0xd5 }, 
+	},
+	{ /* state 223 */
+		{  86, 2, 0xca }, { 130, 2, 0xca }, {  68, 2, 0xca }, {  82, 2, 0xca }, 
+		{  99, 2, 0xca }, {  94, 2, 0xca }, { 104, 2, 0xca }, {   3, 3, 0xca }, 
+		{  86, 2, 0xcd }, { 130, 2, 0xcd }, {  68, 2, 0xcd }, {  82, 2, 0xcd }, 
+		{  99, 2, 0xcd }, {  94, 2, 0xcd }, { 104, 2, 0xcd }, {   3, 3, 0xcd }, 
+	},
+	{ /* state 224 */
+		{  66, 2, 0xda }, {   1, 3, 0xda }, {  66, 2, 0xdb }, {   1, 3, 0xdb }, 
+		{  66, 2, 0xee }, {   1, 3, 0xee }, {  66, 2, 0xf0 }, {   1, 3, 0xf0 }, 
+		{  66, 2, 0xf2 }, {   1, 3, 0xf2 }, {  66, 2, 0xf3 }, {   1, 3, 0xf3 }, 
+		{  66, 2, 0xff }, {   1, 3, 0xff }, {   0, 3, 0xcb }, {   0, 3, 0xcc }, 
+	},
+	{ /* state 225 */
+		{  85, 2, 0xf2 }, {  67, 2, 0xf2 }, {  93, 2, 0xf2 }, {   2, 3, 0xf2 }, 
+		{  85, 2, 0xf3 }, {  67, 2, 0xf3 }, {  93, 2, 0xf3 }, {   2, 3, 0xf3 }, 
+		{  85, 2, 0xff }, {  67, 2, 0xff }, {  93, 2, 0xff }, {   2, 3, 0xff }, 
+		{  66, 2, 0xcb }, {   1, 3, 0xcb }, {  66, 2, 0xcc }, {   1, 3, 0xcc }, 
+	},
+	{ /* state 226 */
+		{  86, 2, 0xff }, { 130, 2, 0xff }, {  68, 2, 0xff }, {  82, 2, 0xff }, 
+		{  99, 2, 0xff }, {  94, 2, 0xff }, { 104, 2, 0xff }, {   3, 3, 0xff }, 
+		{  85, 2, 0xcb }, {  67, 2, 0xcb }, {  93, 2, 0xcb }, {   2, 3, 0xcb }, 
+		{  85, 2, 0xcc }, {  67, 2, 0xcc }, {  93, 2, 0xcc }, {   2, 3, 0xcc }, 
+	},
+	{ /* state 227 */
+		{  86, 2, 0xcb }, { 130, 2, 0xcb }, {  68, 2, 0xcb }, {  82, 2, 0xcb }, 
+		{  99, 2, 0xcb }, {  94, 2, 0xcb }, { 104, 2, 0xcb }, {   3, 3, 0xcb }, 
+		{  86, 2, 0xcc }, { 130, 2, 0xcc }, {  68, 2, 0xcc }, {  82, 2, 0xcc }, 
+		{  99, 2, 0xcc }, {  94, 2, 0xcc }, { 104, 2, 0xcc }, {   3, 3, 0xcc }, 
+	},
+	{ /* state 228 */
+		{  86, 2, 0xd2 }, { 130, 2, 0xd2 }, {  68, 2, 0xd2 }, {  82, 2, 0xd2 }, 
+		{  99, 2, 0xd2 }, {  94, 2, 0xd2 }, { 104, 2, 0xd2 }, {   3, 3, 0xd2 }, 
+		{  86, 2, 0xd5 }, { 130, 2, 0xd5 }, {  68, 2, 0xd5 }, {  82, 2, 0xd5 }, 
+		{  99, 2, 0xd5 }, {  94, 2, 0xd5 }, { 104, 2, 0xd5 }, {   3, 3, 0xd5 }, 
+	},
+	{ /* state 229 */
+		{   0, 3, 0xd3 }, {   0, 3, 0xd4 }, {   0, 3, 0xd6 }, {   0, 3, 0xdd }, 
+		{   0, 3, 0xde }, {   0, 3, 0xdf }, {   0, 3, 0xf1 }, {   0, 3, 0xf4 }, 
+		{   0, 3, 0xf5 }, {   0, 3, 0xf6 }, {   0, 3, 0xf7 }, {   0, 3, 0xf8 }, 
+		{   0, 3, 0xfa }, {   0, 3, 0xfb }, {   0, 3, 0xfc }, {   0, 3, 0xfd }, 
+	},
+	{ /* state 230 */
+		{  66, 2, 0xd3 }, {   1, 3, 0xd3 }, {  66, 2, 0xd4 }, {   1, 3, 0xd4 }, 
+		{  66, 2, 0xd6 }, {   1, 3, 0xd6 }, {  66, 2, 0xdd }, {   1, 3, 0xdd }, 
+		{  66, 2, 0xde }, {   1, 3, 0xde }, {  66, 2, 0xdf }, {   1, 3, 0xdf }, 
+		{  66, 2, 0xf1 }, {   1, 3, 0xf1 }, {  66, 2, 0xf4 }, {   1, 3, 0xf4 }, 
+	},
+	{ /* state 231 */
+		{  85, 2, 0xd3 }, {  67, 2, 0xd3 }, {  93, 2, 0xd3 }, {   2, 3, 0xd3 }, 
+		{  85, 2, 0xd4 }, {  67, 2, 0xd4 }, {  93, 2, 0xd4 }, {   2, 3, 0xd4 }, 
+		{  85, 2, 0xd6 }, {  67, 2, 0xd6 }, {  93, 2, 0xd6 }, {   2, 3, 0xd6 }, 
+		{  85, 2, 0xdd }, {  67, 2, 0xdd }, {  93, 2, 0xdd }, {   2, 3, 0xdd }, 
+	},
+	{ /* state 232 */
+		{  86, 2, 0xd3 }, { 130, 2, 0xd3 }, {  68, 2, 0xd3 }, {  82, 2, 0xd3 }, 
+		{  99, 2, 0xd3 }, {  94, 2, 0xd3 }, { 104, 2, 0xd3 }, {   3, 3, 0xd3 }, 
+		{  86, 2, 0xd4 }, { 130, 2, 0xd4 }, {  68, 2, 0xd4 }, {  82, 2, 0xd4 }, 
+		{  99, 2, 0xd4 }, {  94, 2, 0xd4 }, { 104, 2, 0xd4 }, {   3, 3, 0xd4 }, 
+	},
+	{ /* state 233 */
+		{  86, 2, 0xd6 }, { 130, 2, 0xd6 }, {  68, 2, 0xd6 }, {  82, 2, 0xd6 }, 
+		{  99, 2, 0xd6 }, {  94, 2, 0xd6 }, { 104, 2, 0xd6 }, {   3, 3, 0xd6 }, 
+		{  86, 2, 0xdd }, { 130, 2, 0xdd }, {  68, 2, 0xdd }, {  82, 2, 0xdd }, 
+		{  99, 2, 0xdd }, {  94, 2, 0xdd }, { 104, 2, 0xdd }, {   3, 3, 0xdd }, 
+	},
+	{ /* state 234 */
+		{  86, 2, 0xd7 }, { 130, 2, 0xd7 }, {  68, 2, 0xd7 }, {  82, 2, 0xd7 }, 
+		{  99, 2, 0xd7 }, {  94, 2, 0xd7 }, { 104, 2, 0xd7 }, {   3, 3, 0xd7 }, 
+		{  86, 2, 0xe1 }, { 130, 2, 0xe1 }, {  68, 2, 0xe1 }, {  82, 2, 0xe1 }, 
+		{  99, 2, 0xe1 }, {  94, 2, 0xe1 }, { 104, 2, 0xe1 }, {   3, 3, 0xe1 }, 
+	},
+	{ /* state 235 */
+		{  85, 2, 0xd8 }, {  67, 2, 0xd8 }, {  93, 2, 0xd8 }, {   2, 3, 0xd8 }, 
+		{  85, 2, 0xd9 }, {  67, 2, 0xd9 }, {  93, 2, 0xd9 }, {   2, 3, 0xd9 }, 
+		{  85, 2, 0xe3 }, {  67, 2, 0xe3 }, {  93, 2, 0xe3 }, {   2, 3, 0xe3 }, 
+		{  85, 2, 0xe5 }, {  67, 2, 0xe5 }, {  93, 2, 0xe5 }, {   2, 3, 0xe5 }, 
+	},
+	{ /* state 236 */
+		{  86, 2, 0xd8 }, { 130, 2, 0xd8 }, {  68, 2, 0xd8 }, {  82, 2, 0xd8 }, 
+		{  99, 2, 0xd8 }, {  94, 2, 0xd8 }, { 104, 2, 0xd8 }, {   3, 3, 0xd8 }, 
+		{  86, 2, 0xd9 }, { 130, 2, 0xd9 }, {  68, 2, 0xd9 }, {  82, 2, 0xd9 }, 
+		{  99, 2, 0xd9 }, {  94, 2, 0xd9 }, { 104, 2, 0xd9 }, {   3, 3, 0xd9 }, 
+	},
+	{ /* state 237 */
+		{  85, 2, 0xda }, {  67, 2, 0xda }, {  93, 2, 0xda }, {   2, 3, 0xda }, 
+		{  85, 2, 0xdb }, {  67, 2, 0xdb }, {  93, 2, 0xdb }, {   2, 3, 0xdb }, 
+		{  85, 2, 0xee }, {  67, 2, 0xee }, {  93, 2, 0xee }, {   2, 3, 0xee }, 
+		{  85, 2, 0xf0 }, {  67, 2, 0xf0 }, {  93, 2, 0xf0 }, {   2, 3, 0xf0 }, 
+	},
+	{ /* state 238 */
+		{  86, 2, 0xda }, { 130, 2, 0xda }, {  68, 2, 0xda }, {  82, 2, 0xda }, 
+		{  99, 2, 0xda }, {  94, 2, 0xda }, { 104, 2, 0xda }, {   3, 3, 0xda }, 
+		{  86, 2, 0xdb }, { 130, 2, 0xdb }, {  68, 2, 0xdb }, {  82, 2, 0xdb }, 
+		{  99, 2, 0xdb }, {  94, 2, 0xdb }, { 104, 2, 0xdb }, {   3, 3, 0xdb }, 
+	},
+	{ /* state 239 */
+		{  85, 2, 0xde }, {  67, 2, 0xde }, {  93, 2, 0xde }, {   2, 3, 0xde }, 
+		{  85, 2, 0xdf }, {  67, 2, 0xdf }, {  93, 2, 0xdf }, {   2, 3, 0xdf }, 
+		{  85, 2, 0xf1 }, {  67, 2, 0xf1 }, {  93, 2, 0xf1 }, {   2, 3, 0xf1 }, 
+		{  85, 2, 0xf4 }, {  67, 2, 0xf4 }, {  93, 2, 0xf4 }, {   2, 3, 0xf4 }, 
+	},
+	{ /* state 240 */
+		{  86, 2, 0xde }, { 130, 2, 0xde }, {  68, 2, 0xde }, {  82, 2, 0xde }, 
+		{  99, 2, 0xde }, {  94, 2, 0xde }, { 104, 2, 0xde }, {   3, 3, 0xde }, 
+		{  86, 2, 0xdf }, { 130, 2, 0xdf }, {  68, 2, 0xdf }, {  82, 2, 0xdf }, 
+		{  99, 2, 0xdf }, {  94, 2, 0xdf }, { 104, 2, 0xdf }, {   3, 3, 0xdf }, 
+	},
+	{ /* state 241 */
+		{  86, 2, 0xe0 }, { 130, 2, 0xe0 }, {  68, 2, 0xe0 }, {  82, 2, 0xe0 }, 
+		{  99, 2, 0xe0 }, {  94, 2, 0xe0 }, { 104, 2, 0xe0 }, {   3, 3, 0xe0 }, 
+		{  86, 2, 0xe2 }, { 130, 2, 0xe2 }, {  68, 2, 0xe2 }, {  82, 2, 0xe2 }, 
+		{  99, 2, 0xe2 }, {  94, 2, 0xe2 }, { 104, 2, 0xe2 }, {   3, 3, 0xe2 }, 
+	},
+	{ /* state 242 */
+		{  86, 2, 0xe3 }, { 130, 2, 0xe3 }, {  68, 2, 0xe3 }, {  82, 2, 0xe3 }, 
+		{  99, 2, 0xe3 }, {  94, 2, 0xe3 }, { 104, 2, 0xe3 }, {   3, 3, 0xe3 }, 
+		{  86, 2, 0xe5 }, { 130, 2, 0xe5 }, {  68, 2, 0xe5 }, {  82, 2, 0xe5 }, 
+		{  99, 2, 0xe5 }, {  94, 2, 0xe5 }, { 104, 2, 0xe5 }, {   3, 3, 0xe5 }, 
+	},
+	{ /* state 243 */
+		{  86, 2, 0xe8 }, { 130, 2, 0xe8 }, {  68, 2, 0xe8 }, {  82, 2, 0xe8 }, 
+		{  99, 2, 0xe8 }, {  94, 2, 0xe8 }, { 104, 2, 0xe8 }, {   3, 3, 0xe8 }, 
+		{  86, 2, 0xe9 }, { 130, 2, 0xe9 }, {  68, 2, 0xe9 }, {  82, 2, 0xe9 }, 
+		{  99, 2, 0xe9 }, {  94, 2, 0xe9 }, { 104, 2, 0xe9 }, {   3, 3, 0xe9 }, 
+	},
+	{ /* state 244 */
+		{  86, 2, 0xea }, { 130, 2, 0xea }, {  68, 2, 0xea }, {  82, 2, 0xea }, 
+		{  99, 2, 0xea }, {  94, 2, 0xea }, { 104, 2, 0xea }, {   3, 3, 0xea }, 
+		{  86, 2, 0xeb }, { 130, 2, 0xeb }, {  68, 2, 0xeb }, {  82, 2, 0xeb }, 
+		{  99, 2, 0xeb }, {  94, 2, 0xeb }, { 104, 2, 0xeb }, {   3, 3, 0xeb }, 
+	},
+	{ /* state 245 */
+		{  86, 2, 0xec }, { 130, 2, 0xec }, {  68, 2, 0xec }, {  82, 2, 0xec }, 
+		{  99, 2, 0xec }, {  94, 2, 0xec }, { 104, 2, 0xec }, {   3, 3, 0xec }, 
+		{  86, 2, 0xed }, { 130, 2, 0xed }, {  68, 2, 0xed }, {  82, 2, 0xed }, 
+		{  99, 2, 0xed }, {  94, 2, 0xed }, { 104, 2, 0xed }, {   3, 3, 0xed }, 
+	},
+	{ /* state 246 */
+		{  86, 2, 0xee }, { 130, 2, 0xee }, {  68, 2, 0xee }, {  82, 2, 0xee }, 
+		{  99, 2, 0xee }, {  94, 2, 0xee }, { 104, 2, 0xee }, {   3, 3, 0xee }, 
+		{  86, 2, 0xf0 }, { 130, 2, 0xf0 }, {  68, 2, 0xf0 }, {  82, 2, 0xf0 }, 
+		{  99, 2, 0xf0 }, {  94, 2, 0xf0 }, { 104, 2, 0xf0 }, {   3, 3, 0xf0 }, 
+	},
+	{ /* state 247 */
+		{  86, 2, 0xf1 }, { 130, 2, 0xf1 }, {  68, 2, 0xf1 }, {  82, 2, 0xf1 }, 
+		{  99, 2, 0xf1 }, {  94, 2, 0xf1 }, { 104, 2, 0xf1 }, {   3, 3, 0xf1 }, 
+		{  86, 2, 0xf4 }, { 130, 2, 0xf4 }, {  68, 2, 0xf4 }, {  82, 2, 0xf4 }, 
+		{  99, 2, 0xf4 }, {  94, 2, 0xf4 }, { 104, 2, 0xf4 }, {   3, 3, 0xf4 }, 
+	},
+	{ /* state 248 */
+		{  86, 2, 0xf2 }, { 130, 2, 0xf2 }, {  68, 2, 0xf2 }, {  82, 2, 0xf2 }, 
+		{  99, 2, 0xf2 }, {  94, 2, 0xf2 }, { 104, 2, 0xf2 }, {   3, 3, 0xf2 }, 
+		{  86, 2, 0xf3 }, { 130, 2, 0xf3 }, {  68, 2, 0xf3 }, {  82, 2, 0xf3 }, 
+		{  99, 2, 0xf3 }, {  94, 2, 0xf3 }, { 104, 2, 0xf3 }, {   3, 3, 0xf3 }, 
+	},
+	{ /* state 249 */
+		{  66, 2, 0xf5 }, {   1, 3, 0xf5 }, {  66, 2, 0xf6 }, {   1, 3, 0xf6 }, 
+		{  66, 2, 0xf7 }, {   1, 3, 0xf7 }, {  66, 2, 0xf8 }, {   1, 3, 0xf8 }, 
+		{  66, 2, 0xfa }, {   1, 3, 0xfa }, {  66, 2, 0xfb }, {   1, 3, 0xfb }, 
+		{  66, 2, 0xfc }, {   1, 3, 0xfc }, {  66, 2, 0xfd }, {   1, 3, 0xfd }, 
+	},
+	{ /* state 250 */
+		{  85, 2, 0xf5 }, {  67, 2, 0xf5 }, {  93, 2, 0xf5 }, {   2, 3, 0xf5 }, 
+		{  85, 2, 0xf6 }, {  67, 2, 0xf6 }, {  93, 2, 0xf6 }, {   2, 3, 0xf6 }, 
+		{  85, 2, 0xf7 }, {  67, 2, 0xf7 }, {  93, 2, 0xf7 }, {   2, 3, 0xf7 }, 
+		{  85, 2, 0xf8 }, {  67, 2, 0xf8 }, {  93, 2, 0xf8 }, {   2, 3, 0xf8 }, 
+	},
+	{ /* state 251 */
+		{  86, 2, 0xf5 }, { 130, 2, 0xf5 }, {  68, 2, 0xf5 }, {  82, 2, 0xf5 }, 
+		{  99, 2, 0xf5 }, {  94, 2, 0xf5 }, { 104, 2, 0xf5 }, {   3, 3, 0xf5 }, 
+		{  86, 2, 0xf6 }, { 130, 2, 0xf6 }, {  68, 2, 0xf6 }, {  82, 2, 0xf6 }, 
+		{  99, 2, 0xf6 }, {  94, 2, 0xf6 }, { 104, 2, 0xf6 }, {   3, 3, 0xf6 }, 
+	},
+	{ /* state 252 */
+		{  86, 2, 0xf7 }, { 130, 2, 0xf7 }, {  68, 2, 0xf7 }, {  82, 2, 0xf7 }, 
+		{  99, 2, 0xf7 }, {  94, 2, 0xf7 }, { 104, 2, 0xf7 }, {   3, 3, 0xf7 }, 
+		{  86, 2, 0xf8 }, { 130, 2, 0xf8 }, {  68, 2, 0xf8 }, {  82, 2, 0xf8 }, 
+		{  99, 2, 0xf8 }, {  94, 2, 0xf8 }, { 104, 2, 0xf8 }, {   3, 3, 0xf8 }, 
+	},
+	{ /* state 253 */
+		{  85, 2, 0xfa }, {  67, 2, 0xfa }, {  93, 2, 0xfa }, {   2, 3, 0xfa }, 
+		{  85, 2, 0xfb }, {  67, 2, 0xfb }, {  93, 2, 0xfb }, {   2, 3, 0xfb }, 
+		{  85, 2, 0xfc }, {  67, 2, 0xfc }, {  93, 2, 0xfc }, {   2, 3, 0xfc }, 
+		{  85, 2, 0xfd }, {  67, 2, 0xfd }, {  93, 2, 0xfd }, {   2, 3, 0xfd }, 
+	},
+	{ /* state 254 */
+		{  86, 2, 0xfa }, { 130, 2, 0xfa }, {  68, 2, 0xfa }, {  82, 2, 0xfa }, 
+		{  99, 2, 0xfa }, {  94, 2, 0xfa }, { 104, 2, 0xfa }, {   3, 3, 0xfa }, 
+		{  86, 2, 0xfb }, { 130, 2, 0xfb }, {  68, 2, 0xfb }, {  82, 2, 0xfb }, 
+		{  99, 2, 0xfb }, {  94, 2, 0xfb }, { 104, 2, 0xfb }, {   3, 3, 0xfb }, 
+	},
+	{ /* state 255 */
+		{  86, 2, 0xfc }, { 130, 2, 0xfc }, {  68, 2, 0xfc }, {  82, 2, 0xfc }, 
+		{  99, 2, 0xfc }, {  94, 2, 0xfc }, { 104, 2, 0xfc }, {   3, 3, 0xfc }, 
+		{  86, 2, 0xfd }, { 130, 2, 0xfd }, {  68, 2, 0xfd }, {  82, 2, 0xfd }, 
+		{  99, 2, 0xfd }, {  94, 2, 0xfd }, { 104, 2, 0xfd }, {   3, 3, 0xfd }, 
+	},
+};
 
-	0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00, 
-	0x34, 0x0f, 0x43, 0x03, 0xf1, 0x3c, 0xfc, 0x3c, 
-	0x0f, 0x30, 0x37, 0xf7, 0x0f, 0xc3, 0xcf, 0x03, 
-	0x3c, 0xfc, 0xc0, 0xf3, 0xf0, 0x3c, 0xfc, 0xf0, 
-	0xcf, 0xfc, 0xcc, 0xff, 0xfc, 0x0d, 0x34, 0xcc, 
-	0xcf, 0x33, 0xf0, 0x33, 0x0c, 0x3f, 0xc3, 0x3f, 
-	0xcc, 0x30, 0xfc, 0xcf, 0x3c, 0xf0, 0x0c, 0xcf, 
-	0xd0, 0x03, 0x3f, 0x33, 0xff, 0xff, 0xc3, 0xf3, 
+/* code for each symbol, for encoding */
+static const uint32_t huftable_enc_code[] = {
+	0x00001ff8, 0x007fffd8, 0x0fffffe2, 0x0fffffe3, 
+	0x0fffffe4, 0x0fffffe5, 0x0fffffe6, 0x0fffffe7, 
+	0x0fffffe8, 0x00ffffea, 0x3ffffffc, 0x0fffffe9, 
+	0x0fffffea, 0x3ffffffd, 0x0fffffeb, 0x0fffffec, 
+	0x0fffffed, 0x0fffffee, 0x0fffffef, 0x0ffffff0, 
+	0x0ffffff1, 0x0ffffff2, 0x3ffffffe, 0x0ffffff3, 
+	0x0ffffff4, 0x0ffffff5, 0x0ffffff6, 0x0ffffff7, 
+	0x0ffffff8, 0x0ffffff9, 0x0ffffffa, 0x0ffffffb, 
+	0x00000014, 0x000003f8, 0x000003f9, 0x00000ffa, 
+	0x00001ff9, 0x00000015, 0x000000f8, 0x000007fa, 
+	0x000003fa, 0x000003fb, 0x000000f9, 0x000007fb, 
+	0x000000fa, 0x00000016, 0x00000017, 0x00000018, 
+	0x00000000, 0x00000001, 0x00000002, 0x00000019, 
+	0x0000001a, 0x0000001b, 0x0000001c, 0x0000001d, 
+	0x0000001e, 0x0000001f, 0x0000005c, 0x000000fb, 
+	0x00007ffc, 0x00000020, 0x00000ffb, 0x000003fc, 
+	0x00001ffa, 0x00000021, 0x0000005d, 0x0000005e, 
+	0x0000005f, 0x00000060, 0x00000061, 0x00000062, 
+	0x00000063, 0x00000064, 0x00000065, 0x00000066, 
+	0x00000067, 0x00000068, 0x00000069, 0x0000006a, 
+	0x0000006b, 0x0000006c, 0x0000006d, 0x0000006e, 
+	0x0000006f, 0x00000070, 0x00000071, 0x00000072, 
+	0x000000fc, 0x00000073, 0x000000fd, 0x00001ffb, 
+	0x0007fff0, 0x00001ffc, 0x00003ffc, 0x00000022, 
+	0x00007ffd, 0x00000003, 0x00000023, 0x00000004, 
+	0x00000024, 0x00000005, 0x00000025, 0x00000026, 
+	0x00000027, 0x00000006, 0x00000074, 0x00000075, 
+	0x00000028, 0x00000029, 0x0000002a, 0x00000007, 
+	0x0000002b, 0x00000076, 0x0000002c, 0x00000008, 
+	0x00000009, 0x0000002d, 0x00000077, 0x00000078, 
+	0x00000079, 0x0000007a, 0x0000007b, 0x00007ffe, 
+	0x000007fc, 0x00003ffd, 0x00001ffd, 0x0ffffffc, 
+	0x000fffe6, 0x003fffd2, 0x000fffe7, 0x000fffe8, 
+	0x003fffd3, 0x003fffd4, 0x003fffd5, 0x007fffd9, 
+	0x003fffd6, 0x007fffda, 0x007fffdb, 0x007fffdc, 
+	0x007fffdd, 0x007fffde, 0x00ffffeb, 0x007fffdf, 
+	0x00ffffec, 0x00ffffed, 0x003fffd7, 0x007fffe0, 
+	0x00ffffee, 0x007fffe1, 0x007fffe2, 0x007fffe3, 
+	0x007fffe4, 0x001fffdc, 0x003fffd8, 0x007fffe5, 
+	0x003fffd9, 0x007fffe6, 0x007fffe7, 0x00ffffef, 
+	0x003fffda, 0x001fffdd, 0x000fffe9, 0x003fffdb, 
+	0x003fffdc, 0x007fffe8, 0x007fffe9, 0x001fffde, 
+	0x007fffea, 0x003fffdd, 0x003fffde, 0x00fffff0, 
+	0x001fffdf, 0x003fffdf, 0x007fffeb, 0x007fffec, 
+	0x001fffe0, 0x001fffe1, 0x003fffe0, 0x001fffe2, 
+	0x007fffed, 0x003fffe1, 0x007fffee, 0x007fffef, 
+	0x000fffea, 0x003fffe2, 0x003fffe3, 0x003fffe4, 
+	0x007ffff0, 0x003fffe5, 0x003fffe6, 0x007ffff1, 
+	0x03ffffe0, 0x03ffffe1, 0x000fffeb, 0x0007fff1, 
+	0x003fffe7, 0x007ffff2, 0x003fffe8, 0x01ffffec, 
+	0x03ffffe2, 0x03ffffe3, 0x03ffffe4, 0x07ffffde, 
+	0x07ffffdf, 0x03ffffe5, 0x00fffff1, 0x01ffffed, 
+	0x0007fff2, 0x001fffe3, 0x03ffffe6, 0x07ffffe0, 
+	0x07ffffe1, 0x03ffffe7, 0x07ffffe2, 0x00fffff2, 
+	0x001fffe4, 0x001fffe5, 0x03ffffe8, 0x03ffffe9, 
+	0x0ffffffd, 0x07ffffe3, 0x07ffffe4, 0x07ffffe5, 
+	0x000fffec, 0x00fffff3, 0x000fffed, 0x001fffe6, 
+	0x003fffe9, 0x001fffe7, 0x001fffe8, 0x007ffff3, 
+	0x003fffea, 0x003fffeb, 0x01ffffee, 0x01ffffef, 
+	0x00fffff4, 0x00fffff5, 0x03ffffea, 0x007ffff4, 
+	0x03ffffeb, 0x07ffffe6, 0x03ffffec, 0x03ffffed, 
+	0x07ffffe7, 0x07ffffe8, 0x07ffffe9, 0x07ffffea, 
+	0x07ffffeb, 0x0ffffffe, 0x07ffffec, 0x07ffffed, 
+	0x07ffffee, 0x07ffffef, 0x07fffff0, 0x03ffffee, 
+	0x3fffffff, 
 };
 
-/* state that points to 0x100 for disambiguation with 0x0 */
-#define HUFTABLE_0x100_PREV 118
+/* length in bits of each code */
+static const uint8_t huftable_enc_len[] = {
+	13, 23, 28, 28, 28, 28, 28, 28, 
+	28, 24, 30, 28, 28, 30, 28, 28, 
+	28, 28, 28, 28, 28, 28, 30, 28, 
+	28, 28, 28, 28, 28, 28, 28, 28, 
+	 6, 10, 10, 12, 13,  6,  8, 11, 
+	10, 10,  8, 11,  8,  6,  6,  6, 
+	 5,  5,  5,  6,  6,  6,  6,  6, 
+	 6,  6,  7,  8, 15,  6, 12, 10, 
+	13,  6,  7,  7,  7,  7,  7,  7, 
+	 7,  7,  7,  7,  7,  7,  7,  7, 
+	 7,  7,  7,  7,  7,  7,  7,  7, 
+	 8,  7,  8, 13, 19, 13, 14,  6, 
+	15,  5,  6,  5,  6,  5,  6,  6, 
+	 6,  5,  7,  7,  6,  6,  6,  5, 
+	 6,  7,  6,  5,  5,  6,  7,  7, 
+	 7,  7,  7, 15, 11, 14, 13, 28, 
+	20, 22, 20, 20, 22, 22, 22, 23, 
+	22, 23, 23, 23, 23, 23, 24, 23, 
+	24, 24, 22, 23, 24, 23, 23, 23, 
+	23, 21, 22, 23, 22, 23, 23, 24, 
+	22, 21, 20, 22, 22, 23, 23, 21, 
+	23, 22, 22, 24, 21, 22, 23, 23, 
+	21, 21, 22, 21, 23, 22, 23, 23, 
+	20, 22, 22, 22, 23, 22, 22, 23, 
+	26, 26, 20, 19, 22, 23, 22, 25, 
+	26, 26, 26, 27, 27, 26, 24, 25, 
+	19, 21, 26, 27, 27, 26, 27, 24, 
+	21, 21, 26, 26, 28, 27, 27, 27, 
+	20, 24, 20, 21, 22, 21, 21, 23, 
+	22, 22, 25, 25, 24, 24, 26, 23, 
+	26, 27, 26, 26, 27, 27, 27, 27, 
+	27, 28, 27, 27, 27, 27, 27, 26, 
+	30, 
+};
@@ -9,7 +9,7 @@
  *
  * Usage: gcc minihuf.c -o minihuf && ./minihuf > huftable.h
  *
- * Run it twice to test parsing on the generated table on stderr
+ * It checks the decode table it generates before exiting, see stderr
  */
 
 #include <stdio.h>
@@ -298,65 +298,77 @@ int code_bit(int idx, int bit)
 	return -1;
 }
 
-#include "huftable.h"
-
-#define PARALLEL 2
-
 struct state {
 	int terminal;
-	int state[PARALLEL];
-	int bytepos;
+	int state[2];
 
-	int real_pos;
+	int id; /* nibble decoder state for nonterminals */
+	int accept; /* all 1s from the root and < 8 bits deep, ie, padding */
 };
 
-struct state state[2000];
-unsigned char terms[2000];
+struct state state[600];
 int next = 1;
 
-int lextable_decode(int pos, char c)
+/*
+ * The nibble decoder has one state per nonterminal node of the tree.  For
+ * each state and 4-bit input, it knows the state we end up in, if we passed
+ * through a terminal on the way and if the bits so far could be padding.
+ * Codes are at least 5 bits, so one nibble completes at most one symbol.
+ */
+
+#define NIB_ACCEPT	1
+#define NIB_SYM		2
+#define NIB_FAIL	4
+
+struct nib {
+	int state;
+	int flags;
+	int sym;
+};
+
+struct nib nib[256][16];
+int node_of_id[256];
+
+int nib_decode(const unsigned char *in, int len, unsigned char *out)
 {
-	int q = pos + !!c;
+	int n, m, s = 0, o = 0, acc = 1;
+	struct nib *e;
+
+	for (n = 0; n < len; n++)
+		for (m = 0; m < 2; m++) {
+			e = &nib[s][m ? in[n] & 0xf : in[n] >> 4];
+			if (e->flags & NIB_FAIL)
+				return -1;
+			if (e->flags & NIB_SYM)
+				out[o++] = e->sym;
+			s = e->state;
+			acc = !!(e->flags & NIB_ACCEPT);
+		}
 
-	if (lextable_terms[q >> 3] & (1 << (q & 7))) /* terminal */
-		return lextable[q] | 0x8000;
+	if (!acc)
+		return -1;
 
-	return pos + (lextable[q] << 1);
+	return o;
 }
 
 int main(void)
 {
-	int n = 0;
-	int m = 0;
-	int prev;
-	char c;
-	int walk;
-	int saw;
-	int y;
-	int j;
-	int q;
-	int pos = 0;
-	int biggest = 0;
-	int fails = 0;
-
-	m = 0;
-	while (m < LWS_ARRAY_SIZE(state)) {
-		for (j = 0; j < PARALLEL; j++) {
-			state[m].state[j] = 0xffff;
-			state[m].terminal = 0;
-		}
-		m++;
+	unsigned char in[8], out[8];
+	int n, m, j, walk, ids = 0, acc, len;
+
+	for (n = 0; n < LWS_ARRAY_SIZE(state); n++) {
+		state[n].state[0] = 0xffff;
+		state[n].state[1] = 0xffff;
 	}
 
+	n = 0;
 	while (n < LWS_ARRAY_SIZE(huf_literal)) {
 
 		m = 0;
 		walk = 0;
-		prev = 0;
 
 		while (m < huf_literal[n].len) {
 
-			saw = 0;
 			if (state[walk].state[code_bit(n, m)] != 0xffff) {
 				/* exists -- go forward */
 				walk = state[walk].state[code_bit(n, m)];
@@ -375,142 +387,151 @@ again:
 		state[walk].state[0] = 0; /* terminal marker */
 	}
 
-	walk = 0;
+	/* number the nonterminals, the root is state 0 */
+
 	for (n = 0; n < next; n++) {
-		state[n].bytepos = walk;
-		walk += (2 * 2);
+		if (!state[n].state[0])
+			continue;
+		if (state[n].state[0] == 0xffff || state[n].state[1] == 0xffff) {
+			fprintf(stderr, "tree incomplete at %d\n", n);
+			return 1;
+		}
+		if (ids == 256) {
+			fprintf(stderr, "too many states\n");
+			return 1;
+		}
+		node_of_id[ids] = n;
+		state[n].id = ids++;
 	}
 
-	/* compute everyone's position first */
-
-	pos = 0;
-	walk = 0;
-	for (n = 0; n < next; n++) {
+	for (n = 0, walk = 0; n < 8; n++) {
+		state[walk].accept = 1;
+		walk = state[walk].state[1];
+	}
 
-		state[n].real_pos = pos;
+	for (n = 0; n < ids; n++)
+		for (m = 0; m < 16; m++) {
+			walk = node_of_id[n];
+			nib[n][m].flags = 0;
+			nib[n][m].sym = 0;
+
+			for (j = 3; j >= 0; j--) {
+				walk = state[walk].state[(m >> j) & 1];
+				if (state[walk].state[0])
+					continue;
+				/* terminal */
+				if (state[walk].terminal == 256)
+					nib[n][m].flags |= NIB_FAIL;
+				else {
+					nib[n][m].flags |= NIB_SYM;
+					nib[n][m].sym = state[walk].terminal;
+				}
+				walk = 0;
+			}
 
-		if (state[n].state[0]) /* nonterminal */
-			pos += 2;
+			nib[n][m].state = state[walk].id;
+			if (state[walk].accept)
+				nib[n][m].flags |= NIB_ACCEPT;
+		}
 
-		walk ++;
+	fprintf(stdout, "/*\n * Generated by minihuf.c, do not edit\n *\n"
+			" * HPACK Huffman decoder, taking 4 bits at a time.  Index with the\n"
+			" * current state (starting at 0) and the next nibble of input, msb\n"
+			" * first.\n */\n\n"
+			"#define HUFTABLE_ACCEPT\t%d /* the string may end here */\n"
+			"#define HUFTABLE_SYM\t%d /* .sym was decoded */\n"
+			"#define HUFTABLE_FAIL\t%d /* EOS was decoded */\n\n"
+			"struct huftable_nib {\n"
+			"\tuint8_t state;\n"
+			"\tuint8_t flags;\n"
+			"\tuint8_t sym;\n"
+			"};\n\n"
+			"static const struct huftable_nib huftable_nib[%d][16] = {\n",
+			NIB_ACCEPT, NIB_SYM, NIB_FAIL, ids);
+
+	for (n = 0; n < ids; n++) {
+		fprintf(stdout, "\t{ /* state %d */\n", n);
+		for (m = 0; m < 16; m++) {
+			if (!(m & 3))
+				fprintf(stdout, "\t\t");
+			fprintf(stdout, "{ %3d, %d, 0x%02x }, ", nib[n][m].state,
+				nib[n][m].flags, nib[n][m].sym);
+			if ((m & 3) == 3)
+				fprintf(stdout, "\n");
+		}
+		fprintf(stdout, "\t},\n");
 	}
+	fprintf(stdout, "};\n");
 
-	fprintf(stdout, "static unsigned char lextable[] = {\n");
+	/*
+	 * Try to decode every symbol, on its own and after a 5-bit one so it
+	 * starts mid-nibble, padded out with 1s
+	 */
 
-#define TERMINAL_MASK 0x8000
+	for (n = 0; n < LWS_ARRAY_SIZE(huf_literal) - 1; n++) {
+		for (j = 0; j < 2; j++) {
+			unsigned long long v = 0;
+			int bits = 0;
 
-	walk = 0;
-	pos = 0;
-	q = 0;
-	for (n = 0; n < next; n++) {
-		q = pos;
-		for (m = 0; m < 2; m++) {
-			saw = state[n].state[m];
-
-			if (saw == 0) { // c is a terminal then
-				m = 2;
-				continue;
-			}
-			if (!m)
-				fprintf(stdout, "/* pos %04x: %3d */ ",
-							  state[n].real_pos, n);
-			else
-				fprintf(stdout, "                    ");
-
-			if (saw == 0xffff) {
-				fprintf(stdout,
-				  "   0xff, 0xff, /* 0 = fail */\n                    ");
-				pos ++; /* fail */
-				fails++;
-				continue;
+			if (j) {
+				v = huf_literal['0'].code; /* 5 bits */
+				bits = huf_literal['0'].len;
 			}
-
-			if (state[saw].state[0] == 0) { /* points to terminal */
-				fprintf(stdout, "    /* terminal %d */ 0x%02X,\n",
-					state[saw].terminal,
-					state[saw].terminal & 0xff);
-				terms[(state[n].real_pos + m) >> 3] |=
-					1 << ((state[n].real_pos + m) & 7);
-				pos++;
-				walk++;
-				continue;
+			v = (v << huf_literal[n].len) | huf_literal[n].code;
+			bits += huf_literal[n].len;
+			len = (bits + 7) / 8;
+			v = (v << (len * 8 - bits)) | ((1 << (len * 8 - bits)) - 1);
+			for (m = 0; m < len; m++)
+				in[m] = (unsigned char)(v >> ((len - 1 - m) * 8));
+
+			m = nib_decode(in, len, out);
+			if (m != j + 1 || out[j] != n || (j && out[0] != '0')) {
+				fprintf(stderr, "decode failed %d (%d)\n", n, m);
+				return 4;
 			}
-
-			j = (state[saw].real_pos - q) >> 1;
-
-			if (j > biggest)
-				biggest = j;
-
-			if (j > 0xffff) {
-				fprintf(stderr,
-				  "Jump > 64K bytes ahead (%d to %d)\n",
-					state[n].real_pos, state[saw].real_pos);
-				return 1;
-			}
-
-			fprintf(stdout, "   /* %d */ 0x%02X  "
-				"/* (to 0x%04X state %3d) */,\n",
-				m,
-				j & 0xff,
-				state[saw].real_pos, saw);
-			pos++;
-
-			walk++;
 		}
 	}
 
-	fprintf(stdout, "/* total size %d bytes, biggest jump %d/256, fails=%d */\n};\n"
-			"\n static unsigned char lextable_terms[] = {\n",
-	 		pos, biggest, fails);
-
-	for (n = 0; n < (walk + 7) / 8; n++) {
-		if (!(n & 7))
-			fprintf(stdout, "\n\t");
-		fprintf(stdout, "0x%02x, ", terms[n]);
+	/* padding that is too long, or not 1s, and EOS must fail */
+
+	in[0] = 0x02; /* "0  " is 00000 010100 010100, then 7 bits of 1s */
+	in[1] = 0x8a;
+	in[2] = 0x7f;
+	acc = nib_decode(in, 3, out) == 3 && !memcmp(out, "0  ", 3);
+	in[0] = 0xff; /* 8 bits of padding */
+	acc = acc && nib_decode(in, 1, out) < 0;
+	in[0] = 0x06; /* '0' then 3 bits of padding that aren't all 1s */
+	acc = acc && nib_decode(in, 1, out) < 0;
+	in[0] = 0x07; /* '0' then 111 */
+	acc = acc && nib_decode(in, 1, out) == 1;
+	in[0] = in[1] = in[2] = 0xff;
+	in[3] = 0xfc; /* EOS, 30 1s */
+	acc = acc && nib_decode(in, 4, out) < 0;
+	if (!acc) {
+		fprintf(stderr, "padding / EOS checks failed\n");
+		return 5;
 	}
-	fprintf(stdout, "\n};\n");
 
 	/*
-	 * Try to parse every legal input string
+	 * The encoder just needs the code and its length in bits for each
+	 * symbol
 	 */
 
+	fprintf(stdout, "\n/* code for each symbol, for encoding */\n"
+			"static const uint32_t huftable_enc_code[] = {");
 	for (n = 0; n < LWS_ARRAY_SIZE(huf_literal); n++) {
-		walk = 0;
-		m = 0;
-		y = -1;
-
-		fprintf(stderr, "  trying %d\n", n);
-
-		while (m < huf_literal[n].len) {
-			prev = walk;
-			walk = lextable_decode(walk, code_bit(n, m));
-
-			if (walk == 0xffff) {
-				fprintf(stderr, "failed\n");
-				return 3;
-			}
-
-			if (walk & 0x8000) {
-				y = walk & 0x7fff;
-				if (y == 0 && m == 29) {
-					y |= 0x100;
-					fprintf(stdout,
-						"\n/* state that points to "
-						"0x100 for disambiguation with "
-						"0x0 */\n"
-						"#define HUFTABLE_0x100_PREV "
-						"%d\n", prev);
-				}
-				break;
-			}
-			m++;
-		}
-
-		if (y != n) {
-			fprintf(stderr, "decode failed %d got %d (0x%x)\n", n, y, y);
-			return 4;
-		}
+		if (!(n & 3))
+			fprintf(stdout, "\n\t");
+		fprintf(stdout, "0x%08x, ", huf_literal[n].code);
 	}
+	fprintf(stdout, "\n};\n\n/* length in bits of each code */\n"
+			"static const uint8_t huftable_enc_len[] = {");
+	for (n = 0; n < LWS_ARRAY_SIZE(huf_literal); n++) {
+		if (!(n & 7))
+			fprintf(stdout, "\n\t");
+		fprintf(stdout, "%2d, ", huf_literal[n].len);
+	}
+	fprintf(stdout, "\n};\n");
 
 	fprintf(stderr, "All decode OK\n");
 
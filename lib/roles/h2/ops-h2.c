@@ -280,7 +280,7 @@ drain:
 			}
 		} else
 			if (n != ebuf.len) {
-				m = lws_buflist_append_segment(&wsi->buflist,
+				m = lws_wsi_buflist_append(wsi, &wsi->buflist,
 						(uint8_t *)ebuf.token + n,
 						ebuf.len - n);
 				if (m < 0)
@@ -296,11 +296,16 @@ drain:
 
 	// lws_buflist_describe(&wsi->buflist, wsi);
 
+	/*
+	 * After an h2c upgrade, the ah holds the upgrade request's headers
+	 * until they're passed on to sid 1 when we ack the peer's SETTINGS
+	 */
+
 	if (wsi->http.ah
 #if !defined(LWS_NO_CLIENT)
 			&& !wsi->client_h2_alpn
 #endif
-			)
+			&& (lws_is_ssl(wsi) || lwsi_state(wsi) == LRS_ESTABLISHED))
 		lws_header_table_detach(wsi, 0);
 
 	pending = lws_ssl_pending(wsi);
@@ -455,6 +460,28 @@ rops_write_role_protocol_h2(struct lws *wsi, unsigned char *buf, size_t len,
 		wsi->h2.send_END_STREAM = 1;
 	}
 
+	if (n == LWS_H2_FRAME_TYPE_HEADERS ||
+	    n == LWS_H2_FRAME_TYPE_CONTINUATION) {
+		struct lws_context_per_thread *pt =
+					&wsi->context->pt[(int)wsi->tsi];
+
+		/* this is where the header block meets the dynamic table */
+
+		if (lws_hpack_enc_block(wsi, n == LWS_H2_FRAME_TYPE_HEADERS,
+					flags & LWS_H2_FLAG_END_HEADERS,
+					&buf, &len)) {
+			lwsl_err("%s: unable to encode header block\n",
+				 __func__);
+			return -1;
+		}
+
+		if (n == LWS_H2_FRAME_TYPE_HEADERS)
+			lws_stats_atomic_bump(wsi->context, pt,
+					LWSSTATS_C_H2_HEADER_BLOCKS_TX, 1);
+		lws_stats_atomic_bump(wsi->context, pt,
+				      LWSSTATS_B_H2_HEADER_BLOCKS_TX, len);
+	}
+
 	n = lws_h2_frame_write(wsi, n, flags, wsi->h2.my_sid, (int)len, buf);
 	if (n < 0)
 		return n;
@@ -519,6 +546,9 @@ rops_init_vhost_h2(struct lws_vhost *vh,
 			vh->h2.set.s[n] = info->http2_settings[n];
 	}
 
+	vh->h2.rx_win_budget = info->h2_rx_window_budget ?
+			info->h2_rx_window_budget : LWS_H2_RX_WIN_BUDGET_DEFAULT;
+
 	return 0;
 }
 
@@ -567,8 +597,10 @@ rops_destroy_role_h2(struct lws *wsi)
 	if (wsi->upgraded_to_http2 || wsi->http2_substream) {
 		lws_hpack_destroy_dynamic_header(wsi);
 
-		if (wsi->h2.h2n)
+		if (wsi->h2.h2n) {
+			lws_h2_rx_win_release(wsi);
 			lws_free_set_NULL(wsi->h2.h2n);
+		}
 	}
 
 	return 0;
@@ -657,6 +689,7 @@ rops_close_kill_connection_h2(struct lws *wsi, enum lws_close_status reason)
 			wsi->http2_substream) &&
 	     wsi->h2.parent_wsi) {
 		lwsl_info("  %p: disentangling from siblings\n", wsi);
+		lws_h2_sched_detach(wsi);
 		lws_start_foreach_llp(struct lws **, w,
 				wsi->h2.parent_wsi->h2.child_list) {
 			/* disconnect from siblings */
@@ -726,6 +759,7 @@ rops_callback_on_writable_h2(struct lws *wsi)
 	}
 
 	wsi->h2.skint = 0;
+	lws_h2_sched_wake(wsi);
 	network_wsi = lws_get_network_wsi(wsi);
 	already = network_wsi->h2.requested_POLLOUT;
 
@@ -814,11 +848,12 @@ lws_h2_bind_for_post_before_action(struct lws *wsi)
 /*
  * we are the 'network wsi' for potentially many muxed child wsi with
  * no network connection of their own, who have to use us for all their
- * network actions.  So we use a round-robin scheme to share out the
- * POLLOUT notifications to our children.
+ * network actions.  So we share out the POLLOUT notifications to our
+ * children, in the order the stream scheduler decides from their RFC7540
+ * weights and dependencies (see lws_h2_sched_pick()).
  *
- * But because any child could exhaust the socket's ability to take
- * writes, we can only let one child get notified each time.
+ * Each child that was waiting when we came gets at most one turn, and we
+ * stop early if the socket can't take any more.
  *
  * In addition children may be closed / deleted / added between POLLOUT
  * notifications, so we can't hold pointers
@@ -827,11 +862,11 @@ lws_h2_bind_for_post_before_action(struct lws *wsi)
 static int
 rops_perform_user_POLLOUT_h2(struct lws *wsi)
 {
-	struct lws **wsi2, *wsi2a;
+	struct lws *w, *wsi2a;
 #if defined(LWS_ROLE_WS)
 	int write_type = LWS_WRITE_PONG;
 #endif
-	int n;
+	int n, turns = 0;
 
 	wsi = lws_get_network_wsi(wsi);
 
@@ -843,48 +878,16 @@ rops_perform_user_POLLOUT_h2(struct lws *wsi)
 
 	lws_h2_dump_waiting_children(wsi);
 
-	wsi2 = &wsi->h2.child_list;
-	if (!*wsi2)
-		return 0;
-
-	do {
-		struct lws *w, **wa;
+	lws_start_foreach_ll(struct lws *, w1, wsi->h2.child_list) {
+		if (w1->h2.requested_POLLOUT)
+			turns++;
+	} lws_end_foreach_ll(w1, h2.sibling_list);
 
-		wa = &(*wsi2)->h2.sibling_list;
-		if (!(*wsi2)->h2.requested_POLLOUT)
-			goto next_child;
-
-		/*
-		 * we're going to do writable callback for this child.
-		 * move him to be the last child
-		 */
+	while (turns-- > 0) {
 
-		lwsl_debug("servicing child %p\n", *wsi2);
-
-		w = *wsi2;
-		while (w) {
-			if (!w->h2.sibling_list) { /* w is the current last */
-				lwsl_debug("w=%p, *wsi2 = %p\n", w, *wsi2);
-				if (w == *wsi2) /* we are already last */
-					break;
-				/* last points to us as new last */
-				w->h2.sibling_list = *wsi2;
-				/* guy pointing to us until now points to
-				 * our old next */
-				*wsi2 = (*wsi2)->h2.sibling_list;
-				/* we point to nothing because we are last */
-				w->h2.sibling_list->h2.sibling_list = NULL;
-				/* w becomes us */
-				w = w->h2.sibling_list;
-				break;
-			}
-			w = w->h2.sibling_list;
-		}
-
-		if (!w) {
-			wa = &wsi->h2.child_list;
-			goto next_child;
-		}
+		w = lws_h2_sched_pick(wsi);
+		if (!w)
+			break;
 
 		w->h2.requested_POLLOUT = 0;
 		lwsl_info("%s: child %p (wsistate 0x%x)\n", __func__, w,
@@ -898,11 +901,9 @@ rops_perform_user_POLLOUT_h2(struct lws *wsi)
 				lwsl_info("%s signalling to close\n", __func__);
 				lws_close_free_wsi(w, LWS_CLOSE_STATUS_NOSTATUS,
 						   "h2 end stream 1");
-				wa = &wsi->h2.child_list;
 				goto next_child;
 			}
 			lws_callback_on_writable(w);
-			wa = &wsi->h2.child_list;
 			goto next_child;
 		}
 
@@ -924,7 +925,6 @@ rops_perform_user_POLLOUT_h2(struct lws *wsi)
 						   "comp write fail");
 			}
 			lws_callback_on_writable(w);
-			wa = &wsi->h2.child_list;
 			goto next_child;
 		}
 #endif
@@ -935,7 +935,6 @@ rops_perform_user_POLLOUT_h2(struct lws *wsi)
 			w->socket_is_permanently_unusable = 1;
 			lws_close_free_wsi(w, LWS_CLOSE_STATUS_NOSTATUS,
 					   "h2 end stream 1");
-			wa = &wsi->h2.child_list;
 			goto next_child;
 		}
 
@@ -952,7 +951,6 @@ rops_perform_user_POLLOUT_h2(struct lws *wsi)
 			lws_free_set_NULL(w->h2.pending_status_body);
 			lws_close_free_wsi(w, LWS_CLOSE_STATUS_NOSTATUS,
 					   "h2 end stream 1");
-			wa = &wsi->h2.child_list;
 			goto next_child;
 		}
 
@@ -993,7 +991,6 @@ rops_perform_user_POLLOUT_h2(struct lws *wsi)
 				lwsl_info("closing stream after h2 action\n");
 				lws_close_free_wsi(w, LWS_CLOSE_STATUS_NOSTATUS,
 						   "h2 end stream");
-				wa = &wsi->h2.child_list;
 			}
 
 			goto next_child;
@@ -1020,7 +1017,6 @@ rops_perform_user_POLLOUT_h2(struct lws *wsi)
 				lwsl_debug("Closing POLLOUT child %p\n", w);
 				lws_close_free_wsi(w, LWS_CLOSE_STATUS_NOSTATUS,
 						   "h2 end stream file");
-				wa = &wsi->h2.child_list;
 				goto next_child;
 			}
 			if (n > 0)
@@ -1081,7 +1077,6 @@ rops_perform_user_POLLOUT_h2(struct lws *wsi)
 				lwsi_set_state(w, LRS_RETURNED_CLOSE);
 				lws_close_free_wsi(w, LWS_CLOSE_STATUS_NOSTATUS,
 						   "returned close packet");
-				wa = &wsi->h2.child_list;
 				goto next_child;
 			}
 
@@ -1097,14 +1092,14 @@ rops_perform_user_POLLOUT_h2(struct lws *wsi)
 				  w->h2.send_END_STREAM);
 			lws_close_free_wsi(w, LWS_CLOSE_STATUS_NOSTATUS,
 					   "h2 pollout handle");
-			wa = &wsi->h2.child_list;
 		} else
 			 if (w->h2.send_END_STREAM)
 				lws_h2_state(w, LWS_H2_STATE_HALF_CLOSED_LOCAL);
 
 next_child:
-		wsi2 = wa;
-	} while (wsi2 && *wsi2 && !lws_send_pipe_choked(wsi));
+		if (lws_send_pipe_choked(wsi))
+			break;
+	}
 
 	// lws_h2_dump_waiting_children(wsi);
 
@@ -43,6 +43,8 @@ struct http2_settings {
 
 struct lws_vhost_role_h2 {
 	struct http2_settings set;
+	uint32_t rx_win_budget; /* rx window growth our conns may share */
+	uint32_t rx_win_committed; /* rx window growth in use */
 };
 
 enum lws_h2_wellknown_frame_types {
@@ -190,15 +192,28 @@ enum http2_hpack_type {
 #define LWS_HPACK_IGNORE_ENTRY 0xffff
 
 
+/*
+ * HPACK decoder dynamic table for what we receive.
+ *
+ * The entries and a ring of their value bytes are one allocation, sized when
+ * the table size is set.  Values are written to the ring in insertion order
+ * and eviction is always of the oldest entry, so inserting and evicting just
+ * move the ring head and usage.  A value may wrap around the end of the ring.
+ */
+
 struct hpack_dt_entry {
-	char *value; /* malloc'd */
+	uint32_t value_ofs; /* start of value in dyn->values */
 	uint16_t value_len;
 	uint16_t hdr_len; /* virtual, for accounting */
 	uint16_t lws_hdr_idx; /* LWS_HPACK_IGNORE_ENTRY = IGNORE */
 };
 
 struct hpack_dynamic_table {
-	struct hpack_dt_entry *entries; /* malloc'd */
+	struct hpack_dt_entry *entries; /* malloc'd, value ring follows */
+	char *values; /* ring of value bytes, inside entries allocation */
+	uint32_t values_size;
+	uint32_t values_head; /* where the next value starts */
+	uint32_t values_used;
 	uint32_t virtual_payload_usage;
 	uint32_t virtual_payload_max;
 	uint16_t pos;
@@ -206,6 +221,59 @@ struct hpack_dynamic_table {
 	uint16_t num_entries;
 };
 
+/*
+ * HPACK encoder dynamic table for what we send.
+ *
+ * Header blocks are built by lws_add_http_header_...() into user buffers,
+ * not necessarily in the order they will be sent (eg, the other_headers for
+ * lws_serve_http_file() are prepared beforehand).  So those apis only use
+ * stateless representations, and each whole block is recoded against this
+ * table when it is actually written.
+ */
+
+#if defined(LWS_WITH_ESP32)
+#define LWS_H2_HPACK_ENC_TABLE_MAX 1024
+#else
+#define LWS_H2_HPACK_ENC_TABLE_MAX 4096
+#endif
+
+struct hpack_enc_entry {
+	char *nv; /* malloc'd name then value */
+	uint16_t name_len;
+	uint16_t value_len;
+};
+
+struct hpack_enc_table {
+	struct hpack_enc_entry *entries; /* malloc'd ring, oldest first */
+	unsigned char *scratch; /* malloc'd, blocks are recoded into here */
+	uint32_t scratch_len;
+	uint32_t size; /* rfc7541 size of the entries */
+	uint32_t max; /* size we told the peer's decoder to use */
+	uint32_t peer_max; /* peer's SETTINGS_HEADER_TABLE_SIZE */
+	uint16_t first; /* ring index of the oldest entry */
+	uint16_t used;
+	uint16_t num_entries; /* ring size */
+	uint8_t size_update; /* signal max at the start of the next block */
+	uint8_t initialized;
+};
+
+/*
+ * Each time a stream is picked to write, it's charged this many bytes on top
+ * of what it actually sent, so streams that only send headers or small
+ * frames still take turns
+ */
+#define LWS_H2_SCHED_TURN_COST 1024
+
+/*
+ * Receive window sizing: new streams get this much on top of the initial
+ * window, BDP estimation may grow a connection's windows up to
+ * LWS_H2_RX_WIN_MAX, and the growth of all the connections on a vhost is
+ * limited to its budget
+ */
+#define LWS_H2_RX_WIN_OPEN (4 * 65536)
+#define LWS_H2_RX_WIN_MAX (16 * 1024 * 1024)
+#define LWS_H2_RX_WIN_BUDGET_DEFAULT (64 * 1024 * 1024)
+
 enum lws_h2_protocol_send_type {
 	LWS_PPS_NONE,
 	LWS_H2_PPS_MY_SETTINGS,
@@ -214,6 +282,7 @@ enum lws_h2_protocol_send_type {
 	LWS_H2_PPS_GOAWAY,
 	LWS_H2_PPS_RST_STREAM,
 	LWS_H2_PPS_UPDATE_WINDOW,
+	LWS_H2_PPS_PING,
 };
 
 struct lws_h2_protocol_send {
@@ -261,11 +330,20 @@ struct lws_h2_ghost_sid {
 struct lws_h2_netconn {
 	struct http2_settings set;
 	struct hpack_dynamic_table hpack_dyn_table;
+	struct hpack_enc_table hpack_enc;
 	uint8_t	ping_payload[8];
 	uint8_t one_setting[LWS_H2_SETTINGS_LEN];
 	char goaway_str[32]; /* for rx */
 	struct lws *swsi;
 	struct lws_h2_protocol_send *pps; /* linked list */
+	uint64_t sched_vclock; /* pass of the last stream scheduled */
+	uint64_t bdp_bw_max; /* best rx bytes / s seen by a BDP ping */
+	lws_usec_t bdp_ping_us; /* when the BDP ping went out */
+	lws_usec_t settings_us; /* when our SETTINGS went out */
+	lws_usec_t rtt_min; /* best RTT seen, 0 = none yet */
+	uint32_t bdp_bytes; /* DATA rx since the BDP ping went out */
+	int rx_win; /* window we keep the peer topped up to */
+	int rx_win_grown; /* how much of rx_win came from the vhost budget */
 
 	enum http2_hpack_state hpack;
 	enum http2_hpack_type hpack_type;
@@ -279,8 +357,9 @@ struct lws_h2_netconn {
 	unsigned int pad_length:1;
 	unsigned int collected_priority:1;
 	unsigned int is_first_header_char:1;
-	unsigned int zero_huff_padding:1;
+	unsigned int huff_accept:1; /* huffman string may end here */
 	unsigned int last_action_dyntable_resize:1;
+	unsigned int bdp_ping_inflight:1;
 
 	uint32_t hdr_idx;
 	uint32_t hpack_len;
@@ -298,14 +377,13 @@ struct lws_h2_netconn {
 	uint32_t goaway_err;
 	uint32_t hpack_hdr_len;
 
-	uint16_t hpack_pos;
+	uint16_t hpack_pos; /* huffman decoder state */
 
 	uint8_t frame_state;
 	uint8_t type;
 	uint8_t flags;
 	uint8_t padding;
 	uint8_t weight_temp;
-	uint8_t huff_pad;
 	char first_hdr_char;
 	uint8_t hpack_m;
 	uint8_t ext_count;
@@ -324,8 +402,9 @@ struct _lws_h2_related {
 	int peer_tx_cr_est;
 	unsigned int my_sid;
 	unsigned int child_count;
-	int my_priority;
-	uint32_t dependent_on;
+	int my_priority; /* RFC7540 weight, 1 .. 256 */
+	struct lws *sched_dep; /* stream we depend on, NULL = root */
+	uint64_t sched_pass; /* stride scheduler virtual time */
 
 	unsigned int END_STREAM:1;
 	unsigned int END_HEADERS:1;
@@ -334,11 +413,7 @@ struct _lws_h2_related {
 	unsigned int requested_POLLOUT:1;
 	unsigned int skint:1;
 
-	uint16_t round_robin_POLLOUT;
-	uint16_t count_POLLOUT_children;
-
 	uint8_t h2_state; /* the RFC7540 state of the connection */
-	uint8_t weight;
 	uint8_t initialized;
 };
 
@@ -381,12 +456,27 @@ LWS_EXTERN void
 lws_hpack_destroy_dynamic_header(struct lws *wsi);
 LWS_EXTERN int
 lws_hpack_dynamic_size(struct lws *wsi, int size);
+LWS_EXTERN void
+lws_hpack_enc_peer_table_size(struct lws *nwsi, uint32_t size);
+LWS_EXTERN int
+lws_hpack_enc_block(struct lws *wsi, int first, int end_headers,
+		    unsigned char **buf, size_t *len);
 LWS_EXTERN int
 lws_h2_goaway(struct lws *wsi, uint32_t err, const char *reason);
 LWS_EXTERN int
 lws_h2_tx_cr_get(struct lws *wsi);
 LWS_EXTERN void
 lws_h2_tx_cr_consume(struct lws *wsi, int consumed);
+LWS_EXTERN void
+lws_h2_sched_set_priority(struct lws *wsi, uint32_t dep, uint8_t weight);
+LWS_EXTERN void
+lws_h2_sched_detach(struct lws *wsi);
+LWS_EXTERN void
+lws_h2_sched_wake(struct lws *wsi);
+LWS_EXTERN struct lws *
+lws_h2_sched_pick(struct lws *nwsi);
+LWS_EXTERN void
+lws_h2_rx_win_release(struct lws *nwsi);
 LWS_EXTERN int
 lws_hdr_extant(struct lws *wsi, enum lws_token_indexes h);
 LWS_EXTERN void
@@ -1,5 +1,6 @@
 #include "core/private.h"
 
+#if !defined(LWS_WITH_ASYNC_DNS)
 static int
 lws_getaddrinfo46(struct lws *wsi, const char *ads, struct addrinfo **result)
 {
@@ -24,188 +25,218 @@ lws_getaddrinfo46(struct lws *wsi, const char *ads, struct addrinfo **result)
 
 	return getaddrinfo(ads, NULL, &hints, result);
 }
-
-struct lws *
-lws_client_connect_2(struct lws *wsi)
-{
-#if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
-	struct lws_context *context = wsi->context;
-	struct lws_context_per_thread *pt = &context->pt[(int)wsi->tsi];
-	const char *adsin;
-	struct lws *wsi_piggyback = NULL;
-	struct lws_pollfd pfd;
-	ssize_t plen = 0;
-#endif
-	struct addrinfo *result;
-#if defined(LWS_WITH_UNIX_SOCK)
-	struct sockaddr_un sau;
-	char unix_skt = 0;
 #endif
-	const char *ads;
-	sockaddr46 sa46;
-	const struct sockaddr *psa;
-	int n, m, port = 0, rawish = 0;
-	const char *cce = "", *iface;
-	const char *meth = NULL;
-#ifdef LWS_WITH_IPV6
-	char ipv6only = lws_check_opt(wsi->vhost->options,
-			LWS_SERVER_OPTION_IPV6_V6ONLY_MODIFY |
-			LWS_SERVER_OPTION_IPV6_V6ONLY_VALUE);
 
-#if defined(__ANDROID__)
-	ipv6only = 0;
-#endif
-#endif
+/*
+ * Report the connection error and get rid of the wsi.  Until it is in the
+ * fds table, we can simply free it.  But once it is, or if others queued
+ * their transactions on it while it was waiting for dns, it has to go
+ * through the whole close flow.
+ */
 
-#if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
-	if (!wsi->http.ah && !wsi->stash) {
-		cce = "ah was NULL at cc2";
-		lwsl_err("%s\n", cce);
-		goto oom4;
+static struct lws *
+lws_client_connect_failed(struct lws *wsi, const char *cce)
+{
+	if (lwsi_role_client(wsi) && !wsi->already_did_cce) {
+		wsi->protocol->callback(wsi,
+			LWS_CALLBACK_CLIENT_CONNECTION_ERROR,
+			wsi->user_space, (void *)cce, strlen(cce));
+		wsi->already_did_cce = 1;
 	}
 
-	/* we can only piggyback GET or POST */
-
-	if (wsi->stash)
-		meth = wsi->stash->method;
-	else
-		meth = lws_hdr_simple_ptr(wsi, _WSI_TOKEN_CLIENT_METHOD);
+	if (wsi->position_in_fds_table != LWS_NO_FDS_POS
+#if !defined(LWS_NO_CLIENT)
+	    || wsi->dll_client_transaction_queue_head.next
+#endif
+	) {
+		lws_close_free_wsi(wsi, LWS_CLOSE_STATUS_NOSTATUS,
+				   "client_connect2");
 
-	if (meth && !strcmp(meth, "RAW"))
-		rawish = 1;
+		return NULL;
+	}
 
-	if (meth && strcmp(meth, "GET") && strcmp(meth, "POST"))
-		goto create_new_conn;
+	/*
+	 * We can't be an active client connection any more, if we thought
+	 * that was what we were going to be doing.  It should be if we are
+	 * failing by this path, we are still called by
+	 * lws_client_connect_via_info() and will be returning NULL to that,
+	 * or we were waiting for dns with nobody queued on us.
+	 */
+	{
+		struct lws_vhost *vhost = wsi->vhost;
 
-	/* we only pipeline connections that said it was okay */
+		lws_vhost_lock(vhost);
+		__lws_free_wsi(wsi);
+		lws_vhost_unlock(vhost);
+	}
 
-	if (!wsi->client_pipeline)
-		goto create_new_conn;
+	return NULL;
+}
 
-	/*
-	 * let's take a look first and see if there are any already-active
-	 * client connections we can piggy-back on.
-	 */
+/*
+ * Decide what it is we need to connect to, given the peer address
+ */
 
-	adsin = lws_hdr_simple_ptr(wsi, _WSI_TOKEN_CLIENT_PEER_ADDRESS);
+static const char *
+lws_client_connect_target(struct lws *wsi, const char *ads, int *port)
+{
+#if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
+	/* Priority 1: connect to http proxy */
 
-	lws_vhost_lock(wsi->vhost); /* ----------------------------------- { */
+	if (wsi->vhost->http.http_proxy_port) {
+		*port = wsi->vhost->http.http_proxy_port;
 
-	lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1,
-				   wsi->vhost->dll_active_client_conns.next) {
-		struct lws *w = lws_container_of(d, struct lws,
-						 dll_active_client_conns);
+		return wsi->vhost->http.http_proxy_address;
+	}
+#endif
+#if defined(LWS_WITH_SOCKS5)
+	/* Priority 2: Connect to SOCK5 Proxy */
 
-		lwsl_debug("%s: check %s %s %d %d\n", __func__, adsin,
-			   w->client_hostname_copy, wsi->c_port, w->c_port);
+	if (wsi->vhost->socks_proxy_port) {
+		*port = wsi->vhost->socks_proxy_port;
 
-		if (w != wsi && w->client_hostname_copy &&
-		    !strcmp(adsin, w->client_hostname_copy) &&
-#if defined(LWS_WITH_TLS)
-		    (wsi->tls.use_ssl & LCCSCF_USE_SSL) ==
-		     (w->tls.use_ssl & LCCSCF_USE_SSL) &&
+		return wsi->vhost->socks_proxy_address;
+	}
 #endif
-		    wsi->c_port == w->c_port) {
 
-			/* someone else is already connected to the right guy */
+	/* Priority 3: Connect directly */
 
-			/* do we know for a fact pipelining won't fly? */
-			if (w->keepalive_rejected) {
-				lwsl_info("defeating pipelining due to no "
-					    "keepalive on server\n");
-				lws_vhost_unlock(wsi->vhost); /* } ---------- */
-				goto create_new_conn;
-			}
-#if defined (LWS_WITH_HTTP2)
-			/*
-			 * h2: in usable state already: just use it without
-			 *     going through the queue
-			 */
-			if (w->client_h2_alpn &&
-			    (lwsi_state(w) == LRS_H2_WAITING_TO_SEND_HEADERS ||
-			     lwsi_state(w) == LRS_ESTABLISHED)) {
+	*port = wsi->c_port;
 
-				lwsl_info("%s: just join h2 directly\n",
-						__func__);
+	return ads;
+}
 
-				wsi->client_h2_alpn = 1;
-				lws_wsi_h2_adopt(w, wsi);
-				lws_vhost_unlock(wsi->vhost); /* } ---------- */
+#if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
+static struct lws *
+lws_client_connect_4(struct lws *wsi, struct lws *wsi_piggyback)
+{
+	struct lws_context *context = wsi->context;
+	const char *cce = "", *meth;
+	struct lws_pollfd pfd;
+	int n, m;
 
-				return wsi;
-			}
-#endif
+	if (wsi_piggyback &&
+	    !lws_dll_is_null(&wsi->dll_client_transaction_queue)) {
+		/*
+		 * We are pipelining on an already-established connection...
+		 * we can skip tls establishment.
+		 */
 
-			lwsl_info("applying %p to txn queue on %p state 0x%x\n",
-				wsi, w, w->wsistate);
-			/*
-			 * ...let's add ourselves to his transaction queue...
-			 * we are adding ourselves at the HEAD
-			 */
-			lws_dll_lws_add_front(&wsi->dll_client_transaction_queue,
-				&w->dll_client_transaction_queue_head);
+		lwsi_set_state(wsi, LRS_H1C_ISSUE_HANDSHAKE2);
 
-			/*
-			 * h1: pipeline our headers out on him,
-			 * and wait for our turn at client transaction_complete
-			 * to take over parsing the rx.
-			 */
+		/*
+		 * we can't send our headers directly, because they have to
+		 * be sent when the parent is writeable.  The parent will check
+		 * for anybody on his client transaction queue that is in
+		 * LRS_H1C_ISSUE_HANDSHAKE2, and let them write.
+		 *
+		 * If we are trying to do this too early, before the master
+		 * connection has written his own headers, then it will just
+		 * wait in the queue until it's possible to send them.
+		 */
+		lws_callback_on_writable(wsi_piggyback);
+		lwsl_info("%s: wsi %p: waiting to send hdrs (par state 0x%x)\n",
+			    __func__, wsi, lwsi_state(wsi_piggyback));
 
-			wsi_piggyback = w;
+		return wsi;
+	}
 
-			lws_vhost_unlock(wsi->vhost); /* } ---------- */
-			goto send_hs;
-		}
+	lwsl_info("%s: wsi %p: client creating own connection\n",
+		    __func__, wsi);
 
-	} lws_end_foreach_dll_safe(d, d1);
+	if (wsi->stash)
+		meth = wsi->stash->method;
+	else
+		meth = lws_hdr_simple_ptr(wsi, _WSI_TOKEN_CLIENT_METHOD);
 
-	lws_vhost_unlock(wsi->vhost); /* } ---------------------------------- */
+	/* we are making our own connection */
+	if (!meth || strcmp(meth, "RAW"))
+		lwsi_set_state(wsi, LRS_H1C_ISSUE_HANDSHAKE);
+	else {
+		/* for a method = "RAW" connection, this makes us
+		 * established */
+
+		/* clear his established timeout */
+		lws_set_timeout(wsi, NO_PENDING_TIMEOUT, 0);
+
+		m = wsi->role_ops->adoption_cb[0];
+		if (m) {
+			n = user_callback_handle_rxflow(
+					wsi->protocol->callback, wsi,
+					m, wsi->user_space, NULL, 0);
+			if (n < 0) {
+				lwsl_info("LWS_CALLBACK_RAW_PROXY_CLI_ADOPT failed\n");
+				goto failed;
+			}
+		}
 
-create_new_conn:
-#endif
+		/* service.c pollout processing wants this */
+		wsi->hdr_parsing_completed = 1;
 
-	/*
-	 * clients who will create their own fresh connection keep a copy of
-	 * the hostname they originally connected to, in case other connections
-	 * want to use it too
-	 */
+		lwsi_set_state(wsi, LRS_ESTABLISHED);
 
-	if (!wsi->client_hostname_copy) {
-		if (wsi->stash)
-			wsi->client_hostname_copy = lws_strdup(
-					wsi->stash->host);
-		else
-			wsi->client_hostname_copy =
-				lws_strdup(lws_hdr_simple_ptr(wsi,
-					_WSI_TOKEN_CLIENT_PEER_ADDRESS));
+		return wsi;
 	}
 
 	/*
-	 * If we made our own connection, and we're doing a method that can take
-	 * a pipeline, we are an "active client connection".
+	 * provoke service to issue the handshake directly.
 	 *
-	 * Add ourselves to the vhost list of those so that others can
-	 * piggyback on our transaction queue
+	 * we need to do it this way because in the proxy case, this is
+	 * the next state and executed only if and when we get a good
+	 * proxy response inside the state machine... but notice in
+	 * SSL case this may not have sent anything yet with 0 return,
+	 * and won't until many retries from main loop.  To stop that
+	 * becoming endless, cover with a timeout.
 	 */
 
-	if (meth && (!strcmp(meth, "GET") || !strcmp(meth, "POST")) &&
-	    lws_dll_is_null(&wsi->dll_client_transaction_queue) &&
-	    lws_dll_is_null(&wsi->dll_active_client_conns)) {
-		lws_vhost_lock(wsi->vhost);
-		/* caution... we will have to unpick this on oom4 path */
-		lws_dll_lws_add_front(&wsi->dll_active_client_conns,
-				      &wsi->vhost->dll_active_client_conns);
-		lws_vhost_unlock(wsi->vhost);
+	lws_set_timeout(wsi, PENDING_TIMEOUT_SENT_CLIENT_HANDSHAKE,
+			AWAITING_TIMEOUT);
+
+	pfd.fd = wsi->desc.sockfd;
+	pfd.events = LWS_POLLIN;
+	pfd.revents = LWS_POLLIN;
+
+	n = lws_service_fd(context, &pfd);
+	if (n < 0) {
+		cce = "first service failed";
+		goto failed;
 	}
+	if (n) /* returns 1 on failure after closing wsi */
+		return NULL;
 
-	/*
-	 * unix socket destination?
-	 */
+	return wsi;
+
+failed:
+	return lws_client_connect_failed(wsi, cce);
+}
+#endif
+
+/*
+ * We know the address to connect to (sa46 is NULL for a unix socket), create
+ * the socket if we didn't already and connect it.  If the connect completes
+ * later, we come back here from lws_client_connect_2() to check it.
+ */
+
+struct lws *
+lws_client_connect_3(struct lws *wsi, sockaddr46 *sa46)
+{
+#if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
+	struct lws_context_per_thread *pt = &wsi->context->pt[(int)wsi->tsi];
+	ssize_t plen = 0;
+#endif
+#if defined(LWS_WITH_UNIX_SOCK)
+	struct sockaddr_un sau;
+	char unix_skt = 0;
+#endif
+	const struct sockaddr *psa;
+	const char *cce = "", *iface, *ads;
+	int n, port = 0;
 
 	if (wsi->stash)
 		ads = wsi->stash->address;
 	else
 		ads = lws_hdr_simple_ptr(wsi, _WSI_TOKEN_CLIENT_PEER_ADDRESS);
+
 #if defined(LWS_WITH_UNIX_SOCK)
 	if (*ads == '+') {
 		ads++;
@@ -220,188 +251,34 @@ create_new_conn:
 			sau.sun_path[0] = '\0';
 
 		unix_skt = 1;
-		goto ads_known;
-	}
+	} else
+#endif
+	{
+		lws_client_connect_target(wsi, ads, &port);
+#if defined(LWS_WITH_ASYNC_DNS)
+		/* keep it for when we come back to complete the connect */
+		if (sa46 != &wsi->sa46_peer)
+			wsi->sa46_peer = *sa46;
 #endif
+	}
 
-	/*
-	 * start off allowing ipv6 on connection if vhost allows it
-	 */
-	wsi->ipv6 = LWS_IPV6_ENABLED(wsi->vhost);
+	/* now we decided on ipv4 or ipv6, set the port */
 
-#if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
+	if (!lws_socket_is_valid(wsi->desc.sockfd)) {
 
-	/* Decide what it is we need to connect to:
-	 *
-	 * Priority 1: connect to http proxy */
+		if (wsi->context->event_loop_ops->check_client_connect_ok &&
+		    wsi->context->event_loop_ops->check_client_connect_ok(wsi)) {
+			cce = "waiting for event loop watcher to close";
+			goto failed;
+		}
 
-	if (wsi->vhost->http.http_proxy_port) {
-		plen = snprintf((char *)pt->serv_buf, 256,
-			"CONNECT %s:%u HTTP/1.0\x0d\x0a"
-			"User-agent: libwebsockets\x0d\x0a",
-			ads, wsi->c_port);
-
-		if (wsi->vhost->proxy_basic_auth_token[0])
-			plen += snprintf((char *)pt->serv_buf + plen, 256,
-					"Proxy-authorization: basic %s\x0d\x0a",
-					wsi->vhost->proxy_basic_auth_token);
-
-		plen += snprintf((char *)pt->serv_buf + plen, 5, "\x0d\x0a");
-		ads = wsi->vhost->http.http_proxy_address;
-		port = wsi->vhost->http.http_proxy_port;
-#else
-		if (0) {
-#endif
-
-#if defined(LWS_WITH_SOCKS5)
-
-	/* Priority 2: Connect to SOCK5 Proxy */
-
-	} else if (wsi->vhost->socks_proxy_port) {
-		socks_generate_msg(wsi, SOCKS_MSG_GREETING, &plen);
-		lwsl_client("Sending SOCKS Greeting\n");
-		ads = wsi->vhost->socks_proxy_address;
-		port = wsi->vhost->socks_proxy_port;
-#endif
-	} else {
-
-		/* Priority 3: Connect directly */
-
-		/* ads already set */
-		port = wsi->c_port;
-	}
-
-	/*
-	 * prepare the actual connection
-	 * to whatever we decided to connect to
-	 */
-
-       lwsl_info("%s: %p: address %s:%u\n", __func__, wsi, ads, port);
-
-       n = lws_getaddrinfo46(wsi, ads, &result);
-
-#ifdef LWS_WITH_IPV6
-	if (wsi->ipv6) {
-		struct sockaddr_in6 *sa6;
-
-		if (n || !result) {
-			/* lws_getaddrinfo46 failed, there is no usable result */
-			lwsl_notice("%s: lws_getaddrinfo46 failed %d\n",
-					__func__, n);
-			cce = "ipv6 lws_getaddrinfo46 failed";
-			goto oom4;
-		}
-
-		sa6 = ((struct sockaddr_in6 *)result->ai_addr);
-
-		memset(&sa46, 0, sizeof(sa46));
-
-		sa46.sa6.sin6_family = AF_INET6;
-		switch (result->ai_family) {
-		case AF_INET:
-			if (ipv6only)
-				break;
-			/* map IPv4 to IPv6 */
-			bzero((char *)&sa46.sa6.sin6_addr,
-						sizeof(sa46.sa6.sin6_addr));
-			sa46.sa6.sin6_addr.s6_addr[10] = 0xff;
-			sa46.sa6.sin6_addr.s6_addr[11] = 0xff;
-			memcpy(&sa46.sa6.sin6_addr.s6_addr[12],
-				&((struct sockaddr_in *)result->ai_addr)->sin_addr,
-							sizeof(struct in_addr));
-			lwsl_notice("uplevelling AF_INET to AF_INET6\n");
-			break;
-
-		case AF_INET6:
-			memcpy(&sa46.sa6.sin6_addr, &sa6->sin6_addr,
-						sizeof(struct in6_addr));
-			sa46.sa6.sin6_scope_id = sa6->sin6_scope_id;
-			sa46.sa6.sin6_flowinfo = sa6->sin6_flowinfo;
-			break;
-		default:
-			lwsl_err("Unknown address family\n");
-			freeaddrinfo(result);
-			cce = "unknown address family";
-			goto oom4;
-		}
-	} else
-#endif /* use ipv6 */
-
-	/* use ipv4 */
-	{
-		void *p = NULL;
-
-		if (!n) {
-			struct addrinfo *res = result;
-
-			/* pick the first AF_INET (IPv4) result */
-
-			while (!p && res) {
-				switch (res->ai_family) {
-				case AF_INET:
-					p = &((struct sockaddr_in *)res->ai_addr)->sin_addr;
-					break;
-				}
-
-				res = res->ai_next;
-			}
-#if defined(LWS_FALLBACK_GETHOSTBYNAME)
-		} else if (n == EAI_SYSTEM) {
-			struct hostent *host;
-
-			lwsl_info("ipv4 getaddrinfo err, try gethostbyname\n");
-			host = gethostbyname(ads);
-			if (host) {
-				p = host->h_addr;
-			} else {
-				lwsl_err("gethostbyname failed\n");
-				cce = "gethostbyname (ipv4) failed";
-				goto oom4;
-			}
-#endif
-		} else {
-			lwsl_err("getaddrinfo failed: %d\n", n);
-			cce = "getaddrinfo failed";
-			goto oom4;
-		}
-
-		if (!p) {
-			if (result)
-				freeaddrinfo(result);
-			lwsl_err("Couldn't identify address\n");
-			cce = "unable to lookup address";
-			goto oom4;
-		}
-
-		sa46.sa4.sin_family = AF_INET;
-		sa46.sa4.sin_addr = *((struct in_addr *)p);
-		bzero(&sa46.sa4.sin_zero, 8);
-	}
-
-	if (result)
-		freeaddrinfo(result);
-
-#if defined(LWS_WITH_UNIX_SOCK)
-ads_known:
-#endif
-
-	/* now we decided on ipv4 or ipv6, set the port */
-
-	if (!lws_socket_is_valid(wsi->desc.sockfd)) {
-
-		if (wsi->context->event_loop_ops->check_client_connect_ok &&
-		    wsi->context->event_loop_ops->check_client_connect_ok(wsi)) {
-			cce = "waiting for event loop watcher to close";
-			goto oom4;
-		}
-
-#if defined(LWS_WITH_UNIX_SOCK)
-		if (unix_skt) {
-			wsi->unix_skt = 1;
-			wsi->desc.sockfd = socket(AF_UNIX, SOCK_STREAM, 0);
-		} else
-#endif
-		{
+#if defined(LWS_WITH_UNIX_SOCK)
+		if (unix_skt) {
+			wsi->unix_skt = 1;
+			wsi->desc.sockfd = socket(AF_UNIX, SOCK_STREAM, 0);
+		} else
+#endif
+		{
 
 #ifdef LWS_WITH_IPV6
 		if (wsi->ipv6)
@@ -414,7 +291,7 @@ ads_known:
 		if (!lws_socket_is_valid(wsi->desc.sockfd)) {
 			lwsl_warn("Unable to open socket\n");
 			cce = "unable to open socket";
-			goto oom4;
+			goto failed;
 		}
 
 		if (lws_plat_set_socket_options(wsi->vhost, wsi->desc.sockfd,
@@ -426,7 +303,7 @@ ads_known:
 			lwsl_err("Failed to set wsi socket options\n");
 			compatible_close(wsi->desc.sockfd);
 			cce = "set socket opts failed";
-			goto oom4;
+			goto failed;
 		}
 
 		lwsi_set_state(wsi, LRS_WAITING_CONNECT);
@@ -435,20 +312,20 @@ ads_known:
 			if (wsi->context->event_loop_ops->accept(wsi)) {
 				compatible_close(wsi->desc.sockfd);
 				cce = "event loop accept failed";
-				goto oom4;
+				goto failed;
 			}
 
 		if (__insert_wsi_socket_into_fds(wsi->context, wsi)) {
 			compatible_close(wsi->desc.sockfd);
 			cce = "insert wsi failed";
-			goto oom4;
+			goto failed;
 		}
 
 		lws_change_pollfd(wsi, 0, LWS_POLLIN);
 
 		/*
 		 * past here, we can't simply free the structs as error
-		 * handling as oom4 does.  We have to run the whole close flow.
+		 * handling, we have to run the whole close flow.
 		 */
 
 		if (!wsi->protocol)
@@ -485,15 +362,15 @@ ads_known:
 	{
 #ifdef LWS_WITH_IPV6
 		if (wsi->ipv6) {
-			sa46.sa6.sin6_port = htons(port);
+			sa46->sa6.sin6_port = htons(port);
 			n = sizeof(struct sockaddr_in6);
-			psa = (const struct sockaddr *)&sa46;
+			psa = (const struct sockaddr *)sa46;
 		} else
 #endif
 		{
-			sa46.sa4.sin_port = htons(port);
+			sa46->sa4.sin_port = htons(port);
 			n = sizeof(struct sockaddr);
-			psa = (const struct sockaddr *)&sa46;
+			psa = (const struct sockaddr *)sa46;
 		}
 	}
 
@@ -541,6 +418,18 @@ ads_known:
 	/* http proxy */
 	if (wsi->vhost->http.http_proxy_port) {
 
+		plen = snprintf((char *)pt->serv_buf, 256,
+			"CONNECT %s:%u HTTP/1.0\x0d\x0a"
+			"User-agent: libwebsockets\x0d\x0a",
+			ads, wsi->c_port);
+
+		if (wsi->vhost->proxy_basic_auth_token[0])
+			plen += snprintf((char *)pt->serv_buf + plen, 256,
+					"Proxy-authorization: basic %s\x0d\x0a",
+					wsi->vhost->proxy_basic_auth_token);
+
+		plen += snprintf((char *)pt->serv_buf + plen, 5, "\x0d\x0a");
+
 		/*
 		 * OK from now on we talk via the proxy, so connect to that
 		 *
@@ -579,6 +468,9 @@ ads_known:
 #if defined(LWS_WITH_SOCKS5)
 	/* socks proxy */
 	else if (wsi->vhost->socks_proxy_port) {
+		socks_generate_msg(wsi, SOCKS_MSG_GREETING, &plen);
+		lwsl_client("Sending SOCKS Greeting\n");
+
 		n = send(wsi->desc.sockfd, (char *)pt->serv_buf, plen,
 			 MSG_NOSIGNAL);
 		if (n < 0) {
@@ -597,129 +489,347 @@ ads_known:
 	}
 #endif
 #if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
-send_hs:
+	return lws_client_connect_4(wsi, NULL);
+#else
+	return wsi;
+#endif
 
-	if (wsi_piggyback &&
-	    !lws_dll_is_null(&wsi->dll_client_transaction_queue)) {
-		/*
-		 * We are pipelining on an already-established connection...
-		 * we can skip tls establishment.
-		 */
+failed:
+	return lws_client_connect_failed(wsi, cce);
+}
 
-		lwsi_set_state(wsi, LRS_H1C_ISSUE_HANDSHAKE2);
+struct lws *
+lws_client_connect_2(struct lws *wsi)
+{
+#if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
+	const char *adsin;
+#endif
+#if !defined(LWS_WITH_ASYNC_DNS)
+	struct addrinfo *result;
+	int n;
+#endif
+	const char *ads;
+	sockaddr46 sa46;
+	int port = 0;
+	const char *cce = "";
+	const char *meth = NULL;
+#if defined(LWS_WITH_IPV6) && !defined(LWS_WITH_ASYNC_DNS)
+	char ipv6only = lws_check_opt(wsi->vhost->options,
+			LWS_SERVER_OPTION_IPV6_V6ONLY_MODIFY |
+			LWS_SERVER_OPTION_IPV6_V6ONLY_VALUE);
 
-		/*
-		 * we can't send our headers directly, because they have to
-		 * be sent when the parent is writeable.  The parent will check
-		 * for anybody on his client transaction queue that is in
-		 * LRS_H1C_ISSUE_HANDSHAKE2, and let them write.
-		 *
-		 * If we are trying to do this too early, before the master
-		 * connection has written his own headers, then it will just
-		 * wait in the queue until it's possible to send them.
-		 */
-		lws_callback_on_writable(wsi_piggyback);
-		lwsl_info("%s: wsi %p: waiting to send hdrs (par state 0x%x)\n",
-			    __func__, wsi, lwsi_state(wsi_piggyback));
-	} else {
-		lwsl_info("%s: wsi %p: client creating own connection\n",
-			    __func__, wsi);
-
-		/* we are making our own connection */
-		if (!rawish)
-			lwsi_set_state(wsi, LRS_H1C_ISSUE_HANDSHAKE);
-		else {
-			/* for a method = "RAW" connection, this makes us
-			 * established */
-
-			/* clear his established timeout */
-			lws_set_timeout(wsi, NO_PENDING_TIMEOUT, 0);
-
-			m = wsi->role_ops->adoption_cb[0];
-			if (m) {
-				n = user_callback_handle_rxflow(
-						wsi->protocol->callback, wsi,
-						m, wsi->user_space, NULL, 0);
-				if (n < 0) {
-					lwsl_info("LWS_CALLBACK_RAW_PROXY_CLI_ADOPT failed\n");
-					goto failed;
-				}
+#if defined(__ANDROID__)
+	ipv6only = 0;
+#endif
+#endif
+
+#if defined(LWS_WITH_ASYNC_DNS)
+	/*
+	 * We are coming back to complete a nonblocking connect... we already
+	 * have the address we are connecting to, don't look it up again
+	 */
+	if (lws_socket_is_valid(wsi->desc.sockfd) &&
+	    lwsi_state(wsi) == LRS_WAITING_CONNECT)
+		return lws_client_connect_3(wsi, &wsi->sa46_peer);
+#endif
+
+#if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
+	if (!wsi->http.ah && !wsi->stash) {
+		cce = "ah was NULL at cc2";
+		lwsl_err("%s\n", cce);
+		goto oom4;
+	}
+
+	/* we can only piggyback GET or POST */
+
+	if (wsi->stash)
+		meth = wsi->stash->method;
+	else
+		meth = lws_hdr_simple_ptr(wsi, _WSI_TOKEN_CLIENT_METHOD);
+
+	if (meth && strcmp(meth, "GET") && strcmp(meth, "POST"))
+		goto create_new_conn;
+
+	/* we only pipeline connections that said it was okay */
+
+	if (!wsi->client_pipeline)
+		goto create_new_conn;
+
+	/*
+	 * let's take a look first and see if there are any already-active
+	 * client connections we can piggy-back on.
+	 */
+
+	adsin = lws_hdr_simple_ptr(wsi, _WSI_TOKEN_CLIENT_PEER_ADDRESS);
+
+	lws_vhost_lock(wsi->vhost); /* ----------------------------------- { */
+
+	lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1,
+				   wsi->vhost->dll_active_client_conns.next) {
+		struct lws *w = lws_container_of(d, struct lws,
+						 dll_active_client_conns);
+
+		lwsl_debug("%s: check %s %s %d %d\n", __func__, adsin,
+			   w->client_hostname_copy, wsi->c_port, w->c_port);
+
+		if (w != wsi && w->client_hostname_copy &&
+		    !strcmp(adsin, w->client_hostname_copy) &&
+#if defined(LWS_WITH_TLS)
+		    (wsi->tls.use_ssl & LCCSCF_USE_SSL) ==
+		     (w->tls.use_ssl & LCCSCF_USE_SSL) &&
+#endif
+		    wsi->c_port == w->c_port) {
+
+			/* someone else is already connected to the right guy */
+
+			/* do we know for a fact pipelining won't fly? */
+			if (w->keepalive_rejected) {
+				lwsl_info("defeating pipelining due to no "
+					    "keepalive on server\n");
+				lws_vhost_unlock(wsi->vhost); /* } ---------- */
+				goto create_new_conn;
 			}
+#if defined (LWS_WITH_HTTP2)
+			/*
+			 * h2: in usable state already: just use it without
+			 *     going through the queue
+			 */
+			if (w->client_h2_alpn &&
+			    (lwsi_state(w) == LRS_H2_WAITING_TO_SEND_HEADERS ||
+			     lwsi_state(w) == LRS_ESTABLISHED)) {
 
-			/* service.c pollout processing wants this */
-			wsi->hdr_parsing_completed = 1;
+				lwsl_info("%s: just join h2 directly\n",
+						__func__);
 
-			lwsi_set_state(wsi, LRS_ESTABLISHED);
+				wsi->client_h2_alpn = 1;
+				lws_wsi_h2_adopt(w, wsi);
+				lws_vhost_unlock(wsi->vhost); /* } ---------- */
 
-			return wsi;
-		}
+				return wsi;
+			}
+#endif
 
-		/*
-		 * provoke service to issue the handshake directly.
-		 *
-		 * we need to do it this way because in the proxy case, this is
-		 * the next state and executed only if and when we get a good
-		 * proxy response inside the state machine... but notice in
-		 * SSL case this may not have sent anything yet with 0 return,
-		 * and won't until many retries from main loop.  To stop that
-		 * becoming endless, cover with a timeout.
-		 */
+			lwsl_info("applying %p to txn queue on %p state 0x%x\n",
+				wsi, w, w->wsistate);
+			/*
+			 * ...let's add ourselves to his transaction queue...
+			 * we are adding ourselves at the HEAD
+			 */
+			lws_dll_lws_add_front(&wsi->dll_client_transaction_queue,
+				&w->dll_client_transaction_queue_head);
 
-		lws_set_timeout(wsi, PENDING_TIMEOUT_SENT_CLIENT_HANDSHAKE,
-				AWAITING_TIMEOUT);
+			lws_vhost_unlock(wsi->vhost); /* } ---------- */
 
-		pfd.fd = wsi->desc.sockfd;
-		pfd.events = LWS_POLLIN;
-		pfd.revents = LWS_POLLIN;
+			/*
+			 * h1: pipeline our headers out on him,
+			 * and wait for our turn at client transaction_complete
+			 * to take over parsing the rx.
+			 */
 
-		n = lws_service_fd(context, &pfd);
-		if (n < 0) {
-			cce = "first service failed";
-			goto failed;
+			return lws_client_connect_4(wsi, w);
 		}
-		if (n) /* returns 1 on failure after closing wsi */
-			return NULL;
-	}
+
+	} lws_end_foreach_dll_safe(d, d1);
+
+	lws_vhost_unlock(wsi->vhost); /* } ---------------------------------- */
+
+create_new_conn:
 #endif
-	return wsi;
 
-oom4:
-	if (lwsi_role_client(wsi) /* && lwsi_state_est(wsi) */) {
-		wsi->protocol->callback(wsi,
-			LWS_CALLBACK_CLIENT_CONNECTION_ERROR,
-			wsi->user_space, (void *)cce, strlen(cce));
-		wsi->already_did_cce = 1;
+	/*
+	 * clients who will create their own fresh connection keep a copy of
+	 * the hostname they originally connected to, in case other connections
+	 * want to use it too
+	 */
+
+	if (!wsi->client_hostname_copy) {
+		if (wsi->stash)
+			wsi->client_hostname_copy = lws_strdup(
+					wsi->stash->host);
+		else
+			wsi->client_hostname_copy =
+				lws_strdup(lws_hdr_simple_ptr(wsi,
+					_WSI_TOKEN_CLIENT_PEER_ADDRESS));
 	}
-	/* take care that we might be inserted in fds already */
-	if (wsi->position_in_fds_table != LWS_NO_FDS_POS)
-		goto failed1;
 
 	/*
-	 * We can't be an active client connection any more, if we thought
-	 * that was what we were going to be doing.  It should be if we are
-	 * failing by oom4 path, we are still called by
-	 * lws_client_connect_via_info() and will be returning NULL to that,
-	 * so nobody else should have had a chance to queue on us.
+	 * If we made our own connection, and we're doing a method that can take
+	 * a pipeline, we are an "active client connection".
+	 *
+	 * Add ourselves to the vhost list of those so that others can
+	 * piggyback on our transaction queue
+	 */
+
+	if (meth && (!strcmp(meth, "GET") || !strcmp(meth, "POST")) &&
+	    lws_dll_is_null(&wsi->dll_client_transaction_queue) &&
+	    lws_dll_is_null(&wsi->dll_active_client_conns)) {
+		lws_vhost_lock(wsi->vhost);
+		/* caution... we will have to unpick this on oom4 path */
+		lws_dll_lws_add_front(&wsi->dll_active_client_conns,
+				      &wsi->vhost->dll_active_client_conns);
+		lws_vhost_unlock(wsi->vhost);
+	}
+
+	/*
+	 * unix socket destination?
+	 */
+
+	if (wsi->stash)
+		ads = wsi->stash->address;
+	else
+		ads = lws_hdr_simple_ptr(wsi, _WSI_TOKEN_CLIENT_PEER_ADDRESS);
+#if defined(LWS_WITH_UNIX_SOCK)
+	if (*ads == '+')
+		return lws_client_connect_3(wsi, NULL);
+#endif
+
+	/*
+	 * start off allowing ipv6 on connection if vhost allows it
+	 */
+	wsi->ipv6 = LWS_IPV6_ENABLED(wsi->vhost);
+
+	ads = lws_client_connect_target(wsi, ads, &port);
+
+	/*
+	 * prepare the actual connection
+	 * to whatever we decided to connect to
 	 */
+
+	lwsl_info("%s: %p: address %s:%u\n", __func__, wsi, ads, port);
+
+#if defined(LWS_WITH_ASYNC_DNS)
+	switch (lws_async_dns_query(wsi, ads, &sa46)) {
+	case LADNS_RESOLVED:
+		break;
+
+	case LADNS_QUEUED:
+		/*
+		 * The event loop continues us at lws_client_connect_3() when
+		 * the answer comes.  Until then, a timeout or close reports a
+		 * connection error like a connect() that never completed.
+		 */
+		if (!wsi->protocol)
+			wsi->protocol = &wsi->vhost->protocols[0];
+		lwsi_set_state(wsi, LRS_WAITING_CONNECT);
+		lws_set_timeout(wsi, PENDING_TIMEOUT_AWAITING_CONNECT_RESPONSE,
+				AWAITING_TIMEOUT);
+
+		return wsi;
+
+	default:
+		lwsl_notice("%s: unable to resolve %s\n", __func__, ads);
+		cce = "async dns lookup failed";
+		goto oom4;
+	}
+#else
+	n = lws_getaddrinfo46(wsi, ads, &result);
+
+#ifdef LWS_WITH_IPV6
+	if (wsi->ipv6) {
+		struct sockaddr_in6 *sa6;
+
+		if (n || !result) {
+			/* lws_getaddrinfo46 failed, there is no usable result */
+			lwsl_notice("%s: lws_getaddrinfo46 failed %d\n",
+					__func__, n);
+			cce = "ipv6 lws_getaddrinfo46 failed";
+			goto oom4;
+		}
+
+		sa6 = ((struct sockaddr_in6 *)result->ai_addr);
+
+		memset(&sa46, 0, sizeof(sa46));
+
+		sa46.sa6.sin6_family = AF_INET6;
+		switch (result->ai_family) {
+		case AF_INET:
+			if (ipv6only)
+				break;
+			/* map IPv4 to IPv6 */
+			bzero((char *)&sa46.sa6.sin6_addr,
+						sizeof(sa46.sa6.sin6_addr));
+			sa46.sa6.sin6_addr.s6_addr[10] = 0xff;
+			sa46.sa6.sin6_addr.s6_addr[11] = 0xff;
+			memcpy(&sa46.sa6.sin6_addr.s6_addr[12],
+				&((struct sockaddr_in *)result->ai_addr)->sin_addr,
+							sizeof(struct in_addr));
+			lwsl_notice("uplevelling AF_INET to AF_INET6\n");
+			break;
+
+		case AF_INET6:
+			memcpy(&sa46.sa6.sin6_addr, &sa6->sin6_addr,
+						sizeof(struct in6_addr));
+			sa46.sa6.sin6_scope_id = sa6->sin6_scope_id;
+			sa46.sa6.sin6_flowinfo = sa6->sin6_flowinfo;
+			break;
+		default:
+			lwsl_err("Unknown address family\n");
+			freeaddrinfo(result);
+			cce = "unknown address family";
+			goto oom4;
+		}
+	} else
+#endif /* use ipv6 */
+
+	/* use ipv4 */
 	{
-		struct lws_vhost *vhost = wsi->vhost;
+		void *p = NULL;
 
-		lws_vhost_lock(vhost);
-		__lws_free_wsi(wsi);
-		lws_vhost_unlock(vhost);
+		if (!n) {
+			struct addrinfo *res = result;
+
+			/* pick the first AF_INET (IPv4) result */
+
+			while (!p && res) {
+				switch (res->ai_family) {
+				case AF_INET:
+					p = &((struct sockaddr_in *)res->ai_addr)->sin_addr;
+					break;
+				}
+
+				res = res->ai_next;
+			}
+#if defined(LWS_FALLBACK_GETHOSTBYNAME)
+		} else if (n == EAI_SYSTEM) {
+			struct hostent *host;
+
+			lwsl_info("ipv4 getaddrinfo err, try gethostbyname\n");
+			host = gethostbyname(ads);
+			if (host) {
+				p = host->h_addr;
+			} else {
+				lwsl_err("gethostbyname failed\n");
+				cce = "gethostbyname (ipv4) failed";
+				goto oom4;
+			}
+#endif
+		} else {
+			lwsl_err("getaddrinfo failed: %d\n", n);
+			cce = "getaddrinfo failed";
+			goto oom4;
+		}
+
+		if (!p) {
+			if (result)
+				freeaddrinfo(result);
+			lwsl_err("Couldn't identify address\n");
+			cce = "unable to lookup address";
+			goto oom4;
+		}
+
+		sa46.sa4.sin_family = AF_INET;
+		sa46.sa4.sin_addr = *((struct in_addr *)p);
+		bzero(&sa46.sa4.sin_zero, 8);
 	}
 
-	return NULL;
+	if (result)
+		freeaddrinfo(result);
+#endif
 
-failed:
-	wsi->protocol->callback(wsi,
-		LWS_CALLBACK_CLIENT_CONNECTION_ERROR,
-		wsi->user_space, (void *)cce, strlen(cce));
-	wsi->already_did_cce = 1;
-failed1:
-	lws_close_free_wsi(wsi, LWS_CLOSE_STATUS_NOSTATUS, "client_connect2");
+	return lws_client_connect_3(wsi, &sa46);
 
-	return NULL;
+oom4:
+	return lws_client_connect_failed(wsi, cce);
 }
 
 #if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
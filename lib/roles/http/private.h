@@ -179,9 +179,61 @@ struct lws_peer_role_http {
 	uint32_t total_ah;
 };
 
+/*
+ * The vhost mount list compiled into a char trie keyed by mountpoint, so
+ * lws_find_mount() collects every mount that prefixes the uri in one walk
+ * along the uri, rather than comparing the uri against each mount in turn
+ */
+
+struct lws_mount_trie_node {
+	int32_t child;		/* first child node index, or 0 */
+	int32_t sibling;	/* next child of the same parent, or 0 */
+	int32_t mounts;		/* first ref with its mountpoint ending here */
+	char c;
+};
+
+struct lws_mount_trie_ref {
+	const struct lws_http_mount *m;
+	int32_t next;		/* next ref ending at the same node, or -1 */
+	int32_t seq;		/* index of m in the vhost mount_list */
+};
+
+struct lws_mount_trie {
+	struct lws_mount_trie_node *node;	/* node[0] is the root */
+	struct lws_mount_trie_ref *ref;
+	int count_nodes;
+	int count_refs;
+};
+
+/* more candidates than this along one uri, lws_find_mount() goes linear */
+#define LWS_MOUNT_TRIE_MAX_CANDIDATES 16
+
+/*
+ * Builtin and per-mount extra mimetypes hashed by file suffix, so serving a
+ * file costs one lookup per '.' in its name.  Each mount's extra mimetypes
+ * are keyed by the extra_mimetypes list they came from, mounts sharing a
+ * list share its entries and the builtins are under a NULL list.
+ */
+
+struct lws_mimetype_ent {
+	struct lws_mimetype_ent *next;
+	const struct lws_protocol_vhost_options *extra;
+	const char *suffix;
+	const char *mimetype;
+	uint32_t hash;
+	int len;
+};
+
+struct lws_mimetype_index {
+	struct lws_mimetype_ent **bucket;
+	int count_buckets;
+};
+
 struct lws_vhost_role_http {
 	char http_proxy_address[128];
 	const struct lws_http_mount *mount_list;
+	struct lws_mount_trie *mount_trie;
+	struct lws_mimetype_index *mimetypes;
 	const char *error_document_404;
 	unsigned int http_proxy_port;
 };
@@ -198,6 +250,8 @@ struct lws_access_log {
 
 #define LWS_HTTP_CHUNK_HDR_MAX_SIZE (6 + 2) /* 6 hex digits and then CRLF */
 #define LWS_HTTP_CHUNK_TRL_MAX_SIZE (2 + 5) /* CRLF, then maybe 0 CRLF CRLF */
+/* largest file fragment we ask sendfile() to send in one go */
+#define LWS_SENDFILE_MAX_CHUNK (1024 * 1024)
 
 struct _lws_http_mode_related {
 	struct lws *new_wsi_list;
@@ -118,6 +118,10 @@ static const char * const paths_vhosts[] = {
 	"vhosts[].allow-non-tls",
 	"vhosts[].redirect-http",
 	"vhosts[].allow-http-on-https",
+	"vhosts[].ssl-session-cache-size",
+	"vhosts[].ssl-session-timeout",
+	"vhosts[].ssl-ticket-key-file",
+	"vhosts[].ssl-ticket-key-reload-secs",
 };
 
 enum lejp_vhost_paths {
@@ -182,6 +186,10 @@ enum lejp_vhost_paths {
 	LEJPVP_FLAG_ALLOW_NON_TLS,
 	LEJPVP_FLAG_REDIRECT_HTTP,
 	LEJPVP_FLAG_ALLOW_HTTP_ON_HTTPS,
+	LEJPVP_SSL_SESSION_CACHE_SIZE,
+	LEJPVP_SSL_SESSION_TIMEOUT,
+	LEJPVP_SSL_TICKET_KEY_FILE,
+	LEJPVP_SSL_TICKET_KEY_RELOAD_SECS,
 };
 
 static const char * const parser_errs[] = {
@@ -379,7 +387,8 @@ lejp_vhosts_cb(struct lejp_ctx *ctx, char reason)
 			LWS_SERVER_OPTION_EXPLICIT_VHOSTS |
 			LWS_SERVER_OPTION_UV_NO_SIGSEGV_SIGFPE_SPIN |
 			LWS_SERVER_OPTION_LIBEVENT |
-			LWS_SERVER_OPTION_LIBEV
+			LWS_SERVER_OPTION_LIBEV |
+			LWS_SERVER_OPTION_EPOLL
 				);
 		ss = a->info->server_string;
 		i[2] = a->info->ws_ping_pong_interval;
@@ -670,6 +679,11 @@ lejp_vhosts_cb(struct lejp_ctx *ctx, char reason)
 	case LEJPVP_ECDH_CURVE:
 		a->info->ecdh_curve = a->p;
 		break;
+
+	case LEJPVP_SSL_TICKET_KEY_FILE:
+		a->info->ssl_ticket_key_filepath = a->p;
+		break;
+
 	case LEJPVP_PMO:
 	case LEJPVP_CGI_ENV:
 		mp_cgienv = lwsws_align(a);
@@ -793,6 +807,16 @@ lejp_vhosts_cb(struct lejp_ctx *ctx, char reason)
 	case LEJPVP_SSL_OPTION_CLEAR:
 		a->info->ssl_options_clear |= atol(ctx->buf);
 		return 0;
+	case LEJPVP_SSL_SESSION_CACHE_SIZE:
+		a->info->ssl_session_cache_size = atoi(ctx->buf);
+		return 0;
+	case LEJPVP_SSL_SESSION_TIMEOUT:
+		a->info->ssl_session_timeout = (unsigned int)atoi(ctx->buf);
+		return 0;
+	case LEJPVP_SSL_TICKET_KEY_RELOAD_SECS:
+		a->info->ssl_ticket_key_reload_secs =
+						(unsigned int)atoi(ctx->buf);
+		return 0;
 
 	case LEJPVP_SSL_CLIENT_OPTION_SET:
 		a->info->ssl_client_options_set |= atol(ctx->buf);
@@ -888,7 +888,7 @@ lws_parse(struct lws *wsi, unsigned char *buf, int *len)
 					break;
 			if (m == LWS_ARRAY_SIZE(methods))
 				/* it was not any of the methods */
-				goto check_eol;
+				goto value;
 
 			/* special URI processing... end at space */
 
@@ -936,6 +936,37 @@ lws_parse(struct lws *wsi, unsigned char *buf, int *len)
 			default:
 				return LPR_FAIL;
 			}
+			goto check_eol;
+
+value:
+			/*
+			 * Header values (other than the method URI, which needs
+			 * urldecoding) don't need looking at bytewise: find the
+			 * CR, or the end of what we have so far, and copy the run
+			 * in one go.  If the run would meet the ah or token limit,
+			 * or contains a NUL, leave it to the bytewise code below.
+			 */
+			if (c != '\x0d' && ah->parser_state != WSI_TOKEN_CHALLENGE &&
+			    *len) {
+				unsigned char *cr = memchr(buf, '\x0d', (size_t)*len);
+				unsigned int run = 1 + (unsigned int)(cr ?
+						   lws_ptr_diff(cr, buf) : *len);
+
+				if (ah->pos + run <
+				       (unsigned int)context->max_http_header_data &&
+				    (!ah->current_token_limit ||
+				     ah->frags[ah->nfrag].len + run <=
+						     ah->current_token_limit) &&
+				    !memchr(buf - 1, '\0', run)) {
+					memcpy(ah->data + ah->pos, buf - 1, run);
+					ah->pos += run;
+					ah->frags[ah->nfrag].len += run;
+					buf += run - 1;
+					*len -= run - 1;
+					break;
+				}
+			}
+
 check_eol:
 			/* bail at EOL */
 			if (ah->parser_state != WSI_TOKEN_CHALLENGE &&
@@ -1128,8 +1159,19 @@ excessive:
 		case WSI_TOKEN_SKIPPING:
 			lwsl_parser("WSI_TOKEN_SKIPPING '%c'\n", c);
 
-			if (c == '\x0d')
+			if (c == '\x0d') {
 				ah->parser_state = WSI_TOKEN_SKIPPING_SAW_CR;
+				break;
+			}
+
+			/* skip directly to the next CR, or the end of the buf */
+			if (*len) {
+				unsigned char *cr = memchr(buf, '\x0d', (size_t)*len);
+
+				n = cr ? lws_ptr_diff(cr, buf) : *len;
+				buf += n;
+				*len -= n;
+			}
 			break;
 
 		case WSI_TOKEN_SKIPPING_SAW_CR:
@@ -316,6 +316,145 @@ bail:
 	return -1;
 }
 
+static uint32_t
+lws_vhost_index_hash(int port, const char *name, int len)
+{
+	uint32_t h = 2166136261u ^ (uint32_t)port; /* FNV-1a */
+
+	while (len--) {
+		h ^= (uint8_t)*name++;
+		h *= 16777619u;
+	}
+
+	return h;
+}
+
+static struct lws_vhost_index *
+lws_vhost_index_build(struct lws_context *context)
+{
+	struct lws_vhost_index_name *ents;
+	struct lws_vhost_index *vi;
+	struct lws_vhost *vh;
+	int n = 0, nb = 16, m, b;
+
+	lws_start_foreach_ll(struct lws_vhost *, v, context->vhost_list) {
+		n++;
+	} lws_end_foreach_ll(v, vhost_next);
+
+	while (nb < n * 2)
+		nb <<= 1;
+
+	/* one allocation: index, buckets, names, worst-case ports */
+
+	vi = lws_zalloc(sizeof(*vi) + (sizeof(vi->bucket[0]) * (unsigned int)nb) +
+			((sizeof(*ents) + sizeof(vi->ports[0])) * (unsigned int)n),
+			"vhost index");
+	if (!vi)
+		return NULL;
+
+	vi->bucket = (struct lws_vhost_index_name **)&vi[1];
+	ents = (struct lws_vhost_index_name *)&vi->bucket[nb];
+	vi->ports = (struct lws_vhost_index_port *)&ents[n];
+	vi->count_buckets = nb;
+
+	vh = context->vhost_list;
+	for (m = 0; m < n; m++, vh = vh->vhost_next) {
+		ents[m].vh = vh;
+		ents[m].seq = m;
+		ents[m].len = (int)strlen(vh->name);
+		ents[m].hash = lws_vhost_index_hash(vh->listen_port, vh->name,
+						    ents[m].len);
+		b = (int)(ents[m].hash & (uint32_t)(nb - 1));
+		ents[m].next = vi->bucket[b];
+		vi->bucket[b] = &ents[m];
+
+		for (b = 0; b < vi->count_ports; b++)
+			if (vi->ports[b].port == vh->listen_port)
+				break;
+		if (b == vi->count_ports) {
+			vi->ports[b].port = vh->listen_port;
+			vi->ports[b].first = vh;
+			vi->count_ports++;
+		}
+	}
+
+	lwsl_info("%s: %d vhosts, %d ports, %d buckets\n", __func__, n,
+		  vi->count_ports, nb);
+
+	return vi;
+}
+
+/* the earliest vhost in vhost_list called exactly name on port, if any */
+
+static struct lws_vhost_index_name *
+lws_vhost_index_lookup(struct lws_vhost_index *vi, int port, const char *name,
+		       int len)
+{
+	uint32_t h = lws_vhost_index_hash(port, name, len);
+	struct lws_vhost_index_name *e, *best = NULL;
+
+	for (e = vi->bucket[h & (uint32_t)(vi->count_buckets - 1)]; e;
+	     e = e->next)
+		if (e->hash == h && e->len == len &&
+		    e->vh->listen_port == port &&
+		    !strncmp(e->vh->name, name, (unsigned int)len) &&
+		    (!best || e->seq < best->seq))
+			best = e;
+
+	return best;
+}
+
+static struct lws_vhost *
+lws_select_vhost_index(struct lws_vhost_index *vi, int port,
+		       const char *servername, int colon)
+{
+	struct lws_vhost_index_name *e, *best;
+	int n;
+
+	/* Priority 1: exact match (an empty name takes the first on the port) */
+
+	e = colon ? lws_vhost_index_lookup(vi, port, servername, colon) : NULL;
+	if (e) {
+		lwsl_info("SNI: Found: %s\n", servername);
+		return e->vh;
+	}
+
+	/*
+	 * Priority 2: a vhost named for a suffix of servername following a
+	 * '.', ie, x.com matches a.x.com or a.b.x.com.  Probe each suffix,
+	 * choosing the earliest vhost in vhost_list as the linear walk would.
+	 */
+
+	if (port) {
+		best = NULL;
+		for (n = 1; n < colon; n++)
+			if (servername[n] == '.') {
+				e = lws_vhost_index_lookup(vi, port,
+						&servername[n + 1], colon - n - 1);
+				if (e && (!best || e->seq < best->seq))
+					best = e;
+			}
+		if (best) {
+			lwsl_info("SNI: Found %s on wildcard: %s\n",
+				    servername, best->vh->name);
+			return best->vh;
+		}
+	}
+
+	/* Priority 3: the first vhost on our port */
+
+	for (n = 0; n < vi->count_ports; n++)
+		if ((port || !colon) && vi->ports[n].port == port) {
+			lwsl_info("%s: vhost match to %s based on port %d\n",
+				  __func__, vi->ports[n].first->name, port);
+			return vi->ports[n].first;
+		}
+
+	/* no match */
+
+	return NULL;
+}
+
 struct lws_vhost *
 lws_select_vhost(struct lws_context *context, int port, const char *servername)
 {
@@ -329,6 +468,23 @@ lws_select_vhost(struct lws_context *context, int port, const char *servername)
 	if (p)
 		colon = lws_ptr_diff(p, servername);
 
+	lws_context_lock(context, __func__); /* ------------- context { */
+
+	if (!context->vhost_index)
+		context->vhost_index = lws_vhost_index_build(context);
+
+	if (context->vhost_index) {
+		vhost = lws_select_vhost_index(context->vhost_index, port,
+					       servername, colon);
+		lws_context_unlock(context); /* ------------- } context */
+
+		return vhost;
+	}
+
+	lws_context_unlock(context); /* --------------------- } context */
+
+	/* couldn't allocate the index, do it the slow way */
+
 	/* Priotity 1: first try exact matches */
 
 	while (vhost) {
@@ -378,75 +534,285 @@ lws_select_vhost(struct lws_context *context, int port, const char *servername)
 	return NULL;
 }
 
-LWS_VISIBLE LWS_EXTERN const char *
-lws_get_mimetype(const char *file, const struct lws_http_mount *m)
+static const struct lws_protocol_vhost_options builtin_mimetypes[] = {
+	{ NULL, NULL, ".ico",	"image/x-icon" },
+	{ NULL, NULL, ".gif",	"image/gif" },
+	{ NULL, NULL, ".js",	"text/javascript" },
+	{ NULL, NULL, ".png",	"image/png" },
+	{ NULL, NULL, ".jpg",	"image/jpeg" },
+	{ NULL, NULL, ".gz",	"application/gzip" },
+	{ NULL, NULL, ".html",	"text/html" },
+	{ NULL, NULL, ".css",	"text/css" },
+	{ NULL, NULL, ".txt",	"text/plain" },
+	{ NULL, NULL, ".svg",	"image/svg+xml" },
+	{ NULL, NULL, ".ttf",	"application/x-font-ttf" },
+	{ NULL, NULL, ".otf",	"application/font-woff" },
+	{ NULL, NULL, ".woff",	"application/font-woff" },
+	{ NULL, NULL, ".xml",	"application/xml" },
+};
+
+static char
+lws_mimetype_lc(char c)
 {
-	const struct lws_protocol_vhost_options *pvo = NULL;
-	int n = (int)strlen(file);
+	if (c >= 'A' && c <= 'Z')
+		return (char)(c + ('a' - 'A'));
 
-	if (m)
-		pvo = m->extra_mimetypes;
+	return c;
+}
 
-	if (n < 5)
-		return NULL;
+static int
+lws_mimetype_suffix_eq(const char *a, const char *b, int len)
+{
+	while (len--)
+		if (lws_mimetype_lc(*a++) != lws_mimetype_lc(*b++))
+			return 0;
 
-	if (!strcmp(&file[n - 4], ".ico"))
-		return "image/x-icon";
+	return 1;
+}
 
-	if (!strcmp(&file[n - 4], ".gif"))
-		return "image/gif";
+static uint32_t
+lws_mimetype_hash(const struct lws_protocol_vhost_options *extra,
+		  const char *suffix, int len)
+{
+	uint32_t h = 2166136261u ^ (uint32_t)(lws_intptr_t)extra; /* FNV-1a */
 
-	if (!strcmp(&file[n - 3], ".js"))
-		return "text/javascript";
+	while (len--) {
+		h ^= (uint8_t)lws_mimetype_lc(*suffix++);
+		h *= 16777619u;
+	}
 
-	if (!strcmp(&file[n - 4], ".png"))
-		return "image/png";
+	return h;
+}
 
-	if (!strcmp(&file[n - 4], ".jpg"))
-		return "image/jpeg";
+static const char *
+lws_mimetype_lookup_linear(const struct lws_protocol_vhost_options *extra,
+			   const char *suffix, int len)
+{
+	const struct lws_protocol_vhost_options *pvo;
+	int n;
+
+	for (n = 0; n < (int)LWS_ARRAY_SIZE(builtin_mimetypes); n++)
+		if ((int)strlen(builtin_mimetypes[n].name) == len &&
+		    lws_mimetype_suffix_eq(builtin_mimetypes[n].name,
+					   suffix, len))
+			return builtin_mimetypes[n].value;
+
+	for (pvo = extra; pvo; pvo = pvo->next)
+		if ((int)strlen(pvo->name) == len &&
+		    lws_mimetype_suffix_eq(pvo->name, suffix, len))
+			return pvo->value;
+
+	return NULL;
+}
 
-	if (!strcmp(&file[n - 3], ".gz"))
-		return "application/gzip";
+static const char *
+lws_mimetype_lookup_index(struct lws_mimetype_index *mi,
+			  const struct lws_protocol_vhost_options *extra,
+			  const char *suffix, int len)
+{
+	uint32_t h = lws_mimetype_hash(extra, suffix, len);
+	struct lws_mimetype_ent *e;
 
-	if (!strcmp(&file[n - 4], ".JPG"))
-		return "image/jpeg";
+	for (e = mi->bucket[h & (uint32_t)(mi->count_buckets - 1)]; e;
+	     e = e->next)
+		if (e->hash == h && e->extra == extra && e->len == len &&
+		    lws_mimetype_suffix_eq(e->suffix, suffix, len))
+			return e->mimetype;
 
-	if (!strcmp(&file[n - 5], ".html"))
-		return "text/html";
+	return NULL;
+}
 
-	if (!strcmp(&file[n - 4], ".css"))
-		return "text/css";
+/*
+ * Each '.'-suffix of the filename, longest first, is looked up in the
+ * builtins and then the mount's extra mimetypes, case-insensitively.  If
+ * none match, an extra mimetype whose name starts with '*' matches anything.
+ */
 
-	if (!strcmp(&file[n - 4], ".txt"))
-		return "text/plain";
+static const char *
+lws_mimetype_find(struct lws_mimetype_index *mi, const char *file,
+		  const struct lws_protocol_vhost_options *extra)
+{
+	const char *base = strrchr(file, '/'), *dot, *end, *mt;
+	const struct lws_protocol_vhost_options *pvo;
+	int len;
 
-	if (!strcmp(&file[n - 4], ".svg"))
-		return "image/svg+xml";
+	end = file + strlen(file);
+	dot = strchr(base ? base + 1 : file, '.');
 
-	if (!strcmp(&file[n - 4], ".ttf"))
-		return "application/x-font-ttf";
+	while (dot) {
+		len = lws_ptr_diff(end, dot);
 
-	if (!strcmp(&file[n - 4], ".otf"))
-		return "application/font-woff";
+		if (mi) {
+			mt = lws_mimetype_lookup_index(mi, NULL, dot, len);
+			if (!mt && extra)
+				mt = lws_mimetype_lookup_index(mi, extra,
+							       dot, len);
+		} else
+			mt = lws_mimetype_lookup_linear(extra, dot, len);
+		if (mt)
+			return mt;
 
-	if (!strcmp(&file[n - 5], ".woff"))
-		return "application/font-woff";
+		dot = strchr(dot + 1, '.');
+	}
 
-	if (!strcmp(&file[n - 4], ".xml"))
-		return "application/xml";
+	if (mi)
+		return lws_mimetype_lookup_index(mi, extra, "*", 1);
 
-	while (pvo) {
+	for (pvo = extra; pvo; pvo = pvo->next)
 		if (pvo->name[0] == '*') /* ie, match anything */
 			return pvo->value;
 
-		if (!strcmp(&file[n - strlen(pvo->name)], pvo->name))
-			return pvo->value;
+	return NULL;
+}
 
-		pvo = pvo->next;
+static int
+lws_mimetype_ptr_cmp(const void *a, const void *b)
+{
+	const void *pa = *(const void * const *)a, *pb = *(const void * const *)b;
+
+	return pa < pb ? -1 : pa > pb;
+}
+
+static void
+lws_mimetype_index_add(struct lws_mimetype_index *mi,
+		       struct lws_mimetype_ent *e,
+		       const struct lws_protocol_vhost_options *extra,
+		       const char *suffix, const char *mimetype)
+{
+	uint32_t b;
+
+	e->extra = extra;
+	e->suffix = suffix;
+	e->mimetype = mimetype;
+	e->len = (int)strlen(suffix);
+	e->hash = lws_mimetype_hash(extra, suffix, e->len);
+
+	b = e->hash & (uint32_t)(mi->count_buckets - 1);
+	e->next = mi->bucket[b];
+	mi->bucket[b] = e;
+}
+
+int
+lws_mimetype_index_build(struct lws_vhost *vh)
+{
+	const struct lws_protocol_vhost_options **lists = NULL, *pvo;
+	const struct lws_http_mount *hm;
+	struct lws_mimetype_index *mi;
+	struct lws_mimetype_ent *e;
+	int n, m, count_lists = 0, ents = (int)LWS_ARRAY_SIZE(builtin_mimetypes),
+	    nb = 16;
+
+	lws_free_set_NULL(vh->http.mimetypes);
+
+	if (!vh->http.mount_list)
+		return 0;
+
+	/* the distinct extra mimetype lists used by the vhost's mounts */
+
+	for (hm = vh->http.mount_list; hm; hm = hm->mount_next)
+		count_lists++;
+
+	if (count_lists) {
+		lists = lws_malloc(sizeof(*lists) * (unsigned int)count_lists,
+				   "mimetype lists");
+		if (!lists)
+			return 1;
 	}
 
-	return NULL;
+	n = 0;
+	for (hm = vh->http.mount_list; hm; hm = hm->mount_next)
+		if (hm->extra_mimetypes)
+			lists[n++] = hm->extra_mimetypes;
+
+	if (n)
+		qsort(lists, (unsigned int)n, sizeof(*lists),
+		      lws_mimetype_ptr_cmp);
+
+	count_lists = 0;
+	for (m = 0; m < n; m++)
+		if (!m || lists[m] != lists[m - 1]) {
+			lists[count_lists++] = lists[m];
+			for (pvo = lists[m]; pvo; pvo = pvo->next)
+				ents++;
+		}
+
+	while (nb < ents * 2)
+		nb <<= 1;
+
+	/* one allocation: index, buckets, worst-case entries */
+
+	mi = lws_zalloc(sizeof(*mi) + (sizeof(mi->bucket[0]) * (unsigned int)nb) +
+			(sizeof(*e) * (unsigned int)ents), "mimetype index");
+	if (!mi) {
+		lws_free(lists);
+		return 1;
+	}
+
+	mi->bucket = (struct lws_mimetype_ent **)&mi[1];
+	mi->count_buckets = nb;
+	e = (struct lws_mimetype_ent *)&mi->bucket[nb];
+
+	for (n = 0; n < (int)LWS_ARRAY_SIZE(builtin_mimetypes); n++)
+		lws_mimetype_index_add(mi, e++, NULL,
+				       builtin_mimetypes[n].name,
+				       builtin_mimetypes[n].value);
+
+	/*
+	 * The builtins win over an extra with the same suffix, and the first
+	 * extra with a given suffix wins over any later one in its list
+	 */
+
+	for (m = 0; m < count_lists; m++)
+		for (pvo = lists[m]; pvo; pvo = pvo->next) {
+			/* as before, any name starting with '*' is the wildcard */
+			if (pvo->name[0] == '*') {
+				if (lws_mimetype_lookup_index(mi, lists[m],
+							      "*", 1))
+					continue;
+				lws_mimetype_index_add(mi, e++, lists[m], "*",
+						       pvo->value);
+				continue;
+			}
+
+			if (pvo->name[0] != '.')
+				lwsl_notice("%s: mimetype suffix %s should "
+					    "start with '.'\n", __func__,
+					    pvo->name);
+
+			n = (int)strlen(pvo->name);
+			if (lws_mimetype_lookup_index(mi, NULL, pvo->name, n) ||
+			    lws_mimetype_lookup_index(mi, lists[m],
+						      pvo->name, n))
+				continue;
+
+			lws_mimetype_index_add(mi, e++, lists[m], pvo->name,
+					       pvo->value);
+		}
+
+	lws_free(lists);
+
+	lwsl_info("%s: %s: %d mimetypes, %d buckets\n", __func__, vh->name,
+		  (int)(e - (struct lws_mimetype_ent *)&mi->bucket[nb]), nb);
+
+	vh->http.mimetypes = mi;
+
+	return 0;
 }
+
+const char *
+lws_vhost_get_mimetype(struct lws_vhost *vh, const char *file,
+		       const struct lws_http_mount *m)
+{
+	return lws_mimetype_find(vh->http.mimetypes, file,
+				 m ? m->extra_mimetypes : NULL);
+}
+
+LWS_VISIBLE LWS_EXTERN const char *
+lws_get_mimetype(const char *file, const struct lws_http_mount *m)
+{
+	return lws_mimetype_find(NULL, file, m ? m->extra_mimetypes : NULL);
+}
+
 static lws_fop_flags_t
 lws_vfs_prepare_flags(struct lws *wsi)
 {
@@ -660,7 +1026,7 @@ lws_http_serve(struct lws *wsi, char *uri, const char *origin,
 		return -1;
 #endif
 
-	mimetype = lws_get_mimetype(path, m);
+	mimetype = lws_vhost_get_mimetype(wsi->vhost, path, m);
 	if (!mimetype) {
 		lwsl_info("unknown mimetype for %s\n", path);
 		if (lws_return_http_status(wsi,
@@ -729,8 +1095,23 @@ notfound:
 }
 
 #if defined(LWS_ROLE_H1) || defined(LWS_ROLE_H2)
-const struct lws_http_mount *
-lws_find_mount(struct lws *wsi, const char *uri_ptr, int uri_len)
+/*
+ * Whether the mount can serve a uri it prefixes, and if so whether it takes
+ * over from the best hit so far.  Callback mounts always take over; others
+ * only if their mountpoint is longer, so the earliest of equal length wins.
+ */
+
+static int
+lws_mount_accepts(const struct lws_http_mount *hm, int headers, int best)
+{
+	return hm->origin_protocol == LWSMPRO_CALLBACK ||
+	       ((hm->origin_protocol == LWSMPRO_CGI || headers ||
+		 hm->protocol) && hm->mountpoint_len > best);
+}
+
+static const struct lws_http_mount *
+lws_find_mount_linear(struct lws *wsi, const char *uri_ptr, int uri_len,
+		      int headers)
 {
 	const struct lws_http_mount *hm, *hit = NULL;
 	int best = 0;
@@ -741,25 +1122,154 @@ lws_find_mount(struct lws *wsi, const char *uri_ptr, int uri_len)
 		    !strncmp(uri_ptr, hm->mountpoint, hm->mountpoint_len) &&
 		    (uri_ptr[hm->mountpoint_len] == '\0' ||
 		     uri_ptr[hm->mountpoint_len] == '/' ||
-		     hm->mountpoint_len == 1)
-		    ) {
-			if (hm->origin_protocol == LWSMPRO_CALLBACK ||
-			    ((hm->origin_protocol == LWSMPRO_CGI ||
-			     lws_hdr_total_length(wsi, WSI_TOKEN_GET_URI) ||
-			     (wsi->http2_substream &&
-				lws_hdr_total_length(wsi,
-						WSI_TOKEN_HTTP_COLON_PATH)) ||
-			     hm->protocol) &&
-			    hm->mountpoint_len > best)) {
-				best = hm->mountpoint_len;
-				hit = hm;
-			}
+		     hm->mountpoint_len == 1) &&
+		    lws_mount_accepts(hm, headers, best)) {
+			best = hm->mountpoint_len;
+			hit = hm;
 		}
 		hm = hm->mount_next;
 	}
 
 	return hit;
 }
+
+int
+lws_mount_trie_build(struct lws_vhost *vh)
+{
+	const struct lws_http_mount *hm;
+	struct lws_mount_trie_node *nd;
+	struct lws_mount_trie *mt;
+	int32_t *pr, cur, c;
+	int nodes = 1, refs = 0, n;
+
+	lws_free_set_NULL(vh->http.mount_trie);
+
+	for (hm = vh->http.mount_list; hm; hm = hm->mount_next) {
+		nodes += hm->mountpoint_len;
+		refs++;
+	}
+
+	if (!refs)
+		return 0;
+
+	/* one allocation: trie, worst-case nodes, one ref per mount */
+
+	mt = lws_zalloc(sizeof(*mt) + (sizeof(*nd) * (unsigned int)nodes) +
+			(sizeof(mt->ref[0]) * (unsigned int)refs),
+			"mount trie");
+	if (!mt)
+		return 1;
+
+	mt->node = (struct lws_mount_trie_node *)&mt[1];
+	mt->ref = (struct lws_mount_trie_ref *)&mt->node[nodes];
+	mt->node[0].mounts = -1;
+	mt->count_nodes = 1;
+
+	for (hm = vh->http.mount_list; hm; hm = hm->mount_next) {
+		cur = 0;
+		for (n = 0; n < hm->mountpoint_len; n++) {
+			/* strncmp() in the linear match stops at a NUL */
+			if (!hm->mountpoint[n])
+				break;
+
+			for (c = mt->node[cur].child; c; c = mt->node[c].sibling)
+				if (mt->node[c].c == hm->mountpoint[n])
+					break;
+			if (!c) {
+				c = mt->count_nodes++;
+				nd = &mt->node[c];
+				nd->c = hm->mountpoint[n];
+				nd->mounts = -1;
+				nd->sibling = mt->node[cur].child;
+				mt->node[cur].child = c;
+			}
+			cur = c;
+		}
+
+		if (n != hm->mountpoint_len) {
+			/* the uri would need a NUL inside it; never matches */
+			lwsl_notice("%s: mountpoint_len %d too long for %s\n",
+				    __func__, hm->mountpoint_len,
+				    hm->mountpoint);
+			continue;
+		}
+
+		/* keep the refs ending at each node in mount_list order */
+
+		mt->ref[mt->count_refs].m = hm;
+		mt->ref[mt->count_refs].seq = mt->count_refs;
+		mt->ref[mt->count_refs].next = -1;
+		pr = &mt->node[cur].mounts;
+		while (*pr >= 0)
+			pr = &mt->ref[*pr].next;
+		*pr = mt->count_refs++;
+	}
+
+	lwsl_info("%s: %s: %d mounts, %d trie nodes\n", __func__, vh->name,
+		  mt->count_refs, mt->count_nodes);
+
+	vh->http.mount_trie = mt;
+
+	return 0;
+}
+
+const struct lws_http_mount *
+lws_find_mount(struct lws *wsi, const char *uri_ptr, int uri_len)
+{
+	struct lws_mount_trie *mt = wsi->vhost->http.mount_trie;
+	const struct lws_http_mount *hit = NULL;
+	int32_t cand[LWS_MOUNT_TRIE_MAX_CANDIDATES], cur = 0, r, c;
+	int headers, count = 0, best = 0, n, m;
+
+	headers = lws_hdr_total_length(wsi, WSI_TOKEN_GET_URI) ||
+		  (wsi->http2_substream &&
+		   lws_hdr_total_length(wsi, WSI_TOKEN_HTTP_COLON_PATH));
+
+	if (!mt)
+		return lws_find_mount_linear(wsi, uri_ptr, uri_len, headers);
+
+	/*
+	 * Walk the uri down the trie collecting, in mount_list order, every
+	 * mount whose mountpoint is a prefix of the uri ending at a path
+	 * boundary (or is one char long), just like the linear match
+	 */
+
+	for (n = 0; ; n++) {
+		if (mt->node[cur].mounts >= 0 &&
+		    (uri_ptr[n] == '\0' || uri_ptr[n] == '/' || n == 1))
+			for (r = mt->node[cur].mounts; r >= 0;
+			     r = mt->ref[r].next) {
+				if (count == LWS_MOUNT_TRIE_MAX_CANDIDATES)
+					return lws_find_mount_linear(wsi,
+						uri_ptr, uri_len, headers);
+				m = count++;
+				while (m && mt->ref[cand[m - 1]].seq >
+					    mt->ref[r].seq) {
+					cand[m] = cand[m - 1];
+					m--;
+				}
+				cand[m] = r;
+			}
+
+		if (n == uri_len)
+			break;
+
+		for (c = mt->node[cur].child; c; c = mt->node[c].sibling)
+			if (mt->node[c].c == uri_ptr[n])
+				break;
+		if (!c)
+			break;
+		cur = c;
+	}
+
+	for (n = 0; n < count; n++)
+		if (lws_mount_accepts(mt->ref[cand[n]].m, headers, best)) {
+			hit = mt->ref[cand[n]].m;
+			best = hit->mountpoint_len;
+		}
+
+	return hit;
+}
 #endif
 
 #if !defined(LWS_WITH_ESP32)
@@ -1965,7 +2475,9 @@ upgrade_h2c:
 			return 1;
 		}
 
-		lwsi_set_state(wsi, LRS_H2_AWAIT_PREFACE);
+		/* what comes next is the h2 preface, so h2 must handle rx */
+		lws_role_transition(wsi, LWSIFR_SERVER, LRS_H2_AWAIT_PREFACE,
+				    &role_ops_h2);
 		wsi->upgraded_to_http2 = 1;
 
 		return 0;
@@ -2426,10 +2938,31 @@ LWS_VISIBLE int lws_serve_http_file_fragment(struct lws *wsi)
 #if defined(LWS_WITH_RANGES)
 	unsigned char finished = 0;
 #endif
-	int n, m;
+	int n, m, zc = 0;
 
 	lwsl_debug("wsi->http2_substream %d\n", wsi->http2_substream);
 
+#if defined(LWS_HAVE_SYS_SENDFILE_H)
+	/*
+	 * If it's plaintext h1 from a real file via the platform fops, and
+	 * nothing needs to see or change the payload on the way out, we can
+	 * have the kernel send it straight from the file to the socket
+	 */
+	zc = !wsi->http2_substream && !wsi->role_ops->tx_credit &&
+#if defined(LWS_WITH_TLS)
+	     !wsi->tls.use_ssl &&
+#endif
+#if defined(LWS_WITH_HTTP_STREAM_COMPRESSION)
+	     !wsi->http.lcs &&
+#endif
+#if defined(LWS_WITH_RANGES)
+	     wsi->http.range.count_ranges < 2 &&
+#endif
+	     !wsi->sending_chunked && !wsi->interpreting &&
+	     wsi->http.fop_fd &&
+	     wsi->http.fop_fd->fops->LWS_FOP_READ == _lws_plat_file_read;
+#endif
+
 	do {
 
 		/* priority 1: buffered output */
@@ -2510,6 +3043,13 @@ LWS_VISIBLE int lws_serve_http_file_fragment(struct lws *wsi)
 		poss = context->pt_serv_buf_size - n -
 				LWS_H2_FRAME_HEADER_LENGTH;
 
+		if (zc) {
+			/* no buffer involved, so only the file limits us */
+			poss = wsi->http.filelen - wsi->http.filepos;
+			if (poss > LWS_SENDFILE_MAX_CHUNK)
+				poss = LWS_SENDFILE_MAX_CHUNK;
+		}
+
 		if (wsi->http.tx_content_length)
 			if (poss > wsi->http.tx_content_remain)
 				poss = wsi->http.tx_content_remain;
@@ -2539,6 +3079,21 @@ LWS_VISIBLE int lws_serve_http_file_fragment(struct lws *wsi)
 			 */
 		}
 
+#if defined(LWS_ROLE_H2)
+		/*
+		 * On h2, only send one frame's worth each turn, however much
+		 * window we have: more just holds up the other streams until
+		 * the scheduler can get back to them
+		 */
+		if (wsi->http2_substream) {
+			struct lws *nwsi = lws_get_network_wsi(wsi);
+
+			if (nwsi->h2.h2n && poss >
+				    nwsi->h2.h2n->set.s[H2SET_MAX_FRAME_SIZE])
+				poss = nwsi->h2.h2n->set.s[H2SET_MAX_FRAME_SIZE];
+		}
+#endif
+
 #if defined(LWS_WITH_RANGES)
 		if (wsi->http.range.count_ranges) {
 			if (wsi->http.range.count_ranges > 1)
@@ -2554,13 +3109,32 @@ LWS_VISIBLE int lws_serve_http_file_fragment(struct lws *wsi)
 			poss -= 10 + 128;
 		}
 
-		if (lws_vfs_file_read(wsi->http.fop_fd, &amount, p, poss) < 0)
-			goto file_had_it; /* caller will close */
-
-		if (wsi->sending_chunked)
+#if defined(LWS_HAVE_SYS_SENDFILE_H)
+		if (zc) {
+			if (lws_plat_file_sendfile(wsi->http.fop_fd,
+						   wsi->desc.sockfd, &amount,
+						   poss) < 0) {
+				wsi->socket_is_permanently_unusable = 1;
+				goto file_had_it;
+			}
+			lws_stats_atomic_bump(context, pt, LWSSTATS_B_WRITE,
+					      amount);
+#ifdef LWS_WITH_ACCESS_LOG
+			wsi->http.access_log.sent += amount;
+#endif
 			n = (int)amount;
-		else
-			n = lws_ptr_diff(p, pstart) + (int)amount;
+		} else
+#endif
+		{
+			if (lws_vfs_file_read(wsi->http.fop_fd, &amount, p,
+					      poss) < 0)
+				goto file_had_it; /* caller will close */
+
+			if (wsi->sending_chunked)
+				n = (int)amount;
+			else
+				n = lws_ptr_diff(p, pstart) + (int)amount;
+		}
 
 		lwsl_debug("%s: sending %d\n", __func__, n);
 
@@ -2568,6 +3142,12 @@ LWS_VISIBLE int lws_serve_http_file_fragment(struct lws *wsi)
 			lws_set_timeout(wsi, PENDING_TIMEOUT_HTTP_CONTENT,
 					context->timeout_secs);
 
+			if (zc) {
+				/* the kernel already sent it all */
+				m = n;
+				goto sent;
+			}
+
 			if (wsi->interpreting) {
 				args.p = (char *)p;
 				args.len = n;
@@ -2601,7 +3181,7 @@ LWS_VISIBLE int lws_serve_http_file_fragment(struct lws *wsi)
 					 LWS_WRITE_HTTP_FINAL : LWS_WRITE_HTTP);
 			if (m < 0)
 				goto file_had_it;
-
+sent:
 			wsi->http.filepos += amount;
 
 #if defined(LWS_WITH_RANGES)
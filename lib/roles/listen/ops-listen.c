@@ -28,7 +28,7 @@ rops_handle_POLLIN_listen(struct lws_context_per_thread *pt, struct lws *wsi,
 	struct lws_context *context = wsi->context;
 	lws_sockfd_type accept_fd = LWS_SOCK_INVALID;
 	lws_sock_file_fd_type fd;
-	int opts = LWS_ADOPT_SOCKET | LWS_ADOPT_ALLOW_SSL;
+	int opts = LWS_ADOPT_SOCKET | LWS_ADOPT_ALLOW_SSL, tsi;
 	struct sockaddr_storage cli_addr;
 	socklen_t clilen;
 
@@ -127,9 +127,20 @@ rops_handle_POLLIN_listen(struct lws_context_per_thread *pt, struct lws *wsi,
 		else
 			opts = LWS_ADOPT_SOCKET;
 
+		/*
+		 * If each pt has its own listen socket, the kernel already
+		 * balanced the accepts across the pts.  Keep the new
+		 * connection on our pt if we can, so it goes into our own
+		 * fds table without involving any other service thread.
+		 */
+		tsi = -1;
+		if (context->listen_accept_own_pt &&
+		    pt->fds_count < context->fd_limit_per_thread - 1)
+			tsi = wsi->tsi;
+
 		fd.sockfd = accept_fd;
-		cwsi = lws_adopt_descriptor_vhost(wsi->vhost, opts, fd,
-						  NULL, NULL);
+		cwsi = lws_adopt_descriptor_vhost_tsi(wsi->vhost, opts, fd,
+						      NULL, NULL, tsi);
 		if (!cwsi) {
 			lwsl_err("%s: lws_adopt_descriptor_vhost failed\n",
 					__func__);
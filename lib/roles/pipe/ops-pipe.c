@@ -51,6 +51,15 @@ rops_handle_POLLIN_pipe(struct lws_context_per_thread *pt, struct lws *wsi,
 	lws_threadpool_tsi_context(pt->context, pt->tid);
 #endif
 
+#if defined(LWS_ROLE_WS)
+	/*
+	 * lws_ws_broadcast() on any thread queues the work it can't do for
+	 * our wsi itself, asking for POLLOUT or closing slow readers, and
+	 * cancels our service so we do it here
+	 */
+	lws_ws_bcast_service_pt(pt);
+#endif
+
 	/*
 	 * the poll() wait, or the event loop for libuv etc is a
 	 * process-wide resource that we interrupted.  So let every
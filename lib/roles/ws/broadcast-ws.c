@@ -0,0 +1,535 @@
+/*
+ * libwebsockets - small server side websockets and web server implementation
+ *
+ * Copyright (C) 2010-2019 Andy Green <andy@warmcat.com>
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation:
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include "core/private.h"
+
+/*
+ * Broadcast
+ *
+ * lws_ws_broadcast() copies the message once, into a struct lws_ws_bcast
+ * holding it as a complete unmasked frame, and appends that to a list kept
+ * per vhost protocol.  Each ws connection on the protocol has a cursor into
+ * the list, the next broadcast it has to send and how much of that it sent
+ * already, and each broadcast has a count of the connections still to send
+ * it.
+ *
+ * A connection that had nothing pending gets the new broadcast as its
+ * cursor, the others will reach it by following ->next.  So the connections
+ * still to send any broadcast also still have to send all the later ones,
+ * and broadcasts can only finish from the head of the list.
+ *
+ * Server connections without active extensions send straight from the
+ * shared frame, on a plain socket several pending frames at a time.  Clients
+ * have to mask, and h2 and extensions have their own framing, so those
+ * connections copy the payload and lws_write() it.
+ *
+ * So one connection that isn't reading pins everything broadcast after the
+ * point it got to.  The frames queued on a list are limited to the vhost's
+ * ws_bcast_max_queued bytes, if a new broadcast goes over that, the
+ * connections that are still to send the oldest one are closed, and so on
+ * until it's back under the limit.  Dropping frames instead would leave the
+ * reader silently missing messages, or part of a frame.
+ *
+ * The lists and the cursors are protected by the vhost lock.
+ *
+ * The connections on the protocol may belong to any of the service threads,
+ * and only a connection's own thread may change its POLLOUT or set its
+ * timeout, both of which take that pt's lock.  Its thread also sends from
+ * the frames without holding the vhost lock, so only it may move its cursor
+ * on or drop it, the broadcaster only sets a NULL cursor to a new frame.  We mustn't take a pt lock
+ * while holding the vhost lock, so the broadcaster only adds the connection
+ * to the vhost's bcast_kick list for its pt, and after dropping the vhost
+ * lock, marks the pt as kicked and wakes it with its cancel pipe.  The pt
+ * then asks for POLLOUT, or drops the cursor of an evicted connection and
+ * sets its timeout, itself.
+ */
+
+static void
+__lws_ws_bcast_trim(struct lws_ws_bcast_list *l)
+{
+	struct lws_ws_bcast *b;
+
+	while (l->head && !l->head->refcount) {
+		b = l->head;
+		l->head = b->next;
+		if (!l->head)
+			l->tail = NULL;
+		l->queued -= b->hdr_len + b->len;
+		lws_free(b);
+	}
+}
+
+/*
+ * Ask for POLLOUT on the wsi's behalf.  If nothing else had asked for it
+ * already, remember it's only for broadcasts, so we can turn it off again
+ * when they're sent instead of the user getting a WRITEABLE they didn't ask
+ * for.  ws over h2 asks its network wsi, so we leave those alone.
+ *
+ * Only called from the wsi's own service thread.
+ */
+
+static void
+lws_ws_bcast_want_pollout(struct lws *wsi)
+{
+	struct lws_context_per_thread *pt = &wsi->context->pt[(int)wsi->tsi];
+	char only = 0;
+
+	if (!wsi->http2_substream && !wsi->h2_stream_carries_ws &&
+	    wsi->position_in_fds_table != LWS_NO_FDS_POS)
+		only = wsi->ws->bcast_pollout ||
+		       !(pt->fds[wsi->position_in_fds_table].events &
+			 LWS_POLLOUT);
+
+	lws_callback_on_writable(wsi);
+	wsi->ws->bcast_pollout = only;
+}
+
+/*
+ * Queue the wsi for its own pt to look at, and note the pt needs waking.
+ * Caller holds the vhost lock.
+ */
+
+static void
+__lws_ws_bcast_kick(struct lws *wsi, char *kick)
+{
+	if (lws_dll_is_null(&wsi->dll_bcast_kick))
+		lws_dll_lws_add_front(&wsi->dll_bcast_kick,
+				      &wsi->vhost->ws.bcast_kick[(int)wsi->tsi]);
+
+	kick[(int)wsi->tsi] = 1;
+}
+
+/*
+ * The list is over its limit.  Mark the connections that are holding up
+ * its oldest broadcasts to be closed, until what's left after theirs is
+ * back under the limit.  Their pts drop their cursors, so the frames are
+ * only freed then.  Caller holds the vhost lock.
+ */
+
+static void
+__lws_ws_bcast_evict(struct lws_vhost *vh, int n, struct lws_ws_bcast_list *l,
+		     char *kick)
+{
+	struct lws_ws_bcast *f = l->head;
+	size_t queued = l->queued;
+
+	while (f && f != l->tail && queued > vh->ws.bcast_max_queued) {
+
+		lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1,
+					   vh->same_vh_protocol_heads[n].next) {
+			struct lws *wsi = lws_container_of(d, struct lws,
+							   same_vh_protocol);
+
+			if (lwsi_role_ws(wsi) && wsi->ws &&
+			    wsi->ws->bcast == f && !wsi->ws->bcast_evicted) {
+				lwsl_notice("%s: wsi %p too slow for "
+					    "broadcasts\n", __func__, wsi);
+				wsi->ws->bcast_evicted = 1;
+				__lws_ws_bcast_kick(wsi, kick);
+			}
+
+		} lws_end_foreach_dll_safe(d, d1);
+
+		queued -= f->hdr_len + f->len;
+		f = f->next;
+	}
+}
+
+LWS_VISIBLE int
+lws_ws_broadcast(struct lws_vhost *vh, const struct lws_protocols *prot,
+		 const void *buf, size_t len, enum lws_write_protocol wp)
+{
+	uint8_t hdr[LWS_WS_BCAST_HDR_MAX], *p;
+	struct lws_context_per_thread *pt;
+	char kick[LWS_MAX_SMP];
+	struct lws_ws_bcast_list *l;
+	struct lws_ws_bcast *b;
+	int n, m, count;
+
+	if (prot < vh->protocols ||
+	    prot >= (vh->protocols + vh->count_protocols) ||
+	    (wp != LWS_WRITE_TEXT && wp != LWS_WRITE_BINARY)) {
+		lwsl_err("%s: protocol %p not on vhost %s, or wp 0x%x\n",
+			 __func__, prot, vh->name, wp);
+
+		return -1;
+	}
+
+	n = (int)(prot - vh->protocols);
+
+	b = lws_malloc(sizeof(*b) + LWS_WS_BCAST_HDR_MAX + len, "ws bcast");
+	if (!b)
+		return -1;
+
+	b->next = NULL;
+	b->len = len;
+	b->refcount = 0;
+	b->wp = (uint8_t)wp;
+
+	hdr[0] = 0x80 | (wp == LWS_WRITE_TEXT ? LWSWSOPC_TEXT_FRAME :
+						LWSWSOPC_BINARY_FRAME);
+	if (len < 126) {
+		hdr[1] = (uint8_t)len;
+		b->hdr_len = 2;
+	} else
+		if (len < 65536) {
+			hdr[1] = 126;
+			hdr[2] = (uint8_t)(len >> 8);
+			hdr[3] = (uint8_t)len;
+			b->hdr_len = 4;
+		} else {
+			hdr[1] = 127;
+			for (m = 0; m < 8; m++)
+				hdr[2 + m] = (uint8_t)((uint64_t)len >>
+						       (56 - (8 * m)));
+			b->hdr_len = 10;
+		}
+
+	p = lws_ws_bcast_payload(b);
+	memcpy(p - b->hdr_len, hdr, b->hdr_len);
+	memcpy(p, buf, len);
+
+	memset(kick, 0, sizeof(kick));
+
+	lws_vhost_lock(vh);
+
+	if (!vh->ws.bcast) {
+		vh->ws.bcast = lws_zalloc(sizeof(*vh->ws.bcast) *
+					  vh->count_protocols, "ws bcast lists");
+		if (!vh->ws.bcast) {
+			lws_vhost_unlock(vh);
+			lws_free(b);
+
+			return -1;
+		}
+	}
+	l = &vh->ws.bcast[n];
+	b->owner = l;
+
+	lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1,
+				   vh->same_vh_protocol_heads[n].next) {
+		struct lws *wsi = lws_container_of(d, struct lws,
+						   same_vh_protocol);
+
+		if (lwsi_role_ws(wsi) && wsi->ws && !wsi->ws->bcast_evicted &&
+		    lwsi_state(wsi) == LRS_ESTABLISHED) {
+			b->refcount++;
+			if (!wsi->ws->bcast) {
+				wsi->ws->bcast = b;
+				wsi->ws->bcast_ofs = 0;
+			}
+			__lws_ws_bcast_kick(wsi, kick);
+		}
+
+	} lws_end_foreach_dll_safe(d, d1);
+
+	count = b->refcount;
+	if (count) {
+		if (l->tail)
+			l->tail->next = b;
+		else
+			l->head = b;
+		l->tail = b;
+		l->queued += b->hdr_len + b->len;
+
+		/* the new one alone may be over the limit, it's allowed */
+		if (l->queued > vh->ws.bcast_max_queued)
+			__lws_ws_bcast_evict(vh, n, l, kick);
+	} else
+		lws_free(b);
+
+	lws_vhost_unlock(vh);
+
+	/* the pts do the rest themselves, see lws_ws_bcast_service_pt() */
+	for (n = 0; n < vh->context->count_threads; n++) {
+		if (!kick[n])
+			continue;
+
+		pt = &vh->context->pt[n];
+		lws_pt_lock(pt, __func__);
+		pt->ws.bcast_kicked = 1;
+		lws_pt_unlock(pt);
+
+		if (pt->pipe_wsi)
+			lws_plat_pipe_signal(pt->pipe_wsi);
+	}
+
+	return count;
+}
+
+/*
+ * Called on the pt's own service thread when its cancel pipe was signalled,
+ * to ask for POLLOUT for the pt's connections with new broadcasts, or drop
+ * the broadcasts of the ones that were evicted and set the timeout to close
+ * them.
+ *
+ * We take each wsi off the kick list under the vhost lock, and deal with it
+ * after dropping it... only this pt can close the wsi, so it's still there.
+ */
+
+void
+lws_ws_bcast_service_pt(struct lws_context_per_thread *pt)
+{
+	struct lws_vhost *vh;
+	struct lws *wsi;
+	char kicked, evicted, pending;
+
+	lws_pt_lock(pt, __func__);
+	kicked = pt->ws.bcast_kicked;
+	pt->ws.bcast_kicked = 0;
+	lws_pt_unlock(pt);
+
+	if (!kicked)
+		return;
+
+	for (vh = pt->context->vhost_list; vh; vh = vh->vhost_next) {
+		for (;;) {
+			lws_vhost_lock(vh);
+			if (!vh->ws.bcast_kick[pt->tid].next) {
+				lws_vhost_unlock(vh);
+				break;
+			}
+			wsi = lws_container_of(vh->ws.bcast_kick[pt->tid].next,
+					       struct lws, dll_bcast_kick);
+			lws_dll_lws_remove(&wsi->dll_bcast_kick);
+			evicted = (char)wsi->ws->bcast_evicted;
+			if (evicted)
+				__lws_ws_bcast_detach(wsi);
+			pending = !!wsi->ws->bcast;
+			lws_vhost_unlock(vh);
+
+			if (evicted)
+				lws_set_timeout(wsi, PENDING_TIMEOUT_LAGGING,
+						LWS_TO_KILL_ASYNC);
+			else
+				if (pending) /* else it sent them already */
+					lws_ws_bcast_want_pollout(wsi);
+		}
+	}
+}
+
+/*
+ * We sent amount more of the wsi's broadcasts, retire the ones it finished
+ */
+
+static void
+lws_ws_bcast_sent(struct lws *wsi, size_t amount)
+{
+	struct lws_ws_bcast_list *l;
+	struct lws_ws_bcast *b;
+	size_t left;
+
+	if (amount)
+		lws_restart_ws_ping_pong_timer(wsi);
+
+	lws_vhost_lock(wsi->vhost);
+
+	b = wsi->ws->bcast;
+	if (!b) {
+		/* it was detached meanwhile, there's nothing to account */
+		lws_vhost_unlock(wsi->vhost);
+
+		return;
+	}
+	l = b->owner;
+
+	while (b && amount) {
+		left = b->hdr_len + b->len - wsi->ws->bcast_ofs;
+		if (amount < left) {
+			wsi->ws->bcast_ofs += amount;
+			break;
+		}
+		amount -= left;
+		b->refcount--;
+		b = b->next;
+		wsi->ws->bcast = b;
+		wsi->ws->bcast_ofs = 0;
+	}
+
+	__lws_ws_bcast_trim(l);
+
+	lws_vhost_unlock(wsi->vhost);
+
+	/*
+	 * If POLLOUT was only on for the broadcasts and we sent the last one,
+	 * turn it off, unless another thread asked for it meanwhile
+	 */
+	if (!b && wsi->ws->bcast_pollout) {
+		wsi->ws->bcast_pollout = 0;
+		if (!wsi->leave_pollout_active)
+			lws_change_pollfd(wsi, LWS_POLLOUT, 0);
+	}
+}
+
+/*
+ * Called from the ws POLLOUT handler before the user gets a WRITEABLE, only
+ * between messages.
+ *
+ * Only this pt moves the cursor on or drops it, so the frames from the cursor
+ * on stay allocated while we send from them without the vhost lock.
+ */
+
+int
+lws_ws_bcast_pollout(struct lws *wsi)
+{
+#if defined(LWS_HAVE_SYS_UIO_H)
+	struct iovec iov[LWS_WS_BCAST_IOV];
+	size_t amount;
+#endif
+	struct lws_ws_bcast *b;
+	uint8_t *p, *copy;
+	size_t ofs;
+	int n;
+
+	lws_vhost_lock(wsi->vhost);
+	b = wsi->ws->bcast;
+	ofs = wsi->ws->bcast_ofs;
+	lws_vhost_unlock(wsi->vhost);
+
+	if (!b || wsi->ws->tx_msg_open || wsi->ws->inside_frame)
+		return LWS_HP_RET_USER_SERVICE;
+
+#if !defined(LWS_WITHOUT_EXTENSIONS)
+	if (wsi->ws->tx_draining_ext || wsi->ws->extension_data_pending)
+		return LWS_HP_RET_USER_SERVICE;
+#endif
+
+	p = lws_ws_bcast_payload(b);
+
+	if (lwsi_role_client(wsi) || wsi->http2_substream ||
+#if !defined(LWS_WITHOUT_EXTENSIONS)
+	    wsi->ws->count_act_ext ||
+#endif
+	    wsi->h2_stream_carries_ws) {
+		/* it needs its own framing, send a copy of the payload */
+		copy = lws_malloc(LWS_PRE + b->len, "ws bcast copy");
+		if (!copy)
+			return LWS_HP_RET_BAIL_DIE;
+
+		memcpy(copy + LWS_PRE, p, b->len);
+		n = lws_write(wsi, copy + LWS_PRE, b->len,
+			      (enum lws_write_protocol)b->wp);
+		lws_free(copy);
+		if (n < 0)
+			return LWS_HP_RET_BAIL_DIE;
+
+		lws_ws_bcast_sent(wsi, b->hdr_len + b->len);
+
+		return LWS_HP_RET_BAIL_OK;
+	}
+
+#if defined(LWS_HAVE_SYS_UIO_H)
+#if defined(LWS_WITH_TLS)
+	if (!wsi->tls.use_ssl)
+#endif
+	{
+		/*
+		 * On a plain socket, give the kernel as many of the frames as
+		 * we have pending, up to LWS_WS_BCAST_IOV, in one go
+		 */
+		n = 0;
+
+		lws_vhost_lock(wsi->vhost);
+		while (b && n < LWS_WS_BCAST_IOV) {
+			iov[n].iov_base = lws_ws_bcast_payload(b) -
+					  b->hdr_len + ofs;
+			iov[n++].iov_len = b->hdr_len + b->len - ofs;
+			ofs = 0;
+			b = b->next;
+		}
+		lws_vhost_unlock(wsi->vhost);
+
+		if (lws_plat_send_iov(wsi->desc.sockfd, iov, n, &amount)) {
+			wsi->socket_is_permanently_unusable = 1;
+			return LWS_HP_RET_BAIL_DIE;
+		}
+
+		lws_ws_bcast_sent(wsi, amount);
+
+		/* POLLOUT stays on, we come back for any more */
+		return LWS_HP_RET_BAIL_OK;
+	}
+#endif
+
+	/* send the rest of the shared frame */
+	n = lws_ssl_capable_write(wsi, p - b->hdr_len + ofs,
+				  (int)(b->hdr_len + b->len - ofs));
+	switch (n) {
+	case LWS_SSL_CAPABLE_ERROR:
+		wsi->socket_is_permanently_unusable = 1;
+		return LWS_HP_RET_BAIL_DIE;
+	case LWS_SSL_CAPABLE_MORE_SERVICE:
+		n = 0;
+		break;
+	}
+
+	lws_ws_bcast_sent(wsi, (size_t)n);
+
+	return LWS_HP_RET_BAIL_OK;
+}
+
+/*
+ * The wsi is leaving the protocol's connection list, it won't send the
+ * broadcasts it has pending.  Caller holds the vhost lock.
+ */
+
+void
+__lws_ws_bcast_detach(struct lws *wsi)
+{
+	struct lws_ws_bcast *b = wsi->ws->bcast;
+	struct lws_ws_bcast_list *l;
+
+	if (!b)
+		return;
+
+	l = b->owner;
+	while (b) {
+		b->refcount--;
+		b = b->next;
+	}
+
+	wsi->ws->bcast = NULL;
+	wsi->ws->bcast_ofs = 0;
+
+	__lws_ws_bcast_trim(l);
+}
+
+
+void
+lws_ws_bcast_destroy_vhost(struct lws_vhost *vh)
+{
+	struct lws_ws_bcast *b, *b1;
+	int n;
+
+	if (!vh->ws.bcast)
+		return;
+
+	for (n = 0; n < vh->count_protocols; n++) {
+		b = vh->ws.bcast[n].head;
+		while (b) {
+			b1 = b->next;
+			lws_free(b);
+			b = b1;
+		}
+	}
+
+	lws_free_set_NULL(vh->ws.bcast);
+}
@@ -41,6 +41,169 @@ const struct lws_ext_options lws_ext_pm_deflate_options[] = {
 	{ NULL, 0 }, /* sentinel */
 };
 
+/* the no_context_takeover arg that applies to what we send, and receive */
+#define pmd_nct_tx(_wsi) (lwsi_role_client(_wsi) ? \
+		PMD_CLIENT_NO_CONTEXT_TAKEOVER : PMD_SERVER_NO_CONTEXT_TAKEOVER)
+#define pmd_nct_rx(_wsi) (lwsi_role_client(_wsi) ? \
+		PMD_SERVER_NO_CONTEXT_TAKEOVER : PMD_CLIENT_NO_CONTEXT_TAKEOVER)
+
+/*
+ * zlib streams
+ *
+ * With context takeover, a message may refer back to anything in the last
+ * 2^window_bits bytes of the earlier ones, so the connection has to keep its
+ * z_streams, around 300KB of zlib state with the defaults, for as long as it
+ * lives.  But in a direction that negotiated no_context_takeover, messages
+ * stand alone, and the stream is only needed while one is being compressed
+ * or decompressed.  Those streams are taken from a per-pt pool when the
+ * message starts and reset and given back to it when the message ends, so
+ * the memory follows the number of messages in flight, not of connections.
+ *
+ * zlib allocates through lws_malloc() here so the stats can track it.
+ */
+
+#define LWS_PMD_ZHDR (sizeof(size_t) * 2)
+
+static voidpf
+lws_pmd_zalloc(voidpf opaque, uInt items, uInt size)
+{
+	struct lws_context_per_thread *pt =
+				(struct lws_context_per_thread *)opaque;
+	size_t len = (size_t)items * size, *p;
+
+	p = lws_malloc(LWS_PMD_ZHDR + len, "pmd zlib");
+	if (!p)
+		return Z_NULL;
+
+	*p = len;
+#if defined(LWS_WITH_STATS)
+	lws_stats_atomic_bump(pt->context, pt, LWSSTATS_B_PMD_ZLIB_MEM, len);
+	lws_stats_atomic_max(pt->context, pt, LWSSTATS_B_PMD_ZLIB_MEM_PEAK,
+			     pt->stats.s[LWSSTATS_B_PMD_ZLIB_MEM]);
+#else
+	(void)pt;
+#endif
+
+	return (uint8_t *)p + LWS_PMD_ZHDR;
+}
+
+static void
+lws_pmd_zfree(voidpf opaque, voidpf address)
+{
+	struct lws_context_per_thread *pt =
+				(struct lws_context_per_thread *)opaque;
+	size_t *p = (size_t *)((uint8_t *)address - LWS_PMD_ZHDR);
+
+#if defined(LWS_WITH_STATS)
+	lws_stats_atomic_bump(pt->context, pt, LWSSTATS_B_PMD_ZLIB_MEM,
+			      (uint64_t)0 - *p);
+#else
+	(void)pt;
+#endif
+
+	lws_free(p);
+}
+
+static z_stream *
+lws_pmd_zs_get(struct lws *wsi, int inflater, int wbits, int level,
+	       int mem_level)
+{
+	struct lws_context_per_thread *pt = &wsi->context->pt[(int)wsi->tsi];
+	struct lws_pmd_zs **pz = &pt->ws.pmd_zs_free, *z;
+	int n;
+
+	while (*pz) {
+		z = *pz;
+		if (z->inflate == inflater && z->wbits == wbits &&
+		    (inflater ||
+		     (z->level == level && z->mem_level == mem_level))) {
+			*pz = z->next;
+			pt->ws.pmd_zs_count_free--;
+			lws_stats_atomic_bump(wsi->context, pt,
+					      LWSSTATS_C_PMD_ZS_POOL_HIT, 1);
+
+			return &z->zs;
+		}
+		pz = &z->next;
+	}
+
+	lws_stats_atomic_bump(wsi->context, pt, LWSSTATS_C_PMD_ZS_POOL_MISS, 1);
+
+	z = lws_pmd_zalloc(pt, 1, sizeof(*z));
+	if (!z)
+		return NULL;
+
+	memset(z, 0, sizeof(*z));
+	z->pt = pt;
+	z->inflate = (unsigned char)inflater;
+	z->wbits = (unsigned char)wbits;
+	z->level = (unsigned char)level;
+	z->mem_level = (unsigned char)mem_level;
+	z->zs.zalloc = lws_pmd_zalloc;
+	z->zs.zfree = lws_pmd_zfree;
+	z->zs.opaque = pt;
+
+	if (inflater)
+		n = inflateInit2(&z->zs, -wbits);
+	else
+		n = deflateInit2(&z->zs, level, Z_DEFLATED, -wbits, mem_level,
+				 Z_DEFAULT_STRATEGY);
+	if (n != Z_OK) {
+		lwsl_err("%s: zlib init failed %d\n", __func__, n);
+		lws_pmd_zfree(pt, z);
+
+		return NULL;
+	}
+
+	return &z->zs;
+}
+
+static void
+lws_pmd_zs_end(struct lws_pmd_zs *z)
+{
+	if (z->inflate)
+		(void)inflateEnd(&z->zs);
+	else
+		(void)deflateEnd(&z->zs);
+
+	lws_pmd_zfree(z->pt, z);
+}
+
+/* the connection is done with its stream, put it back in the pool */
+
+static void
+lws_pmd_zs_put(z_stream **pzs)
+{
+	struct lws_pmd_zs *z = lws_container_of(*pzs, struct lws_pmd_zs, zs);
+	struct lws_context_per_thread *pt = z->pt;
+
+	*pzs = NULL;
+
+	if (pt->ws.pmd_zs_count_free >= LWS_PMD_ZS_POOL_MAX_FREE ||
+	    (z->inflate ? inflateReset(&z->zs) :
+			  deflateReset(&z->zs)) != Z_OK) {
+		lws_pmd_zs_end(z);
+		return;
+	}
+
+	z->next = pt->ws.pmd_zs_free;
+	pt->ws.pmd_zs_free = z;
+	pt->ws.pmd_zs_count_free++;
+}
+
+void
+lws_pmd_zs_pool_destroy(struct lws_context_per_thread *pt)
+{
+	struct lws_pmd_zs *z;
+
+	while (pt->ws.pmd_zs_free) {
+		z = pt->ws.pmd_zs_free;
+		pt->ws.pmd_zs_free = z->next;
+		lws_pmd_zs_end(z);
+	}
+	pt->ws.pmd_zs_count_free = 0;
+}
+
 static void
 lws_extension_pmdeflate_restrict_args(struct lws *wsi,
 				      struct lws_ext_pm_deflate_priv *priv)
@@ -169,28 +332,31 @@ lws_extension_callback_pm_deflate(struct lws_context *context,
 		lwsl_ext("%s: LWS_EXT_CB_DESTROY\n", __func__);
 		lws_free(priv->buf_rx_inflated);
 		lws_free(priv->buf_tx_deflated);
-		if (priv->rx_init)
-			(void)inflateEnd(&priv->rx);
-		if (priv->tx_init)
-			(void)deflateEnd(&priv->tx);
+		lws_free(priv->rx_stash);
+		if (priv->rx)
+			lws_pmd_zs_put(&priv->rx);
+		if (priv->tx)
+			lws_pmd_zs_put(&priv->tx);
 		lws_free(priv);
 		return ret;
 
 	case LWS_EXT_CB_PAYLOAD_RX:
 		lwsl_ext(" %s: LWS_EXT_CB_PAYLOAD_RX: in %d, existing in %d\n",
-			 __func__, ebuf->len, priv->rx.avail_in);
+			 __func__, ebuf->len, priv->rx ? priv->rx->avail_in : 0);
 		if (!(wsi->ws->rsv_first_msg & 0x40) || (wsi->ws->opcode & 8))
 			return 0;
 
 		// lwsl_hexdump_debug(ebuf->token, ebuf->len);
 
-		if (!priv->rx_init)
-			if (inflateInit2(&priv->rx,
-			     -priv->args[PMD_SERVER_MAX_WINDOW_BITS]) != Z_OK) {
+		if (!priv->rx) {
+			priv->rx = lws_pmd_zs_get(wsi, 1,
+				       priv->args[PMD_SERVER_MAX_WINDOW_BITS],
+				       0, 0);
+			if (!priv->rx) {
 				lwsl_err("%s: iniflateInit failed\n", __func__);
 				return -1;
 			}
-		priv->rx_init = 1;
+		}
 		if (!priv->buf_rx_inflated)
 			priv->buf_rx_inflated = lws_malloc(LWS_PRE + 7 + 5 +
 					    (1 << priv->args[PMD_RX_BUF_PWR2]),
@@ -206,18 +372,18 @@ lws_extension_callback_pm_deflate(struct lws_context *context,
 		 * rx buffer by the caller, so this assumption is safe while
 		 * we block new rx while draining the existing rx
 		 */
-		if (!priv->rx.avail_in && ebuf->token && ebuf->len) {
-			priv->rx.next_in = (unsigned char *)ebuf->token;
-			priv->rx.avail_in = ebuf->len;
+		if (!priv->rx->avail_in && ebuf->token && ebuf->len) {
+			priv->rx->next_in = (unsigned char *)ebuf->token;
+			priv->rx->avail_in = ebuf->len;
 		}
-		priv->rx.next_out = priv->buf_rx_inflated + LWS_PRE;
-		ebuf->token = (char *)priv->rx.next_out;
-		priv->rx.avail_out = 1 << priv->args[PMD_RX_BUF_PWR2];
+		priv->rx->next_out = priv->buf_rx_inflated + LWS_PRE;
+		ebuf->token = (char *)priv->rx->next_out;
+		priv->rx->avail_out = 1 << priv->args[PMD_RX_BUF_PWR2];
 
 		if (priv->rx_held_valid) {
 			lwsl_ext("-- RX piling on held byte --\n");
-			*(priv->rx.next_out++) = priv->rx_held;
-			priv->rx.avail_out--;
+			*(priv->rx->next_out++) = priv->rx_held;
+			priv->rx->avail_out--;
 			priv->rx_held_valid = 0;
 		}
 
@@ -230,24 +396,24 @@ lws_extension_callback_pm_deflate(struct lws_context *context,
 		 * ...then put back the 00 00 FF FF the sender stripped as our
 		 * input to zlib
 		 */
-		if (!priv->rx.avail_in && wsi->ws->final &&
+		if (!priv->rx->avail_in && wsi->ws->final &&
 		    !wsi->ws->rx_packet_length) {
 			lwsl_ext("RX APPEND_TRAILER-DO\n");
 			was_fin = 1;
-			priv->rx.next_in = trail;
-			priv->rx.avail_in = sizeof(trail);
+			priv->rx->next_in = trail;
+			priv->rx->avail_in = sizeof(trail);
 		}
 
-		n = inflate(&priv->rx, Z_NO_FLUSH);
+		n = inflate(priv->rx, Z_NO_FLUSH);
 		lwsl_ext("inflate ret %d, avi %d, avo %d, wsifinal %d\n", n,
-			 priv->rx.avail_in, priv->rx.avail_out, wsi->ws->final);
+			 priv->rx->avail_in, priv->rx->avail_out, wsi->ws->final);
 		switch (n) {
 		case Z_NEED_DICT:
 		case Z_STREAM_ERROR:
 		case Z_DATA_ERROR:
 		case Z_MEM_ERROR:
 			lwsl_notice("zlib error inflate %d: %s\n",
-				  n, priv->rx.msg);
+				  n, priv->rx->msg);
 			return -1;
 		}
 		/*
@@ -258,24 +424,24 @@ lws_extension_callback_pm_deflate(struct lws_context *context,
 		 * being a FIN fragment, then do the FIN message processing
 		 * of faking up the 00 00 FF FF that the sender stripped.
 		 */
-		if (!priv->rx.avail_in && wsi->ws->final &&
+		if (!priv->rx->avail_in && wsi->ws->final &&
 		    !wsi->ws->rx_packet_length && !was_fin &&
-		    priv->rx.avail_out /* ambiguous as to if it is the end */
+		    priv->rx->avail_out /* ambiguous as to if it is the end */
 		) {
 			lwsl_ext("RX APPEND_TRAILER-DO\n");
 			was_fin = 1;
-			priv->rx.next_in = trail;
-			priv->rx.avail_in = sizeof(trail);
-			n = inflate(&priv->rx, Z_SYNC_FLUSH);
+			priv->rx->next_in = trail;
+			priv->rx->avail_in = sizeof(trail);
+			n = inflate(priv->rx, Z_SYNC_FLUSH);
 			lwsl_ext("RX trailer inf returned %d, avi %d, avo %d\n",
-				 n, priv->rx.avail_in, priv->rx.avail_out);
+				 n, priv->rx->avail_in, priv->rx->avail_out);
 			switch (n) {
 			case Z_NEED_DICT:
 			case Z_STREAM_ERROR:
 			case Z_DATA_ERROR:
 			case Z_MEM_ERROR:
 				lwsl_info("zlib error inflate %d: %s\n",
-					  n, priv->rx.msg);
+					  n, priv->rx->msg);
 				return -1;
 			}
 		}
@@ -296,29 +462,61 @@ lws_extension_callback_pm_deflate(struct lws_context *context,
 		 * on, even if actually nothing more is coming from the next
 		 * inflate action itself.
 		 */
-		if (!priv->rx.avail_out) { /* he used all available out buf */
+		if (!priv->rx->avail_out) { /* he used all available out buf */
 			lwsl_ext("-- rx grabbing held --\n");
 			/* snip the last byte and hold it for next time */
-			priv->rx_held = *(--priv->rx.next_out);
+			priv->rx_held = *(--priv->rx->next_out);
 			priv->rx_held_valid = 1;
 		}
 
-		ebuf->len = lws_ptr_diff(priv->rx.next_out, ebuf->token);
+		ebuf->len = lws_ptr_diff(priv->rx->next_out, ebuf->token);
 		priv->count_rx_between_fin += ebuf->len;
 
 		lwsl_ext("  %s: RX leaving with new effbuff len %d, "
 			 "ret %d, rx.avail_in=%d, TOTAL RX since FIN %lu\n",
 			 __func__, ebuf->len, priv->rx_held_valid,
-			 priv->rx.avail_in,
+			 priv->rx->avail_in,
 			 (unsigned long)priv->count_rx_between_fin);
 
 		if (was_fin) {
 			priv->count_rx_between_fin = 0;
-			if (priv->args[PMD_SERVER_NO_CONTEXT_TAKEOVER]) {
-				lwsl_ext("PMD_SERVER_NO_CONTEXT_TAKEOVER\n");
-				(void)inflateEnd(&priv->rx);
-				priv->rx_init = 0;
+			/*
+			 * If the sender doesn't take over context, we don't
+			 * need the stream until his next message... unless
+			 * we are still holding some of this one
+			 */
+			if (priv->args[pmd_nct_rx(wsi)] &&
+			    !priv->rx_held_valid && !priv->rx->avail_in) {
+				lwsl_ext("rx no_context_takeover\n");
+				lws_pmd_zs_put(&priv->rx);
+			}
+		}
+
+		/*
+		 * If zlib didn't take all the input, we come back for the rest
+		 * while draining.  But that input may be in the pt serv_buf,
+		 * which other connections read into before then, so keep a
+		 * copy of it.
+		 */
+		if (priv->rx && priv->rx->avail_in &&
+		    (priv->rx->next_in < trail ||
+		     priv->rx->next_in >= trail + sizeof(trail)) &&
+		    (!priv->rx_stash || priv->rx->next_in < priv->rx_stash ||
+		     priv->rx->next_in >= priv->rx_stash + priv->rx_stash_size)) {
+			if (priv->rx_stash_size < priv->rx->avail_in) {
+				lws_free(priv->rx_stash);
+				priv->rx_stash_size = 0;
+				priv->rx_stash = lws_malloc(priv->rx->avail_in,
+							    "pmd rx stash");
+				if (!priv->rx_stash) {
+					lwsl_err("%s: OOM\n", __func__);
+					return -1;
+				}
+				priv->rx_stash_size = priv->rx->avail_in;
 			}
+			memcpy(priv->rx_stash, priv->rx->next_in,
+			       priv->rx->avail_in);
+			priv->rx->next_in = priv->rx_stash;
 		}
 
 		// lwsl_hexdump_debug(ebuf->token, ebuf->len);
@@ -327,19 +525,17 @@ lws_extension_callback_pm_deflate(struct lws_context *context,
 
 	case LWS_EXT_CB_PAYLOAD_TX:
 
-		if (!priv->tx_init) {
-			n = deflateInit2(&priv->tx, priv->args[PMD_COMP_LEVEL],
-					 Z_DEFLATED,
-					 -priv->args[PMD_SERVER_MAX_WINDOW_BITS +
+		if (!priv->tx) {
+			priv->tx = lws_pmd_zs_get(wsi, 0,
+					priv->args[PMD_SERVER_MAX_WINDOW_BITS +
 						(wsi->vhost->listen_port <= 0)],
-					 priv->args[PMD_MEM_LEVEL],
-					 Z_DEFAULT_STRATEGY);
-			if (n != Z_OK) {
-				lwsl_ext("inflateInit2 failed %d\n", n);
+					priv->args[PMD_COMP_LEVEL],
+					priv->args[PMD_MEM_LEVEL]);
+			if (!priv->tx) {
+				lwsl_ext("deflateInit2 failed\n");
 				return 1;
 			}
 		}
-		priv->tx_init = 1;
 		if (!priv->buf_tx_deflated)
 			priv->buf_tx_deflated = lws_malloc(LWS_PRE + 7 + 5 +
 					    (1 << priv->args[PMD_TX_BUF_PWR2]),
@@ -352,8 +548,8 @@ lws_extension_callback_pm_deflate(struct lws_context *context,
 		if (ebuf->token) {
 			lwsl_ext("%s: TX: ebuf length %d\n", __func__,
 				 ebuf->len);
-			priv->tx.next_in = (unsigned char *)ebuf->token;
-			priv->tx.avail_in = ebuf->len;
+			priv->tx->next_in = (unsigned char *)ebuf->token;
+			priv->tx->avail_in = ebuf->len;
 		}
 
 #if 0
@@ -365,12 +561,12 @@ lws_extension_callback_pm_deflate(struct lws_context *context,
 		printf("\n");
 #endif
 
-		priv->tx.next_out = priv->buf_tx_deflated + LWS_PRE + 5;
-		ebuf->token = (char *)priv->tx.next_out;
-		priv->tx.avail_out = 1 << priv->args[PMD_TX_BUF_PWR2];
+		priv->tx->next_out = priv->buf_tx_deflated + LWS_PRE + 5;
+		ebuf->token = (char *)priv->tx->next_out;
+		priv->tx->avail_out = 1 << priv->args[PMD_TX_BUF_PWR2];
 
-		if (priv->tx.avail_in) {
-			n = deflate(&priv->tx, Z_SYNC_FLUSH);
+		if (priv->tx->avail_in) {
+			n = deflate(priv->tx, Z_SYNC_FLUSH);
 			if (n == Z_STREAM_ERROR) {
 				lwsl_ext("%s: Z_STREAM_ERROR\n", __func__);
 				return -1;
@@ -379,7 +575,7 @@ lws_extension_callback_pm_deflate(struct lws_context *context,
 
 		if (priv->tx_held_valid) {
 			priv->tx_held_valid = 0;
-			if ((int)priv->tx.avail_out ==
+			if ((int)priv->tx->avail_out ==
 					1 << priv->args[PMD_TX_BUF_PWR2])
 				/*
 				 * We can get a situation he took something in
@@ -406,7 +602,7 @@ lws_extension_callback_pm_deflate(struct lws_context *context,
 			}
 		}
 		priv->compressed_out = 1;
-		ebuf->len = lws_ptr_diff(priv->tx.next_out, ebuf->token);
+		ebuf->len = lws_ptr_diff(priv->tx->next_out, ebuf->token);
 
 		/*
 		 * we must announce in our returncode now if there is more
@@ -429,30 +625,29 @@ lws_extension_callback_pm_deflate(struct lws_context *context,
 		 * be in a position to understand if that has a FIN or not.
 		 */
 
-		extra = !!(len & LWS_WRITE_NO_FIN) || !priv->tx.avail_out;
+		extra = !!(len & LWS_WRITE_NO_FIN) || !priv->tx->avail_out;
 
 		if (ebuf->len >= 4 + extra) {
 			lwsl_ext("tx held %d\n", 4 + extra);
 			priv->tx_held_valid = extra;
 			for (n = 3 + extra; n >= 0; n--)
-				priv->tx_held[n] = *(--priv->tx.next_out);
+				priv->tx_held[n] = *(--priv->tx->next_out);
 			ebuf->len -= 4 + extra;
 		}
 		lwsl_ext("  TX rewritten with new effbuff len %d, ret %d\n",
-			 ebuf->len, !priv->tx.avail_out);
+			 ebuf->len, !priv->tx->avail_out);
 
-		return !priv->tx.avail_out; /* 1 == have more tx pending */
+		return !priv->tx->avail_out; /* 1 == have more tx pending */
 
 	case LWS_EXT_CB_PACKET_TX_PRESEND:
 		if (!priv->compressed_out)
 			break;
 		priv->compressed_out = 0;
 
-		if ((*(ebuf->token) & 0x80) &&
-		    priv->args[PMD_CLIENT_NO_CONTEXT_TAKEOVER]) {
-			lwsl_debug("PMD_CLIENT_NO_CONTEXT_TAKEOVER\n");
-			(void)deflateEnd(&priv->tx);
-			priv->tx_init = 0;
+		if ((*(ebuf->token) & 0x80) && priv->tx &&
+		    priv->args[pmd_nct_tx(wsi)]) {
+			lwsl_debug("tx no_context_takeover\n");
+			lws_pmd_zs_put(&priv->tx);
 		}
 
 		n = *(ebuf->token) & 15;
@@ -17,12 +17,37 @@ enum arg_indexes {
 	PMD_ARG_COUNT
 };
 
+#if defined(LWS_WITH_ESP32)
+#define LWS_PMD_ZS_POOL_MAX_FREE 2
+#else
+#define LWS_PMD_ZS_POOL_MAX_FREE 16
+#endif
+
+/*
+ * A zlib stream, either owned by a connection or idle on its pt's freelist.
+ * The z_stream can't be copied, zlib's state points back to it.
+ */
+
+struct lws_pmd_zs {
+	z_stream zs;
+	struct lws_pmd_zs *next; /* pt freelist */
+	struct lws_context_per_thread *pt;
+
+	/* what it was initialized with, only alike ones can be reused */
+	unsigned char inflate;
+	unsigned char wbits;
+	unsigned char level;
+	unsigned char mem_level;
+};
+
 struct lws_ext_pm_deflate_priv {
-	z_stream rx;
-	z_stream tx;
+	z_stream *rx; /* NULL if none checked out */
+	z_stream *tx;
 
 	unsigned char *buf_rx_inflated; /* RX inflated output buffer */
 	unsigned char *buf_tx_deflated; /* TX deflated output buffer */
+	unsigned char *rx_stash; /* RX input zlib didn't take yet */
+	size_t rx_stash_size;
 
 	size_t count_rx_between_fin;
 
@@ -30,8 +55,6 @@ struct lws_ext_pm_deflate_priv {
 	unsigned char tx_held[5];
 	unsigned char rx_held;
 
-	unsigned char tx_init:1;
-	unsigned char rx_init:1;
 	unsigned char compressed_out:1;
 	unsigned char rx_held_valid:1;
 	unsigned char tx_held_valid:1;
@@ -21,8 +21,95 @@
 
 #include <core/private.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #define LWS_CPYAPP(ptr, str) { strcpy(ptr, str); ptr += strlen(str); }
 
+/*
+ * ws masking is an XOR with the 4-byte mask repeating from mask_idx.  After
+ * lining up on 8 bytes bytewise, we take the mask pattern rotated to that
+ * phase and XOR 32, 16 or 8 bytes at a time with whatever the compiler was
+ * told the cpu can do, then finish bytewise.
+ */
+
+LWS_VISIBLE void
+lws_ws_mask(uint8_t *buf, size_t len, const uint8_t *mask, uint8_t *mask_idx)
+{
+	unsigned int idx = *mask_idx & 3;
+	uint8_t m[8];
+	uint64_t m64, u;
+	size_t n;
+
+	*mask_idx = (uint8_t)((idx + len) & 3);
+
+	while (len && ((uintptr_t)buf & 7)) {
+		*buf++ ^= mask[idx++ & 3];
+		len--;
+	}
+
+	for (n = 0; n < sizeof(m); n++)
+		m[n] = mask[(idx + n) & 3];
+	memcpy(&m64, m, sizeof(m64));
+
+#if defined(__AVX2__)
+	if (len >= 32) {
+		__m256i v = _mm256_set1_epi64x((long long)m64);
+
+		while (len >= 32) {
+			_mm256_storeu_si256((__m256i *)buf,
+				_mm256_xor_si256(v,
+				     _mm256_loadu_si256((const __m256i *)buf)));
+			buf += 32;
+			len -= 32;
+		}
+	}
+#endif
+#if defined(__SSE2__)
+	if (len >= 16) {
+		__m128i v = _mm_set1_epi64x((long long)m64);
+
+		while (len >= 16) {
+			_mm_storeu_si128((__m128i *)buf,
+				_mm_xor_si128(v,
+				     _mm_loadu_si128((const __m128i *)buf)));
+			buf += 16;
+			len -= 16;
+		}
+	}
+#elif defined(__ARM_NEON)
+	if (len >= 16) {
+		uint8x16_t v = vcombine_u8(vld1_u8(m), vld1_u8(m));
+
+		while (len >= 16) {
+			vst1q_u8(buf, veorq_u8(v, vld1q_u8(buf)));
+			buf += 16;
+			len -= 16;
+		}
+	}
+#endif
+
+	/* buf is still 8-byte aligned, since we only moved it in 8s */
+
+	while (len >= 8) {
+		memcpy(&u, buf, sizeof(u));
+		u ^= m64;
+		memcpy(buf, &u, sizeof(u));
+		buf += 8;
+		len -= 8;
+	}
+
+	/* the phase is unchanged since we moved in multiples of 4 */
+
+	for (n = 0; n < len; n++)
+		buf[n] ^= m[n];
+}
+
 /*
  * client-parser.c: lws_ws_client_rx_sm() needs to be roughly kept in
  *   sync with changes here, esp related to ext draining
@@ -1195,6 +1282,13 @@ int rops_handle_POLLOUT_ws(struct lws *wsi)
 			wsi->protocol->name, wsi->ws->tx_draining_ext);
 #endif
 
+	/*
+	 * Priority 2b: the rest of a broadcast frame we partly sent, nothing
+	 *		else may go out in the middle of it
+	 */
+	if (lwsi_role_ws(wsi) && wsi->ws->bcast_ofs)
+		return lws_ws_bcast_pollout(wsi);
+
 	/* Priority 3: pending control packets (pong or close)
 	 *
 	 * 3a: close notification packet requested from close api
@@ -1286,6 +1380,16 @@ int rops_handle_POLLOUT_ws(struct lws *wsi)
 	if (lwsi_state(wsi) == LRS_RETURNED_CLOSE)
 		return LWS_HP_RET_USER_SERVICE;
 
+	/*
+	 * Priority 4b: pending broadcasts, if we're between messages... they
+	 *		go out ahead of the user's own WRITEABLE
+	 */
+	if (lwsi_role_ws(wsi) && wsi->ws->bcast) {
+		n = lws_ws_bcast_pollout(wsi);
+		if (n != LWS_HP_RET_USER_SERVICE)
+			return n;
+	}
+
 #if !defined(LWS_WITHOUT_EXTENSIONS)
 	/* Priority 5: Tx path extension with more to send
 	 *
@@ -1759,6 +1863,10 @@ rops_write_role_protocol_ws(struct lws *wsi, unsigned char *buf, size_t len,
 			return -1;
 		}
 
+		if (n < LWSWSOPC_CLOSE)
+			/* broadcasts must wait until the message is finished */
+			wsi->ws->tx_msg_open = !!((*wp) & LWS_WRITE_NO_FIN);
+
 		if (!((*wp) & LWS_WRITE_NO_FIN))
 			n |= 1 << 7;
 
@@ -1815,9 +1923,8 @@ do_more_inside_frame:
 		 * in v7, just mask the payload
 		 */
 		if (dropmask) { /* never set if already inside frame */
-			for (n = 4; n < (int)len + 4; n++)
-				dropmask[n] = dropmask[n] ^ wsi->ws->mask[
-					(wsi->ws->mask_idx++) & 3];
+			lws_ws_mask(dropmask + 4, len, wsi->ws->mask,
+				    &wsi->ws->mask_idx);
 
 			/* copy the frame nonce into place */
 			memcpy(dropmask, wsi->ws->mask, 4);
@@ -1962,12 +2069,18 @@ rops_init_vhost_ws(struct lws_vhost *vh,
 		vh->ws.extensions = info->extensions;
 #endif
 
+	vh->ws.bcast_max_queued = info->ws_bcast_max_queued ?
+			info->ws_bcast_max_queued :
+			LWS_WS_BCAST_MAX_QUEUED_DEFAULT;
+
 	return 0;
 }
 
 static int
 rops_destroy_vhost_ws(struct lws_vhost *vh)
 {
+	lws_ws_bcast_destroy_vhost(vh);
+
 #ifdef LWS_WITH_PLUGINS
 #if !defined(LWS_WITHOUT_EXTENSIONS)
 	if (vh->context->plugin_extension_count)
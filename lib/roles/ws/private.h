@@ -73,19 +73,65 @@ enum lws_websocket_opcodes_07 {
 #define ALREADY_PROCESSED_IGNORE_CHAR 1
 #define ALREADY_PROCESSED_NO_CB 2
 
-#if !defined(LWS_WITHOUT_EXTENSIONS)
+/*
+ * One message from lws_ws_broadcast(), framed once and shared by every
+ * connection it was queued for.  The frame header is built for an unmasked
+ * frame, immediately before the payload.
+ */
+struct lws_ws_bcast {
+	struct lws_ws_bcast *next; /* later broadcast on the same list */
+	struct lws_ws_bcast_list *owner;
+	size_t len; /* payload length */
+	int refcount; /* connections that have yet to finish sending it */
+	uint8_t hdr_len;
+	uint8_t wp;
+	/* the frame follows, after LWS_WS_BCAST_HDR_MAX - hdr_len padding */
+};
+
+#define LWS_WS_BCAST_HDR_MAX 10
+/* most pending broadcasts a plain socket is given in one send */
+#define LWS_WS_BCAST_IOV 16
+#define lws_ws_bcast_payload(_b) \
+	((uint8_t *)&(_b)[1] + LWS_WS_BCAST_HDR_MAX)
+
+/* default for info->ws_bcast_max_queued */
+#define LWS_WS_BCAST_MAX_QUEUED_DEFAULT (16 * 1024 * 1024)
+
+struct lws_ws_bcast_list {
+	struct lws_ws_bcast *head; /* oldest, the only one that can be done */
+	struct lws_ws_bcast *tail;
+	size_t queued; /* frame bytes on the list */
+};
+
 struct lws_vhost_role_ws {
+#if !defined(LWS_WITHOUT_EXTENSIONS)
 	const struct lws_extension *extensions;
+#endif
+	/* per protocol, allocated on first lws_ws_broadcast() */
+	struct lws_ws_bcast_list *bcast;
+	size_t bcast_max_queued;
+	/* per pt, wsi with broadcast work for their own pt to do */
+	struct lws_dll_lws bcast_kick[LWS_MAX_SMP];
 };
 
+struct lws_pmd_zs;
+
 struct lws_pt_role_ws {
+#if !defined(LWS_WITHOUT_EXTENSIONS)
 	struct lws *rx_draining_ext_list;
 	struct lws *tx_draining_ext_list;
-};
+	/* idle permessage-deflate zlib streams, reset and ready to reuse */
+	struct lws_pmd_zs *pmd_zs_free;
+	uint16_t pmd_zs_count_free;
 #endif
+	/* some vhost has bcast_kick for us, protected by the pt lock */
+	char bcast_kicked;
+};
 
 struct _lws_websocket_related {
 	char *rx_ubuf;
+	struct lws_ws_bcast *bcast; /* next broadcast to send, or NULL */
+	size_t bcast_ofs; /* how much of its frame we sent */
 #if !defined(LWS_WITHOUT_EXTENSIONS)
 	const struct lws_extension *active_extensions[LWS_MAX_EXTENSIONS_ACTIVE];
 	void *act_ext_user[LWS_MAX_EXTENSIONS_ACTIVE];
@@ -112,6 +158,8 @@ struct _lws_websocket_related {
 	uint8_t stashed_write_type;
 	uint8_t tx_draining_stashed_wp;
 	uint8_t ietf_spec_revision;
+	/* closing for being too slow, written under the vhost lock */
+	uint8_t bcast_evicted;
 
 	unsigned int final:1;
 	unsigned int frame_is_binary:1;
@@ -129,6 +177,9 @@ struct _lws_websocket_related {
 	unsigned int send_check_ping:1;
 	unsigned int first_fragment:1;
 	unsigned int peer_has_sent_close:1;
+	unsigned int tx_msg_open:1; /* we sent a data frame without FIN */
+	/* POLLOUT is only on for broadcasts, only used by our own pt */
+	unsigned int bcast_pollout:1;
 #if !defined(LWS_WITHOUT_EXTENSIONS)
 	unsigned int extension_data_pending:1;
 	unsigned int rx_draining_ext:1;
@@ -141,6 +192,15 @@ struct _lws_websocket_related {
 int
 lws_ws_handshake_client(struct lws *wsi, unsigned char **buf, size_t len);
 
+void
+__lws_ws_bcast_detach(struct lws *wsi);
+int
+lws_ws_bcast_pollout(struct lws *wsi);
+void
+lws_ws_bcast_destroy_vhost(struct lws_vhost *vh);
+void
+lws_ws_bcast_service_pt(struct lws_context_per_thread *pt);
+
 #if !defined(LWS_WITHOUT_EXTENSIONS)
 LWS_VISIBLE void
 lws_context_init_extensions(const struct lws_context_creation_info *info,
@@ -154,6 +214,8 @@ lws_ext_cb_active(struct lws *wsi, int reason, void *buf, int len);
 LWS_EXTERN int
 lws_ext_cb_all_exts(struct lws_context *context, struct lws *wsi, int reason,
 		    void *arg, int len);
+void
+lws_pmd_zs_pool_destroy(struct lws_context_per_thread *pt);
 #endif
 
 int
@@ -24,15 +24,34 @@
 #define LWS_CPYAPP(ptr, str) { strcpy(ptr, str); ptr += strlen(str); }
 
 #if !defined(LWS_WITHOUT_EXTENSIONS)
+/* is the option name in the user's defaults string, as a whole token? */
+
+static int
+lws_ext_defaults_mention(const char *defs, const char *name)
+{
+	size_t len = strlen(name);
+	const char *c = defs;
+
+	while ((c = strstr(c, name))) {
+		if ((c == defs || c[-1] == ' ' || c[-1] == ';') &&
+		    (!c[len] || c[len] == ' ' || c[len] == ';'))
+			return 1;
+		c += len;
+	}
+
+	return 0;
+}
+
 static int
 lws_extension_server_handshake(struct lws *wsi, char **p, int budget)
 {
 	struct lws_context *context = wsi->context;
 	struct lws_context_per_thread *pt = &context->pt[(int)wsi->tsi];
-	char ext_name[64], *args, *end = (*p) + budget - 1;
+	char ext_name[64], defs[128], *args, *end = (*p) + budget - 1;
 	const struct lws_ext_options *opts, *po;
 	const struct lws_extension *ext;
 	struct lws_ext_option_arg oa;
+	uint32_t echoed;
 	int n, m, more = 1;
 	int ext_count = 0;
 	char ignore;
@@ -176,6 +195,31 @@ lws_extension_server_handshake(struct lws *wsi, char **p, int budget)
 					  "\x0d\x0aSec-WebSocket-Extensions: ");
 			*p += lws_snprintf(*p, (end - *p), "%s", ext_name);
 
+			/*
+			 * Allow the user code to override ext defaults if it
+			 * wants to, like on the client side.  The arg-less
+			 * options it sets are also added to our response below,
+			 * so it can ask for, eg, client_no_context_takeover
+			 * even if the client didn't offer it.
+			 */
+			defs[0] = '\0';
+			if (user_callback_handle_rxflow(wsi->protocol->callback,
+					wsi, LWS_CALLBACK_WS_EXT_DEFAULTS,
+					(char *)ext->name, defs, sizeof(defs)) ||
+			    (defs[0] &&
+			     lws_ext_parse_options(ext, wsi,
+				     wsi->ws->act_ext_user[
+						wsi->ws->count_act_ext],
+				     opts, defs, (int)strlen(defs)))) {
+				lwsl_err("%s: unable to set defaults '%s'\n",
+					 __func__, defs);
+				/* so it's destroyed along with the wsi */
+				wsi->ws->count_act_ext++;
+
+				return 1;
+			}
+			echoed = 0;
+
 			/*
 			 * The client may send a bunch of different option
 			 * sets for the same extension, we are supposed to
@@ -220,6 +264,9 @@ lws_extension_server_handshake(struct lws *wsi, char **p, int budget)
 							      "; %s", po->name);
 						lwsl_debug("adding option %s\n",
 							   po->name);
+						if (po - opts < 32)
+							echoed |= 1u <<
+								 (po - opts);
 					}
 					po++;
 				}
@@ -230,6 +277,16 @@ lws_extension_server_handshake(struct lws *wsi, char **p, int budget)
 					args++;
 			}
 
+			for (po = opts; defs[0] && po->name; po++)
+				if (po->type == EXTARG_NONE && po - opts < 32 &&
+				    !(echoed & (1u << (po - opts))) &&
+				    lws_ext_defaults_mention(defs, po->name)) {
+					*p += lws_snprintf(*p, (end - *p),
+							   "; %s", po->name);
+					lwsl_debug("adding default option %s\n",
+						   po->name);
+				}
+
 			wsi->ws->count_act_ext++;
 			lwsl_parser("cnt_act_ext <- %d\n",
 				    wsi->ws->count_act_ext);
@@ -634,7 +691,7 @@ static int
 lws_ws_frame_rest_is_payload(struct lws *wsi, uint8_t **buf, size_t len)
 {
 	unsigned int avail = (unsigned int)len;
-	uint8_t *buffer = *buf, mask[4];
+	uint8_t *buffer = *buf;
 	struct lws_tokens ebuf;
 #if !defined(LWS_WITHOUT_EXTENSIONS)
 	unsigned int old_packet_length = (int)wsi->ws->rx_packet_length;
@@ -675,31 +732,8 @@ lws_ws_frame_rest_is_payload(struct lws *wsi, uint8_t **buf, size_t len)
 
 	//lwsl_hexdump_notice(ebuf.token, ebuf.len);
 
-	if (!wsi->ws->all_zero_nonce) {
-
-		for (n = 0; n < 4; n++)
-			mask[n] = wsi->ws->mask[(wsi->ws->mask_idx + n) & 3];
-
-		/* deal with 4-byte chunks using unwrapped loop */
-		n = avail >> 2;
-		while (n--) {
-			*(buffer) = *(buffer) ^ mask[0];
-			buffer++;
-			*(buffer) = *(buffer) ^ mask[1];
-			buffer++;
-			*(buffer) = *(buffer) ^ mask[2];
-			buffer++;
-			*(buffer) = *(buffer) ^ mask[3];
-			buffer++;
-		}
-		/* and the remaining bytes bytewise */
-		for (n = 0; n < (int)(avail & 3); n++) {
-			*(buffer) = *(buffer) ^ mask[n];
-			buffer++;
-		}
-
-		wsi->ws->mask_idx = (wsi->ws->mask_idx + avail) & 3;
-	}
+	if (!wsi->ws->all_zero_nonce)
+		lws_ws_mask(buffer, avail, wsi->ws->mask, &wsi->ws->mask_idx);
 
 	lwsl_info("%s: using %d of raw input (total %d on offer)\n", __func__,
 		    avail, (int)len);
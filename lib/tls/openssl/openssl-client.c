@@ -109,6 +109,191 @@ OpenSSL_client_verify_callback(int preverify_ok, X509_STORE_CTX *x509_ctx)
 #endif
 
 
+#if defined(LWS_HAVE_SSL_SESSION_dup)
+
+/*
+ * Client session cache
+ *
+ * Servers give client connections a session, or in TLS1.3 tickets, that
+ * they can offer on a later connection to skip most of the handshake.  We
+ * keep them per vhost, keyed by the server name the cert is checked against,
+ * the address and port we connect to, and the LCCSCF_ flags deciding how
+ * strictly the cert was checked, and only offer one again if all of those
+ * match.
+ *
+ * TLS1.3 tickets should only be offered once, so they leave the cache when
+ * they are used.  The server normally sends fresh ones on the new connection.
+ *
+ * We keep a copy of the session rather than the one the SSL uses, since
+ * OpenSSL marks that one unresumable when the connection is freed without
+ * us having sent close_notify, which is the usual case when the server
+ * closes first.  TLS1.3 doesn't require that, and clients commonly ignore
+ * it for TLS1.2 as well.
+ *
+ * The cache is protected by the vhost lock.
+ */
+
+struct lws_tls_session {
+	struct lws_dll_lws list;
+	SSL_SESSION *session;
+	time_t expires;
+	/* the key string follows */
+};
+
+static void
+lws_tls_session_key(struct lws *wsi, const char *sni, char *buf, size_t len)
+{
+	lws_snprintf(buf, len, "%s %s:%u %x", sni,
+		     wsi->client_hostname_copy ? wsi->client_hostname_copy : "",
+		     wsi->c_port, wsi->tls.use_ssl);
+}
+
+static void
+__lws_tls_session_destroy(struct lws_vhost *vh, struct lws_tls_session *ts)
+{
+	lws_dll_lws_remove(&ts->list);
+	SSL_SESSION_free(ts->session);
+	lws_free(ts);
+	vh->tls.session_cache_count--;
+}
+
+/* find the key's session, dropping any expired ones we pass */
+
+static struct lws_tls_session *
+__lws_tls_session_lookup(struct lws_vhost *vh, const char *key, time_t now)
+{
+	lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1,
+				   vh->tls.session_head.next) {
+		struct lws_tls_session *ts = lws_container_of(d,
+					struct lws_tls_session, list);
+
+		if (ts->expires <= now)
+			__lws_tls_session_destroy(vh, ts);
+		else
+			if (!strcmp((const char *)&ts[1], key))
+				return ts;
+
+	} lws_end_foreach_dll_safe(d, d1);
+
+	return NULL;
+}
+
+static int
+lws_tls_session_new_cb(SSL *ssl, SSL_SESSION *session)
+{
+	struct lws *wsi = SSL_get_ex_data(ssl,
+					  openssl_websocket_private_data_index);
+	const char *sni = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+	time_t now = (time_t)lws_now_secs();
+	struct lws_tls_session *ts, *old;
+	struct lws_dll_lws *d;
+	struct lws_vhost *vh;
+	char key[256];
+	long life;
+	size_t n;
+
+	if (!wsi || !sni)
+		return 0; /* we didn't keep it */
+
+	vh = wsi->vhost;
+	lws_tls_session_key(wsi, sni, key, sizeof(key));
+	n = strlen(key) + 1;
+
+	ts = lws_malloc(sizeof(*ts) + n, "tls session");
+	if (!ts)
+		return 0;
+
+	ts->session = SSL_SESSION_dup(session);
+	if (!ts->session) {
+		lws_free(ts);
+		return 0;
+	}
+
+	memset(&ts->list, 0, sizeof(ts->list));
+	life = SSL_SESSION_get_timeout(session);
+	if (life <= 0 || life > (long)vh->tls.session_timeout)
+		life = (long)vh->tls.session_timeout;
+	ts->expires = now + life;
+	memcpy(&ts[1], key, n);
+
+	lws_vhost_lock(vh);
+
+	/* a newer session for the same key replaces the old one */
+	old = __lws_tls_session_lookup(vh, key, now);
+	if (old)
+		__lws_tls_session_destroy(vh, old);
+
+	if (vh->tls.session_cache_count >= vh->tls.session_cache_max) {
+		/* drop the oldest, it's at the end */
+		d = vh->tls.session_head.next;
+		while (d->next)
+			d = d->next;
+		__lws_tls_session_destroy(vh, lws_container_of(d,
+					  struct lws_tls_session, list));
+	}
+
+	lws_dll_lws_add_front(&ts->list, &vh->tls.session_head);
+	vh->tls.session_cache_count++;
+
+	lwsl_info("%s: kept session for %s (%d)\n", __func__, key,
+		  vh->tls.session_cache_count);
+
+	lws_vhost_unlock(vh);
+
+	return 0; /* we kept our own copy */
+}
+
+/* offer the session we kept for where the wsi is connecting, if any */
+
+static void
+lws_tls_session_offer(struct lws *wsi, const char *sni)
+{
+	struct lws_vhost *vh = wsi->vhost;
+	struct lws_tls_session *ts;
+	SSL_SESSION *s;
+	char key[256];
+
+	lws_tls_session_key(wsi, sni, key, sizeof(key));
+
+	lws_vhost_lock(vh);
+
+	ts = __lws_tls_session_lookup(vh, key, (time_t)lws_now_secs());
+	if (ts) {
+		/*
+		 * the SSL gets its own copy too, since a resumed TLS1.2
+		 * connection would otherwise mark the one we keep
+		 */
+		s = SSL_SESSION_dup(ts->session);
+		if (s) {
+			if (SSL_set_session(wsi->tls.ssl, s) == 1)
+				lwsl_info("%s: offering session for %s\n",
+					  __func__, key);
+			SSL_SESSION_free(s);
+		}
+#if defined(TLS1_3_VERSION)
+		if (SSL_SESSION_get_protocol_version(ts->session) ==
+								TLS1_3_VERSION)
+			__lws_tls_session_destroy(vh, ts);
+#endif
+	}
+
+	lws_vhost_unlock(vh);
+}
+
+#endif
+
+void
+lws_tls_session_cache_destroy(struct lws_vhost *vh)
+{
+#if defined(LWS_HAVE_SSL_SESSION_dup)
+	lws_start_foreach_dll_safe(struct lws_dll_lws *, d, d1,
+				   vh->tls.session_head.next) {
+		__lws_tls_session_destroy(vh, lws_container_of(d,
+					  struct lws_tls_session, list));
+	} lws_end_foreach_dll_safe(d, d1);
+#endif
+}
+
 int
 lws_ssl_client_bio_create(struct lws *wsi)
 {
@@ -179,6 +364,10 @@ lws_ssl_client_bio_create(struct lws *wsi)
 
 #if !defined(USE_WOLFSSL)
 	SSL_set_mode(wsi->tls.ssl,  SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+#endif
+#if defined(LWS_HAVE_SSL_SESSION_dup)
+	if (wsi->vhost->tls.session_cache_max)
+		lws_tls_session_offer(wsi, hostname);
 #endif
 	/*
 	 * use server name indication (SNI), if supported,
@@ -280,6 +469,11 @@ lws_tls_client_connect(struct lws *wsi)
 
 		lws_role_call_alpn_negotiated(wsi, (const char *)a);
 #endif
+		lws_stats_atomic_bump(wsi->context,
+				&wsi->context->pt[(int)wsi->tsi],
+				SSL_session_reused(wsi->tls.ssl) ?
+					LWSSTATS_C_SSL_CLIENT_SESSION_HIT :
+					LWSSTATS_C_SSL_CLIENT_SESSION_MISS, 1);
 		lwsl_info("client connect OK\n");
 		lws_openssl_describe_cipher(wsi);
 		return LWS_SSL_CAPABLE_DONE;
@@ -406,6 +600,24 @@ lws_tls_client_create_vhost_context(struct lws_vhost *vh,
 	SSL_CTX_set_options(vh->tls.ssl_client_ctx,
 			    SSL_OP_CIPHER_SERVER_PREFERENCE);
 
+#if defined(LWS_HAVE_SSL_SESSION_dup)
+	if (info->client_ssl_session_cache_max >= 0) {
+		/* we keep client sessions ourselves, see above */
+		vh->tls.session_cache_max = info->client_ssl_session_cache_max;
+		if (!vh->tls.session_cache_max)
+			vh->tls.session_cache_max = 32;
+		vh->tls.session_timeout = info->client_ssl_session_timeout;
+		if (!vh->tls.session_timeout)
+			vh->tls.session_timeout = 300;
+
+		SSL_CTX_set_session_cache_mode(vh->tls.ssl_client_ctx,
+					       SSL_SESS_CACHE_CLIENT |
+					       SSL_SESS_CACHE_NO_INTERNAL_STORE);
+		SSL_CTX_sess_set_new_cb(vh->tls.ssl_client_ctx,
+					lws_tls_session_new_cb);
+	}
+#endif
+
 	if (info->ssl_client_options_set)
 		SSL_CTX_set_options(vh->tls.ssl_client_ctx,
 				    info->ssl_client_options_set);
@@ -90,15 +90,18 @@ lws_tls_server_client_cert_verify_config(struct lws_vhost *vh)
 }
 
 #if defined(SSL_TLSEXT_ERR_NOACK) && !defined(OPENSSL_NO_TLSEXT)
-static int
-lws_ssl_server_name_cb(SSL *ssl, int *ad, void *arg)
+/*
+ * The vhost servername selects, or if it's NULL or doesn't match, the vhost
+ * whose ssl_ctx the connection is using.  This works the same before and
+ * after SSL_set_SSL_CTX() moved the connection to the SNI vhost's ssl_ctx,
+ * since SNI vhosts share the listening vhost's port.
+ */
+
+static struct lws_vhost *
+lws_ssl_server_name_vhost(struct lws_context *context, SSL *ssl,
+			  const char *servername)
 {
-	struct lws_context *context = (struct lws_context *)arg;
 	struct lws_vhost *vhost, *vh;
-	const char *servername;
-
-	if (!ssl)
-		return SSL_TLSEXT_ERR_NOACK;
 
 	/*
 	 * We can only get ssl accepted connections by using a vhost's ssl_ctx
@@ -115,28 +118,42 @@ lws_ssl_server_name_cb(SSL *ssl, int *ad, void *arg)
 
 	if (!vh) {
 		assert(vh); /* can't match the incoming vh? */
-		return SSL_TLSEXT_ERR_OK;
+		return NULL;
 	}
 
-	servername = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
 	if (!servername) {
 		/* the client doesn't know what hostname it wants */
 		lwsl_info("SNI: Unknown ServerName: %s\n", servername);
 
-		return SSL_TLSEXT_ERR_OK;
+		return vh;
 	}
 
 	vhost = lws_select_vhost(context, vh->listen_port, servername);
 	if (!vhost) {
 		lwsl_info("SNI: none: %s:%d\n", servername, vh->listen_port);
 
-		return SSL_TLSEXT_ERR_OK;
+		return vh;
 	}
 
 	lwsl_info("SNI: Found: %s:%d\n", servername, vh->listen_port);
 
-	/* select the ssl ctx from the selected vhost for this conn */
-	SSL_set_SSL_CTX(ssl, vhost->tls.ssl_ctx);
+	return vhost;
+}
+
+static int
+lws_ssl_server_name_cb(SSL *ssl, int *ad, void *arg)
+{
+	struct lws_context *context = (struct lws_context *)arg;
+	struct lws_vhost *vhost;
+
+	if (!ssl)
+		return SSL_TLSEXT_ERR_NOACK;
+
+	vhost = lws_ssl_server_name_vhost(context, ssl,
+			SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name));
+	if (vhost && vhost->tls.ssl_ctx != SSL_get_SSL_CTX(ssl))
+		/* select the ssl ctx from the selected vhost for this conn */
+		SSL_set_SSL_CTX(ssl, vhost->tls.ssl_ctx);
 
 	return SSL_TLSEXT_ERR_OK;
 }
@@ -371,6 +388,327 @@ post_ecdh:
 	return 0;
 }
 
+#if !defined(USE_WOLFSSL)
+
+/*
+ * Session ticket keys
+ *
+ * By default OpenSSL makes up a random ticket key for each SSL_CTX, so the
+ * tickets we issue are useless after a restart, or to another process
+ * serving the same vhost.  If we're given a file of keys instead, we encrypt
+ * and check tickets ourselves with those.
+ *
+ * The file is one or more 80-byte keys, in the same layout nginx uses: a
+ * 16-byte name sent in the clear in the ticket, a 32-byte HMAC-SHA256 secret
+ * and a 32-byte AES-256-CBC key.  The first key issues tickets, the others
+ * are only accepted, and tickets they made are renewed with the first key.
+ *
+ * The file is read again every reload_secs so keys can be rotated without a
+ * restart.  The ticket callback can come on any service thread, so the keys
+ * are protected by the vhost lock.
+ */
+
+#if defined(LWS_HAVE_SSL_CTX_set_tlsext_ticket_key_evp_cb)
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+typedef EVP_MAC_CTX lws_tls_ticket_hmac_ctx;
+#else
+typedef HMAC_CTX lws_tls_ticket_hmac_ctx;
+#endif
+
+#define LWS_TLS_TICKET_KEYS_MAX 4
+
+struct lws_tls_ticket_key {
+	uint8_t name[16];
+	uint8_t hmac[32];
+	uint8_t aes[32];
+};
+
+struct lws_tls_ticket_keys {
+	struct lws_tls_ticket_key key[LWS_TLS_TICKET_KEYS_MAX];
+	int count;
+	time_t last_check;
+	unsigned int reload_secs;
+	/* the file path follows */
+};
+
+static int
+lws_tls_ticket_keys_load(struct lws_vhost *vh)
+{
+	struct lws_tls_ticket_keys *tk = vh->tls.ticket_keys;
+	struct lws_tls_ticket_key key[LWS_TLS_TICKET_KEYS_MAX];
+	const char *path = (const char *)&tk[1];
+	lws_filepos_t amount;
+	uint8_t *buf;
+	int n, changed;
+
+	if (alloc_file(vh->context, path, &buf, &amount)) {
+		lwsl_err("%s: vhost %s: unable to read %s\n", __func__,
+			 vh->name, path);
+		return 1;
+	}
+
+	if (!amount || amount % sizeof(key[0])) {
+		lwsl_err("%s: vhost %s: %s must be a multiple of %d bytes\n",
+			 __func__, vh->name, path, (int)sizeof(key[0]));
+		lws_explicit_bzero(buf, (size_t)amount);
+		lws_free(buf);
+		return 1;
+	}
+
+	n = (int)(amount / sizeof(key[0]));
+	if (n > LWS_TLS_TICKET_KEYS_MAX) {
+		lwsl_warn("%s: vhost %s: only using the first %d keys in %s\n",
+			  __func__, vh->name, LWS_TLS_TICKET_KEYS_MAX, path);
+		n = LWS_TLS_TICKET_KEYS_MAX;
+	}
+
+	memcpy(key, buf, (unsigned int)n * sizeof(key[0]));
+	lws_explicit_bzero(buf, (size_t)amount);
+	lws_free(buf);
+
+	lws_vhost_lock(vh);
+	changed = n != tk->count ||
+		  memcmp(key, tk->key, (unsigned int)n * sizeof(key[0]));
+	memcpy(tk->key, key, (unsigned int)n * sizeof(key[0]));
+	tk->count = n;
+	lws_vhost_unlock(vh);
+
+	lws_explicit_bzero(key, sizeof(key));
+
+	if (changed)
+		lwsl_notice("%s: vhost %s: %d session ticket keys from %s\n",
+			    __func__, vh->name, n, path);
+
+	return 0;
+}
+
+static int
+lws_tls_ticket_hmac_init(lws_tls_ticket_hmac_ctx *hctx, const uint8_t *secret)
+{
+#if defined(LWS_HAVE_SSL_CTX_set_tlsext_ticket_key_evp_cb)
+	OSSL_PARAM params[2];
+
+	params[0] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+						     (char *)"SHA256", 0);
+	params[1] = OSSL_PARAM_construct_end();
+
+	return EVP_MAC_init(hctx, secret, 32, params) != 1;
+#else
+	return HMAC_Init_ex(hctx, secret, 32, EVP_sha256(), NULL) != 1;
+#endif
+}
+
+/*
+ * Returns -1 to fail the handshake, 0 to not issue a ticket or not accept
+ * the one offered, 1 if it's fine, or 2 if the offered ticket should be
+ * renewed.
+ */
+
+static int
+lws_tls_ticket_key_cb(SSL *ssl, unsigned char *name, unsigned char *iv,
+		      EVP_CIPHER_CTX *ectx, lws_tls_ticket_hmac_ctx *hctx,
+		      int enc)
+{
+	struct lws *wsi = SSL_get_ex_data(ssl,
+					  openssl_websocket_private_data_index);
+	const EVP_CIPHER *cipher = EVP_aes_256_cbc();
+	struct lws_tls_ticket_keys *tk;
+	struct lws_vhost *vh;
+	int n, ret = 1;
+
+	if (!wsi)
+		return 0;
+
+	/*
+	 * OpenSSL calls the callback of the SSL_CTX the connection was
+	 * accepted on, even if SNI moved it to another vhost's SSL_CTX, and
+	 * wsi->vhost is still the accepting vhost at this point.  So find the
+	 * SNI vhost ourselves, and use its keys if it has some.
+	 *
+	 * The offered ticket is checked before the servername callback, but
+	 * lws_tls_client_hello_cb() already switched SSL_CTX for us then.
+	 */
+	vh = wsi->vhost;
+#if defined(SSL_TLSEXT_ERR_NOACK) && !defined(OPENSSL_NO_TLSEXT)
+	{
+		struct lws_vhost *sni = lws_ssl_server_name_vhost(vh->context,
+			ssl, SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name));
+
+		if (sni && sni->tls.ticket_keys)
+			vh = sni;
+	}
+#endif
+	if (!vh->tls.ticket_keys)
+		return 0;
+
+	tk = vh->tls.ticket_keys;
+
+	lws_vhost_lock(vh);
+
+	if (enc) {
+		n = EVP_CIPHER_iv_length(cipher);
+		if (lws_get_random(vh->context, iv, n) != n) {
+			ret = -1;
+			goto bail;
+		}
+		memcpy(name, tk->key[0].name, sizeof(tk->key[0].name));
+		if (EVP_EncryptInit_ex(ectx, cipher, NULL, tk->key[0].aes,
+				       iv) != 1 ||
+		    lws_tls_ticket_hmac_init(hctx, tk->key[0].hmac))
+			ret = -1;
+		goto bail;
+	}
+
+	for (n = 0; n < tk->count; n++)
+		if (!memcmp(name, tk->key[n].name, sizeof(tk->key[n].name)))
+			break;
+
+	if (n == tk->count) {
+		/* not one of ours, or too old: do a full handshake */
+		ret = 0;
+		goto bail;
+	}
+
+	if (lws_tls_ticket_hmac_init(hctx, tk->key[n].hmac) ||
+	    EVP_DecryptInit_ex(ectx, cipher, NULL, tk->key[n].aes, iv) != 1) {
+		ret = -1;
+		goto bail;
+	}
+
+	/*
+	 * Reissue it if it's not from the current key.  TLS1.3 clients should
+	 * only use a ticket once, so they need a fresh one every time.
+	 */
+	if (n
+#if defined(TLS1_3_VERSION)
+	    || SSL_version(ssl) == TLS1_3_VERSION
+#endif
+	)
+		ret = 2;
+
+bail:
+	lws_vhost_unlock(vh);
+
+	return ret;
+}
+
+#if defined(LWS_HAVE_SSL_CTX_set_client_hello_cb) && \
+    defined(SSL_TLSEXT_ERR_NOACK) && !defined(OPENSSL_NO_TLSEXT)
+/*
+ * OpenSSL checks an offered ticket before it parses the SNI extension, so
+ * if we left switching to the SNI vhost's SSL_CTX to the servername
+ * callback, the ticket callback couldn't tell which vhost's keys to use.
+ * So where we handle tickets, we switch it here, as early as possible.
+ */
+
+static int
+lws_tls_client_hello_cb(SSL *ssl, int *al, void *arg)
+{
+	struct lws_context *context = (struct lws_context *)arg;
+	struct lws_vhost *vhost;
+	const unsigned char *p;
+	char name[256];
+	size_t len, n;
+
+	if (!SSL_client_hello_get0_ext(ssl, TLSEXT_TYPE_server_name, &p, &len))
+		return SSL_CLIENT_HELLO_SUCCESS;
+
+	/* list length, then the first entry must be a host_name */
+	if (len < 5 || (size_t)((p[0] << 8) | p[1]) != len - 2 ||
+	    p[2] != TLSEXT_NAMETYPE_host_name)
+		return SSL_CLIENT_HELLO_SUCCESS;
+
+	n = (size_t)((p[3] << 8) | p[4]);
+	if (!n || n > len - 5 || n >= sizeof(name))
+		return SSL_CLIENT_HELLO_SUCCESS;
+
+	memcpy(name, p + 5, n);
+	name[n] = '\0';
+
+	vhost = lws_ssl_server_name_vhost(context, ssl, name);
+	if (vhost && vhost->tls.ssl_ctx != SSL_get_SSL_CTX(ssl))
+		SSL_set_SSL_CTX(ssl, vhost->tls.ssl_ctx);
+
+	return SSL_CLIENT_HELLO_SUCCESS;
+}
+#endif
+
+static int
+lws_tls_server_ticket_keys_init(struct lws_vhost *vh,
+				const struct lws_context_creation_info *info)
+{
+	size_t n = strlen(info->ssl_ticket_key_filepath) + 1;
+
+	vh->tls.ticket_keys = lws_zalloc(sizeof(*vh->tls.ticket_keys) + n,
+					 "ticket keys");
+	if (!vh->tls.ticket_keys)
+		return 1;
+
+	memcpy(&vh->tls.ticket_keys[1], info->ssl_ticket_key_filepath, n);
+	vh->tls.ticket_keys->reload_secs = info->ssl_ticket_key_reload_secs;
+	if (!vh->tls.ticket_keys->reload_secs)
+		vh->tls.ticket_keys->reload_secs = 60;
+	vh->tls.ticket_keys->last_check = (time_t)lws_now_secs();
+
+	if (lws_tls_ticket_keys_load(vh))
+		return 1;
+
+#if defined(LWS_HAVE_SSL_CTX_set_tlsext_ticket_key_evp_cb)
+	SSL_CTX_set_tlsext_ticket_key_evp_cb(vh->tls.ssl_ctx,
+					     lws_tls_ticket_key_cb);
+#else
+	SSL_CTX_set_tlsext_ticket_key_cb(vh->tls.ssl_ctx,
+					 lws_tls_ticket_key_cb);
+#endif
+#if defined(LWS_HAVE_SSL_CTX_set_client_hello_cb) && \
+    defined(SSL_TLSEXT_ERR_NOACK) && !defined(OPENSSL_NO_TLSEXT)
+	SSL_CTX_set_client_hello_cb(vh->tls.ssl_ctx, lws_tls_client_hello_cb,
+				    vh->context);
+#endif
+
+	return 0;
+}
+
+#endif
+
+void
+lws_tls_server_ticket_keys_check(struct lws_vhost *vh, time_t now)
+{
+#if !defined(USE_WOLFSSL)
+	struct lws_tls_ticket_keys *tk = vh->tls.ticket_keys;
+	int due;
+
+	if (!tk)
+		return;
+
+	/* every service thread comes here, only one should reload */
+
+	lws_vhost_lock(vh);
+	due = now - tk->last_check >= (time_t)tk->reload_secs;
+	if (due)
+		tk->last_check = now;
+	lws_vhost_unlock(vh);
+
+	if (due)
+		/* on failure, we keep the keys we have */
+		lws_tls_ticket_keys_load(vh);
+#endif
+}
+
+void
+lws_tls_server_ticket_keys_destroy(struct lws_vhost *vh)
+{
+#if !defined(USE_WOLFSSL)
+	if (!vh->tls.ticket_keys)
+		return;
+
+	lws_explicit_bzero(vh->tls.ticket_keys->key,
+			   sizeof(vh->tls.ticket_keys->key));
+	lws_free_set_NULL(vh->tls.ticket_keys);
+#endif
+}
+
 int
 lws_tls_server_vhost_backend_init(const struct lws_context_creation_info *info,
 				  struct lws_vhost *vhost, struct lws *wsi)
@@ -438,6 +776,28 @@ lws_tls_server_vhost_backend_init(const struct lws_context_creation_info *info,
 				      info->ssl_options_clear);
 #endif
 
+	/*
+	 * The session cache belongs to the SSL_CTX, which all the service
+	 * threads use, so a session can be resumed on any of them
+	 */
+	if (info->ssl_session_cache_size < 0)
+		SSL_CTX_set_session_cache_mode(vhost->tls.ssl_ctx,
+					       SSL_SESS_CACHE_OFF);
+	else
+		if (info->ssl_session_cache_size)
+			SSL_CTX_sess_set_cache_size(vhost->tls.ssl_ctx,
+					(long)info->ssl_session_cache_size);
+
+	if (info->ssl_session_timeout)
+		SSL_CTX_set_timeout(vhost->tls.ssl_ctx,
+				    (long)info->ssl_session_timeout);
+
+#if !defined(USE_WOLFSSL)
+	if (info->ssl_ticket_key_filepath &&
+	    lws_tls_server_ticket_keys_init(vhost, info))
+		return 1;
+#endif
+
 	lwsl_info(" SSL options 0x%lX\n",
 			(unsigned long)SSL_CTX_get_options(vhost->tls.ssl_ctx));
 	if (!vhost->tls.use_ssl ||
@@ -529,6 +889,12 @@ lws_tls_server_accept(struct lws *wsi)
 
 		lws_openssl_describe_cipher(wsi);
 
+		lws_stats_atomic_bump(wsi->context,
+				&wsi->context->pt[(int)wsi->tsi],
+				SSL_session_reused(wsi->tls.ssl) ?
+					LWSSTATS_C_SSL_SERVER_SESSION_HIT :
+					LWSSTATS_C_SSL_SERVER_SESSION_MISS, 1);
+
 		if (SSL_pending(wsi->tls.ssl) &&
 		    lws_dll_is_null(&wsi->tls.pending_tls_list)) {
 			struct lws_context_per_thread *pt =
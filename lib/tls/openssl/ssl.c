@@ -149,9 +149,12 @@ lws_ssl_capable_read(struct lws *wsi, unsigned char *buf, int len)
 #endif
 #if defined(LWS_WITH_STATS)
 	if (!wsi->seen_rx && wsi->accept_start_us) {
-                lws_stats_atomic_bump(wsi->context, pt, LWSSTATS_MS_SSL_RX_DELAY,
-                		      lws_time_in_microseconds() -
-                			      wsi->accept_start_us);
+		uint64_t ul = lws_time_in_microseconds() -
+			      wsi->accept_start_us;
+
+		lws_stats_atomic_bump(wsi->context, pt,
+				      LWSSTATS_MS_SSL_RX_DELAY, ul);
+		lws_stats_hist_add(pt, LWSSTATS_H_SSL_RX_DELAY, ul);
                 lws_stats_atomic_bump(wsi->context, pt,
                 		      LWSSTATS_C_SSL_CONNS_HAD_RX, 1);
 		wsi->seen_rx = 1;
@@ -378,6 +381,9 @@ lws_ssl_SSL_CTX_destroy(struct lws_vhost *vhost)
 	if (vhost->tls.ssl_ctx)
 		SSL_CTX_free(vhost->tls.ssl_ctx);
 
+	lws_tls_session_cache_destroy(vhost);
+	lws_tls_server_ticket_keys_destroy(vhost);
+
 	if (!vhost->tls.user_supplied_ssl_ctx && vhost->tls.ssl_client_ctx)
 		SSL_CTX_free(vhost->tls.ssl_client_ctx);
 #if defined(LWS_WITH_ACME)
@@ -472,6 +478,11 @@ tops_periodic_housekeeping_openssl(struct lws_context *context, time_t now)
 	    !lws_tls_check_all_cert_lifetimes(context))
 		context->tls.last_cert_check_s = now;
 
+	lws_start_foreach_ll(struct lws_vhost *, v, context->vhost_list) {
+		if (!v->being_destroyed)
+			lws_tls_server_ticket_keys_check(v, now);
+	} lws_end_foreach_ll(v, vhost_next);
+
 	return 0;
 }
 
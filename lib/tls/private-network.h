@@ -61,6 +61,16 @@ struct lws_vhost_tls {
 	int allow_non_ssl_on_ssl_port;
 	int ssl_info_event_mask;
 
+#if defined(LWS_HAVE_SSL_SESSION_dup)
+	struct lws_dll_lws session_head; /* client sessions, newest first */
+	int session_cache_max;
+	int session_cache_count;
+	unsigned int session_timeout;
+#endif
+#if !defined(LWS_WITH_MBEDTLS)
+	struct lws_tls_ticket_keys *ticket_keys; /* server, if from a file */
+#endif
+
 	unsigned int user_supplied_ssl_ctx:1;
 	unsigned int skipped_certs:1;
 };
@@ -131,6 +141,23 @@ lws_tls_generic_cert_checks(struct lws_vhost *vhost, const char *cert,
 LWS_EXTERN void
 lws_ssl_destroy(struct lws_vhost *vhost);
 
+#if !defined(LWS_WITH_MBEDTLS) && !defined(LWS_NO_CLIENT)
+void
+lws_tls_session_cache_destroy(struct lws_vhost *vh);
+#else
+#define lws_tls_session_cache_destroy(_a)
+#endif
+
+#if !defined(LWS_WITH_MBEDTLS) && !defined(LWS_NO_SERVER)
+void
+lws_tls_server_ticket_keys_check(struct lws_vhost *vh, time_t now);
+void
+lws_tls_server_ticket_keys_destroy(struct lws_vhost *vh);
+#else
+#define lws_tls_server_ticket_keys_check(_a, _b)
+#define lws_tls_server_ticket_keys_destroy(_a)
+#endif
+
 /*
 * lws_tls_ abstract backend implementations
 */
@@ -387,11 +387,15 @@ lws_server_socket_service_ssl(struct lws *wsi, lws_sockfd_type accept_fd)
 		lws_stats_atomic_bump(wsi->context, pt,
 				      LWSSTATS_C_SSL_CONNECTIONS_ACCEPTED, 1);
 #if defined(LWS_WITH_STATS)
-		if (wsi->accept_start_us)
+		if (wsi->accept_start_us) {
+			uint64_t ul = lws_time_in_microseconds() -
+				      wsi->accept_start_us;
+
 			lws_stats_atomic_bump(wsi->context, pt,
 				      LWSSTATS_MS_SSL_CONNECTIONS_ACCEPTED_DELAY,
-				      lws_time_in_microseconds() -
-					      wsi->accept_start_us);
+				      ul);
+			lws_stats_hist_add(pt, LWSSTATS_H_SSL_ACCEPT_DELAY, ul);
+		}
 		wsi->accept_start_us = lws_time_in_microseconds();
 #endif
 
@@ -0,0 +1,423 @@
+/*
+ * lws-api-test-async-dns
+ *
+ * Copyright (C) 2019 Andy Green <andy@warmcat.com>
+ *
+ * This file is made available under the Creative Commons CC0 1.0
+ * Universal Public Domain Dedication.
+ *
+ * Runs a tiny stub DNS server on a udp socket in the same event loop, points
+ * the context's async dns at it with info.async_dns_server, and makes http
+ * client connections to names only the stub knows, served by our own vhost.
+ *
+ * It confirms lookups succeed, follow CNAMEs, are cached for their TTL (and
+ * not at all with TTL 0), that simultaneous connections to the same name
+ * share one query, and that NXDOMAIN and a nameserver that never answers
+ * both end in a connection error.  Retries must come from a new source port,
+ * a nameserver that doesn't keep the case of the question is asked again
+ * without random case, and the address in a truncated answer is used.
+ */
+
+#include <libwebsockets.h>
+#include <string.h>
+#include <signal.h>
+
+#define DNS_PORT	7790
+#define HTTP_PORT	7791
+
+/* how the stub answers A queries for each name, AAAA get no records */
+
+enum {
+	TC_WITH_RECORD = 1,
+	TC_EMPTY,
+};
+
+static struct stub_name {
+	const char *name;
+	const char *cname;	/* answer with a CNAME to this first */
+	uint32_t ttl;
+	int rcode;
+	int drop;		/* never answer */
+	int swapcase;		/* echo the question with its case swapped */
+	int tc;			/* set the truncated bit */
+	int count_a;		/* A queries seen */
+	int ports;		/* ... from a different port than the last */
+	uint16_t port;
+} names[] = {
+	{ "a.test",	NULL,	  30, 0, 0, 0, 0 },
+	{ "b.test",	NULL,	  30, 0, 0, 0, 0 },
+	{ "cname.test",	"a.test", 30, 0, 0, 0, 0 },
+	{ "zero.test",	NULL,	   0, 0, 0, 0, 0 },
+	{ "nx.test",	NULL,	  30, 3, 0, 0, 0 },
+	{ "drop.test",	NULL,	  30, 0, 1, 0, 0 },
+	{ "case.test",	NULL,	  30, 0, 0, 1, 0 },
+	{ "tc.test",	NULL,	  30, 0, 0, 0, TC_WITH_RECORD },
+	{ "tcempty.test", NULL,	  30, 0, 0, 0, TC_EMPTY },
+};
+
+/* each step connects to host, expecting success or failure and for the stub
+ * to have seen a_queries A queries for the host in total afterwards, from
+ * at least ports different source ports in a row */
+
+static const struct step {
+	const char *host;
+	int conns;
+	int ok;
+	int a_queries;
+	int ports;
+} steps[] = {
+	{ "a.test",	1, 1, 1, 1 },
+	{ "a.test",	1, 1, 1, 1 }, /* from the cache */
+	{ "cname.test",	1, 1, 1, 1 },
+	{ "zero.test",	1, 1, 1, 1 },
+	{ "zero.test",	1, 1, 2, 2 }, /* TTL 0 is not cached */
+	{ "b.test",	2, 1, 1, 1 }, /* both wait on one query */
+	{ "nx.test",	1, 0, 1, 1 },
+	{ "drop.test",	1, 0, 3, 2 }, /* tried 3 times, new ports */
+	{ "case.test",	1, 1, 2, 2 }, /* asked again without 0x20 */
+	{ "tc.test",	1, 1, 1, 1 },
+	{ "tcempty.test", 1, 0, 1, 1 },
+};
+
+static int interrupted, step = -1, step_done, step_ok, fails, advance = 1;
+
+struct pss {
+	int done;
+};
+
+static struct stub_name *
+find_name(const char *name)
+{
+	size_t n;
+
+	for (n = 0; n < LWS_ARRAY_SIZE(names); n++)
+		if (!strcasecmp(names[n].name, name))
+			return &names[n];
+
+	return NULL;
+}
+
+static uint8_t *
+put_name(uint8_t *p, const char *name)
+{
+	size_t n;
+
+	while (*name) {
+		n = strcspn(name, ".");
+		*p++ = (uint8_t)n;
+		memcpy(p, name, n);
+		p += n;
+		name += n;
+		if (*name)
+			name++;
+	}
+	*p++ = 0;
+
+	return p;
+}
+
+static uint8_t *
+put_rr(uint8_t *p, uint16_t name_ofs, uint16_t type, uint32_t ttl,
+       const uint8_t *rdata, uint16_t rdlen)
+{
+	*p++ = 0xc0 | (name_ofs >> 8);
+	*p++ = name_ofs & 0xff;
+	*p++ = type >> 8;
+	*p++ = type & 0xff;
+	*p++ = 0;
+	*p++ = 1;
+	*p++ = ttl >> 24;
+	*p++ = (ttl >> 16) & 0xff;
+	*p++ = (ttl >> 8) & 0xff;
+	*p++ = ttl & 0xff;
+	*p++ = rdlen >> 8;
+	*p++ = rdlen & 0xff;
+	memcpy(p, rdata, rdlen);
+
+	return p + rdlen;
+}
+
+static void
+count_query(struct stub_name *sn, uint16_t type, uint16_t port)
+{
+	if (type != 1)
+		return;
+
+	sn->count_a++;
+	if (port != sn->port)
+		sn->ports++;
+	sn->port = port;
+}
+
+/* returns length of the response to send in out, or 0 to send nothing */
+
+static int
+stub_answer(const uint8_t *q, int len, uint8_t *out, uint16_t port)
+{
+	static const uint8_t lo[4] = { 127, 0, 0, 1 };
+	uint8_t *p, cn[64], *cne;
+	struct stub_name *sn;
+	char name[128];
+	int qe = 12, o = 0, rcode = 0, an = 0, n;
+	uint16_t type, target = 12;
+
+	if (len < 17)
+		return 0;
+
+	while (qe < len && q[qe] && o < (int)sizeof(name) - 64) {
+		if (o)
+			name[o++] = '.';
+		memcpy(name + o, q + qe + 1, q[qe]);
+		o += q[qe];
+		qe += q[qe] + 1;
+	}
+	name[o] = '\0';
+	qe++;
+	if (qe + 4 > len)
+		return 0;
+	type = (q[qe] << 8) | q[qe + 1];
+	qe += 4;
+
+	sn = find_name(name);
+	if (sn)
+		count_query(sn, type, port);
+	if (sn && sn->drop)
+		return 0;
+
+	memcpy(out, q, qe);
+	p = out + qe;
+
+	if (!sn)
+		rcode = 3;
+	else {
+		rcode = sn->rcode;
+		if (sn->swapcase)
+			for (n = 12; n < qe - 4; n++)
+				if ((out[n] | 0x20) >= 'a' &&
+				    (out[n] | 0x20) <= 'z')
+					out[n] ^= 0x20;
+	}
+
+	if (!rcode && (!sn->tc || sn->tc == TC_WITH_RECORD)) {
+		if (sn->cname) {
+			cne = put_name(cn, sn->cname);
+			/* the A record names the CNAME target by pointer */
+			target = (uint16_t)(lws_ptr_diff(p, out) + 12);
+			p = put_rr(p, 12, 5, sn->ttl, cn,
+				   (uint16_t)lws_ptr_diff(cne, cn));
+			an++;
+		}
+		if (type == 1) {
+			p = put_rr(p, target, 1, sn->ttl, lo, 4);
+			an++;
+		}
+	}
+
+	out[2] = 0x81; /* response, recursion desired */
+	if (sn && sn->tc)
+		out[2] |= 0x02;
+	out[3] = 0x80 | rcode; /* recursion available */
+	out[6] = 0;
+	out[7] = an;
+
+	return lws_ptr_diff(p, out);
+}
+
+static void
+start_step(struct lws_context *context)
+{
+	struct lws_client_connect_info i;
+	int n;
+
+	memset(&i, 0, sizeof i);
+	i.context = context;
+	i.port = HTTP_PORT;
+	i.address = steps[step].host;
+	i.path = "/";
+	i.host = i.address;
+	i.origin = i.address;
+	i.method = "GET";
+	i.protocol = "http";
+
+	lwsl_user("step %d: connecting to %s x %d\n", step,
+		  steps[step].host, steps[step].conns);
+
+	step_done = step_ok = 0;
+
+	for (n = 0; n < steps[step].conns; n++)
+		if (!lws_client_connect_via_info(&i))
+			step_done++;
+}
+
+static void
+conn_result(struct lws *wsi, int ok)
+{
+	step_ok += ok;
+	if (++step_done == steps[step].conns) {
+		advance = 1;
+		lws_cancel_service(lws_get_context(wsi));
+	}
+}
+
+static int
+callback_http(struct lws *wsi, enum lws_callback_reasons reason,
+	      void *user, void *in, size_t len)
+{
+	struct pss *pss = (struct pss *)user;
+
+	switch (reason) {
+	case LWS_CALLBACK_CLIENT_CONNECTION_ERROR:
+		lwsl_user("  connection error: %s\n",
+			  in ? (char *)in : "(null)");
+		conn_result(wsi, 0);
+		break;
+
+	case LWS_CALLBACK_ESTABLISHED_CLIENT_HTTP:
+		if (pss->done)
+			break;
+		pss->done = 1;
+		lwsl_user("  connected, server response %d\n",
+			  lws_http_client_http_response(wsi));
+		conn_result(wsi, 1);
+		/* we're done with it */
+		lws_set_timeout(wsi, PENDING_TIMEOUT_KILLED_BY_PARENT,
+				LWS_TO_KILL_ASYNC);
+		break;
+
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static int
+callback_stub_dns(struct lws *wsi, enum lws_callback_reasons reason,
+		  void *user, void *in, size_t len)
+{
+	const struct lws_udp *udp;
+	uint8_t out[512];
+	int n;
+
+	switch (reason) {
+	case LWS_CALLBACK_RAW_RX:
+		udp = lws_get_udp(wsi);
+		n = stub_answer(in, (int)len, out,
+				ntohs(((struct sockaddr_in *)&udp->sa)->sin_port));
+		if (n && sendto(lws_get_socket_fd(wsi), (const char *)out, n, 0,
+				&udp->sa, udp->salen) != n)
+			lwsl_err("%s: sendto failed\n", __func__);
+		break;
+
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+static const struct lws_protocols protocols[] = {
+	{ "http", callback_http, sizeof(struct pss), 0 },
+	{ "stub-dns", callback_stub_dns, 0, 0 },
+	{ NULL, NULL, 0, 0 }
+};
+
+static void
+sigint_handler(int sig)
+{
+	interrupted = 1;
+}
+
+static int
+check_step(void)
+{
+	const struct step *s = &steps[step];
+	struct stub_name *sn = find_name(s->host);
+	int ok = s->ok ? s->conns : 0;
+
+	if (step_ok != ok || sn->count_a != s->a_queries ||
+	    sn->ports < s->ports) {
+		lwsl_err("step %d (%s): %d of %d ok, %d A queries from %d "
+			 "ports, expected %d ok, %d queries from %d\n", step,
+			 s->host, step_ok, s->conns, sn->count_a, sn->ports,
+			 ok, s->a_queries, s->ports);
+		return 1;
+	}
+
+	return 0;
+}
+
+int main(int argc, const char **argv)
+{
+	struct lws_context_creation_info info;
+	struct lws_context *context;
+	struct lws_vhost *vh;
+	const char *p;
+	time_t t;
+	int n = 0, logs = LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE;
+
+	signal(SIGINT, sigint_handler);
+
+	if ((p = lws_cmdline_option(argc, argv, "-d")))
+		logs = atoi(p);
+
+	lws_set_log_level(logs, NULL);
+	lwsl_user("LWS API selftest: async dns\n");
+
+	memset(&info, 0, sizeof info); /* otherwise uninitialized garbage */
+	info.options = LWS_SERVER_OPTION_EXPLICIT_VHOSTS;
+	info.port = HTTP_PORT;
+	info.protocols = protocols;
+	info.async_dns_server = "127.0.0.1:7790";
+
+	context = lws_create_context(&info);
+	if (!context) {
+		lwsl_err("lws init failed\n");
+		return 1;
+	}
+
+	/* our vhost serves the http, and the stub dns on its udp socket */
+
+	vh = lws_create_vhost(context, &info);
+	if (!vh || !lws_create_adopt_udp(vh, DNS_PORT, LWS_CAUDP_BIND,
+					 "stub-dns", NULL)) {
+		lwsl_err("%s: unable to create stub dns socket\n", __func__);
+		fails++;
+		goto bail;
+	}
+
+	t = time(NULL);
+	while (n >= 0 && !interrupted) {
+		if (advance) {
+			advance = 0;
+			if (step >= 0)
+				fails += check_step();
+			if (++step == (int)LWS_ARRAY_SIZE(steps))
+				break;
+			start_step(context);
+			if (step_done == steps[step].conns)
+				advance = 1;
+		}
+
+		if (time(NULL) - t > 30) {
+			lwsl_err("timed out in step %d\n", step);
+			fails++;
+			break;
+		}
+
+		n = lws_service(context, 1000);
+	}
+
+bail:
+	lws_context_destroy(context);
+
+	if (fails) {
+		lwsl_user("Completed: FAIL (%d)\n", fails);
+
+		return 1;
+	}
+
+	lwsl_user("Completed: PASS\n");
+
+	return 0;
+}
@@ -12,6 +12,9 @@
 #include <getopt.h>
 #endif
 #include <fcntl.h>
+#if defined(LWS_HAVE_PTHREAD_H)
+#include <pthread.h>
+#endif
 
 #if defined(LWS_HAS_GETOPT_LONG) || defined(WIN32)
 static struct option options[] = {
@@ -21,28 +24,214 @@ static struct option options[] = {
 	{ "debug",	required_argument,	NULL, 'd' },
 	{ "file",	required_argument,	NULL, 'f' },
 	{ "lines",	required_argument,	NULL, 'l' },
+	{ "jobs",	required_argument,	NULL, 'j' },
+	{ "all",	no_argument,		NULL, 'a' },
+	{ "any",	no_argument,		NULL, 'o' },
+	{ "phrase",	no_argument,		NULL, 'p' },
+	{ "unchecked",	no_argument,		NULL, 'u' },
 	{ NULL, 0, 0, 0 }
 };
 #endif
 
+#define MAX_SHARDS 64
+
+/* one of these per thread indexing its share of the input files */
+
+struct shard {
+#if defined(LWS_HAVE_PTHREAD_H)
+	pthread_t thread;
+#endif
+	char index_filepath[256];
+	char **files;
+	int count;
+	int result;
+};
+
 static const char *index_filepath = "/tmp/lws-fts-test-index";
 static char filepath[256];
 
+/*
+ * create an index by shifting through files and indexing each one into a
+ * single combined index
+ */
+
+static int
+create_index(const char *path, char **files, int count)
+{
+	int ft, fd, fi, n, ret = 1;
+	struct lws_fts *t;
+	char buf[16384];
+
+	ft = open(path, O_CREAT | O_WRONLY | O_TRUNC, 0600);
+	if (ft < 0) {
+		lwsl_err("%s: can't open index %s\n", __func__, path);
+
+		return 1;
+	}
+
+	t = lws_fts_create(ft);
+	if (!t) {
+		lwsl_err("%s: Unable to allocate trie\n", __func__);
+
+		goto bail;
+	}
+
+	while (count--) {
+
+		fi = lws_fts_file_index(t, *files, strlen(*files), 1);
+		if (fi < 0) {
+			lwsl_err("%s: Failed to get file idx for %s\n",
+				 __func__, *files);
+
+			goto bail1;
+		}
+
+		fd = open(*files, O_RDONLY);
+		if (fd < 0) {
+			lwsl_err("unable to open %s for read\n", *files);
+			goto bail1;
+		}
+
+		do {
+			n = read(fd, buf, sizeof(buf));
+			if (n <= 0)
+				break;
+
+			if (lws_fts_fill(t, fi, buf, n)) {
+				lwsl_err("%s: lws_fts_fill failed\n",
+					 __func__);
+				close(fd);
+
+				goto bail1;
+			}
+
+		} while (1);
+
+		close(fd);
+		files++;
+	}
+
+	if (lws_fts_serialize(t)) {
+		lwsl_err("%s: serialize failed\n", __func__);
+
+		goto bail1;
+	}
+
+	ret = 0;
+
+bail1:
+	lws_fts_destroy(&t);
+bail:
+	close(ft);
+
+	return ret;
+}
+
+#if defined(LWS_HAVE_PTHREAD_H)
+static void *
+thread_shard(void *d)
+{
+	struct shard *sh = (struct shard *)d;
+
+	sh->result = create_index(sh->index_filepath, sh->files, sh->count);
+
+	pthread_exit(NULL);
+}
+#endif
+
+/*
+ * Split the files into contiguous runs, one per thread, and index each run
+ * into its own temporary index.  Then merge those into one index, which lists
+ * the files in the same order as if we had indexed them all on one thread.
+ */
+
+static int
+create_index_sharded(const char *path, char **files, int count, int threads)
+{
+	const char *paths[MAX_SHARDS];
+	struct shard shards[MAX_SHARDS];
+	unsigned long long us;
+	int n, ft, ret = 0;
+
+	if (threads > count)
+		threads = count;
+
+	us = lws_time_in_microseconds();
+
+	for (n = 0; n < threads; n++) {
+		struct shard *sh = &shards[n];
+
+		lws_snprintf(sh->index_filepath, sizeof(sh->index_filepath),
+			     "%s.shard%d", path, n);
+		paths[n] = sh->index_filepath;
+		sh->files = files + ((count * n) / threads);
+		sh->count = (int)((files + ((count * (n + 1)) / threads)) -
+				  sh->files);
+		sh->result = 1;
+#if defined(LWS_HAVE_PTHREAD_H)
+		if (pthread_create(&sh->thread, NULL, thread_shard, sh)) {
+			lwsl_err("%s: thread creation failed\n", __func__);
+			threads = n;
+			ret = 1;
+			break;
+		}
+#else
+		/* no threads... we can still show the merge works */
+		sh->result = create_index(sh->index_filepath, sh->files,
+					  sh->count);
+#endif
+	}
+
+	for (n = 0; n < threads; n++) {
+#if defined(LWS_HAVE_PTHREAD_H)
+		pthread_join(shards[n].thread, NULL);
+#endif
+		ret |= shards[n].result;
+	}
+
+	if (ret)
+		goto bail;
+
+	lwsl_notice("%s: %d shards indexed in %llums\n", __func__, threads,
+		    (lws_time_in_microseconds() - us) / 1000);
+
+	us = lws_time_in_microseconds();
+
+	ft = open(path, O_CREAT | O_WRONLY | O_TRUNC, 0600);
+	if (ft < 0) {
+		lwsl_err("%s: can't open index %s\n", __func__, path);
+		ret = 1;
+
+		goto bail;
+	}
+
+	ret = lws_fts_merge(ft, paths, threads);
+	close(ft);
+
+	lwsl_notice("%s: merged in %llums\n", __func__,
+		    (lws_time_in_microseconds() - us) / 1000);
+
+bail:
+	for (n = 0; n < threads; n++)
+		unlink(shards[n].index_filepath);
+
+	return ret;
+}
+
 int main(int argc, char **argv)
 {
 	int n, logs = LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE;
-	int fd, fi, ft, createindex = 0, flags = LWSFTS_F_QUERY_AUTOCOMPLETE;
+	int createindex = 0, flags = LWSFTS_F_QUERY_AUTOCOMPLETE, threads = 1;
 	struct lws_fts_search_params params;
 	struct lws_fts_result *result;
 	struct lws_fts_file *jtf;
-	struct lws_fts *t;
-	char buf[16384];
+	unsigned long long us;
 
 	do {
 #if defined(LWS_HAS_GETOPT_LONG) || defined(WIN32)
-		n = getopt_long(argc, argv, "hd:i:cfl", options, NULL);
+		n = getopt_long(argc, argv, "hd:i:cflj:aopu", options, NULL);
 #else
-       n = getopt(argc, argv, "hd:i:cfl");
+       n = getopt(argc, argv, "hd:i:cflj:aopu");
 #endif
 		if (n < 0)
 			continue;
@@ -66,10 +255,34 @@ int main(int argc, char **argv)
 			flags |= LWSFTS_F_QUERY_FILES |
 				 LWSFTS_F_QUERY_FILE_LINES;
 			break;
+		case 'a':
+		case 'o':
+		case 'p':
+			/* each searchterm is a list of terms, with file results */
+			flags &= ~LWSFTS_F_QUERY_AUTOCOMPLETE;
+			flags |= LWSFTS_F_QUERY_FILES;
+			if (n == 'a')
+				flags |= LWSFTS_F_QUERY_ALL_TERMS;
+			if (n == 'o')
+				flags |= LWSFTS_F_QUERY_ANY_TERM;
+			if (n == 'p')
+				flags |= LWSFTS_F_QUERY_PHRASE;
+			break;
+		case 'u':
+			flags |= LWSFTS_F_QUERY_PHRASE_UNCHECKED;
+			break;
+		case 'j':
+			threads = atoi(optarg);
+			if (threads < 1 || threads > MAX_SHARDS) {
+				lwsl_err("-j must be 1 to %d\n", MAX_SHARDS);
+				exit(1);
+			}
+			break;
 		case 'h':
 			fprintf(stderr,
-				"Usage: %s [--createindex]"
+				"Usage: %s [--createindex [-j <threads>]]"
 					"[--index=<index filepath>] "
+					"[--all | --any | --phrase [--unchecked]] "
 					"[-d <log bitfield>] file1 file2 \n",
 					argv[0]);
 			exit(1);
@@ -83,72 +296,19 @@ int main(int argc, char **argv)
 
 		lwsl_notice("Creating index\n");
 
-		/*
-		 * create an index by shifting through argv and indexing each
-		 * file given there into a single combined index
-		 */
-
-		ft = open(index_filepath, O_CREAT | O_WRONLY | O_TRUNC, 0600);
-		if (ft < 0) {
-			lwsl_err("%s: can't open index %s\n", __func__,
-				 index_filepath);
+		us = lws_time_in_microseconds();
 
+		if (threads == 1)
+			n = create_index(index_filepath, argv + optind,
+					 argc - optind);
+		else
+			n = create_index_sharded(index_filepath, argv + optind,
+						 argc - optind, threads);
+		if (n)
 			goto bail;
-		}
-
-		t = lws_fts_create(ft);
-		if (!t) {
-			lwsl_err("%s: Unable to allocate trie\n", __func__);
-
-			goto bail1;
-		}
-
-		while (optind < argc) {
-
-			fi = lws_fts_file_index(t, argv[optind],
-						strlen(argv[optind]), 1);
-			if (fi < 0) {
-				lwsl_err("%s: Failed to get file idx for %s\n",
-					 __func__, argv[optind]);
-
-				goto bail1;
-			}
-
-			fd = open(argv[optind], O_RDONLY);
-			if (fd < 0) {
-				lwsl_err("unable to open %s for read\n",
-						argv[optind]);
-				goto bail;
-			}
-
-			do {
-				int n = read(fd, buf, sizeof(buf));
-
-				if (n <= 0)
-					break;
 
-				if (lws_fts_fill(t, fi, buf, n)) {
-					lwsl_err("%s: lws_fts_fill failed\n",
-						 __func__);
-					close(fd);
-
-					goto bail;
-				}
-
-			} while (1);
-
-			close(fd);
-			optind++;
-		}
-
-		if (lws_fts_serialize(t)) {
-			lwsl_err("%s: serialize failed\n", __func__);
-
-			goto bail;
-		}
-
-		lws_fts_destroy(&t);
-		close(ft);
+		lwsl_notice("Index created in %llums\n",
+			    (lws_time_in_microseconds() - us) / 1000);
 
 		return 0;
 	}
@@ -198,16 +358,30 @@ int main(int argc, char **argv)
 		if (!fp)
 			lwsl_notice("%s: no filepath results\n", __func__);
 
+		if ((flags & LWSFTS_F_QUERY_PHRASE) &&
+		    !(result->effective_flags & LWSFTS_F_QUERY_PHRASE))
+			lwsl_notice("%s: phrase not checked\n", __func__);
+
 		while (fp) {
 			lwsl_notice("%s: %s: (%d lines) %d hits \n", __func__,
 				(((char *)(fp + 1)) + fp->matches_length),
 				fp->lines_in_file, fp->matches);
 
+			/*
+			 * each match is its line number and the file offset
+			 * of the line, followed by a pointer to the quoted
+			 * line if we asked for that
+			 */
 			if (fp->matches_length) {
 				l = (uint32_t *)(fp + 1);
 				n = 0;
-				while ((int)n++ < fp->matches)
-					lwsl_notice(" %d\n", *l++);
+				while ((int)n++ < fp->matches) {
+					lwsl_notice(" %u @ %u\n", l[0], l[1]);
+					l += 2;
+					if (flags & LWSFTS_F_QUERY_QUOTE_LINE)
+						l += sizeof(const char *) /
+						     sizeof(uint32_t);
+				}
 			}
 			fp = fp->next;
 		}
@@ -221,8 +395,6 @@ int main(int argc, char **argv)
 
 	return 0;
 
-bail1:
-	close(ft);
 bail:
 	lwsl_user("FAILED\n");
 
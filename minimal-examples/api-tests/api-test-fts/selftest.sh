@@ -18,7 +18,7 @@
 
 . $5/selftests-library.sh
 
-COUNT_TESTS=4
+COUNT_TESTS=11
 
 FAILS=0
 
@@ -55,4 +55,85 @@ if [ $? -ne 0 ] ; then
 	FAILS=$(( $FAILS + 1 ))
 fi
 
+#
+# the same two files indexed on two threads and merged must give the same
+# results as indexing them in one go
+#
+dotest $1 $2 apitest -c -j2 -i /tmp/lws-fts-both-j2.index \
+   "../minimal-examples/api-tests/api-test-fts/the-picture-of-dorian-gray.txt" \
+   "../minimal-examples/api-tests/api-test-fts/les-mis-utf8.txt"
+
+dotest $1 $2 apitest -i /tmp/lws-fts-both-j2.index -f -l help
+cat $2/api-test-fts/apitest.log | cut -d' ' -f5- > /tmp/fts3
+diff -urN /tmp/fts3 "../minimal-examples/api-tests/api-test-fts/canned-2.txt"
+if [ $? -ne 0 ] ; then
+	echo "Test 3 failed"
+	FAILS=$(( $FAILS + 1 ))
+fi
+
+#
+# phrases, which must be on one line with the terms in order... anything that
+# can't be in a symbol separates the terms, since we can't pass spaces here
+#
+dotest $1 $2 apitest -i /tmp/lws-fts-both.index -p lord+henry jean+valjean \
+   henry+lord
+cat $2/api-test-fts/apitest.log | cut -d' ' -f5- > /tmp/fts4
+diff -urN /tmp/fts4 "../minimal-examples/api-tests/api-test-fts/canned-3.txt"
+if [ $? -ne 0 ] ; then
+	echo "Test 4 failed"
+	FAILS=$(( $FAILS + 1 ))
+fi
+
+#
+# from another directory, the relative input filepaths in the index can't be
+# opened, so the phrase can't be checked... and there must be no results,
+# unless we ask for the unchecked lines with all the terms
+#
+QQ=`pwd`
+cd /
+dotest $1 $2 apitest -i /tmp/lws-fts-both.index -p henry+lord
+cd $QQ
+cat $2/api-test-fts/apitest.log | cut -d' ' -f5- > /tmp/fts5
+diff -urN /tmp/fts5 "../minimal-examples/api-tests/api-test-fts/canned-4.txt"
+if [ $? -ne 0 ] ; then
+	echo "Test 5 failed"
+	FAILS=$(( $FAILS + 1 ))
+fi
+
+cd /
+dotest $1 $2 apitest -i /tmp/lws-fts-both.index -p -u henry+lord
+cd $QQ
+cat $2/api-test-fts/apitest.log | cut -d' ' -f5- > /tmp/fts6
+diff -urN /tmp/fts6 "../minimal-examples/api-tests/api-test-fts/canned-5.txt"
+if [ $? -ne 0 ] ; then
+	echo "Test 6 failed"
+	FAILS=$(( $FAILS + 1 ))
+fi
+
+#
+# all the terms, anywhere in the file: lord+henry are only both in Dorian, so
+# Les Mis is skipped, help+monsieur are in both, and a term that isn't in the
+# index means no results at all
+#
+dotest $1 $2 apitest -i /tmp/lws-fts-both.index -a lord+henry help+monsieur \
+   zzz+henry
+cat $2/api-test-fts/apitest.log | cut -d' ' -f5- > /tmp/fts7
+diff -urN /tmp/fts7 "../minimal-examples/api-tests/api-test-fts/canned-6.txt"
+if [ $? -ne 0 ] ; then
+	echo "Test 7 failed"
+	FAILS=$(( $FAILS + 1 ))
+fi
+
+#
+# any of the terms: a term that isn't in the index is just ignored
+#
+dotest $1 $2 apitest -i /tmp/lws-fts-both.index -o zzz+henry lord+jean \
+   zzz+qqq
+cat $2/api-test-fts/apitest.log | cut -d' ' -f5- > /tmp/fts8
+diff -urN /tmp/fts8 "../minimal-examples/api-tests/api-test-fts/canned-7.txt"
+if [ $? -ne 0 ] ; then
+	echo "Test 8 failed"
+	FAILS=$(( $FAILS + 1 ))
+fi
+
 exit $FAILS
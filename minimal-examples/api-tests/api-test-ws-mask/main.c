@@ -0,0 +1,129 @@
+/*
+ * lws-api-test-ws-mask
+ *
+ * Copyright (C) 2019 Andy Green <andy@warmcat.com>
+ *
+ * This file is made available under the Creative Commons CC0 1.0
+ * Universal Public Domain Dedication.
+ *
+ * Confirms lws_ws_mask() agrees with bytewise masking for every combination
+ * of length, alignment and starting mask index that matters, including
+ * masking a payload in several pieces.  With -b, also compares its
+ * throughput with the bytewise loop.
+ */
+
+#include <libwebsockets.h>
+
+static const uint8_t mask[4] = { 0x37, 0xfa, 0x21, 0x3d };
+
+static void
+ref_mask(uint8_t *buf, size_t len, uint8_t *mask_idx)
+{
+	while (len--)
+		*buf++ ^= mask[(*mask_idx)++ & 3];
+
+	*mask_idx &= 3;
+}
+
+static void
+fill(uint8_t *buf, size_t len, unsigned int seed)
+{
+	while (len--) {
+		seed = seed * 1103515245 + 12345;
+		*buf++ = (uint8_t)(seed >> 16);
+	}
+}
+
+static int
+test_one(size_t len, int align, uint8_t idx, size_t split)
+{
+	uint8_t a[600], b[600], ia = idx, ib = idx;
+
+	fill(a, sizeof(a), (unsigned int)(len * 131 + align * 7 + idx));
+	memcpy(b, a, sizeof(a));
+
+	ref_mask(a + align, len, &ia);
+
+	if (split > len)
+		split = len;
+
+	lws_ws_mask(b + align, split, mask, &ib);
+	lws_ws_mask(b + align + split, len - split, mask, &ib);
+
+	if (memcmp(a, b, sizeof(a)) || ia != ib) {
+		lwsl_err("%s: FAIL len %d align %d idx %d split %d\n",
+			 __func__, (int)len, align, idx, (int)split);
+		return 1;
+	}
+
+	return 0;
+}
+
+static void
+bench(size_t len, int loops)
+{
+	uint8_t *buf = malloc(len), idx = 0;
+	lws_usec_t t;
+	int n;
+
+	if (!buf)
+		return;
+
+	fill(buf, len, 1);
+
+	t = lws_time_in_microseconds();
+	for (n = 0; n < loops; n++)
+		ref_mask(buf, len, &idx);
+	t = lws_time_in_microseconds() - t;
+	lwsl_user("  bytewise:    %8llu MB/s\n", (unsigned long long)
+		  ((uint64_t)len * (uint64_t)loops / (uint64_t)(t ? t : 1)));
+
+	t = lws_time_in_microseconds();
+	for (n = 0; n < loops; n++)
+		lws_ws_mask(buf, len, mask, &idx);
+	t = lws_time_in_microseconds() - t;
+	lwsl_user("  lws_ws_mask: %8llu MB/s\n", (unsigned long long)
+		  ((uint64_t)len * (uint64_t)loops / (uint64_t)(t ? t : 1)));
+
+	free(buf);
+}
+
+int main(int argc, const char **argv)
+{
+	int align, fails = 0, logs = LLL_USER | LLL_ERR | LLL_WARN |
+				    LLL_NOTICE;
+	const char *p;
+	size_t len;
+	uint8_t idx;
+
+	if ((p = lws_cmdline_option(argc, argv, "-d")))
+		logs = atoi(p);
+
+	lws_set_log_level(logs, NULL);
+	lwsl_user("LWS API selftest: ws mask\n");
+
+	for (len = 0; len < 520; len++)
+		for (align = 0; align < 8; align++)
+			for (idx = 0; idx < 4; idx++) {
+				fails += test_one(len, align, idx, len);
+				fails += test_one(len, align, idx, len / 3);
+				fails += test_one(len, align, idx, 5);
+			}
+
+	if (lws_cmdline_option(argc, argv, "-b")) {
+		lwsl_user("Benchmark: 64 x 1MiB\n");
+		bench(1024 * 1024, 64);
+		lwsl_user("Benchmark: 65536 x 1KiB\n");
+		bench(1024, 65536);
+	}
+
+	if (fails) {
+		lwsl_user("Completed: FAIL (%d)\n", fails);
+
+		return 1;
+	}
+
+	lwsl_user("Completed: PASS\n");
+
+	return 0;
+}
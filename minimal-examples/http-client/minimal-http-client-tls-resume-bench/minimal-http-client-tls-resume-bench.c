@@ -0,0 +1,419 @@
+/*
+ * lws-minimal-http-client-tls-resume-bench
+ *
+ * Copyright (C) 2019 Andy Green <andy@warmcat.com>
+ *
+ * This file is made available under the Creative Commons CC0 1.0
+ * Universal Public Domain Dedication.
+ *
+ * This measures what the client tls session cache saves on connections
+ * that are made again and again to the same server.
+ *
+ * The main thread runs a tls http server.  A second thread runs a client
+ * context that makes one GET after another to it, each on a new connection,
+ * since the server answers with "connection: close".  When they are all
+ * done, we report how long they took, the client thread's cpu time and how
+ * many handshakes resumed a session, from the client's lws stats.
+ *
+ * With -r, the client vhost keeps no sessions, so every connection does a
+ * full handshake.
+ *
+ * With -k <file>, the server takes its session ticket keys from the file,
+ * eg, made with "openssl rand 80 > ticket.key".
+ *
+ * With --restart, the server context is destroyed and created again after
+ * half the connections, and it fails unless every connection after the
+ * first resumed a session... so it needs -k.
+ *
+ * With --sni, the server has two vhosts on the port: "default", which
+ * listens and makes up new ticket keys each time it starts, and
+ * "localhost", the name the client asks for, which uses the -k keys.
+ */
+
+#include <libwebsockets.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+static struct lws_context *context, *cx_client;
+static const char *keyfile;
+static char keyfile_default[256];
+static int interrupted, port = 7681, conns = 500, tls12, done, ok,
+	   result = 1, restart, sni;
+static volatile int restart_state;
+static uint64_t server_hits, server_misses;
+static struct timespec wall_start, wall_end, cpu_start, cpu_end;
+
+static int
+callback_server(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+		void *in, size_t len)
+{
+	uint8_t buf[LWS_PRE + 256], *start = &buf[LWS_PRE], *p = start,
+		*end = &buf[sizeof(buf) - 1];
+
+	switch (reason) {
+	case LWS_CALLBACK_HTTP:
+		/* no content length, so the connection closes afterwards */
+		if (lws_add_http_common_headers(wsi, HTTP_STATUS_OK,
+				"text/plain", LWS_ILLEGAL_HTTP_CONTENT_LEN,
+				&p, end))
+			return 1;
+		if (lws_finalize_write_http_header(wsi, start, &p, end))
+			return 1;
+		lws_callback_on_writable(wsi);
+		return 0;
+
+	case LWS_CALLBACK_HTTP_WRITEABLE:
+		memcpy(start, "ok\n", 3);
+		if (lws_write(wsi, start, 3, LWS_WRITE_HTTP_FINAL) != 3)
+			return 1;
+		if (lws_http_transaction_completed(wsi))
+			return -1;
+		return 0;
+
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static int
+client_connect(void)
+{
+	struct lws_client_connect_info i;
+
+	memset(&i, 0, sizeof i); /* otherwise uninitialized garbage */
+	i.context = cx_client;
+	i.ssl_connection = LCCSCF_USE_SSL | LCCSCF_ALLOW_SELFSIGNED;
+	i.port = port;
+	i.address = "localhost";
+	i.host = i.address;
+	i.origin = i.address;
+	i.path = "/";
+	i.method = "GET";
+	i.alpn = "http/1.1";
+	i.protocol = "http";
+
+	return !lws_client_connect_via_info(&i);
+}
+
+static int
+callback_client(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+		void *in, size_t len)
+{
+	switch (reason) {
+	case LWS_CALLBACK_CLIENT_CONNECTION_ERROR:
+		lwsl_err("CLIENT_CONNECTION_ERROR: %s\n",
+			 in ? (char *)in : "(null)");
+		interrupted = 1;
+		break;
+
+	case LWS_CALLBACK_ESTABLISHED_CLIENT_HTTP:
+		if (lws_http_client_http_response(wsi) != 200) {
+			lwsl_err("%s: bad response %d\n", __func__,
+				 lws_http_client_http_response(wsi));
+			interrupted = 1;
+			return -1;
+		}
+		ok = 1;
+		break;
+
+	case LWS_CALLBACK_RECEIVE_CLIENT_HTTP_READ:
+		return 0;
+
+	case LWS_CALLBACK_RECEIVE_CLIENT_HTTP:
+		{
+			char buffer[1024 + LWS_PRE];
+			char *px = buffer + LWS_PRE;
+			int lenx = sizeof(buffer) - LWS_PRE;
+
+			if (lws_http_client_read(wsi, &px, &lenx) < 0)
+				return -1;
+		}
+		return 0;
+
+	case LWS_CALLBACK_CLOSED_CLIENT_HTTP:
+		/* the server closes the connection after the response */
+		if (!ok) {
+			interrupted = 1;
+			break;
+		}
+		ok = 0;
+		if (++done == conns) {
+			result = 0;
+			interrupted = 1;
+			lws_cancel_service(context);
+			break;
+		}
+		if (restart && done == conns / 2) {
+			/* the server restarts, and then wakes us to go on */
+			restart_state = 1;
+			lws_cancel_service(context);
+			break;
+		}
+		/* the next one, on a new connection */
+		if (client_connect()) {
+			lwsl_err("%s: connect failed\n", __func__);
+			interrupted = 1;
+		}
+		break;
+
+	case LWS_CALLBACK_EVENT_WAIT_CANCELLED:
+		if (restart_state != 2)
+			break;
+		restart_state = 0;
+		if (client_connect()) {
+			lwsl_err("%s: connect failed\n", __func__);
+			interrupted = 1;
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static const struct lws_protocols protocols_server[] = {
+	{ "http", callback_server, 0, 0 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static const struct lws_protocols protocols_client[] = {
+	{ "http", callback_client, 0, 0 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static void *
+thread_client(void *d)
+{
+	int n = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &wall_start);
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_start);
+
+	if (client_connect()) {
+		lwsl_err("%s: connect failed\n", __func__);
+		goto bail;
+	}
+
+	while (n >= 0 && !interrupted)
+		n = lws_service(cx_client, 1000);
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_end);
+	clock_gettime(CLOCK_MONOTONIC, &wall_end);
+
+bail:
+	interrupted = 1;
+	lws_cancel_service(context);
+
+	return NULL;
+}
+
+void sigint_handler(int sig)
+{
+	interrupted = 1;
+}
+
+static double
+secs(struct timespec *a, struct timespec *b)
+{
+	return (double)(b->tv_sec - a->tv_sec) +
+	       (double)(b->tv_nsec - a->tv_nsec) / 1e9;
+}
+
+static struct lws_context *
+server_create(void)
+{
+	struct lws_context_creation_info info;
+	struct lws_context *cx;
+	uint8_t key[80];
+	int fd;
+
+	memset(&info, 0, sizeof info); /* otherwise uninitialized garbage */
+	info.port = port;
+	info.protocols = protocols_server;
+	info.options = LWS_SERVER_OPTION_DO_SSL_GLOBAL_INIT;
+	info.ssl_cert_filepath = "localhost-100y.cert";
+	info.ssl_private_key_filepath = "localhost-100y.key";
+	info.ssl_ticket_key_filepath = keyfile;
+
+	if (!sni)
+		return lws_create_context(&info);
+
+	info.options |= LWS_SERVER_OPTION_EXPLICIT_VHOSTS;
+	cx = lws_create_context(&info);
+	if (!cx)
+		return NULL;
+
+	/*
+	 * The listening vhost gets new keys each time, only the SNI vhost's
+	 * keys can resume sessions from before a restart
+	 */
+	if (lws_get_random(cx, key, sizeof(key)) != sizeof(key))
+		goto bail;
+	fd = open(keyfile_default, O_CREAT | O_TRUNC | O_WRONLY, 0600);
+	if (fd < 0)
+		goto bail;
+	if (write(fd, key, sizeof(key)) != sizeof(key)) {
+		close(fd);
+		goto bail;
+	}
+	close(fd);
+
+	info.vhost_name = "default";
+	info.ssl_ticket_key_filepath = keyfile_default;
+	if (!lws_create_vhost(cx, &info))
+		goto bail;
+
+	info.vhost_name = "localhost";
+	info.ssl_ticket_key_filepath = keyfile;
+	if (!lws_create_vhost(cx, &info))
+		goto bail;
+
+	return cx;
+
+bail:
+	lws_context_destroy(cx);
+
+	return NULL;
+}
+
+static int
+server_restart(void)
+{
+	server_hits += lws_stats_get(context,
+				     LWSSTATS_C_SSL_SERVER_SESSION_HIT);
+	server_misses += lws_stats_get(context,
+				       LWSSTATS_C_SSL_SERVER_SESSION_MISS);
+	lws_context_destroy(context);
+
+	lwsl_user("restarting the server after %d connections\n", done);
+
+	context = server_create();
+	if (!context) {
+		lwsl_err("server restart failed\n");
+		return 1;
+	}
+
+	restart_state = 2;
+	lws_cancel_service(cx_client);
+
+	return 0;
+}
+
+int main(int argc, const char **argv)
+{
+	struct lws_context_creation_info info;
+	pthread_t pthread_client;
+	const char *p;
+	int n = 0, logs = LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE;
+
+	signal(SIGINT, sigint_handler);
+
+	if ((p = lws_cmdline_option(argc, argv, "-d")))
+		logs = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-n")))
+		conns = atoi(p);
+
+	tls12 = !!lws_cmdline_option(argc, argv, "--tls12");
+	restart = !!lws_cmdline_option(argc, argv, "--restart");
+	sni = !!lws_cmdline_option(argc, argv, "--sni");
+	keyfile = lws_cmdline_option(argc, argv, "-k");
+
+	lws_set_log_level(logs, NULL);
+	lwsl_user("LWS minimal http client tls resume bench (%s)\n",
+		  lws_cmdline_option(argc, argv, "-r") ? "no session cache" :
+							 "session cache");
+
+	if (conns < (restart ? 2 : 1)) {
+		lwsl_err("-n must be at least %d\n", restart ? 2 : 1);
+		return 1;
+	}
+
+	if (sni) {
+		if (!keyfile) {
+			lwsl_err("--sni needs -k\n");
+			return 1;
+		}
+		lws_snprintf(keyfile_default, sizeof(keyfile_default),
+			     "%s.default", keyfile);
+	}
+
+	context = server_create();
+	if (!context) {
+		lwsl_err("lws init failed\n");
+		return 1;
+	}
+
+	memset(&info, 0, sizeof info); /* otherwise uninitialized garbage */
+	info.port = CONTEXT_PORT_NO_LISTEN; /* we do not run any server */
+	info.protocols = protocols_client;
+	info.options = LWS_SERVER_OPTION_DO_SSL_GLOBAL_INIT;
+	if (lws_cmdline_option(argc, argv, "-r"))
+		info.client_ssl_session_cache_max = -1;
+#if defined(SSL_OP_NO_TLSv1_3)
+	if (tls12)
+		info.ssl_client_options_set = SSL_OP_NO_TLSv1_3;
+#endif
+
+	cx_client = lws_create_context(&info);
+	if (!cx_client) {
+		lwsl_err("lws client init failed\n");
+		goto bail;
+	}
+
+	if (pthread_create(&pthread_client, NULL, thread_client, NULL)) {
+		lwsl_err("thread creation failed\n");
+		goto bail;
+	}
+
+	n = 0;
+	while (n >= 0 && !interrupted) {
+		n = lws_service(context, 1000);
+		if (restart_state == 1 && server_restart())
+			interrupted = 1;
+	}
+
+	pthread_join(pthread_client, NULL);
+
+	server_hits += lws_stats_get(context,
+				     LWSSTATS_C_SSL_SERVER_SESSION_HIT);
+	server_misses += lws_stats_get(context,
+				       LWSSTATS_C_SSL_SERVER_SESSION_MISS);
+
+	if (!result)
+		lwsl_user("%d connections: %.3fs, %.0fus each, client cpu "
+			  "%.3fs, sessions resumed %llu, full handshakes %llu\n",
+			  conns, secs(&wall_start, &wall_end),
+			  secs(&wall_start, &wall_end) * 1e6 / conns,
+			  secs(&cpu_start, &cpu_end),
+			  (unsigned long long)lws_stats_get(cx_client,
+					LWSSTATS_C_SSL_CLIENT_SESSION_HIT),
+			  (unsigned long long)lws_stats_get(cx_client,
+					LWSSTATS_C_SSL_CLIENT_SESSION_MISS));
+	if (!result)
+		lwsl_user("server: sessions resumed %llu, full handshakes "
+			  "%llu\n", (unsigned long long)server_hits,
+			  (unsigned long long)server_misses);
+
+	if (!result && restart && server_misses != 1) {
+		lwsl_err("sessions didn't all resume across the restart\n");
+		result = 1;
+	}
+
+bail:
+	if (cx_client)
+		lws_context_destroy(cx_client);
+	lws_context_destroy(context);
+
+	lwsl_user("Completed: %s\n", result ? "FAIL" : "PASS");
+
+	return result;
+}
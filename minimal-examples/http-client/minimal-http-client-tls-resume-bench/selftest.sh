@@ -0,0 +1,35 @@
+#!/bin/bash
+#
+# $1: path to minimal example binaries...
+#     if lws is built with -DLWS_WITH_MINIMAL_EXAMPLES=1
+#     that will be ./bin from your build dir
+#
+# $2: path for logs and results.  The results will go
+#     in a subdir named after the directory this script
+#     is in
+#
+# $3: offset for test index count
+#
+# $4: total test count
+#
+# $5: path to ./minimal-examples dir in lws
+#
+# Test return code 0: OK, 254: timed out, other: error indication
+
+. $5/selftests-library.sh
+
+COUNT_TESTS=4
+
+# the server restarts halfway, every connection after the first must resume
+
+head -c 80 /dev/urandom > $2/$MYTEST/ticket.key
+
+# the server's cert and key are in the example dir
+cd $SCRIPT_DIR
+
+dotest $1 $2 restart --restart -k $2/$MYTEST/ticket.key
+dotest $1 $2 restart-tls12 --restart -k $2/$MYTEST/ticket.key --tls12
+dotest $1 $2 restart-sni --restart -k $2/$MYTEST/ticket.key --sni
+dotest $1 $2 restart-sni-tls12 --restart -k $2/$MYTEST/ticket.key --sni --tls12
+
+exit $FAILS
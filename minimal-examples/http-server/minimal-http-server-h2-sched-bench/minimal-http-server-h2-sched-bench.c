@@ -0,0 +1,335 @@
+/*
+ * lws-minimal-http-server-h2-sched-bench
+ *
+ * Copyright (C) 2019 Andy Green <andy@warmcat.com>
+ *
+ * This file is made available under the Creative Commons CC0 1.0
+ * Universal Public Domain Dedication.
+ *
+ * This measures how long small responses take while a large download is
+ * going on as another stream on the same h2 connection, the way a web ui's
+ * css / js / api calls compete with something big the page is fetching.
+ *
+ * The main thread runs a TLS server with "/big", which sends as fast as the
+ * flow control allows, and "/small/<n>", which sends a few bytes.  Both send
+ * from the WRITEABLE callback, so the order streams get to write in is up to
+ * the h2 stream scheduler.  A second thread runs a client context that
+ * starts "/big", then once that is flowing, makes the small requests one
+ * after another on the same connection and times them.
+ */
+
+#include <libwebsockets.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+
+struct pss {
+	lws_filepos_t remaining;
+	int small;
+};
+
+static struct lws_context *context, *cx_client;
+static int interrupted, smalls = 200, completed, big_flowing, result = 1;
+static lws_filepos_t big_size = 1024 * 1024 * 1024;
+static struct lws *client_wsi, *big_wsi;
+static lws_usec_t us_total, us_max, us_start;
+static uint64_t big_bytes;
+
+static int
+callback_bench(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+	       void *in, size_t len)
+{
+	uint8_t buf[LWS_PRE + 16384], *start = &buf[LWS_PRE], *p = start,
+		*end = &buf[sizeof(buf) - 1];
+	struct pss *pss = (struct pss *)user;
+	const char *u = in;
+	int n;
+
+	switch (reason) {
+	case LWS_CALLBACK_HTTP:
+		pss->small = !!strstr(u, "small/");
+		pss->remaining = pss->small ? 64 : big_size;
+
+		if (lws_add_http_common_headers(wsi, HTTP_STATUS_OK,
+				"application/octet-stream", pss->remaining,
+				&p, end) ||
+		    lws_finalize_write_http_header(wsi, start, &p, end))
+			return 1;
+
+		lws_callback_on_writable(wsi);
+
+		return 0;
+
+	case LWS_CALLBACK_HTTP_WRITEABLE:
+		/* as much as the stream may send this turn */
+		n = (int)lws_get_peer_write_allowance(wsi);
+		if (!n)
+			/* we'll hear again when the peer gives us more credit */
+			return 0;
+		if (n < 0 || n > (int)sizeof(buf) - LWS_PRE)
+			n = (int)sizeof(buf) - LWS_PRE;
+		if ((lws_filepos_t)n > pss->remaining)
+			n = (int)pss->remaining;
+
+		memset(start, 'x', (unsigned int)n);
+		pss->remaining -= (unsigned int)n;
+		if (lws_write(wsi, start, (unsigned int)n, pss->remaining ?
+				LWS_WRITE_HTTP : LWS_WRITE_HTTP_FINAL) != n)
+			return 1;
+
+		if (!pss->remaining) {
+			if (lws_http_transaction_completed(wsi))
+				return -1;
+
+			return 0;
+		}
+
+		lws_callback_on_writable(wsi);
+
+		return 0;
+
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static int
+callback_client(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+		void *in, size_t len)
+{
+	lws_usec_t t;
+
+	switch (reason) {
+	case LWS_CALLBACK_CLIENT_CONNECTION_ERROR:
+		lwsl_err("CLIENT_CONNECTION_ERROR: %s\n",
+			 in ? (char *)in : "(null)");
+		interrupted = 1;
+		break;
+
+	case LWS_CALLBACK_RECEIVE_CLIENT_HTTP_READ:
+		if (wsi != client_wsi) {
+			big_bytes += len;
+			/* let it get up to speed before we start timing */
+			if (big_bytes >= 4 * 1024 * 1024)
+				big_flowing = 1;
+		}
+		return 0;
+
+	case LWS_CALLBACK_RECEIVE_CLIENT_HTTP:
+		{
+			char buffer[1024 + LWS_PRE];
+			char *px = buffer + LWS_PRE;
+			int lenx = sizeof(buffer) - LWS_PRE;
+
+			if (lws_http_client_read(wsi, &px, &lenx) < 0)
+				return -1;
+		}
+		return 0;
+
+	case LWS_CALLBACK_COMPLETED_CLIENT_HTTP:
+		if (wsi != client_wsi) {
+			lwsl_err("%s: big finished before the small ones\n",
+				 __func__);
+			interrupted = 1;
+			break;
+		}
+		if (lws_http_client_http_response(wsi) != 200)
+			interrupted = 1;
+		t = lws_time_in_microseconds() - us_start;
+		us_total += t;
+		if (t > us_max)
+			us_max = t;
+		completed++;
+		client_wsi = NULL;
+		lws_cancel_service(lws_get_context(wsi));
+		break;
+
+	case LWS_CALLBACK_CLOSED_CLIENT_HTTP:
+		if (wsi == client_wsi)
+			/* closed before it completed */
+			interrupted = 1;
+		lws_cancel_service(lws_get_context(wsi));
+		break;
+
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static const struct lws_protocols protocols_server[] = {
+	{ "bench", callback_bench, sizeof(struct pss), 0 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static const struct lws_protocols protocols_client[] = {
+	{ "http", callback_client, 0, 0 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static const struct lws_http_mount mount = {
+	/* .mount_next */		NULL,		/* linked-list "next" */
+	/* .mountpoint */		"/",		/* mountpoint URL */
+	/* .origin */			NULL,
+	/* .def */			NULL,
+	/* .protocol */			"bench",
+	/* .cgienv */			NULL,
+	/* .extra_mimetypes */		NULL,
+	/* .interpret */		NULL,
+	/* .cgi_timeout */		0,
+	/* .cache_max_age */		0,
+	/* .auth_mask */		0,
+	/* .cache_reusable */		0,
+	/* .cache_revalidate */		0,
+	/* .cache_intermediaries */	0,
+	/* .origin_protocol */		LWSMPRO_CALLBACK, /* dynamic */
+	/* .mountpoint_len */		1,		/* char count */
+	/* .basic_auth_login_file */	NULL,
+};
+
+static void *
+thread_client(void *d)
+{
+	struct lws_client_connect_info i;
+	char path[32];
+	int n = 0;
+
+	memset(&i, 0, sizeof i); /* otherwise uninitialized garbage */
+	i.context = cx_client;
+	i.port = 7681;
+	i.address = "localhost";
+	i.host = i.address;
+	i.origin = i.address;
+	i.method = "GET";
+	i.path = "/big";
+	i.alpn = "h2";
+	i.protocol = protocols_client[0].name;
+	i.pwsi = &big_wsi;
+	/* after the first, requests become streams on the same connection */
+	i.ssl_connection = LCCSCF_USE_SSL | LCCSCF_ALLOW_SELFSIGNED |
+			   LCCSCF_PIPELINE;
+
+	if (!lws_client_connect_via_info(&i)) {
+		lwsl_err("%s: connect failed\n", __func__);
+		goto bail;
+	}
+
+	i.path = path;
+	i.pwsi = &client_wsi;
+
+	while (n >= 0 && !interrupted && completed < smalls) {
+		if (big_flowing && !client_wsi) {
+			lws_snprintf(path, sizeof(path), "/small/%d", completed);
+			us_start = lws_time_in_microseconds();
+			if (!lws_client_connect_via_info(&i)) {
+				lwsl_err("%s: connect failed\n", __func__);
+				break;
+			}
+		}
+
+		n = lws_service(cx_client, 1000);
+	}
+
+	if (completed == smalls)
+		result = 0;
+
+bail:
+	interrupted = 1;
+	lws_cancel_service(context);
+
+	return NULL;
+}
+
+void sigint_handler(int sig)
+{
+	interrupted = 1;
+}
+
+int main(int argc, const char **argv)
+{
+	struct lws_context_creation_info info;
+	pthread_t pthread_client;
+	const char *p;
+	int n = 0, logs = LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE;
+	lws_usec_t t;
+
+	signal(SIGINT, sigint_handler);
+
+	if ((p = lws_cmdline_option(argc, argv, "-d")))
+		logs = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-n")))
+		smalls = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-b")))
+		big_size = (lws_filepos_t)atoi(p) * 1024 * 1024;
+
+	lws_set_log_level(logs, NULL);
+	lwsl_user("LWS minimal http server h2 sched bench\n");
+
+	memset(&info, 0, sizeof info); /* otherwise uninitialized garbage */
+	info.port = 7681;
+	info.mounts = &mount;
+	info.protocols = protocols_server;
+	info.options = LWS_SERVER_OPTION_DO_SSL_GLOBAL_INIT;
+	info.ssl_cert_filepath = "localhost-100y.cert";
+	info.ssl_private_key_filepath = "localhost-100y.key";
+
+	context = lws_create_context(&info);
+	if (!context) {
+		lwsl_err("lws init failed\n");
+		return 1;
+	}
+
+	memset(&info, 0, sizeof info);
+	info.port = CONTEXT_PORT_NO_LISTEN; /* we do not run any server */
+	info.protocols = protocols_client;
+	info.options = LWS_SERVER_OPTION_DO_SSL_GLOBAL_INIT;
+
+	cx_client = lws_create_context(&info);
+	if (!cx_client) {
+		lwsl_err("lws client init failed\n");
+		goto bail;
+	}
+
+	if (lws_cmdline_option(argc, argv, "-s")) {
+		/* just serve, eg, for nghttp to fetch from with its own weights */
+		while (n >= 0 && !interrupted)
+			n = lws_service(context, 1000);
+
+		result = 0;
+		goto bail;
+	}
+
+	t = lws_time_in_microseconds();
+	if (pthread_create(&pthread_client, NULL, thread_client, NULL)) {
+		lwsl_err("thread creation failed\n");
+		goto bail;
+	}
+
+	while (n >= 0 && !interrupted)
+		n = lws_service(context, 1000);
+
+	pthread_join(pthread_client, NULL);
+	t = lws_time_in_microseconds() - t;
+
+	lwsl_user("%d small responses during the big one: avg %.2fms, "
+		  "max %.2fms\n", completed, completed ?
+		  (double)us_total / 1000.0 / (double)completed : 0.0,
+		  (double)us_max / 1000.0);
+	lwsl_user("  big: %lluMiB at %.1fMiB/s\n",
+		  (unsigned long long)(big_bytes >> 20),
+		  (double)big_bytes / 1048576.0 / ((double)t / 1000000.0));
+
+bail:
+	if (cx_client)
+		lws_context_destroy(cx_client);
+	lws_context_destroy(context);
+
+	lwsl_user("Completed: %s\n", result ? "FAIL" : "PASS");
+
+	return result;
+}
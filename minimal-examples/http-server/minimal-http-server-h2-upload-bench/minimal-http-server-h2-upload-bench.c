@@ -0,0 +1,327 @@
+/*
+ * lws-minimal-http-server-h2-upload-bench
+ *
+ * Copyright (C) 2019 Andy Green <andy@warmcat.com>
+ *
+ * This file is made available under the Creative Commons CC0 1.0
+ * Universal Public Domain Dedication.
+ *
+ * This measures how fast a large upload goes into the server over h2, where
+ * what usually limits it is the receive window the server gives the client.
+ *
+ * The main thread runs a TLS server whose "/upload" counts the POST body it
+ * receives and answers when it has had all of it.  A second thread runs a
+ * client context that POSTs the body, sending as much as the server's window
+ * allows each time it's writeable, and times it.
+ *
+ * The client can be pointed at another port with -p, eg, a proxy adding
+ * latency, if you can't use netem on lo.
+ */
+
+#include <libwebsockets.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+
+struct pss {
+	lws_filepos_t remaining;
+};
+
+static struct lws_context *context, *cx_client;
+static int interrupted, port = 7681, result = 1;
+static lws_filepos_t upload_size = 256 * 1024 * 1024;
+static struct lws *client_wsi;
+static uint64_t rx_bytes;
+static lws_usec_t us_start, us_done;
+
+static int
+callback_upload(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+		void *in, size_t len)
+{
+	uint8_t buf[LWS_PRE + 256], *start = &buf[LWS_PRE], *p = start,
+		*end = &buf[sizeof(buf) - 1];
+
+	switch (reason) {
+	case LWS_CALLBACK_HTTP:
+		/* we want the body */
+		return 0;
+
+	case LWS_CALLBACK_HTTP_BODY:
+		rx_bytes += len;
+		return 0;
+
+	case LWS_CALLBACK_HTTP_BODY_COMPLETION:
+		if (lws_add_http_common_headers(wsi, HTTP_STATUS_OK,
+				"text/plain", 2, &p, end) ||
+		    lws_finalize_write_http_header(wsi, start, &p, end))
+			return 1;
+
+		memcpy(start, "ok", 2);
+		if (lws_write(wsi, start, 2, LWS_WRITE_HTTP_FINAL) != 2)
+			return 1;
+
+		if (lws_http_transaction_completed(wsi))
+			return -1;
+
+		return 0;
+
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static int
+callback_client(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+		void *in, size_t len)
+{
+	uint8_t buf[LWS_PRE + 16384], *start = &buf[LWS_PRE];
+	struct pss *pss = (struct pss *)user;
+	unsigned char **up, *uend;
+	char cl[24];
+	int n;
+
+	switch (reason) {
+	case LWS_CALLBACK_CLIENT_CONNECTION_ERROR:
+		lwsl_err("CLIENT_CONNECTION_ERROR: %s\n",
+			 in ? (char *)in : "(null)");
+		interrupted = 1;
+		break;
+
+	case LWS_CALLBACK_CLIENT_APPEND_HANDSHAKE_HEADER:
+		up = (unsigned char **)in;
+		uend = *up + len - 1;
+
+		n = lws_snprintf(cl, sizeof(cl), "%llu",
+				 (unsigned long long)upload_size);
+		if (lws_add_http_header_by_token(wsi,
+				WSI_TOKEN_HTTP_CONTENT_LENGTH,
+				(unsigned char *)cl, n, up, uend))
+			return 1;
+
+		pss->remaining = upload_size;
+		us_start = lws_time_in_microseconds();
+		lws_client_http_body_pending(wsi, 1);
+		lws_callback_on_writable(wsi);
+		break;
+
+	case LWS_CALLBACK_CLIENT_HTTP_WRITEABLE:
+		if (!pss->remaining)
+			return 0;
+
+		/* as much as the server lets us send right now */
+		n = (int)lws_get_peer_write_allowance(wsi);
+		if (!n)
+			/* we'll hear again when it gives us more window */
+			return 0;
+		if (n < 0 || n > (int)sizeof(buf) - LWS_PRE)
+			n = (int)sizeof(buf) - LWS_PRE;
+		if ((lws_filepos_t)n > pss->remaining)
+			n = (int)pss->remaining;
+
+		memset(start, 'x', (unsigned int)n);
+		pss->remaining -= (unsigned int)n;
+		if (!pss->remaining)
+			lws_client_http_body_pending(wsi, 0);
+
+		if (lws_write(wsi, start, (unsigned int)n, pss->remaining ?
+				LWS_WRITE_HTTP : LWS_WRITE_HTTP_FINAL) != n)
+			return 1;
+
+		if (pss->remaining)
+			lws_callback_on_writable(wsi);
+
+		return 0;
+
+	case LWS_CALLBACK_RECEIVE_CLIENT_HTTP:
+		{
+			char buffer[1024 + LWS_PRE];
+			char *px = buffer + LWS_PRE;
+			int lenx = sizeof(buffer) - LWS_PRE;
+
+			if (lws_http_client_read(wsi, &px, &lenx) < 0)
+				return -1;
+		}
+		return 0;
+
+	case LWS_CALLBACK_COMPLETED_CLIENT_HTTP:
+		us_done = lws_time_in_microseconds();
+		if (lws_http_client_http_response(wsi) == 200 &&
+		    rx_bytes == upload_size)
+			result = 0;
+		client_wsi = NULL;
+		interrupted = 1;
+		lws_cancel_service(lws_get_context(wsi));
+		break;
+
+	case LWS_CALLBACK_CLOSED_CLIENT_HTTP:
+		if (wsi == client_wsi)
+			/* closed before it completed */
+			interrupted = 1;
+		lws_cancel_service(lws_get_context(wsi));
+		break;
+
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static const struct lws_protocols protocols_server[] = {
+	{ "upload", callback_upload, 0, 0 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static const struct lws_protocols protocols_client[] = {
+	{ "http", callback_client, sizeof(struct pss), 0 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static const struct lws_http_mount mount = {
+	/* .mount_next */		NULL,		/* linked-list "next" */
+	/* .mountpoint */		"/",		/* mountpoint URL */
+	/* .origin */			NULL,
+	/* .def */			NULL,
+	/* .protocol */			"upload",
+	/* .cgienv */			NULL,
+	/* .extra_mimetypes */		NULL,
+	/* .interpret */		NULL,
+	/* .cgi_timeout */		0,
+	/* .cache_max_age */		0,
+	/* .auth_mask */		0,
+	/* .cache_reusable */		0,
+	/* .cache_revalidate */		0,
+	/* .cache_intermediaries */	0,
+	/* .origin_protocol */		LWSMPRO_CALLBACK, /* dynamic */
+	/* .mountpoint_len */		1,		/* char count */
+	/* .basic_auth_login_file */	NULL,
+};
+
+static void *
+thread_client(void *d)
+{
+	struct lws_client_connect_info i;
+	int n = 0;
+
+	memset(&i, 0, sizeof i); /* otherwise uninitialized garbage */
+	i.context = cx_client;
+	i.port = port;
+	i.address = "localhost";
+	i.host = i.address;
+	i.origin = i.address;
+	i.method = "POST";
+	i.path = "/upload";
+	i.alpn = "h2";
+	i.protocol = protocols_client[0].name;
+	i.pwsi = &client_wsi;
+	i.ssl_connection = LCCSCF_USE_SSL | LCCSCF_ALLOW_SELFSIGNED;
+
+	if (!lws_client_connect_via_info(&i)) {
+		lwsl_err("%s: connect failed\n", __func__);
+		goto bail;
+	}
+
+	while (n >= 0 && !interrupted)
+		n = lws_service(cx_client, 1000);
+
+bail:
+	interrupted = 1;
+	lws_cancel_service(context);
+
+	return NULL;
+}
+
+void sigint_handler(int sig)
+{
+	interrupted = 1;
+}
+
+int main(int argc, const char **argv)
+{
+	struct lws_context_creation_info info;
+	pthread_t pthread_client;
+	const char *p;
+	int n = 0, logs = LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE;
+	lws_usec_t t;
+
+	signal(SIGINT, sigint_handler);
+
+	if ((p = lws_cmdline_option(argc, argv, "-d")))
+		logs = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-s")))
+		upload_size = (lws_filepos_t)atoi(p) * 1024 * 1024;
+
+	if ((p = lws_cmdline_option(argc, argv, "-p")))
+		port = atoi(p);
+
+	lws_set_log_level(logs, NULL);
+	lwsl_user("LWS minimal http server h2 upload bench\n");
+
+	memset(&info, 0, sizeof info); /* otherwise uninitialized garbage */
+	info.port = 7681;
+	info.mounts = &mount;
+	info.protocols = protocols_server;
+	info.options = LWS_SERVER_OPTION_DO_SSL_GLOBAL_INIT;
+	info.ssl_cert_filepath = "localhost-100y.cert";
+	info.ssl_private_key_filepath = "localhost-100y.key";
+	if ((p = lws_cmdline_option(argc, argv, "-w")))
+		/* -w 1 effectively stops the rx windows growing */
+		info.h2_rx_window_budget = (unsigned int)atoi(p);
+	if ((p = lws_cmdline_option(argc, argv, "-i"))) {
+		/* the server's SETTINGS_INITIAL_WINDOW_SIZE, the rest stock */
+		info.http2_settings[0] = 1;
+		info.http2_settings[1] = 65536;	/* header table size */
+		info.http2_settings[2] = 1;	/* enable push */
+		info.http2_settings[3] = 24;	/* max concurrent streams */
+		info.http2_settings[4] = (uint32_t)strtoul(p, NULL, 10);
+		info.http2_settings[5] = 16384;	/* max frame size */
+		info.http2_settings[6] = 4096;	/* max header list size */
+	}
+
+	context = lws_create_context(&info);
+	if (!context) {
+		lwsl_err("lws init failed\n");
+		return 1;
+	}
+
+	memset(&info, 0, sizeof info);
+	info.port = CONTEXT_PORT_NO_LISTEN; /* we do not run any server */
+	info.protocols = protocols_client;
+	info.options = LWS_SERVER_OPTION_DO_SSL_GLOBAL_INIT;
+
+	cx_client = lws_create_context(&info);
+	if (!cx_client) {
+		lwsl_err("lws client init failed\n");
+		goto bail;
+	}
+
+	if (pthread_create(&pthread_client, NULL, thread_client, NULL)) {
+		lwsl_err("thread creation failed\n");
+		goto bail;
+	}
+
+	while (n >= 0 && !interrupted)
+		n = lws_service(context, 1000);
+
+	pthread_join(pthread_client, NULL);
+
+	t = us_done - us_start;
+	if (!result && t > 0)
+		lwsl_user("uploaded %lluMiB in %.3fs: %.1fMiB/s\n",
+			  (unsigned long long)(rx_bytes >> 20),
+			  (double)t / 1000000.0,
+			  (double)rx_bytes / 1048576.0 /
+						((double)t / 1000000.0));
+
+bail:
+	if (cx_client)
+		lws_context_destroy(cx_client);
+	lws_context_destroy(context);
+
+	lwsl_user("Completed: %s\n", result ? "FAIL" : "PASS");
+
+	return result;
+}
@@ -0,0 +1,33 @@
+#!/bin/bash
+#
+# $1: path to minimal example binaries...
+#     if lws is built with -DLWS_WITH_MINIMAL_EXAMPLES=1
+#     that will be ./bin from your build dir
+#
+# $2: path for logs and results.  The results will go
+#     in a subdir named after the directory this script
+#     is in
+#
+# $3: offset for test index count
+#
+# $4: total test count
+#
+# $5: path to ./minimal-examples dir in lws
+#
+# Test return code 0: OK, 254: timed out, other: error indication
+
+. $5/selftests-library.sh
+
+COUNT_TESTS=3
+
+# the whole body must arrive, with the windows growing, fixed, and with the
+# server's initial window already at the 2^31 - 1 maximum
+
+# the server's cert and key are in the example dir
+cd $SCRIPT_DIR
+
+dotest $1 $2 default
+dotest $1 $2 fixed-windows -w 1 -s 64
+dotest $1 $2 max-initial-window -i 2147483647
+
+exit $FAILS
@@ -0,0 +1,302 @@
+/*
+ * lws-minimal-http-server-hpack-bench
+ *
+ * Copyright (C) 2019 Andy Green <andy@warmcat.com>
+ *
+ * This file is made available under the Creative Commons CC0 1.0
+ * Universal Public Domain Dedication.
+ *
+ * This measures how many bytes of h2 headers each response costs, for the
+ * kind of small JSON api response where the headers are most of what is sent.
+ *
+ * The main thread runs a TLS server whose api answers every request with a
+ * small JSON object and a typical set of api response headers.  A second
+ * thread runs a client context that makes the requests one after another as
+ * streams on one h2 connection.  At the end the server's
+ * LWSSTATS_B_H2_HEADER_BLOCKS_TX tells us the average header block size.
+ */
+
+#include <libwebsockets.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+
+static struct lws_context *context, *cx_client;
+static int interrupted, requests = 1000, completed, result = 1;
+static struct lws *client_wsi;
+static uint64_t body_bytes;
+
+static int
+callback_api(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+	     void *in, size_t len)
+{
+	uint8_t buf[LWS_PRE + 1024], *start = &buf[LWS_PRE], *p = start,
+		*end = &buf[sizeof(buf) - 1];
+	char body[LWS_PRE + 128];
+	const char *u = in;
+	int n, id;
+
+	switch (reason) {
+	case LWS_CALLBACK_HTTP:
+		while (*u == '/')
+			u++;
+		id = atoi(u);
+		n = lws_snprintf(body + LWS_PRE, sizeof(body) - LWS_PRE,
+				 "{\"id\":%d,\"name\":\"item%d\",\"price\":4.5,"
+				 "\"stock\":%d}", id, id, (id * 7) % 100);
+
+		if (lws_add_http_common_headers(wsi, HTTP_STATUS_OK,
+				"application/json; charset=utf-8",
+				(lws_filepos_t)n, &p, end) ||
+		    lws_add_http_header_by_token(wsi,
+				WSI_TOKEN_HTTP_CACHE_CONTROL,
+				(unsigned char *)"private, max-age=0", 18,
+				&p, end) ||
+		    lws_add_http_header_by_token(wsi,
+				WSI_TOKEN_HTTP_ACCESS_CONTROL_ALLOW_ORIGIN,
+				(unsigned char *)"https://app.example.com", 23,
+				&p, end) ||
+		    lws_add_http_header_by_token(wsi, WSI_TOKEN_HTTP_VARY,
+				(unsigned char *)"Origin, Accept-Encoding", 23,
+				&p, end) ||
+		    lws_add_http_header_by_name(wsi,
+				(unsigned char *)"x-content-type-options:",
+				(unsigned char *)"nosniff", 7, &p, end) ||
+		    lws_add_http_header_by_name(wsi,
+				(unsigned char *)"x-api-version:",
+				(unsigned char *)"2019-04-01", 10, &p, end) ||
+		    lws_add_http_header_by_name(wsi,
+				(unsigned char *)"strict-transport-security:",
+				(unsigned char *)"max-age=31536000; "
+						 "includeSubDomains", 35,
+				&p, end) ||
+		    lws_finalize_write_http_header(wsi, start, &p, end))
+			return 1;
+
+		/* the body is small enough to go immediately */
+
+		if (lws_write(wsi, (uint8_t *)body + LWS_PRE, (unsigned int)n,
+			      LWS_WRITE_HTTP_FINAL) != n)
+			return 1;
+
+		if (lws_http_transaction_completed(wsi))
+			return -1;
+
+		return 0;
+
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static int
+callback_client(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+		void *in, size_t len)
+{
+	switch (reason) {
+	case LWS_CALLBACK_CLIENT_CONNECTION_ERROR:
+		lwsl_err("CLIENT_CONNECTION_ERROR: %s\n",
+			 in ? (char *)in : "(null)");
+		interrupted = 1;
+		break;
+
+	case LWS_CALLBACK_RECEIVE_CLIENT_HTTP_READ:
+		body_bytes += len;
+		return 0;
+
+	case LWS_CALLBACK_RECEIVE_CLIENT_HTTP:
+		{
+			char buffer[1024 + LWS_PRE];
+			char *px = buffer + LWS_PRE;
+			int lenx = sizeof(buffer) - LWS_PRE;
+
+			if (lws_http_client_read(wsi, &px, &lenx) < 0)
+				return -1;
+		}
+		return 0;
+
+	case LWS_CALLBACK_COMPLETED_CLIENT_HTTP:
+		if (lws_http_client_http_response(wsi) != 200)
+			interrupted = 1;
+		completed++;
+		client_wsi = NULL;
+		lws_cancel_service(lws_get_context(wsi));
+		break;
+
+	case LWS_CALLBACK_CLOSED_CLIENT_HTTP:
+		if (wsi == client_wsi)
+			/* closed before it completed */
+			interrupted = 1;
+		lws_cancel_service(lws_get_context(wsi));
+		break;
+
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static const struct lws_protocols protocols_server[] = {
+	{ "api", callback_api, 0, 0 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static const struct lws_protocols protocols_client[] = {
+	{ "http", callback_client, 0, 0 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static const struct lws_http_mount mount = {
+	/* .mount_next */		NULL,		/* linked-list "next" */
+	/* .mountpoint */		"/",		/* mountpoint URL */
+	/* .origin */			NULL,
+	/* .def */			NULL,
+	/* .protocol */			"api",
+	/* .cgienv */			NULL,
+	/* .extra_mimetypes */		NULL,
+	/* .interpret */		NULL,
+	/* .cgi_timeout */		0,
+	/* .cache_max_age */		0,
+	/* .auth_mask */		0,
+	/* .cache_reusable */		0,
+	/* .cache_revalidate */		0,
+	/* .cache_intermediaries */	0,
+	/* .origin_protocol */		LWSMPRO_CALLBACK, /* dynamic */
+	/* .mountpoint_len */		1,		/* char count */
+	/* .basic_auth_login_file */	NULL,
+};
+
+static void *
+thread_client(void *d)
+{
+	struct lws_client_connect_info i;
+	char path[32];
+	int n = 0;
+
+	memset(&i, 0, sizeof i); /* otherwise uninitialized garbage */
+	i.context = cx_client;
+	i.port = 7681;
+	i.address = "localhost";
+	i.host = i.address;
+	i.origin = i.address;
+	i.method = "GET";
+	i.path = path;
+	i.alpn = "h2";
+	i.protocol = protocols_client[0].name;
+	i.pwsi = &client_wsi;
+	/* after the first, requests become streams on the same connection */
+	i.ssl_connection = LCCSCF_USE_SSL | LCCSCF_ALLOW_SELFSIGNED |
+			   LCCSCF_PIPELINE;
+
+	while (n >= 0 && !interrupted && completed < requests) {
+		if (!client_wsi) {
+			lws_snprintf(path, sizeof(path), "/%d", completed);
+			if (!lws_client_connect_via_info(&i)) {
+				lwsl_err("%s: connect failed\n", __func__);
+				break;
+			}
+		}
+
+		n = lws_service(cx_client, 1000);
+	}
+
+	if (completed == requests)
+		result = 0;
+
+	interrupted = 1;
+	lws_cancel_service(context);
+
+	return NULL;
+}
+
+void sigint_handler(int sig)
+{
+	interrupted = 1;
+}
+
+int main(int argc, const char **argv)
+{
+	struct lws_context_creation_info info;
+	pthread_t pthread_client;
+	const char *p;
+	int n = 0, logs = LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE;
+	uint64_t blocks, bytes;
+
+	signal(SIGINT, sigint_handler);
+
+	if ((p = lws_cmdline_option(argc, argv, "-d")))
+		logs = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-n")))
+		requests = atoi(p);
+
+	lws_set_log_level(logs, NULL);
+	lwsl_user("LWS minimal http server hpack bench\n");
+
+	memset(&info, 0, sizeof info); /* otherwise uninitialized garbage */
+	info.port = 7681;
+	info.mounts = &mount;
+	info.protocols = protocols_server;
+	info.options = LWS_SERVER_OPTION_DO_SSL_GLOBAL_INIT;
+	info.ssl_cert_filepath = "localhost-100y.cert";
+	info.ssl_private_key_filepath = "localhost-100y.key";
+
+	context = lws_create_context(&info);
+	if (!context) {
+		lwsl_err("lws init failed\n");
+		return 1;
+	}
+
+	memset(&info, 0, sizeof info);
+	info.port = CONTEXT_PORT_NO_LISTEN; /* we do not run any server */
+	info.protocols = protocols_client;
+	info.options = LWS_SERVER_OPTION_DO_SSL_GLOBAL_INIT;
+
+	cx_client = lws_create_context(&info);
+	if (!cx_client) {
+		lwsl_err("lws client init failed\n");
+		goto bail;
+	}
+
+	if (pthread_create(&pthread_client, NULL, thread_client, NULL)) {
+		lwsl_err("thread creation failed\n");
+		goto bail;
+	}
+
+	while (n >= 0 && !interrupted)
+		n = lws_service(context, 1000);
+
+	pthread_join(pthread_client, NULL);
+
+	blocks = lws_stats_get(context, LWSSTATS_C_H2_HEADER_BLOCKS_TX);
+	bytes = lws_stats_get(context, LWSSTATS_B_H2_HEADER_BLOCKS_TX);
+
+	lwsl_user("%d responses, %llu header blocks: %llu header bytes, "
+		  "%llu body bytes\n", completed, (unsigned long long)blocks,
+		  (unsigned long long)bytes, (unsigned long long)body_bytes);
+	if (blocks)
+		lwsl_user("  header bytes / response: %.1f\n",
+			  (double)bytes / (double)blocks);
+
+	/*
+	 * Sent as literals these headers cost 316 bytes every time; indexed,
+	 * only the first response pays much, so over enough of them the
+	 * average must come right down
+	 */
+	if (!result && blocks >= 100 && bytes > blocks * 32) {
+		lwsl_err("header blocks are not being indexed\n");
+		result = 1;
+	}
+
+bail:
+	if (cx_client)
+		lws_context_destroy(cx_client);
+	lws_context_destroy(context);
+
+	lwsl_user("Completed: %s\n", result ? "FAIL" : "PASS");
+
+	return result;
+}
@@ -0,0 +1,694 @@
+/*
+ * lws-minimal-http-server-hpack-decode-fuzz
+ *
+ * Copyright (C) 2019 Andy Green <andy@warmcat.com>
+ *
+ * This file is made available under the Creative Commons CC0 1.0
+ * Universal Public Domain Dedication.
+ *
+ * This exercises and times the server's HPACK decoder dynamic table.
+ *
+ * The main thread runs a plaintext server that answers every request with the
+ * user-agent and referer headers it decoded.  A second thread talks h2 to it
+ * over a raw socket after an h2c upgrade, sending header blocks built from a
+ * seeded prng: new values with incremental indexing that fill and evict the
+ * dynamic table, references to dynamic entries by index and by name, table
+ * size updates, strings with and without Huffman coding and blocks split
+ * over CONTINUATION frames.  It keeps its own
+ * RFC7541 model of the table, so it knows what each response must contain.
+ *
+ * Every so often it sends a block of random bytes instead.  The server must
+ * then reject the connection, and must still serve the next one.
+ */
+
+#include <libwebsockets.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+#define PORT		7681
+#define MODEL_MAX	(65536 / 32) /* entries are at least 32 bytes */
+
+static struct lws_context *context;
+static int interrupted, requests = 20000, completed, connections, garbage,
+	   result = 1;
+static uint32_t seed = 1, rng;
+static uint64_t hdr_bytes;
+
+/* the fields the server echoes, and a couple more that just fill the table */
+
+static const struct fuzz_name {
+	const char *name;
+	int static_idx; /* 0 = must be sent as a literal name */
+} names[] = {
+	{ "user-agent",		58 },
+	{ "referer",		51 },
+	{ "accept-language",	17 },
+	{ "x-fuzz-filler",	 0 },	/* unknown to lws */
+};
+
+/* our model of the peer's dynamic table, newest first */
+
+static struct model_entry {
+	int name;
+	char value[512];
+	int len;
+} model[MODEL_MAX];
+static int model_count;
+static uint32_t model_size, model_max;
+
+static int
+callback_echo(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+	      void *in, size_t len)
+{
+	uint8_t buf[LWS_PRE + 1024], *start = &buf[LWS_PRE], *p = start,
+		*end = &buf[sizeof(buf) - 1];
+	char body[LWS_PRE + 1100], *b = body + LWS_PRE;
+	int n, m;
+
+	switch (reason) {
+	case LWS_CALLBACK_HTTP:
+		n = lws_hdr_copy(wsi, b, 520, WSI_TOKEN_HTTP_USER_AGENT);
+		if (n < 0)
+			n = 0;
+		b[n++] = '\n';
+		m = lws_hdr_copy(wsi, b + n, 520, WSI_TOKEN_HTTP_REFERER);
+		if (m > 0)
+			n += m;
+
+		if (lws_add_http_common_headers(wsi, HTTP_STATUS_OK,
+				"text/plain", (lws_filepos_t)n, &p, end) ||
+		    lws_finalize_write_http_header(wsi, start, &p, end))
+			return 1;
+
+		if (lws_write(wsi, (uint8_t *)b, (unsigned int)n,
+			      LWS_WRITE_HTTP_FINAL) != n)
+			return 1;
+
+		if (lws_http_transaction_completed(wsi))
+			return -1;
+
+		return 0;
+
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static const struct lws_protocols protocols[] = {
+	{ "echo", callback_echo, 0, 0 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static const struct lws_http_mount mount = {
+	/* .mount_next */		NULL,		/* linked-list "next" */
+	/* .mountpoint */		"/",		/* mountpoint URL */
+	/* .origin */			NULL,
+	/* .def */			NULL,
+	/* .protocol */			"echo",
+	/* .cgienv */			NULL,
+	/* .extra_mimetypes */		NULL,
+	/* .interpret */		NULL,
+	/* .cgi_timeout */		0,
+	/* .cache_max_age */		0,
+	/* .auth_mask */		0,
+	/* .cache_reusable */		0,
+	/* .cache_revalidate */		0,
+	/* .cache_intermediaries */	0,
+	/* .origin_protocol */		LWSMPRO_CALLBACK, /* dynamic */
+	/* .mountpoint_len */		1,		/* char count */
+	/* .basic_auth_login_file */	NULL,
+};
+
+static uint32_t
+prng(void)
+{
+	/* xorshift32 */
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+
+	return rng;
+}
+
+#define chance(_pc) ((int)(prng() % 100) < (_pc))
+
+static void
+model_evict(void)
+{
+	while (model_count && model_size > model_max) {
+		model_count--;
+		model_size -= 32 + strlen(names[model[model_count].name].name) +
+			      model[model_count].len;
+	}
+}
+
+static void
+model_insert(int name, const char *value, int len)
+{
+	uint32_t sz = 32 + strlen(names[name].name) + len;
+
+	/* an entry bigger than the table empties it and isn't added */
+	if (sz > model_max) {
+		model_count = 0;
+		model_size = 0;
+		return;
+	}
+
+	model_size += sz;
+	model_evict();
+
+	memmove(&model[1], &model[0], sizeof(model[0]) * model_count);
+	model[0].name = name;
+	memcpy(model[0].value, value, len);
+	model[0].len = len;
+	model_count++;
+}
+
+static uint8_t *
+put_int(uint8_t *p, uint8_t first, int prefix_bits, uint32_t v)
+{
+	uint32_t lim = (1u << prefix_bits) - 1;
+
+	if (v < lim) {
+		*p++ = first | v;
+		return p;
+	}
+
+	*p++ = first | lim;
+	v -= lim;
+	while (v >= 0x80) {
+		*p++ = 0x80 | (v & 0x7f);
+		v >>= 7;
+	}
+	*p++ = v;
+
+	return p;
+}
+
+/*
+ * RFC7541 Appendix B huffman codes for the only characters we send, 'a' to
+ * 'z', and '-'
+ */
+
+static const struct huf {
+	uint32_t code;
+	uint8_t len;
+} huf_az[] = {
+	{ 0x03, 5 }, { 0x23, 6 }, { 0x04, 5 }, { 0x24, 6 }, { 0x05, 5 },
+	{ 0x25, 6 }, { 0x26, 6 }, { 0x27, 6 }, { 0x06, 5 }, { 0x74, 7 },
+	{ 0x75, 7 }, { 0x28, 6 }, { 0x29, 6 }, { 0x2a, 6 }, { 0x07, 5 },
+	{ 0x2b, 6 }, { 0x76, 7 }, { 0x2c, 6 }, { 0x08, 5 }, { 0x09, 5 },
+	{ 0x2d, 6 }, { 0x77, 7 }, { 0x78, 7 }, { 0x79, 7 }, { 0x7a, 7 },
+	{ 0x7b, 7 },
+}, huf_dash = { 0x16, 6 };
+
+static uint8_t *
+put_str(uint8_t *p, const char *s, int len)
+{
+	const struct huf *h;
+	uint32_t acc = 0;
+	int n, bits = 0, nb = 0;
+
+	if (chance(50)) {
+		p = put_int(p, 0, 7, len); /* not huffman coded */
+		memcpy(p, s, len);
+
+		return p + len;
+	}
+
+	for (n = 0; n < len; n++)
+		bits += s[n] == '-' ? huf_dash.len : huf_az[s[n] - 'a'].len;
+
+	p = put_int(p, 0x80, 7, (bits + 7) / 8);
+
+	for (n = 0; n < len; n++) {
+		h = s[n] == '-' ? &huf_dash : &huf_az[s[n] - 'a'];
+		acc = (acc << h->len) | h->code;
+		nb += h->len;
+		while (nb >= 8) {
+			nb -= 8;
+			*p++ = (uint8_t)(acc >> nb);
+		}
+	}
+
+	/* pad with the msbs of EOS, which are all 1s */
+	if (nb)
+		*p++ = (uint8_t)((acc << (8 - nb)) | (0xff >> nb));
+
+	return p;
+}
+
+/* a dynamic table entry with the given name, or -1 */
+
+static int
+model_find(int name)
+{
+	int n, start = prng() % (model_count + 1);
+
+	for (n = 0; n < model_count; n++)
+		if (model[(start + n) % model_count].name == name)
+			return (start + n) % model_count;
+
+	return -1;
+}
+
+/*
+ * Emit one header field for names[name] in a random representation, and
+ * return what its value must decode to in expect
+ */
+
+static uint8_t *
+put_field(uint8_t *p, int name, char *expect, int *elen)
+{
+	char value[512];
+	int n, len, idx;
+
+	idx = model_find(name);
+
+	if (idx >= 0 && chance(40)) {
+		/* indexed: the whole field from the dynamic table */
+		memcpy(expect, model[idx].value, model[idx].len);
+		*elen = model[idx].len;
+
+		return put_int(p, 0x80, 7, 62 + idx);
+	}
+
+	len = prng() % (name < 2 ? 500 : 300);
+	for (n = 0; n < len; n++)
+		value[n] = 'a' + (prng() % 26);
+	memcpy(expect, value, len);
+	*elen = len;
+	hdr_bytes += len;
+
+	switch (prng() % 6) {
+	case 0: /* without indexing, static name */
+		if (!names[name].static_idx)
+			break;
+		p = put_int(p, 0x00, 4, names[name].static_idx);
+		return put_str(p, value, len);
+	case 1: /* never indexed, static name */
+		if (!names[name].static_idx)
+			break;
+		p = put_int(p, 0x10, 4, names[name].static_idx);
+		return put_str(p, value, len);
+	case 2: /* incremental indexing, name from a dynamic entry */
+		if (idx < 0)
+			break;
+		p = put_int(p, 0x40, 6, 62 + idx);
+		p = put_str(p, value, len);
+		model_insert(name, value, len);
+		return p;
+	case 3: /* incremental indexing, static name */
+		if (!names[name].static_idx)
+			break;
+		p = put_int(p, 0x40, 6, names[name].static_idx);
+		p = put_str(p, value, len);
+		model_insert(name, value, len);
+		return p;
+	default:
+		break;
+	}
+
+	/* incremental indexing, literal name */
+	*p++ = 0x40;
+	p = put_str(p, names[name].name, (int)strlen(names[name].name));
+	p = put_str(p, value, len);
+	model_insert(name, value, len);
+
+	return p;
+}
+
+static int
+send_frame(int fd, int type, int flags, uint32_t sid, const uint8_t *pl,
+	   size_t len)
+{
+	uint8_t h[9];
+
+	h[0] = (uint8_t)(len >> 16);
+	h[1] = (uint8_t)(len >> 8);
+	h[2] = (uint8_t)len;
+	h[3] = (uint8_t)type;
+	h[4] = (uint8_t)flags;
+	h[5] = (uint8_t)(sid >> 24);
+	h[6] = (uint8_t)(sid >> 16);
+	h[7] = (uint8_t)(sid >> 8);
+	h[8] = (uint8_t)sid;
+
+	if (send(fd, h, sizeof(h), 0) != sizeof(h) ||
+	    (len && send(fd, pl, len, 0) != (ssize_t)len))
+		return 1;
+
+	return 0;
+}
+
+/* send the block as a HEADERS frame, maybe split over CONTINUATIONs */
+
+static int
+send_block(int fd, uint32_t sid, const uint8_t *b, size_t len)
+{
+	size_t n, chunk;
+	int type = 1; /* HEADERS */
+
+	do {
+		chunk = len;
+		if (len > 1 && chance(25))
+			chunk = 1 + prng() % (len - 1);
+		n = chunk == len ? 4 : 0; /* END_HEADERS */
+		if (type == 1)
+			n |= 1; /* END_STREAM */
+		if (send_frame(fd, type, (int)n, sid, b, chunk))
+			return 1;
+		b += chunk;
+		len -= chunk;
+		type = 9; /* CONTINUATION */
+	} while (len);
+
+	return 0;
+}
+
+static int
+read_all(int fd, uint8_t *buf, size_t len)
+{
+	ssize_t n;
+
+	while (len) {
+		n = recv(fd, buf, len, 0);
+		if (n <= 0)
+			return 1;
+		buf += n;
+		len -= (size_t)n;
+	}
+
+	return 0;
+}
+
+/*
+ * Read frames until stream sid ends, collecting its body.  Returns 0 if it
+ * completed, 1 if the connection ended or the stream was reset.
+ */
+
+static int
+read_response(int fd, uint32_t sid, char *body, int *blen, uint32_t *tsize)
+{
+	uint8_t h[9], pl[16384], wu[4];
+	uint32_t len, s;
+	int n;
+
+	*blen = 0;
+
+	while (1) {
+		if (read_all(fd, h, sizeof(h)))
+			return 1;
+		len = ((uint32_t)h[0] << 16) | (h[1] << 8) | h[2];
+		s = (((uint32_t)h[5] & 0x7f) << 24) | (h[6] << 16) |
+		    (h[7] << 8) | h[8];
+		if (len > sizeof(pl) || read_all(fd, pl, len))
+			return 1;
+
+		switch (h[3]) {
+		case 0: /* DATA */
+			if (s == sid && body && *blen + (int)len <= 1100) {
+				memcpy(body + *blen, pl, len);
+				*blen += len;
+			}
+			if (len) {
+				/* give the connection window back */
+				wu[0] = (uint8_t)(len >> 24);
+				wu[1] = (uint8_t)(len >> 16);
+				wu[2] = (uint8_t)(len >> 8);
+				wu[3] = (uint8_t)len;
+				if (send_frame(fd, 8, 0, 0, wu, 4))
+					return 1;
+			}
+			break;
+		case 3: /* RST_STREAM */
+			if (s == sid)
+				return 1;
+			break;
+		case 4: /* SETTINGS */
+			if (h[4] & 1)
+				break;
+			for (n = 0; n + 6 <= (int)len; n += 6)
+				if (pl[n] == 0 && pl[n + 1] == 1 && tsize)
+					*tsize = ((uint32_t)pl[n + 2] << 24) |
+						 (pl[n + 3] << 16) |
+						 (pl[n + 4] << 8) | pl[n + 5];
+			if (send_frame(fd, 4, 1, 0, NULL, 0))
+				return 1;
+			if (!sid)
+				return 0;
+			break;
+		case 6: /* PING */
+			if (!(h[4] & 1) && send_frame(fd, 6, 1, 0, pl, len))
+				return 1;
+			break;
+		case 7: /* GOAWAY */
+			return 1;
+		}
+
+		if (s == sid && sid && (h[4] & 1) && (h[3] == 0 || h[3] == 1))
+			return 0; /* END_STREAM */
+	}
+}
+
+static int
+fuzz_connect(uint32_t *tsize)
+{
+	static const char *upg = "GET / HTTP/1.1\r\n"
+				 "Host: localhost\r\n"
+				 "Connection: Upgrade, HTTP2-Settings\r\n"
+				 "Upgrade: h2c\r\n"
+				 "HTTP2-Settings: AAMAAABk\r\n\r\n",
+			  *preface = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+	/* SETTINGS_MAX_CONCURRENT_STREAMS 100, as in our HTTP2-Settings */
+	static const uint8_t settings[] = { 0, 3, 0, 0, 0, 100 };
+	struct sockaddr_in sa;
+	struct timeval tv;
+	char buf[256];
+	int fd, n = 0, one = 1;
+
+	fd = socket(AF_INET, SOCK_STREAM, 0);
+	if (fd < 0)
+		return -1;
+
+	tv.tv_sec = 5;
+	tv.tv_usec = 0;
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+	memset(&sa, 0, sizeof(sa));
+	sa.sin_family = AF_INET;
+	sa.sin_port = htons(PORT);
+	sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	if (connect(fd, (struct sockaddr *)&sa, sizeof(sa)) ||
+	    send(fd, upg, strlen(upg), 0) != (ssize_t)strlen(upg))
+		goto bail;
+
+	/* the 101 response ends with a blank line */
+
+	while (n < 4 || memcmp(buf + n - 4, "\r\n\r\n", 4)) {
+		if (n == sizeof(buf) || recv(fd, buf + n, 1, 0) != 1)
+			goto bail;
+		n++;
+	}
+	if (strncmp(buf, "HTTP/1.1 101", 12))
+		goto bail;
+
+	if (send(fd, preface, strlen(preface), 0) != (ssize_t)strlen(preface) ||
+	    send_frame(fd, 4, 0, 0, settings, sizeof(settings)))
+		goto bail;
+
+	/*
+	 * Wait for the server's SETTINGS, and its answer to the upgrade
+	 * request, which became stream 1
+	 */
+	*tsize = 4096;
+	if (read_response(fd, 0, NULL, &n, tsize) ||
+	    read_response(fd, 1, NULL, &n, NULL))
+		goto bail;
+
+	/* until we say otherwise, the peer decodes with the default size */
+	model_count = 0;
+	model_size = 0;
+	model_max = 4096;
+	connections++;
+
+	return fd;
+
+bail:
+	close(fd);
+
+	return -1;
+}
+
+static void *
+thread_client(void *d)
+{
+	static const uint32_t sizes[] = { 0, 256, 1024, 4096, 16384, 65536 };
+	char ua[512], ref[512], body[1100], expect[1100];
+	uint8_t block[4096], *p;
+	int fd = -1, ualen, reflen, blen, n, per_conn = 0;
+	uint32_t sid = 3, tsize = 4096;
+	struct timeval t0, t1;
+	double secs;
+
+	rng = seed ? seed : 1;
+	gettimeofday(&t0, NULL);
+
+	while (!interrupted && completed < requests) {
+		if (fd < 0) {
+			fd = fuzz_connect(&tsize);
+			if (fd < 0) {
+				lwsl_err("%s: h2c connect failed\n", __func__);
+				break;
+			}
+			sid = 3;
+			per_conn = 20 + prng() % 200;
+		}
+
+		if (!per_conn--) {
+			/*
+			 * Close this connection with a block of noise, which
+			 * the server has to survive
+			 */
+			blen = 1 + prng() % 64;
+			for (n = 0; n < blen; n++)
+				block[n] = (uint8_t)prng();
+			send_block(fd, sid, block, (size_t)blen);
+			read_response(fd, sid, body, &blen, NULL);
+			close(fd);
+			fd = -1;
+			garbage++;
+			continue;
+		}
+
+		p = block;
+
+		if (chance(5)) {
+			/* dynamic table size update */
+			n = prng() % LWS_ARRAY_SIZE(sizes);
+			model_max = sizes[n] > tsize ? tsize : sizes[n];
+			model_evict();
+			p = put_int(p, 0x20, 5, model_max);
+		}
+
+		*p++ = 0x82; /* :method GET */
+		*p++ = 0x86; /* :scheme http */
+		*p++ = 0x84; /* :path / */
+
+		for (n = 0; n < (int)(prng() % 4); n++)
+			p = put_field(p, 2 + (prng() & 1), expect, &blen);
+
+		if (chance(50)) {
+			p = put_field(p, 0, ua, &ualen);
+			p = put_field(p, 1, ref, &reflen);
+		} else {
+			p = put_field(p, 1, ref, &reflen);
+			p = put_field(p, 0, ua, &ualen);
+		}
+
+		if (send_block(fd, sid, block, lws_ptr_diff(p, block)) ||
+		    read_response(fd, sid, body, &blen, NULL)) {
+			lwsl_err("%s: request %d: stream %u failed\n", __func__,
+				 completed, sid);
+			break;
+		}
+
+		memcpy(expect, ua, ualen);
+		expect[ualen] = '\n';
+		memcpy(expect + ualen + 1, ref, reflen);
+		if (blen != ualen + 1 + reflen || memcmp(body, expect, blen)) {
+			lwsl_err("%s: request %d: wrong headers decoded\n",
+				 __func__, completed);
+			break;
+		}
+
+		completed++;
+		sid += 2;
+	}
+
+	gettimeofday(&t1, NULL);
+	if (fd >= 0)
+		close(fd);
+
+	secs = (double)(t1.tv_sec - t0.tv_sec) +
+	       ((double)t1.tv_usec - (double)t0.tv_usec) / 1000000.0;
+	lwsl_user("%d requests on %d connections (%d ended with garbage), "
+		  "%llu value bytes: %.3fs, %.0f req/s\n", completed,
+		  connections, garbage, (unsigned long long)hdr_bytes, secs,
+		  secs > 0 ? completed / secs : 0);
+
+	if (completed == requests)
+		result = 0;
+
+	interrupted = 1;
+	lws_cancel_service(context);
+
+	return NULL;
+}
+
+void sigint_handler(int sig)
+{
+	interrupted = 1;
+}
+
+int main(int argc, const char **argv)
+{
+	struct lws_context_creation_info info;
+	pthread_t pthread_client;
+	const char *p;
+	int n = 0, logs = LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE;
+
+	signal(SIGINT, sigint_handler);
+
+	if ((p = lws_cmdline_option(argc, argv, "-d")))
+		logs = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-n")))
+		requests = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-s")))
+		seed = (uint32_t)atol(p);
+
+	lws_set_log_level(logs, NULL);
+	lwsl_user("LWS minimal http server hpack decode fuzz (seed %u)\n",
+		  seed);
+
+	memset(&info, 0, sizeof info); /* otherwise uninitialized garbage */
+	info.port = PORT;
+	info.mounts = &mount;
+	info.protocols = protocols;
+
+	context = lws_create_context(&info);
+	if (!context) {
+		lwsl_err("lws init failed\n");
+		return 1;
+	}
+
+	if (pthread_create(&pthread_client, NULL, thread_client, NULL)) {
+		lwsl_err("thread creation failed\n");
+		goto bail;
+	}
+
+	while (n >= 0 && !interrupted)
+		n = lws_service(context, 1000);
+
+	pthread_join(pthread_client, NULL);
+
+bail:
+	lws_context_destroy(context);
+
+	lwsl_user("Completed: %s\n", result ? "FAIL" : "PASS");
+
+	return result;
+}
@@ -0,0 +1,273 @@
+/*
+ * lws-minimal-http-server-mount-bench
+ *
+ * Copyright (C) 2019 Andy Green <andy@warmcat.com>
+ *
+ * This file is made available under the Creative Commons CC0 1.0
+ * Universal Public Domain Dedication.
+ *
+ * This measures how the cost of an http transaction depends on how many
+ * mounts the vhost has.
+ *
+ * It creates one vhost per mount count, each on its own port, with that many
+ * per-tenant callback mounts like "/t/tenant0123" plus a "/" mount.  A thread
+ * then makes keep-alive requests deep inside one tenant's url space on each
+ * vhost in turn, and reports the average round trip.
+ *
+ * With lws matching the mounts linearly, the round trip grows with the mount
+ * count; with the compiled mount trie it should stay flat.
+ */
+
+#include <libwebsockets.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#define BASE_PORT 7681
+
+static const int counts[] = { 1, 10, 100, 1000, 4000 };
+
+static struct lws_context *context;
+static int interrupted, requests = 20000, result = 1;
+
+static int
+callback_bench(struct lws *wsi, enum lws_callback_reasons reason,
+	       void *user, void *in, size_t len)
+{
+	uint8_t buf[LWS_PRE + 256], *start = &buf[LWS_PRE], *p = start,
+		*end = &buf[sizeof(buf) - 1];
+
+	switch (reason) {
+	case LWS_CALLBACK_HTTP:
+		if (lws_add_http_common_headers(wsi, HTTP_STATUS_OK,
+						"text/plain", 2, &p, end))
+			return 1;
+		if (lws_finalize_write_http_header(wsi, start, &p, end))
+			return 1;
+
+		lws_callback_on_writable(wsi);
+
+		return 0;
+
+	case LWS_CALLBACK_HTTP_WRITEABLE:
+		memcpy(start, "ok", 2);
+		if (lws_write(wsi, start, 2, LWS_WRITE_HTTP_FINAL) != 2)
+			return 1;
+
+		if (lws_http_transaction_completed(wsi))
+			return -1;
+
+		return 0;
+
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static struct lws_protocols protocols[] = {
+	{ "http", callback_bench, 0, 0 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static struct lws_http_mount *
+create_mounts(int count)
+{
+	struct lws_http_mount *m = calloc((unsigned int)count + 1, sizeof(*m));
+	char *names = malloc((unsigned int)count * 16);
+	int n;
+
+	if (!m || !names) {
+		free(m);
+		free(names);
+
+		return NULL;
+	}
+
+	for (n = 0; n <= count; n++) {
+		m[n].mount_next = n < count ? &m[n + 1] : NULL;
+		m[n].origin_protocol = LWSMPRO_CALLBACK;
+		m[n].protocol = "http";
+		if (n == count) {
+			m[n].mountpoint = "/";
+			m[n].mountpoint_len = 1;
+			continue;
+		}
+		m[n].mountpoint = names + (n * 16);
+		m[n].mountpoint_len = (unsigned char)lws_snprintf(
+				names + (n * 16), 16, "/t/tenant%04d", n);
+	}
+
+	return m;
+}
+
+static void
+destroy_mounts(const struct lws_http_mount *m)
+{
+	free((void *)m->mountpoint);
+	free((void *)m);
+}
+
+static int
+bench_port(int port, int count)
+{
+	struct timeval tv = { 2, 0 };
+	struct sockaddr_in sa;
+	char req[128], rx[512];
+	int fd, n, r, len, got, hdr;
+	lws_usec_t t;
+
+	fd = socket(AF_INET, SOCK_STREAM, 0);
+	if (fd < 0)
+		return 1;
+
+	/* so we notice if the service loop is stopped underneath us */
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+	memset(&sa, 0, sizeof(sa));
+	sa.sin_family = AF_INET;
+	sa.sin_port = htons(port);
+	sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if (connect(fd, (struct sockaddr *)&sa, sizeof(sa)) < 0) {
+		close(fd);
+		return 1;
+	}
+
+	/* a uri inside the url space of the middle tenant */
+
+	len = lws_snprintf(req, sizeof(req), "GET /t/tenant%04d/api/v1/item "
+			   "HTTP/1.1\r\nHost: localhost\r\n\r\n", count / 2);
+
+	t = lws_time_in_microseconds();
+	for (r = 0; r < requests && !interrupted; r++) {
+		if (write(fd, req, (unsigned int)len) != len)
+			goto bail;
+
+		/* the response is headers followed by the 2-byte body */
+
+		got = 0;
+		hdr = -1;
+		while (hdr < 0 || got < hdr + 2) {
+			n = (int)read(fd, rx + got,
+				      sizeof(rx) - 1 - (unsigned int)got);
+			if (n <= 0)
+				goto bail;
+			got += n;
+			rx[got] = '\0';
+			if (hdr < 0 && strstr(rx, "\r\n\r\n"))
+				hdr = lws_ptr_diff(strstr(rx, "\r\n\r\n"),
+						   rx) + 4;
+		}
+	}
+	t = lws_time_in_microseconds() - t;
+	close(fd);
+
+	lwsl_user("  %5d mounts: %6.2fus / request\n", count,
+		  (double)t / (double)(r ? r : 1));
+
+	return 0;
+
+bail:
+	close(fd);
+	lwsl_err("%s: port %d: transaction %d failed\n", __func__, port, r);
+
+	return 1;
+}
+
+static void *
+thread_bench(void *d)
+{
+	int n;
+
+	lwsl_user("%d keep-alive requests per vhost\n", requests);
+
+	for (n = 0; n < (int)LWS_ARRAY_SIZE(counts); n++)
+		if (bench_port(BASE_PORT + n, counts[n]))
+			goto done;
+
+	result = 0;
+
+done:
+	interrupted = 1;
+	lws_cancel_service(context);
+
+	return NULL;
+}
+
+void sigint_handler(int sig)
+{
+	interrupted = 1;
+}
+
+int main(int argc, const char **argv)
+{
+	struct lws_http_mount *mounts[LWS_ARRAY_SIZE(counts)];
+	struct lws_context_creation_info info;
+	pthread_t pthread_bench;
+	const char *p;
+	int n = 0, m, logs = LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE;
+
+	signal(SIGINT, sigint_handler);
+
+	if ((p = lws_cmdline_option(argc, argv, "-d")))
+		logs = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-n")))
+		requests = atoi(p);
+
+	lws_set_log_level(logs, NULL);
+	lwsl_user("LWS minimal http server mount bench\n");
+
+	memset(&info, 0, sizeof info); /* otherwise uninitialized garbage */
+	info.options = LWS_SERVER_OPTION_EXPLICIT_VHOSTS;
+
+	context = lws_create_context(&info);
+	if (!context) {
+		lwsl_err("lws init failed\n");
+		return 1;
+	}
+
+	memset(mounts, 0, sizeof(mounts));
+	info.protocols = protocols;
+
+	for (m = 0; m < (int)LWS_ARRAY_SIZE(counts); m++) {
+		mounts[m] = create_mounts(counts[m]);
+		if (!mounts[m])
+			goto bail;
+
+		info.port = BASE_PORT + m;
+		info.mounts = mounts[m];
+
+		if (!lws_create_vhost(context, &info)) {
+			lwsl_err("Failed to create vhost\n");
+			goto bail;
+		}
+	}
+
+	if (pthread_create(&pthread_bench, NULL, thread_bench, NULL)) {
+		lwsl_err("thread creation failed\n");
+		goto bail;
+	}
+
+	while (n >= 0 && !interrupted)
+		n = lws_service(context, 1000);
+
+	pthread_join(pthread_bench, NULL);
+
+bail:
+	lws_context_destroy(context);
+
+	for (m = 0; m < (int)LWS_ARRAY_SIZE(counts); m++)
+		if (mounts[m])
+			destroy_mounts(mounts[m]);
+
+	lwsl_user("Completed: %s\n", result ? "FAIL" : "PASS");
+
+	return result;
+}
@@ -16,17 +16,56 @@
  * the real number of threads possible is decided by the LWS_MAX_SMP that lws
  * was configured with, by default that is 1.  Lws will limit the number of
  * requested threads to the number possible.
+ *
+ * -r keeps each accepted connection on the service thread whose listen socket
+ * accepted it, and -b <secs> runs a connection rate benchmark against
+ * ourselves, so the two ways of distributing connections can be compared.
  */
 
 #include <libwebsockets.h>
 #include <string.h>
 #include <signal.h>
 #include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
 
 #define COUNT_THREADS 8
 
 static struct lws_context *context;
-static int interrupted;
+static pthread_t pthread_service[COUNT_THREADS];
+static volatile int interrupted, bench_done;
+static int count_service_threads;
+static unsigned long conns_per_thread[COUNT_THREADS], bench_conns;
+static pthread_mutex_t lock_bench = PTHREAD_MUTEX_INITIALIZER;
+
+static int
+callback_smp(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+	     void *in, size_t len)
+{
+	int n;
+
+	switch (reason) {
+	case LWS_CALLBACK_WSI_DESTROY:
+		/* note which service thread the connection ended up on */
+		for (n = 0; n < count_service_threads; n++)
+			if (pthread_equal(pthread_self(), pthread_service[n])) {
+				conns_per_thread[n]++;
+				break;
+			}
+		break;
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static struct lws_protocols protocols[] = {
+	{ "http", callback_smp, 0, 0 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
 
 static const struct lws_http_mount mount = {
 	/* .mount_next */		NULL,		/* linked-list "next" */
@@ -58,6 +97,46 @@ void *thread_service(void *threadid)
 	pthread_exit(NULL);
 }
 
+/*
+ * bench client thread: open a connection, fetch / with HTTP/1.0 so the server
+ * closes it afterwards, and repeat as fast as we can until told to stop
+ */
+
+void *thread_bench(void *d)
+{
+	static const char req[] = "GET / HTTP/1.0\r\n\r\n";
+	struct sockaddr_in sin;
+	unsigned long count = 0;
+	char buf[2048];
+	int fd;
+
+	memset(&sin, 0, sizeof(sin));
+	sin.sin_family = AF_INET;
+	sin.sin_port = htons(7681);
+	sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	while (!bench_done) {
+		fd = socket(AF_INET, SOCK_STREAM, 0);
+		if (fd < 0)
+			break;
+		if (connect(fd, (struct sockaddr *)&sin, sizeof(sin)) < 0 ||
+		    write(fd, req, sizeof(req) - 1) != sizeof(req) - 1) {
+			close(fd);
+			break;
+		}
+		while (read(fd, buf, sizeof(buf)) > 0)
+			;
+		close(fd);
+		count++;
+	}
+
+	pthread_mutex_lock(&lock_bench);
+	bench_conns += count;
+	pthread_mutex_unlock(&lock_bench);
+
+	pthread_exit(NULL);
+}
+
 void sigint_handler(int sig)
 {
 	interrupted = 1;
@@ -66,11 +145,9 @@ void sigint_handler(int sig)
 
 int main(int argc, const char **argv)
 {
-	pthread_t pthread_service[COUNT_THREADS];
+	pthread_t pthread_bench[COUNT_THREADS];
 	struct lws_context_creation_info info;
-	void *retval;
-	const char *p;
-	int n = 0, logs = LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE
+	int n = 0, m, bench_secs = 0, logs = LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE
 			/* for LLL_ verbosity above NOTICE to be built into lws,
 			 * lws must have been configured and built with
 			 * -DCMAKE_BUILD_TYPE=DEBUG instead of =RELEASE */
@@ -78,8 +155,13 @@ int main(int argc, const char **argv)
 			/* | LLL_EXT */ /* | LLL_CLIENT */ /* | LLL_LATENCY */
 			/* | LLL_DEBUG */;
 
+	void *retval;
+	const char *p;
+
 	if ((p = lws_cmdline_option(argc, argv, "-d")))
 		logs = atoi(p);
+	if ((p = lws_cmdline_option(argc, argv, "-b")))
+		bench_secs = atoi(p);
 
 	lws_set_log_level(logs, NULL);
 	lwsl_user("LWS minimal http server SMP | visit http://127.0.0.1:7681\n");
@@ -89,11 +171,13 @@ int main(int argc, const char **argv)
 	memset(&info, 0, sizeof info); /* otherwise uninitialized garbage */
 	info.port = 7681;
 	info.mounts = &mount;
+	info.protocols = protocols;
 	info.options =
 		LWS_SERVER_OPTION_HTTP_HEADERS_SECURITY_BEST_PRACTICES_ENFORCE;
 	if ((p = lws_cmdline_option(argc, argv, "-t"))) {
 		info.count_threads = atoi(p);
-		if (info.count_threads < 1 || info.count_threads > LWS_MAX_SMP)
+		if (info.count_threads < 1 || info.count_threads > LWS_MAX_SMP ||
+		    info.count_threads > COUNT_THREADS)
 			return 1;
 	} else
 		info.count_threads = COUNT_THREADS;
@@ -104,21 +188,52 @@ int main(int argc, const char **argv)
 		info.ssl_private_key_filepath = "localhost-100y.key";
 	}
 
+	if (lws_cmdline_option(argc, argv, "-r"))
+		/* each thread accepts onto itself from its own listen socket */
+		info.listen_accept_own_pt = 1;
+
 	context = lws_create_context(&info);
 	if (!context) {
 		lwsl_err("lws init failed\n");
 		return 1;
 	}
 
-	lwsl_notice("  Service threads: %d\n", lws_get_count_threads(context));
+	count_service_threads = lws_get_count_threads(context);
+	lwsl_notice("  Service threads: %d\n", count_service_threads);
 
 	/* start all the service threads */
 
-	for (n = 0; n < lws_get_count_threads(context); n++)
+	for (n = 0; n < count_service_threads; n++)
 		if (pthread_create(&pthread_service[n], NULL, thread_service,
 				   (void *)(lws_intptr_t)n))
 			lwsl_err("Failed to start service thread\n");
 
+	if (bench_secs) {
+		/* one client thread per service thread */
+
+		for (m = 0; m < n; m++)
+			if (pthread_create(&pthread_bench[m], NULL,
+					   thread_bench, NULL))
+				break;
+
+		sleep(bench_secs);
+		bench_done = 1;
+
+		while ((--m) >= 0)
+			pthread_join(pthread_bench[m], &retval);
+
+		lwsl_user("%s: %d threads: %lu connections in %ds: %lu / s\n",
+			  info.listen_accept_own_pt ? "own pt" : "idlest pt",
+			  count_service_threads, bench_conns, bench_secs,
+			  bench_conns / bench_secs);
+		for (m = 0; m < count_service_threads; m++)
+			lwsl_user("  thread %d: %lu connections\n", m,
+				  conns_per_thread[m]);
+
+		interrupted = 1;
+		lws_cancel_service(context);
+	}
+
 	/* wait for all the service threads to exit */
 
 	while ((--n) >= 0)
@@ -0,0 +1,236 @@
+/*
+ * lws-minimal-raw-idle-bench
+ *
+ * Copyright (C) 2018 Andy Green <andy@warmcat.com>
+ *
+ * This file is made available under the Creative Commons CC0 1.0
+ * Universal Public Domain Dedication.
+ *
+ * This measures how the cost of servicing one active connection changes
+ * with the number of idle connections sharing the same service thread, for
+ * the default poll() event loop and, if lws was built with LWS_WITH_EPOLL,
+ * the epoll() event loop (-e), or with LWS_WITH_IO_URING, the io_uring event
+ * loop (-u).
+ *
+ * We listen on a raw vhost, open -c <count> tcp connections to ourselves
+ * that then sit idle, and then time -n <count> one-byte echo round trips on
+ * just one of them.
+ */
+
+#include <libwebsockets.h>
+#include <string.h>
+#include <signal.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#define BENCH_PORT 7690
+
+struct raw_pss {
+	uint8_t c;
+};
+
+static int interrupted, accepted;
+
+static int
+callback_raw_echo(struct lws *wsi, enum lws_callback_reasons reason,
+		  void *user, void *in, size_t len)
+{
+	struct raw_pss *pss = (struct raw_pss *)user;
+
+	switch (reason) {
+	case LWS_CALLBACK_RAW_ADOPT:
+		accepted++;
+		break;
+
+	case LWS_CALLBACK_RAW_CLOSE:
+		accepted--;
+		break;
+
+	case LWS_CALLBACK_RAW_RX:
+		pss->c = *(uint8_t *)in;
+		lws_callback_on_writable(wsi);
+		break;
+
+	case LWS_CALLBACK_RAW_WRITEABLE:
+		if (lws_write(wsi, &pss->c, 1, LWS_WRITE_RAW) != 1)
+			return 1;
+		break;
+
+	default:
+		break;
+	}
+
+	return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+static struct lws_protocols protocols[] = {
+	{ "raw-echo", callback_raw_echo, sizeof(struct raw_pss), 0 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+void sigint_handler(int sig)
+{
+	interrupted = 1;
+}
+
+static uint64_t
+us_now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+
+	return ((uint64_t)tv.tv_sec * 1000000) + tv.tv_usec;
+}
+
+static int
+connect_one(void)
+{
+	struct sockaddr_in sin;
+	int fd;
+
+	fd = socket(AF_INET, SOCK_STREAM, 0);
+	if (fd < 0)
+		return -1;
+
+	fcntl(fd, F_SETFL, O_NONBLOCK);
+
+	memset(&sin, 0, sizeof(sin));
+	sin.sin_family = AF_INET;
+	sin.sin_port = htons(BENCH_PORT);
+	sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	if (connect(fd, (struct sockaddr *)&sin, sizeof(sin)) < 0 &&
+	    errno != EINPROGRESS) {
+		close(fd);
+		return -1;
+	}
+
+	return fd;
+}
+
+int main(int argc, const char **argv)
+{
+	int n = 0, m, count = 1000, trips = 10000, *fds, logs =
+			LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE;
+	struct lws_context_creation_info info;
+	struct lws_context *context;
+	uint64_t us, services = 0;
+	struct rlimit rl;
+	const char *p, *backend = "poll";
+	uint8_t c;
+
+	signal(SIGINT, sigint_handler);
+
+	if ((p = lws_cmdline_option(argc, argv, "-d")))
+		logs = atoi(p);
+	if ((p = lws_cmdline_option(argc, argv, "-c")))
+		count = atoi(p);
+	if ((p = lws_cmdline_option(argc, argv, "-n")))
+		trips = atoi(p);
+
+	lws_set_log_level(logs, NULL);
+	lwsl_user("LWS minimal raw idle bench\n");
+
+	/* both ends of every connection live in this process */
+
+	getrlimit(RLIMIT_NOFILE, &rl);
+	rl.rlim_cur = (count * 2) + 256;
+	if (rl.rlim_cur > rl.rlim_max)
+		rl.rlim_max = rl.rlim_cur;
+	if (setrlimit(RLIMIT_NOFILE, &rl)) {
+		lwsl_err("Unable to raise RLIMIT_NOFILE to %d (try as root)\n",
+			 (int)rl.rlim_cur);
+		return 1;
+	}
+
+	fds = malloc(sizeof(int) * count);
+	if (!fds)
+		return 1;
+
+	memset(&info, 0, sizeof info); /* otherwise uninitialized garbage */
+	info.port = BENCH_PORT;
+	info.protocols = protocols;
+	info.options = LWS_SERVER_OPTION_ADOPT_APPLY_LISTEN_ACCEPT_CONFIG;
+
+	if (lws_cmdline_option(argc, argv, "-e"))
+#if defined(LWS_WITH_EPOLL)
+	{
+		info.options |= LWS_SERVER_OPTION_EPOLL;
+		backend = "epoll";
+	}
+#else
+	{
+		lwsl_err("lws not built with LWS_WITH_EPOLL\n");
+		return 1;
+	}
+#endif
+
+	if (lws_cmdline_option(argc, argv, "-u")) {
+		/* falls back to poll if the kernel can't do io_uring */
+		info.event_lib = "io_uring";
+		backend = "io_uring";
+	}
+
+	context = lws_create_context(&info);
+	if (!context) {
+		lwsl_err("lws init failed\n");
+		return 1;
+	}
+
+	/*
+	 * Connect the idle population in batches so we don't overflow the
+	 * listen backlog before lws gets a chance to accept them
+	 */
+
+	for (m = 0; m < count && !interrupted; m++) {
+		fds[m] = connect_one();
+		if (fds[m] < 0) {
+			lwsl_err("connect %d failed, errno %d\n", m, errno);
+			count = m;
+			break;
+		}
+		if ((m & 63) == 63 || m == count - 1)
+			while (accepted < m + 1 && !interrupted)
+				lws_service(context, 10);
+	}
+
+	lwsl_user("%d idle connections established\n", accepted);
+
+	/* time echo round trips on the first connection only */
+
+	us = us_now();
+	for (m = 0; m < trips && n >= 0 && !interrupted; m++) {
+		c = (uint8_t)m;
+		if (send(fds[0], &c, 1, 0) != 1) {
+			lwsl_err("send failed\n");
+			break;
+		}
+		while (n >= 0 && !interrupted &&
+		       recv(fds[0], &c, 1, MSG_DONTWAIT) != 1) {
+			n = lws_service(context, 1000);
+			services++;
+		}
+	}
+	us = us_now() - us;
+
+	lwsl_user("%s: %d idle conns: %d round trips in %lluus: "
+		  "%.2fus / trip, %.2fus / lws_service()\n",
+		  backend,
+		  count, m, (unsigned long long)us, (double)us / (m ? m : 1),
+		  (double)us / (services ? services : 1));
+
+	for (m = 0; m < count; m++)
+		close(fds[m]);
+	free(fds);
+
+	lws_context_destroy(context);
+
+	return 0;
+}
@@ -0,0 +1,411 @@
+/*
+ * lws-minimal-ws-server-broadcast-bench
+ *
+ * Copyright (C) 2019 Andy Green <andy@warmcat.com>
+ *
+ * This file is made available under the Creative Commons CC0 1.0
+ * Universal Public Domain Dedication.
+ *
+ * This measures how much server cpu it costs to fan out the same messages
+ * to many ws connections.
+ *
+ * The main thread runs a ws server.  A second thread runs a client context
+ * that opens the connections to it.  When they are all established, the
+ * server publishes the messages, either with lws_ws_broadcast(), or with -c,
+ * the usual way, by having each connection copy each message into its own
+ * buffer and lws_write() it in its WRITEABLE callback.  When every client
+ * got every message, we report the cpu time the server thread spent.
+ *
+ * With -e, the connections use permessage-deflate, so each one has to
+ * compress its own copy of each message either way.
+ *
+ * --evict is a test rather than a bench: a third thread broadcasts to two
+ * connections, one of which stops reading, with a small
+ * ws_bcast_max_queued.  The stalled one must be closed, and the other must
+ * still get every message.
+ */
+
+#include <libwebsockets.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+struct pss {
+	int next; /* the next message this connection sends or receives */
+	char stalled; /* --evict: the client that stopped reading */
+};
+
+static struct lws_context *context, *cx_client;
+static struct lws_vhost *bcast_vh;
+static const struct lws_protocols *bcast_prot;
+static volatile int interrupted, bcast_go, rx_done;
+static int port = 7681, conns = 200, messages = 2000, msg_size = 128, copy,
+	   pmd, evict, established, published, client_established,
+	   server_closed, result = 1;
+static uint64_t rx_messages;
+static uint8_t *msgs;
+static struct timespec cpu_start, cpu_end;
+
+static uint8_t *
+msg(int n)
+{
+	return msgs + (LWS_PRE + msg_size) * n + LWS_PRE;
+}
+
+static int
+callback_bcast(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+	       void *in, size_t len)
+{
+	struct pss *pss = (struct pss *)user;
+	uint8_t buf[LWS_PRE + 4096];
+	int n;
+
+	switch (reason) {
+	case LWS_CALLBACK_ESTABLISHED:
+		pss->next = 0;
+		if (++established != conns)
+			break;
+
+		lwsl_user("%d connections up, publishing %d messages\n",
+			  conns, messages);
+		clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_start);
+
+		if (evict) {
+			/* thread_bcast() publishes them */
+			bcast_vh = lws_get_vhost(wsi);
+			bcast_prot = lws_get_protocol(wsi);
+			bcast_go = 1;
+			break;
+		}
+
+		if (copy) {
+			published = messages;
+			lws_callback_on_writable_all_protocol_vhost(
+					lws_get_vhost(wsi), lws_get_protocol(wsi));
+			break;
+		}
+
+		for (n = 0; n < messages; n++)
+			if (lws_ws_broadcast(lws_get_vhost(wsi),
+					     lws_get_protocol(wsi), msg(n),
+					     (size_t)msg_size,
+					     LWS_WRITE_BINARY) != conns)
+				return -1;
+		break;
+
+	case LWS_CALLBACK_SERVER_WRITEABLE:
+		if (!copy || pss->next == published)
+			break;
+
+		/* the usual way, each connection copies and frames it */
+		memcpy(&buf[LWS_PRE], msg(pss->next), (size_t)msg_size);
+		if (lws_write(wsi, &buf[LWS_PRE], (size_t)msg_size,
+			      LWS_WRITE_BINARY) != msg_size)
+			return -1;
+		if (++pss->next != published)
+			lws_callback_on_writable(wsi);
+		break;
+
+	case LWS_CALLBACK_CLOSED:
+		server_closed++;
+		/* fallthru */
+	case LWS_CALLBACK_EVENT_WAIT_CANCELLED:
+		/* --evict: the reader got everything and the stalled one went */
+		if (evict && rx_done && server_closed && result) {
+			lwsl_user("stalled connection closed, the other "
+				  "got all %d messages\n", messages);
+			result = 0;
+			interrupted = 1;
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+static int
+callback_client(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+		void *in, size_t len)
+{
+	struct pss *pss = (struct pss *)user;
+
+	switch (reason) {
+	case LWS_CALLBACK_CLIENT_CONNECTION_ERROR:
+		lwsl_err("CLIENT_CONNECTION_ERROR: %s\n",
+			 in ? (char *)in : "(null)");
+		interrupted = 1;
+		break;
+
+	case LWS_CALLBACK_CLIENT_ESTABLISHED:
+		if (evict && !client_established++) {
+			/* this one stops reading, so its broadcasts pile up */
+			pss->stalled = 1;
+			lws_rx_flow_control(wsi, 0);
+		}
+		break;
+
+	case LWS_CALLBACK_CLIENT_RECEIVE:
+		if (lws_is_first_fragment(wsi) &&
+		    atoi((const char *)in) != pss->next++) {
+			lwsl_err("%s: message %d out of order\n", __func__,
+				 pss->next - 1);
+			interrupted = 1;
+			return -1;
+		}
+		if (!lws_is_final_fragment(wsi))
+			break;
+		if (evict) {
+			if (!pss->stalled && pss->next == messages) {
+				/* the server decides if we passed */
+				rx_done = 1;
+				lws_cancel_service(context);
+			}
+			break;
+		}
+		if (++rx_messages == (uint64_t)conns * (uint64_t)messages) {
+			result = 0;
+			interrupted = 1;
+			lws_cancel_service(context);
+		}
+		break;
+
+	case LWS_CALLBACK_CLIENT_CLOSED:
+		if (result && !pss->stalled)
+			interrupted = 1;
+		break;
+
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+static const struct lws_extension extensions[] = {
+	{
+		"permessage-deflate",
+		lws_extension_callback_pm_deflate,
+		"permessage-deflate"
+		 "; client_no_context_takeover"
+		 "; client_max_window_bits"
+	},
+	{ NULL, NULL, NULL /* terminator */ }
+};
+
+static const struct lws_protocols protocols_server[] = {
+	{ "http", lws_callback_http_dummy, 0, 0 },
+	{ "bcast", callback_bcast, sizeof(struct pss), 4096 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static const struct lws_protocols protocols_client[] = {
+	{ "bcast", callback_client, sizeof(struct pss), 4096 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static void *
+thread_client(void *d)
+{
+	struct lws_client_connect_info i;
+	int n;
+
+	for (n = 0; n < conns; n++) {
+		memset(&i, 0, sizeof i); /* otherwise uninitialized garbage */
+		i.context = cx_client;
+		i.port = port;
+		i.address = "localhost";
+		i.host = i.address;
+		i.origin = i.address;
+		i.path = "/";
+		i.protocol = protocols_client[0].name;
+
+		if (!lws_client_connect_via_info(&i)) {
+			lwsl_err("%s: connect failed\n", __func__);
+			goto bail;
+		}
+	}
+
+	n = 0;
+	while (n >= 0 && !interrupted)
+		n = lws_service(cx_client, 1000);
+
+bail:
+	interrupted = 1;
+	lws_cancel_service(context);
+
+	return NULL;
+}
+
+/*
+ * --evict: publish from a thread that isn't servicing either context, paced
+ * so the connection that is reading can keep up
+ */
+
+static void *
+thread_bcast(void *d)
+{
+	int n;
+
+	while (!bcast_go && !interrupted)
+		usleep(1000);
+
+	for (n = 0; n < messages && !interrupted; n++) {
+		if (lws_ws_broadcast(bcast_vh, bcast_prot, msg(n),
+				     (size_t)msg_size, LWS_WRITE_BINARY) < 0) {
+			lwsl_err("%s: broadcast failed\n", __func__);
+			interrupted = 1;
+			lws_cancel_service(context);
+			break;
+		}
+		usleep(250);
+	}
+
+	return NULL;
+}
+
+void sigint_handler(int sig)
+{
+	interrupted = 1;
+}
+
+int main(int argc, const char **argv)
+{
+	struct lws_context_creation_info info;
+	pthread_t pthread_client, pthread_bcast;
+	const char *p;
+	int n = 0, logs = LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE;
+	double t;
+
+	signal(SIGINT, sigint_handler);
+
+	if ((p = lws_cmdline_option(argc, argv, "-d")))
+		logs = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-n")))
+		conns = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-m")))
+		messages = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-s")))
+		msg_size = atoi(p);
+
+	copy = !!lws_cmdline_option(argc, argv, "-c");
+	pmd = !!lws_cmdline_option(argc, argv, "-e");
+	evict = !!lws_cmdline_option(argc, argv, "--evict");
+
+	lws_set_log_level(logs, NULL);
+	lwsl_user("LWS minimal ws server broadcast bench (%s)\n",
+		  evict ? "evict test" : (copy ? "copy in WRITEABLE" :
+						 "lws_ws_broadcast"));
+
+	if (evict) {
+#if LWS_MAX_SMP > 1
+		/* enough to fill the stalled one's socket buffers */
+		conns = 2;
+		copy = 0;
+		messages = 2000;
+		msg_size = 4096;
+#else
+		/* lws_ws_broadcast() may only be called from other threads
+		 * if lws was built with LWS_MAX_SMP > 1 */
+		lwsl_user("--evict needs LWS_MAX_SMP > 1, skipping\n");
+		lwsl_user("Completed: PASS\n");
+
+		return 0;
+#endif
+	}
+
+	if (msg_size < 1 || msg_size > 4096 || conns < 1 || messages < 1) {
+		lwsl_err("-s must be 1 - 4096, -n and -m at least 1\n");
+		return 1;
+	}
+
+	msgs = malloc((size_t)(LWS_PRE + msg_size) * (size_t)messages);
+	if (!msgs)
+		return 1;
+	for (n = 0; n < messages; n++) {
+		memset(msg(n), 'a' + (n % 26), (size_t)msg_size);
+		lws_snprintf((char *)msg(n), (size_t)msg_size, "%d", n);
+	}
+
+	memset(&info, 0, sizeof info); /* otherwise uninitialized garbage */
+	info.port = port;
+	info.protocols = protocols_server;
+	info.fd_limit_per_thread = (unsigned int)conns + 16;
+	/* we publish everything at once, let it all be queued */
+	info.ws_bcast_max_queued = (size_t)messages * (size_t)(msg_size + 10);
+	if (evict)
+		/* ... except with --evict, where that's what we're testing */
+		info.ws_bcast_max_queued = 64 * (size_t)(msg_size + 10);
+	if (pmd)
+		info.extensions = extensions;
+
+	context = lws_create_context(&info);
+	if (!context) {
+		lwsl_err("lws init failed\n");
+		goto bail1;
+	}
+
+	memset(&info, 0, sizeof info);
+	info.port = CONTEXT_PORT_NO_LISTEN; /* we do not run any server */
+	info.protocols = protocols_client;
+	info.fd_limit_per_thread = (unsigned int)conns + 16;
+	if (pmd)
+		info.extensions = extensions;
+
+	cx_client = lws_create_context(&info);
+	if (!cx_client) {
+		lwsl_err("lws client init failed\n");
+		goto bail;
+	}
+
+	if (pthread_create(&pthread_client, NULL, thread_client, NULL)) {
+		lwsl_err("thread creation failed\n");
+		goto bail;
+	}
+
+	if (evict &&
+	    pthread_create(&pthread_bcast, NULL, thread_bcast, NULL)) {
+		lwsl_err("thread creation failed\n");
+		interrupted = 1;
+		pthread_join(pthread_client, NULL);
+		goto bail;
+	}
+
+	n = 0;
+	while (n >= 0 && !interrupted)
+		n = lws_service(context, 1000);
+
+	/* the server thread's cpu time, it has nothing left to do */
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_end);
+
+	pthread_join(pthread_client, NULL);
+	if (evict)
+		pthread_join(pthread_bcast, NULL);
+
+	if (!result && !evict) {
+		t = (double)(cpu_end.tv_sec - cpu_start.tv_sec) +
+		    (double)(cpu_end.tv_nsec - cpu_start.tv_nsec) / 1e9;
+		lwsl_user("%d x %dB messages to %d connections: "
+			  "server cpu %.3fs, %.0fns per message delivered\n",
+			  messages, msg_size, conns, t,
+			  (t * 1e9) / ((double)conns * (double)messages));
+	}
+
+bail:
+	if (cx_client)
+		lws_context_destroy(cx_client);
+	lws_context_destroy(context);
+bail1:
+	free(msgs);
+
+	lwsl_user("Completed: %s\n", result ? "FAIL" : "PASS");
+
+	return result;
+}
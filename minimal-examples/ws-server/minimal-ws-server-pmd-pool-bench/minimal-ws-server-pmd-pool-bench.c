@@ -0,0 +1,354 @@
+/*
+ * lws-minimal-ws-server-pmd-pool-bench
+ *
+ * Copyright (C) 2019 Andy Green <andy@warmcat.com>
+ *
+ * This file is made available under the Creative Commons CC0 1.0
+ * Universal Public Domain Dedication.
+ *
+ * This measures how much zlib memory the server needs for many
+ * permessage-deflate connections.
+ *
+ * The main thread runs a ws server.  A second thread runs a client context
+ * that opens the connections to it.  Each client sends its messages one by
+ * one, and the server echoes each one back; the clients check they got back
+ * what they sent.  When they are all done, we report the server's peak zlib
+ * memory from the lws stats.
+ *
+ * By default the connections take over context, so each keeps its own zlib
+ * streams.  With -p, the server uses LWS_CALLBACK_WS_EXT_DEFAULTS to add
+ * server_no_context_takeover and client_no_context_takeover to its response,
+ * so the connections only use a stream from the pool while a message is in
+ * flight.
+ */
+
+#include <libwebsockets.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+#include <time.h>
+
+struct pss {
+	uint8_t *buf; /* the message we are sending */
+	size_t ofs; /* how much of the message we received so far */
+	int next; /* client: the message we send next */
+	char echo; /* server: buf holds a whole message to send back,
+		    * client: we sent msg(next) and wait for it to come back */
+};
+
+static struct lws_context *context, *cx_client;
+static int interrupted, port = 7681, conns = 500, messages = 20,
+	   msg_size = 2048, pooled, done, result = 1;
+static uint8_t *msgs;
+static struct timespec cpu_start, cpu_end;
+
+static uint8_t *
+msg(int n)
+{
+	return msgs + (LWS_PRE + msg_size) * n + LWS_PRE;
+}
+
+static int
+callback_echo(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+	      void *in, size_t len)
+{
+	struct pss *pss = (struct pss *)user;
+
+	switch (reason) {
+	case LWS_CALLBACK_WS_EXT_DEFAULTS:
+		if (pooled)
+			lws_strncpy(in, "server_no_context_takeover; "
+					"client_no_context_takeover", len);
+		break;
+
+	case LWS_CALLBACK_ESTABLISHED:
+		pss->buf = malloc(LWS_PRE + (size_t)msg_size);
+		if (!pss->buf)
+			return -1;
+		pss->ofs = 0;
+		pss->echo = 0;
+		break;
+
+	case LWS_CALLBACK_CLOSED:
+		free(pss->buf);
+		pss->buf = NULL;
+		break;
+
+	case LWS_CALLBACK_RECEIVE:
+		if (pss->echo || pss->ofs + len > (size_t)msg_size) {
+			lwsl_err("%s: unexpected rx\n", __func__);
+			return -1;
+		}
+		memcpy(pss->buf + LWS_PRE + pss->ofs, in, len);
+		pss->ofs += len;
+		if (!lws_is_final_fragment(wsi))
+			break;
+		pss->echo = 1;
+		lws_callback_on_writable(wsi);
+		break;
+
+	case LWS_CALLBACK_SERVER_WRITEABLE:
+		if (!pss->echo)
+			break;
+		if (lws_write(wsi, pss->buf + LWS_PRE, pss->ofs,
+			      LWS_WRITE_TEXT) < (int)pss->ofs)
+			return -1;
+		pss->ofs = 0;
+		pss->echo = 0;
+		break;
+
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+static int
+callback_client(struct lws *wsi, enum lws_callback_reasons reason, void *user,
+		void *in, size_t len)
+{
+	struct pss *pss = (struct pss *)user;
+
+	switch (reason) {
+	case LWS_CALLBACK_CLIENT_CONNECTION_ERROR:
+		lwsl_err("CLIENT_CONNECTION_ERROR: %s\n",
+			 in ? (char *)in : "(null)");
+		interrupted = 1;
+		break;
+
+	case LWS_CALLBACK_CLIENT_ESTABLISHED:
+		pss->buf = malloc(LWS_PRE + (size_t)msg_size);
+		if (!pss->buf)
+			return -1;
+		pss->next = 0;
+		pss->ofs = 0;
+		pss->echo = 0;
+		lws_callback_on_writable(wsi);
+		break;
+
+	case LWS_CALLBACK_CLIENT_WRITEABLE:
+		if (pss->echo)
+			break;
+		/*
+		 * lws_write() may mask the buffer in place, and pmd reads it
+		 * again if it couldn't compress all of it at once, so each
+		 * connection needs its own copy
+		 */
+		memcpy(pss->buf + LWS_PRE, msg(pss->next), (size_t)msg_size);
+		if (lws_write(wsi, pss->buf + LWS_PRE, (size_t)msg_size,
+			      LWS_WRITE_TEXT) < msg_size)
+			return -1;
+		pss->echo = 1;
+		break;
+
+	case LWS_CALLBACK_CLIENT_RECEIVE:
+		if (pss->ofs + len > (size_t)msg_size ||
+		    memcmp(in, msg(pss->next) + pss->ofs, len)) {
+			lwsl_err("%s: message %d echoed wrongly\n", __func__,
+				 pss->next);
+			interrupted = 1;
+			return -1;
+		}
+		pss->ofs += len;
+		if (!lws_is_final_fragment(wsi))
+			break;
+		pss->ofs = 0;
+		pss->echo = 0;
+		if (++pss->next != messages) {
+			lws_callback_on_writable(wsi);
+			break;
+		}
+		if (++done == conns) {
+			result = 0;
+			interrupted = 1;
+			lws_cancel_service(context);
+		}
+		break;
+
+	case LWS_CALLBACK_CLIENT_CLOSED:
+		free(pss->buf);
+		pss->buf = NULL;
+		if (result)
+			interrupted = 1;
+		break;
+
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+static const struct lws_extension extensions[] = {
+	{
+		"permessage-deflate",
+		lws_extension_callback_pm_deflate,
+		"permessage-deflate"
+	},
+	{ NULL, NULL, NULL /* terminator */ }
+};
+
+static const struct lws_protocols protocols_server[] = {
+	{ "http", lws_callback_http_dummy, 0, 0 },
+	{ "echo", callback_echo, sizeof(struct pss), 4096 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static const struct lws_protocols protocols_client[] = {
+	{ "echo", callback_client, sizeof(struct pss), 4096 },
+	{ NULL, NULL, 0, 0 } /* terminator */
+};
+
+static void *
+thread_client(void *d)
+{
+	struct lws_client_connect_info i;
+	int n;
+
+	for (n = 0; n < conns; n++) {
+		memset(&i, 0, sizeof i); /* otherwise uninitialized garbage */
+		i.context = cx_client;
+		i.port = port;
+		i.address = "localhost";
+		i.host = i.address;
+		i.origin = i.address;
+		i.path = "/";
+		i.protocol = protocols_client[0].name;
+
+		if (!lws_client_connect_via_info(&i)) {
+			lwsl_err("%s: connect failed\n", __func__);
+			goto bail;
+		}
+	}
+
+	n = 0;
+	while (n >= 0 && !interrupted)
+		n = lws_service(cx_client, 1000);
+
+bail:
+	interrupted = 1;
+	lws_cancel_service(context);
+
+	return NULL;
+}
+
+void sigint_handler(int sig)
+{
+	interrupted = 1;
+}
+
+int main(int argc, const char **argv)
+{
+	struct lws_context_creation_info info;
+	pthread_t pthread_client;
+	uint64_t peak;
+	const char *p;
+	int n = 0, logs = LLL_USER | LLL_ERR | LLL_WARN | LLL_NOTICE;
+	double t;
+
+	signal(SIGINT, sigint_handler);
+
+	if ((p = lws_cmdline_option(argc, argv, "-d")))
+		logs = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-n")))
+		conns = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-m")))
+		messages = atoi(p);
+
+	if ((p = lws_cmdline_option(argc, argv, "-s")))
+		msg_size = atoi(p);
+
+	pooled = !!lws_cmdline_option(argc, argv, "-p");
+
+	lws_set_log_level(logs, NULL);
+	lwsl_user("LWS minimal ws server pmd pool bench (%s)\n",
+		  pooled ? "no_context_takeover" : "context takeover");
+
+	if (msg_size < 1 || msg_size > 65536 || conns < 1 || messages < 1) {
+		lwsl_err("-s must be 1 - 65536, -n and -m at least 1\n");
+		return 1;
+	}
+
+	msgs = malloc((size_t)(LWS_PRE + msg_size) * (size_t)messages);
+	if (!msgs)
+		return 1;
+	for (n = 0; n < messages; n++) {
+		uint8_t *m = msg(n);
+		int k = 0;
+
+		while (k < msg_size)
+			k += lws_snprintf((char *)m + k, (size_t)(msg_size - k),
+					  "{\"seq\":%d,\"price\":%d,\"qty\":%d}",
+					  n, (n * 7919 + k) % 10007, k % 97);
+		m[msg_size - 1] = '\n';
+	}
+
+	memset(&info, 0, sizeof info); /* otherwise uninitialized garbage */
+	info.port = port;
+	info.protocols = protocols_server;
+	info.extensions = extensions;
+	info.fd_limit_per_thread = (unsigned int)conns + 16;
+
+	context = lws_create_context(&info);
+	if (!context) {
+		lwsl_err("lws init failed\n");
+		goto bail1;
+	}
+
+	memset(&info, 0, sizeof info);
+	info.port = CONTEXT_PORT_NO_LISTEN; /* we do not run any server */
+	info.protocols = protocols_client;
+	info.extensions = extensions;
+	info.fd_limit_per_thread = (unsigned int)conns + 16;
+
+	cx_client = lws_create_context(&info);
+	if (!cx_client) {
+		lwsl_err("lws client init failed\n");
+		goto bail;
+	}
+
+	if (pthread_create(&pthread_client, NULL, thread_client, NULL)) {
+		lwsl_err("thread creation failed\n");
+		goto bail;
+	}
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_start);
+
+	n = 0;
+	while (n >= 0 && !interrupted)
+		n = lws_service(context, 1000);
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_end);
+
+	pthread_join(pthread_client, NULL);
+
+	if (!result) {
+		t = (double)(cpu_end.tv_sec - cpu_start.tv_sec) +
+		    (double)(cpu_end.tv_nsec - cpu_start.tv_nsec) / 1e9;
+		peak = lws_stats_get(context, LWSSTATS_B_PMD_ZLIB_MEM_PEAK);
+		lwsl_user("%d connections x %d %dB messages: server peak zlib "
+			  "memory %lluKiB (%lluB per connection), "
+			  "zlib streams reused %llu, created %llu, "
+			  "server cpu %.3fs\n", conns, messages, msg_size,
+			  (unsigned long long)peak / 1024,
+			  (unsigned long long)peak / (unsigned long long)conns,
+			  (unsigned long long)lws_stats_get(context,
+					LWSSTATS_C_PMD_ZS_POOL_HIT),
+			  (unsigned long long)lws_stats_get(context,
+					LWSSTATS_C_PMD_ZS_POOL_MISS), t);
+	}
+
+bail:
+	if (cx_client)
+		lws_context_destroy(cx_client);
+	lws_context_destroy(context);
+bail1:
+	free(msgs);
+
+	lwsl_user("Completed: %s\n", result ? "FAIL" : "PASS");
+
+	return result;
+}